@@ -0,0 +1,22 @@
+# falseshare: two cores each increment their own word of one 32-byte block 1000 times
+# run with --cores=2; falseshare.json lists the expected L1D coherence counts.
+# The core ID (syscall 11) picks the word; $t2 and $s0 are reset before exit
+# so the final registers match a single-core run (and basesim).
+.text
+    addiu $v0, $zero, 11
+    syscall
+    andi $t2, $v0, 1
+    sll $t2, $t2, 2
+    lui $s0, 0x1000
+    addu $s0, $s0, $t2
+    ori $t1, $zero, 0x3e8
+loop:
+    lw $t0, 0($s0)
+    addiu $t0, $t0, 1
+    sw $t0, 0($s0)
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addu $t2, $zero, $zero
+    lui $s0, 0x1000
+    addiu $v0, $zero, 10
+    syscall
@@ -0,0 +1,16 @@
+2402000b
+0000000c
+304a0001
+000a5080
+3c101000
+020a8021
+340903e8
+8e080000
+25080001
+ae080000
+2529ffff
+1520fffb
+00005021
+3c101000
+2402000a
+0000000c
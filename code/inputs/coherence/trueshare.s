@@ -0,0 +1,15 @@
+# trueshare: two cores both increment the same word 1000 times
+# run with --cores=2; trueshare.json lists the expected L1D coherence counts.
+# The increments are not atomic, so the final memory word is timing dependent;
+# only the registers and the coherence counts are checked.
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x3e8
+loop:
+    lw $t0, 0($s0)
+    addiu $t0, $t0, 1
+    sw $t0, 0($s0)
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
@@ -0,0 +1,9 @@
+3c101000
+340903e8
+8e080000
+25080001
+ae080000
+2529ffff
+1520fffb
+2402000a
+0000000c
@@ -0,0 +1,16392 @@
+# chase256k: pointer chasing over 4x the cache: dependent, mostly missing loads
+# generated by memgen.py chase --count=16384 --footprint=262144 --node=64 --seed=1
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x4000
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3f40
+    lui $t2, 0x1000
+    sw $t0, 0($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2900
+    lui $t2, 0x1000
+    sw $t0, 64($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8380
+    lui $t2, 0x1000
+    sw $t0, 128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa500
+    lui $t2, 0x1000
+    sw $t0, 192($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4b80
+    lui $t2, 0x1000
+    sw $t0, 256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5680
+    lui $t2, 0x1000
+    sw $t0, 320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x68c0
+    lui $t2, 0x1000
+    sw $t0, 384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6280
+    lui $t2, 0x1000
+    sw $t0, 448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8700
+    lui $t2, 0x1000
+    sw $t0, 512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x11c0
+    lui $t2, 0x1000
+    sw $t0, 576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe440
+    lui $t2, 0x1000
+    sw $t0, 640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4b00
+    lui $t2, 0x1000
+    sw $t0, 704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3240
+    lui $t2, 0x1000
+    sw $t0, 768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc000
+    lui $t2, 0x1000
+    sw $t0, 832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2340
+    lui $t2, 0x1000
+    sw $t0, 896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1b00
+    lui $t2, 0x1000
+    sw $t0, 960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3a80
+    lui $t2, 0x1000
+    sw $t0, 1024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3d00
+    lui $t2, 0x1000
+    sw $t0, 1088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9d80
+    lui $t2, 0x1000
+    sw $t0, 1152($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5580
+    lui $t2, 0x1000
+    sw $t0, 1216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c40
+    lui $t2, 0x1000
+    sw $t0, 1280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd280
+    lui $t2, 0x1000
+    sw $t0, 1344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1000
+    lui $t2, 0x1000
+    sw $t0, 1408($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9180
+    lui $t2, 0x1000
+    sw $t0, 1472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xeb00
+    lui $t2, 0x1000
+    sw $t0, 1536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc40
+    lui $t2, 0x1000
+    sw $t0, 1600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5540
+    lui $t2, 0x1000
+    sw $t0, 1664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd580
+    lui $t2, 0x1000
+    sw $t0, 1728($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd5c0
+    lui $t2, 0x1000
+    sw $t0, 1792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9340
+    lui $t2, 0x1000
+    sw $t0, 1856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf40
+    lui $t2, 0x1000
+    sw $t0, 1920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf1c0
+    lui $t2, 0x1000
+    sw $t0, 1984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9080
+    lui $t2, 0x1000
+    sw $t0, 2048($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9640
+    lui $t2, 0x1000
+    sw $t0, 2112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xce40
+    lui $t2, 0x1000
+    sw $t0, 2176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x85c0
+    lui $t2, 0x1000
+    sw $t0, 2240($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcc40
+    lui $t2, 0x1000
+    sw $t0, 2304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2680
+    lui $t2, 0x1000
+    sw $t0, 2368($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2a80
+    lui $t2, 0x1000
+    sw $t0, 2432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaa80
+    lui $t2, 0x1000
+    sw $t0, 2496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8c00
+    lui $t2, 0x1000
+    sw $t0, 2560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf740
+    lui $t2, 0x1000
+    sw $t0, 2624($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6c00
+    lui $t2, 0x1000
+    sw $t0, 2688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6b00
+    lui $t2, 0x1000
+    sw $t0, 2752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c00
+    lui $t2, 0x1000
+    sw $t0, 2816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd040
+    lui $t2, 0x1000
+    sw $t0, 2880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x200
+    lui $t2, 0x1000
+    sw $t0, 2944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1f80
+    lui $t2, 0x1000
+    sw $t0, 3008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xba40
+    lui $t2, 0x1000
+    sw $t0, 3072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9980
+    lui $t2, 0x1000
+    sw $t0, 3136($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x26c0
+    lui $t2, 0x1000
+    sw $t0, 3200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe880
+    lui $t2, 0x1000
+    sw $t0, 3264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf5c0
+    lui $t2, 0x1000
+    sw $t0, 3328($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6ec0
+    lui $t2, 0x1000
+    sw $t0, 3392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdb40
+    lui $t2, 0x1000
+    sw $t0, 3456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfd40
+    lui $t2, 0x1000
+    sw $t0, 3520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdf00
+    lui $t2, 0x1000
+    sw $t0, 3584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4f40
+    lui $t2, 0x1000
+    sw $t0, 3648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaa40
+    lui $t2, 0x1000
+    sw $t0, 3712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x31c0
+    lui $t2, 0x1000
+    sw $t0, 3776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd000
+    lui $t2, 0x1000
+    sw $t0, 3840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfc00
+    lui $t2, 0x1000
+    sw $t0, 3904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9100
+    lui $t2, 0x1000
+    sw $t0, 3968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f40
+    lui $t2, 0x1000
+    sw $t0, 4032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f80
+    lui $t2, 0x1000
+    sw $t0, 4096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2880
+    lui $t2, 0x1000
+    sw $t0, 4160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1480
+    lui $t2, 0x1000
+    sw $t0, 4224($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa40
+    lui $t2, 0x1000
+    sw $t0, 4288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x65c0
+    lui $t2, 0x1000
+    sw $t0, 4352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7900
+    lui $t2, 0x1000
+    sw $t0, 4416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2380
+    lui $t2, 0x1000
+    sw $t0, 4480($t2)
+    lui $t0, 0x1002
+    lui $t2, 0x1000
+    sw $t0, 4544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdfc0
+    lui $t2, 0x1000
+    sw $t0, 4608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4440
+    lui $t2, 0x1000
+    sw $t0, 4672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe700
+    lui $t2, 0x1000
+    sw $t0, 4736($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2040
+    lui $t2, 0x1000
+    sw $t0, 4800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2080
+    lui $t2, 0x1000
+    sw $t0, 4864($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4c0
+    lui $t2, 0x1000
+    sw $t0, 4928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8b40
+    lui $t2, 0x1000
+    sw $t0, 4992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb5c0
+    lui $t2, 0x1000
+    sw $t0, 5056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe1c0
+    lui $t2, 0x1000
+    sw $t0, 5120($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc540
+    lui $t2, 0x1000
+    sw $t0, 5184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2f40
+    lui $t2, 0x1000
+    sw $t0, 5248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x480
+    lui $t2, 0x1000
+    sw $t0, 5312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe180
+    lui $t2, 0x1000
+    sw $t0, 5376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf080
+    lui $t2, 0x1000
+    sw $t0, 5440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x44c0
+    lui $t2, 0x1000
+    sw $t0, 5504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6d00
+    lui $t2, 0x1000
+    sw $t0, 5568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xae00
+    lui $t2, 0x1000
+    sw $t0, 5632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb4c0
+    lui $t2, 0x1000
+    sw $t0, 5696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xba80
+    lui $t2, 0x1000
+    sw $t0, 5760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa6c0
+    lui $t2, 0x1000
+    sw $t0, 5824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f80
+    lui $t2, 0x1000
+    sw $t0, 5888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa740
+    lui $t2, 0x1000
+    sw $t0, 5952($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3240
+    lui $t2, 0x1000
+    sw $t0, 6016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa7c0
+    lui $t2, 0x1000
+    sw $t0, 6080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6400
+    lui $t2, 0x1000
+    sw $t0, 6144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7500
+    lui $t2, 0x1000
+    sw $t0, 6208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe300
+    lui $t2, 0x1000
+    sw $t0, 6272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdec0
+    lui $t2, 0x1000
+    sw $t0, 6336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf180
+    lui $t2, 0x1000
+    sw $t0, 6400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc900
+    lui $t2, 0x1000
+    sw $t0, 6464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa600
+    lui $t2, 0x1000
+    sw $t0, 6528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6240
+    lui $t2, 0x1000
+    sw $t0, 6592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6a40
+    lui $t2, 0x1000
+    sw $t0, 6656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1700
+    lui $t2, 0x1000
+    sw $t0, 6720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5780
+    lui $t2, 0x1000
+    sw $t0, 6784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6040
+    lui $t2, 0x1000
+    sw $t0, 6848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xeac0
+    lui $t2, 0x1000
+    sw $t0, 6912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf380
+    lui $t2, 0x1000
+    sw $t0, 6976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf0c0
+    lui $t2, 0x1000
+    sw $t0, 7040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7c00
+    lui $t2, 0x1000
+    sw $t0, 7104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x28c0
+    lui $t2, 0x1000
+    sw $t0, 7168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa740
+    lui $t2, 0x1000
+    sw $t0, 7232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc2c0
+    lui $t2, 0x1000
+    sw $t0, 7296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6680
+    lui $t2, 0x1000
+    sw $t0, 7360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfcc0
+    lui $t2, 0x1000
+    sw $t0, 7424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf3c0
+    lui $t2, 0x1000
+    sw $t0, 7488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d40
+    lui $t2, 0x1000
+    sw $t0, 7552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe780
+    lui $t2, 0x1000
+    sw $t0, 7616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xac00
+    lui $t2, 0x1000
+    sw $t0, 7680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3240
+    lui $t2, 0x1000
+    sw $t0, 7744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xee80
+    lui $t2, 0x1000
+    sw $t0, 7808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc880
+    lui $t2, 0x1000
+    sw $t0, 7872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2480
+    lui $t2, 0x1000
+    sw $t0, 7936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9c00
+    lui $t2, 0x1000
+    sw $t0, 8000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4540
+    lui $t2, 0x1000
+    sw $t0, 8064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x15c0
+    lui $t2, 0x1000
+    sw $t0, 8128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc400
+    lui $t2, 0x1000
+    sw $t0, 8192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa00
+    lui $t2, 0x1000
+    sw $t0, 8256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6c40
+    lui $t2, 0x1000
+    sw $t0, 8320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe400
+    lui $t2, 0x1000
+    sw $t0, 8384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x41c0
+    lui $t2, 0x1000
+    sw $t0, 8448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x580
+    lui $t2, 0x1000
+    sw $t0, 8512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaa00
+    lui $t2, 0x1000
+    sw $t0, 8576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8e40
+    lui $t2, 0x1000
+    sw $t0, 8640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2040
+    lui $t2, 0x1000
+    sw $t0, 8704($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf600
+    lui $t2, 0x1000
+    sw $t0, 8768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe140
+    lui $t2, 0x1000
+    sw $t0, 8832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfb40
+    lui $t2, 0x1000
+    sw $t0, 8896($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2800
+    lui $t2, 0x1000
+    sw $t0, 8960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3540
+    lui $t2, 0x1000
+    sw $t0, 9024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6a00
+    lui $t2, 0x1000
+    sw $t0, 9088($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbbc0
+    lui $t2, 0x1000
+    sw $t0, 9152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x45c0
+    lui $t2, 0x1000
+    sw $t0, 9216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9600
+    lui $t2, 0x1000
+    sw $t0, 9280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8600
+    lui $t2, 0x1000
+    sw $t0, 9344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa740
+    lui $t2, 0x1000
+    sw $t0, 9408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf6c0
+    lui $t2, 0x1000
+    sw $t0, 9472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4380
+    lui $t2, 0x1000
+    sw $t0, 9536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb1c0
+    lui $t2, 0x1000
+    sw $t0, 9600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4ec0
+    lui $t2, 0x1000
+    sw $t0, 9664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbec0
+    lui $t2, 0x1000
+    sw $t0, 9728($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8080
+    lui $t2, 0x1000
+    sw $t0, 9792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x940
+    lui $t2, 0x1000
+    sw $t0, 9856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1240
+    lui $t2, 0x1000
+    sw $t0, 9920($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6700
+    lui $t2, 0x1000
+    sw $t0, 9984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1600
+    lui $t2, 0x1000
+    sw $t0, 10048($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7d00
+    lui $t2, 0x1000
+    sw $t0, 10112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9ec0
+    lui $t2, 0x1000
+    sw $t0, 10176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1780
+    lui $t2, 0x1000
+    sw $t0, 10240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4880
+    lui $t2, 0x1000
+    sw $t0, 10304($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x80c0
+    lui $t2, 0x1000
+    sw $t0, 10368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf680
+    lui $t2, 0x1000
+    sw $t0, 10432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2900
+    lui $t2, 0x1000
+    sw $t0, 10496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4040
+    lui $t2, 0x1000
+    sw $t0, 10560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe700
+    lui $t2, 0x1000
+    sw $t0, 10624($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xeb80
+    lui $t2, 0x1000
+    sw $t0, 10688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6f00
+    lui $t2, 0x1000
+    sw $t0, 10752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3a40
+    lui $t2, 0x1000
+    sw $t0, 10816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xce00
+    lui $t2, 0x1000
+    sw $t0, 10880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3cc0
+    lui $t2, 0x1000
+    sw $t0, 10944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4ec0
+    lui $t2, 0x1000
+    sw $t0, 11008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 192
+    lui $t2, 0x1000
+    sw $t0, 11072($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc680
+    lui $t2, 0x1000
+    sw $t0, 11136($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6540
+    lui $t2, 0x1000
+    sw $t0, 11200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8440
+    lui $t2, 0x1000
+    sw $t0, 11264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1440
+    lui $t2, 0x1000
+    sw $t0, 11328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3580
+    lui $t2, 0x1000
+    sw $t0, 11392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe0c0
+    lui $t2, 0x1000
+    sw $t0, 11456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b80
+    lui $t2, 0x1000
+    sw $t0, 11520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9b80
+    lui $t2, 0x1000
+    sw $t0, 11584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9f00
+    lui $t2, 0x1000
+    sw $t0, 11648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe980
+    lui $t2, 0x1000
+    sw $t0, 11712($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb680
+    lui $t2, 0x1000
+    sw $t0, 11776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbf40
+    lui $t2, 0x1000
+    sw $t0, 11840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xac0
+    lui $t2, 0x1000
+    sw $t0, 11904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2c0
+    lui $t2, 0x1000
+    sw $t0, 11968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2600
+    lui $t2, 0x1000
+    sw $t0, 12032($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8d40
+    lui $t2, 0x1000
+    sw $t0, 12096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x50c0
+    lui $t2, 0x1000
+    sw $t0, 12160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb3c0
+    lui $t2, 0x1000
+    sw $t0, 12224($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa640
+    lui $t2, 0x1000
+    sw $t0, 12288($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6340
+    lui $t2, 0x1000
+    sw $t0, 12352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8b40
+    lui $t2, 0x1000
+    sw $t0, 12416($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x80c0
+    lui $t2, 0x1000
+    sw $t0, 12480($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb580
+    lui $t2, 0x1000
+    sw $t0, 12544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6100
+    lui $t2, 0x1000
+    sw $t0, 12608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe0c0
+    lui $t2, 0x1000
+    sw $t0, 12672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa1c0
+    lui $t2, 0x1000
+    sw $t0, 12736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8a00
+    lui $t2, 0x1000
+    sw $t0, 12800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd00
+    lui $t2, 0x1000
+    sw $t0, 12864($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2100
+    lui $t2, 0x1000
+    sw $t0, 12928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c00
+    lui $t2, 0x1000
+    sw $t0, 12992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf280
+    lui $t2, 0x1000
+    sw $t0, 13056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2800
+    lui $t2, 0x1000
+    sw $t0, 13120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7ac0
+    lui $t2, 0x1000
+    sw $t0, 13184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x780
+    lui $t2, 0x1000
+    sw $t0, 13248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc980
+    lui $t2, 0x1000
+    sw $t0, 13312($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x72c0
+    lui $t2, 0x1000
+    sw $t0, 13376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xae80
+    lui $t2, 0x1000
+    sw $t0, 13440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3500
+    lui $t2, 0x1000
+    sw $t0, 13504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4fc0
+    lui $t2, 0x1000
+    sw $t0, 13568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3cc0
+    lui $t2, 0x1000
+    sw $t0, 13632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2140
+    lui $t2, 0x1000
+    sw $t0, 13696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xac0
+    lui $t2, 0x1000
+    sw $t0, 13760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5580
+    lui $t2, 0x1000
+    sw $t0, 13824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e00
+    lui $t2, 0x1000
+    sw $t0, 13888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f40
+    lui $t2, 0x1000
+    sw $t0, 13952($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf9c0
+    lui $t2, 0x1000
+    sw $t0, 14016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x600
+    lui $t2, 0x1000
+    sw $t0, 14080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8880
+    lui $t2, 0x1000
+    sw $t0, 14144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9640
+    lui $t2, 0x1000
+    sw $t0, 14208($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc2c0
+    lui $t2, 0x1000
+    sw $t0, 14272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5300
+    lui $t2, 0x1000
+    sw $t0, 14336($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9940
+    lui $t2, 0x1000
+    sw $t0, 14400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd400
+    lui $t2, 0x1000
+    sw $t0, 14464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e40
+    lui $t2, 0x1000
+    sw $t0, 14528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x48c0
+    lui $t2, 0x1000
+    sw $t0, 14592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb900
+    lui $t2, 0x1000
+    sw $t0, 14656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xccc0
+    lui $t2, 0x1000
+    sw $t0, 14720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3cc0
+    lui $t2, 0x1000
+    sw $t0, 14784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3a80
+    lui $t2, 0x1000
+    sw $t0, 14848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1240
+    lui $t2, 0x1000
+    sw $t0, 14912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2bc0
+    lui $t2, 0x1000
+    sw $t0, 14976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf540
+    lui $t2, 0x1000
+    sw $t0, 15040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9d00
+    lui $t2, 0x1000
+    sw $t0, 15104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1a40
+    lui $t2, 0x1000
+    sw $t0, 15168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb500
+    lui $t2, 0x1000
+    sw $t0, 15232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8980
+    lui $t2, 0x1000
+    sw $t0, 15296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6500
+    lui $t2, 0x1000
+    sw $t0, 15360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb4c0
+    lui $t2, 0x1000
+    sw $t0, 15424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8ac0
+    lui $t2, 0x1000
+    sw $t0, 15488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc440
+    lui $t2, 0x1000
+    sw $t0, 15552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbb00
+    lui $t2, 0x1000
+    sw $t0, 15616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f00
+    lui $t2, 0x1000
+    sw $t0, 15680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa880
+    lui $t2, 0x1000
+    sw $t0, 15744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfb80
+    lui $t2, 0x1000
+    sw $t0, 15808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6900
+    lui $t2, 0x1000
+    sw $t0, 15872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb540
+    lui $t2, 0x1000
+    sw $t0, 15936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2600
+    lui $t2, 0x1000
+    sw $t0, 16000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x340
+    lui $t2, 0x1000
+    sw $t0, 16064($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7f40
+    lui $t2, 0x1000
+    sw $t0, 16128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb00
+    lui $t2, 0x1000
+    sw $t0, 16192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5600
+    lui $t2, 0x1000
+    sw $t0, 16256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1700
+    lui $t2, 0x1000
+    sw $t0, 16320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1380
+    lui $t2, 0x1000
+    sw $t0, 16384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8740
+    lui $t2, 0x1000
+    sw $t0, 16448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9840
+    lui $t2, 0x1000
+    sw $t0, 16512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe40
+    lui $t2, 0x1000
+    sw $t0, 16576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2240
+    lui $t2, 0x1000
+    sw $t0, 16640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4040
+    lui $t2, 0x1000
+    sw $t0, 16704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5540
+    lui $t2, 0x1000
+    sw $t0, 16768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4080
+    lui $t2, 0x1000
+    sw $t0, 16832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6600
+    lui $t2, 0x1000
+    sw $t0, 16896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7080
+    lui $t2, 0x1000
+    sw $t0, 16960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4cc0
+    lui $t2, 0x1000
+    sw $t0, 17024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9580
+    lui $t2, 0x1000
+    sw $t0, 17088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf080
+    lui $t2, 0x1000
+    sw $t0, 17152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xafc0
+    lui $t2, 0x1000
+    sw $t0, 17216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3d00
+    lui $t2, 0x1000
+    sw $t0, 17280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6400
+    lui $t2, 0x1000
+    sw $t0, 17344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1e40
+    lui $t2, 0x1000
+    sw $t0, 17408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x880
+    lui $t2, 0x1000
+    sw $t0, 17472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc00
+    lui $t2, 0x1000
+    sw $t0, 17536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6bc0
+    lui $t2, 0x1000
+    sw $t0, 17600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x52c0
+    lui $t2, 0x1000
+    sw $t0, 17664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbc80
+    lui $t2, 0x1000
+    sw $t0, 17728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfec0
+    lui $t2, 0x1000
+    sw $t0, 17792($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3c80
+    lui $t2, 0x1000
+    sw $t0, 17856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe580
+    lui $t2, 0x1000
+    sw $t0, 17920($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd480
+    lui $t2, 0x1000
+    sw $t0, 17984($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4b00
+    lui $t2, 0x1000
+    sw $t0, 18048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7e80
+    lui $t2, 0x1000
+    sw $t0, 18112($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9780
+    lui $t2, 0x1000
+    sw $t0, 18176($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2980
+    lui $t2, 0x1000
+    sw $t0, 18240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb0c0
+    lui $t2, 0x1000
+    sw $t0, 18304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x63c0
+    lui $t2, 0x1000
+    sw $t0, 18368($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa680
+    lui $t2, 0x1000
+    sw $t0, 18432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb180
+    lui $t2, 0x1000
+    sw $t0, 18496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x39c0
+    lui $t2, 0x1000
+    sw $t0, 18560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9040
+    lui $t2, 0x1000
+    sw $t0, 18624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x88c0
+    lui $t2, 0x1000
+    sw $t0, 18688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa540
+    lui $t2, 0x1000
+    sw $t0, 18752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3180
+    lui $t2, 0x1000
+    sw $t0, 18816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6800
+    lui $t2, 0x1000
+    sw $t0, 18880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5700
+    lui $t2, 0x1000
+    sw $t0, 18944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9b80
+    lui $t2, 0x1000
+    sw $t0, 19008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3140
+    lui $t2, 0x1000
+    sw $t0, 19072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5080
+    lui $t2, 0x1000
+    sw $t0, 19136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa080
+    lui $t2, 0x1000
+    sw $t0, 19200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5cc0
+    lui $t2, 0x1000
+    sw $t0, 19264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa800
+    lui $t2, 0x1000
+    sw $t0, 19328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa180
+    lui $t2, 0x1000
+    sw $t0, 19392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd080
+    lui $t2, 0x1000
+    sw $t0, 19456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4140
+    lui $t2, 0x1000
+    sw $t0, 19520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8880
+    lui $t2, 0x1000
+    sw $t0, 19584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4640
+    lui $t2, 0x1000
+    sw $t0, 19648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xeac0
+    lui $t2, 0x1000
+    sw $t0, 19712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x91c0
+    lui $t2, 0x1000
+    sw $t0, 19776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf1c0
+    lui $t2, 0x1000
+    sw $t0, 19840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe840
+    lui $t2, 0x1000
+    sw $t0, 19904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf500
+    lui $t2, 0x1000
+    sw $t0, 19968($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf300
+    lui $t2, 0x1000
+    sw $t0, 20032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6f40
+    lui $t2, 0x1000
+    sw $t0, 20096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3680
+    lui $t2, 0x1000
+    sw $t0, 20160($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5000
+    lui $t2, 0x1000
+    sw $t0, 20224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x63c0
+    lui $t2, 0x1000
+    sw $t0, 20288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd780
+    lui $t2, 0x1000
+    sw $t0, 20352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd900
+    lui $t2, 0x1000
+    sw $t0, 20416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe940
+    lui $t2, 0x1000
+    sw $t0, 20480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x85c0
+    lui $t2, 0x1000
+    sw $t0, 20544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9080
+    lui $t2, 0x1000
+    sw $t0, 20608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdb00
+    lui $t2, 0x1000
+    sw $t0, 20672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7080
+    lui $t2, 0x1000
+    sw $t0, 20736($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xad80
+    lui $t2, 0x1000
+    sw $t0, 20800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8540
+    lui $t2, 0x1000
+    sw $t0, 20864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfd80
+    lui $t2, 0x1000
+    sw $t0, 20928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc140
+    lui $t2, 0x1000
+    sw $t0, 20992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ec0
+    lui $t2, 0x1000
+    sw $t0, 21056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3940
+    lui $t2, 0x1000
+    sw $t0, 21120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc1c0
+    lui $t2, 0x1000
+    sw $t0, 21184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfc00
+    lui $t2, 0x1000
+    sw $t0, 21248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4c0
+    lui $t2, 0x1000
+    sw $t0, 21312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7140
+    lui $t2, 0x1000
+    sw $t0, 21376($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x43c0
+    lui $t2, 0x1000
+    sw $t0, 21440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcd40
+    lui $t2, 0x1000
+    sw $t0, 21504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x10c0
+    lui $t2, 0x1000
+    sw $t0, 21568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaf80
+    lui $t2, 0x1000
+    sw $t0, 21632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe200
+    lui $t2, 0x1000
+    sw $t0, 21696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9700
+    lui $t2, 0x1000
+    sw $t0, 21760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4840
+    lui $t2, 0x1000
+    sw $t0, 21824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x340
+    lui $t2, 0x1000
+    sw $t0, 21888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf2c0
+    lui $t2, 0x1000
+    sw $t0, 21952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x64c0
+    lui $t2, 0x1000
+    sw $t0, 22016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdb00
+    lui $t2, 0x1000
+    sw $t0, 22080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x39c0
+    lui $t2, 0x1000
+    sw $t0, 22144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2980
+    lui $t2, 0x1000
+    sw $t0, 22208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5740
+    lui $t2, 0x1000
+    sw $t0, 22272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6100
+    lui $t2, 0x1000
+    sw $t0, 22336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6080
+    lui $t2, 0x1000
+    sw $t0, 22400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6300
+    lui $t2, 0x1000
+    sw $t0, 22464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa000
+    lui $t2, 0x1000
+    sw $t0, 22528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x49c0
+    lui $t2, 0x1000
+    sw $t0, 22592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8340
+    lui $t2, 0x1000
+    sw $t0, 22656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7fc0
+    lui $t2, 0x1000
+    sw $t0, 22720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe880
+    lui $t2, 0x1000
+    sw $t0, 22784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9480
+    lui $t2, 0x1000
+    sw $t0, 22848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdb80
+    lui $t2, 0x1000
+    sw $t0, 22912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe80
+    lui $t2, 0x1000
+    sw $t0, 22976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc500
+    lui $t2, 0x1000
+    sw $t0, 23040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4b80
+    lui $t2, 0x1000
+    sw $t0, 23104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1080
+    lui $t2, 0x1000
+    sw $t0, 23168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2b00
+    lui $t2, 0x1000
+    sw $t0, 23232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf600
+    lui $t2, 0x1000
+    sw $t0, 23296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7c40
+    lui $t2, 0x1000
+    sw $t0, 23360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc9c0
+    lui $t2, 0x1000
+    sw $t0, 23424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1fc0
+    lui $t2, 0x1000
+    sw $t0, 23488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8c80
+    lui $t2, 0x1000
+    sw $t0, 23552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc840
+    lui $t2, 0x1000
+    sw $t0, 23616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4b80
+    lui $t2, 0x1000
+    sw $t0, 23680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcac0
+    lui $t2, 0x1000
+    sw $t0, 23744($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3080
+    lui $t2, 0x1000
+    sw $t0, 23808($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbb00
+    lui $t2, 0x1000
+    sw $t0, 23872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3e00
+    lui $t2, 0x1000
+    sw $t0, 23936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb380
+    lui $t2, 0x1000
+    sw $t0, 24000($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x71c0
+    lui $t2, 0x1000
+    sw $t0, 24064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f40
+    lui $t2, 0x1000
+    sw $t0, 24128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6280
+    lui $t2, 0x1000
+    sw $t0, 24192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9ec0
+    lui $t2, 0x1000
+    sw $t0, 24256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5480
+    lui $t2, 0x1000
+    sw $t0, 24320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2a40
+    lui $t2, 0x1000
+    sw $t0, 24384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc340
+    lui $t2, 0x1000
+    sw $t0, 24448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5f00
+    lui $t2, 0x1000
+    sw $t0, 24512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4480
+    lui $t2, 0x1000
+    sw $t0, 24576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd700
+    lui $t2, 0x1000
+    sw $t0, 24640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3740
+    lui $t2, 0x1000
+    sw $t0, 24704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5100
+    lui $t2, 0x1000
+    sw $t0, 24768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c00
+    lui $t2, 0x1000
+    sw $t0, 24832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd680
+    lui $t2, 0x1000
+    sw $t0, 24896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6d40
+    lui $t2, 0x1000
+    sw $t0, 24960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb100
+    lui $t2, 0x1000
+    sw $t0, 25024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1100
+    lui $t2, 0x1000
+    sw $t0, 25088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdcc0
+    lui $t2, 0x1000
+    sw $t0, 25152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8f80
+    lui $t2, 0x1000
+    sw $t0, 25216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf380
+    lui $t2, 0x1000
+    sw $t0, 25280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4f40
+    lui $t2, 0x1000
+    sw $t0, 25344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2140
+    lui $t2, 0x1000
+    sw $t0, 25408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2dc0
+    lui $t2, 0x1000
+    sw $t0, 25472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4c40
+    lui $t2, 0x1000
+    sw $t0, 25536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x25c0
+    lui $t2, 0x1000
+    sw $t0, 25600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfa00
+    lui $t2, 0x1000
+    sw $t0, 25664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xec80
+    lui $t2, 0x1000
+    sw $t0, 25728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x88c0
+    lui $t2, 0x1000
+    sw $t0, 25792($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x99c0
+    lui $t2, 0x1000
+    sw $t0, 25856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xce80
+    lui $t2, 0x1000
+    sw $t0, 25920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6380
+    lui $t2, 0x1000
+    sw $t0, 25984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7b40
+    lui $t2, 0x1000
+    sw $t0, 26048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbe00
+    lui $t2, 0x1000
+    sw $t0, 26112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe980
+    lui $t2, 0x1000
+    sw $t0, 26176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x91c0
+    lui $t2, 0x1000
+    sw $t0, 26240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4240
+    lui $t2, 0x1000
+    sw $t0, 26304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6f00
+    lui $t2, 0x1000
+    sw $t0, 26368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3340
+    lui $t2, 0x1000
+    sw $t0, 26432($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5680
+    lui $t2, 0x1000
+    sw $t0, 26496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3f80
+    lui $t2, 0x1000
+    sw $t0, 26560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf7c0
+    lui $t2, 0x1000
+    sw $t0, 26624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9ec0
+    lui $t2, 0x1000
+    sw $t0, 26688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5b40
+    lui $t2, 0x1000
+    sw $t0, 26752($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc800
+    lui $t2, 0x1000
+    sw $t0, 26816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe900
+    lui $t2, 0x1000
+    sw $t0, 26880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6700
+    lui $t2, 0x1000
+    sw $t0, 26944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6180
+    lui $t2, 0x1000
+    sw $t0, 27008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b00
+    lui $t2, 0x1000
+    sw $t0, 27072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x87c0
+    lui $t2, 0x1000
+    sw $t0, 27136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9d00
+    lui $t2, 0x1000
+    sw $t0, 27200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xea40
+    lui $t2, 0x1000
+    sw $t0, 27264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaa80
+    lui $t2, 0x1000
+    sw $t0, 27328($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf840
+    lui $t2, 0x1000
+    sw $t0, 27392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xce80
+    lui $t2, 0x1000
+    sw $t0, 27456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6280
+    lui $t2, 0x1000
+    sw $t0, 27520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc240
+    lui $t2, 0x1000
+    sw $t0, 27584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7840
+    lui $t2, 0x1000
+    sw $t0, 27648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf5c0
+    lui $t2, 0x1000
+    sw $t0, 27712($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xeac0
+    lui $t2, 0x1000
+    sw $t0, 27776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe740
+    lui $t2, 0x1000
+    sw $t0, 27840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4600
+    lui $t2, 0x1000
+    sw $t0, 27904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 64
+    lui $t2, 0x1000
+    sw $t0, 27968($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3900
+    lui $t2, 0x1000
+    sw $t0, 28032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1040
+    lui $t2, 0x1000
+    sw $t0, 28096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9300
+    lui $t2, 0x1000
+    sw $t0, 28160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb80
+    lui $t2, 0x1000
+    sw $t0, 28224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1c00
+    lui $t2, 0x1000
+    sw $t0, 28288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8c0
+    lui $t2, 0x1000
+    sw $t0, 28352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4bc0
+    lui $t2, 0x1000
+    sw $t0, 28416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc140
+    lui $t2, 0x1000
+    sw $t0, 28480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8c0
+    lui $t2, 0x1000
+    sw $t0, 28544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa8c0
+    lui $t2, 0x1000
+    sw $t0, 28608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x81c0
+    lui $t2, 0x1000
+    sw $t0, 28672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1340
+    lui $t2, 0x1000
+    sw $t0, 28736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc980
+    lui $t2, 0x1000
+    sw $t0, 28800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdf00
+    lui $t2, 0x1000
+    sw $t0, 28864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3800
+    lui $t2, 0x1000
+    sw $t0, 28928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb440
+    lui $t2, 0x1000
+    sw $t0, 28992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4780
+    lui $t2, 0x1000
+    sw $t0, 29056($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5300
+    lui $t2, 0x1000
+    sw $t0, 29120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b40
+    lui $t2, 0x1000
+    sw $t0, 29184($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd300
+    lui $t2, 0x1000
+    sw $t0, 29248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc9c0
+    lui $t2, 0x1000
+    sw $t0, 29312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9b40
+    lui $t2, 0x1000
+    sw $t0, 29376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbc40
+    lui $t2, 0x1000
+    sw $t0, 29440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a00
+    lui $t2, 0x1000
+    sw $t0, 29504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x88c0
+    lui $t2, 0x1000
+    sw $t0, 29568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xde40
+    lui $t2, 0x1000
+    sw $t0, 29632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa200
+    lui $t2, 0x1000
+    sw $t0, 29696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8f00
+    lui $t2, 0x1000
+    sw $t0, 29760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcb40
+    lui $t2, 0x1000
+    sw $t0, 29824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5c80
+    lui $t2, 0x1000
+    sw $t0, 29888($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe540
+    lui $t2, 0x1000
+    sw $t0, 29952($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9900
+    lui $t2, 0x1000
+    sw $t0, 30016($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5d40
+    lui $t2, 0x1000
+    sw $t0, 30080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6580
+    lui $t2, 0x1000
+    sw $t0, 30144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcc80
+    lui $t2, 0x1000
+    sw $t0, 30208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbf00
+    lui $t2, 0x1000
+    sw $t0, 30272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa600
+    lui $t2, 0x1000
+    sw $t0, 30336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf680
+    lui $t2, 0x1000
+    sw $t0, 30400($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdd80
+    lui $t2, 0x1000
+    sw $t0, 30464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa280
+    lui $t2, 0x1000
+    sw $t0, 30528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd340
+    lui $t2, 0x1000
+    sw $t0, 30592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xae00
+    lui $t2, 0x1000
+    sw $t0, 30656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8e80
+    lui $t2, 0x1000
+    sw $t0, 30720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x86c0
+    lui $t2, 0x1000
+    sw $t0, 30784($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1840
+    lui $t2, 0x1000
+    sw $t0, 30848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x540
+    lui $t2, 0x1000
+    sw $t0, 30912($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa240
+    lui $t2, 0x1000
+    sw $t0, 30976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5200
+    lui $t2, 0x1000
+    sw $t0, 31040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xadc0
+    lui $t2, 0x1000
+    sw $t0, 31104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2080
+    lui $t2, 0x1000
+    sw $t0, 31168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdc40
+    lui $t2, 0x1000
+    sw $t0, 31232($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xadc0
+    lui $t2, 0x1000
+    sw $t0, 31296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6140
+    lui $t2, 0x1000
+    sw $t0, 31360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3f80
+    lui $t2, 0x1000
+    sw $t0, 31424($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2a00
+    lui $t2, 0x1000
+    sw $t0, 31488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1840
+    lui $t2, 0x1000
+    sw $t0, 31552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9a80
+    lui $t2, 0x1000
+    sw $t0, 31616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8200
+    lui $t2, 0x1000
+    sw $t0, 31680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2fc0
+    lui $t2, 0x1000
+    sw $t0, 31744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9a00
+    lui $t2, 0x1000
+    sw $t0, 31808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8d00
+    lui $t2, 0x1000
+    sw $t0, 31872($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xae40
+    lui $t2, 0x1000
+    sw $t0, 31936($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1700
+    lui $t2, 0x1000
+    sw $t0, 32000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7900
+    lui $t2, 0x1000
+    sw $t0, 32064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xde80
+    lui $t2, 0x1000
+    sw $t0, 32128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8780
+    lui $t2, 0x1000
+    sw $t0, 32192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e40
+    lui $t2, 0x1000
+    sw $t0, 32256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5740
+    lui $t2, 0x1000
+    sw $t0, 32320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf600
+    lui $t2, 0x1000
+    sw $t0, 32384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa0c0
+    lui $t2, 0x1000
+    sw $t0, 32448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x100
+    lui $t2, 0x1000
+    sw $t0, 32512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcf00
+    lui $t2, 0x1000
+    sw $t0, 32576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd880
+    lui $t2, 0x1000
+    sw $t0, 32640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4080
+    lui $t2, 0x1000
+    sw $t0, 32704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2900
+    lui $t2, 0x1001
+    sw $t0, -32768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5080
+    lui $t2, 0x1001
+    sw $t0, -32704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9b00
+    lui $t2, 0x1001
+    sw $t0, -32640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3200
+    lui $t2, 0x1001
+    sw $t0, -32576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6900
+    lui $t2, 0x1001
+    sw $t0, -32512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe4c0
+    lui $t2, 0x1001
+    sw $t0, -32448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2cc0
+    lui $t2, 0x1001
+    sw $t0, -32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2940
+    lui $t2, 0x1001
+    sw $t0, -32320($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3980
+    lui $t2, 0x1001
+    sw $t0, -32256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x78c0
+    lui $t2, 0x1001
+    sw $t0, -32192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1200
+    lui $t2, 0x1001
+    sw $t0, -32128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5240
+    lui $t2, 0x1001
+    sw $t0, -32064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7940
+    lui $t2, 0x1001
+    sw $t0, -32000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe680
+    lui $t2, 0x1001
+    sw $t0, -31936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa840
+    lui $t2, 0x1001
+    sw $t0, -31872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbfc0
+    lui $t2, 0x1001
+    sw $t0, -31808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2700
+    lui $t2, 0x1001
+    sw $t0, -31744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x19c0
+    lui $t2, 0x1001
+    sw $t0, -31680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3cc0
+    lui $t2, 0x1001
+    sw $t0, -31616($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9f00
+    lui $t2, 0x1001
+    sw $t0, -31552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b40
+    lui $t2, 0x1001
+    sw $t0, -31488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x480
+    lui $t2, 0x1001
+    sw $t0, -31424($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8d00
+    lui $t2, 0x1001
+    sw $t0, -31360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x280
+    lui $t2, 0x1001
+    sw $t0, -31296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd440
+    lui $t2, 0x1001
+    sw $t0, -31232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc740
+    lui $t2, 0x1001
+    sw $t0, -31168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa080
+    lui $t2, 0x1001
+    sw $t0, -31104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4840
+    lui $t2, 0x1001
+    sw $t0, -31040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1980
+    lui $t2, 0x1001
+    sw $t0, -30976($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 128
+    lui $t2, 0x1001
+    sw $t0, -30912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf8c0
+    lui $t2, 0x1001
+    sw $t0, -30848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4e40
+    lui $t2, 0x1001
+    sw $t0, -30784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4940
+    lui $t2, 0x1001
+    sw $t0, -30720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x56c0
+    lui $t2, 0x1001
+    sw $t0, -30656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x58c0
+    lui $t2, 0x1001
+    sw $t0, -30592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4080
+    lui $t2, 0x1001
+    sw $t0, -30528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdf80
+    lui $t2, 0x1001
+    sw $t0, -30464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3d80
+    lui $t2, 0x1001
+    sw $t0, -30400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbbc0
+    lui $t2, 0x1001
+    sw $t0, -30336($t2)
+    lui $t0, 0x1000
+    lui $t2, 0x1001
+    sw $t0, -30272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcec0
+    lui $t2, 0x1001
+    sw $t0, -30208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3400
+    lui $t2, 0x1001
+    sw $t0, -30144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2180
+    lui $t2, 0x1001
+    sw $t0, -30080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf4c0
+    lui $t2, 0x1001
+    sw $t0, -30016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9100
+    lui $t2, 0x1001
+    sw $t0, -29952($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd400
+    lui $t2, 0x1001
+    sw $t0, -29888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdb00
+    lui $t2, 0x1001
+    sw $t0, -29824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7dc0
+    lui $t2, 0x1001
+    sw $t0, -29760($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9900
+    lui $t2, 0x1001
+    sw $t0, -29696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xef00
+    lui $t2, 0x1001
+    sw $t0, -29632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1d00
+    lui $t2, 0x1001
+    sw $t0, -29568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5040
+    lui $t2, 0x1001
+    sw $t0, -29504($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xab80
+    lui $t2, 0x1001
+    sw $t0, -29440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9540
+    lui $t2, 0x1001
+    sw $t0, -29376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5280
+    lui $t2, 0x1001
+    sw $t0, -29312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9080
+    lui $t2, 0x1001
+    sw $t0, -29248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8d40
+    lui $t2, 0x1001
+    sw $t0, -29184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa500
+    lui $t2, 0x1001
+    sw $t0, -29120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x55c0
+    lui $t2, 0x1001
+    sw $t0, -29056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4400
+    lui $t2, 0x1001
+    sw $t0, -28992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe7c0
+    lui $t2, 0x1001
+    sw $t0, -28928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xccc0
+    lui $t2, 0x1001
+    sw $t0, -28864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8300
+    lui $t2, 0x1001
+    sw $t0, -28800($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5880
+    lui $t2, 0x1001
+    sw $t0, -28736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1a00
+    lui $t2, 0x1001
+    sw $t0, -28672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb900
+    lui $t2, 0x1001
+    sw $t0, -28608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x94c0
+    lui $t2, 0x1001
+    sw $t0, -28544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfe80
+    lui $t2, 0x1001
+    sw $t0, -28480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9940
+    lui $t2, 0x1001
+    sw $t0, -28416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd3c0
+    lui $t2, 0x1001
+    sw $t0, -28352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c40
+    lui $t2, 0x1001
+    sw $t0, -28288($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8100
+    lui $t2, 0x1001
+    sw $t0, -28224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb300
+    lui $t2, 0x1001
+    sw $t0, -28160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd880
+    lui $t2, 0x1001
+    sw $t0, -28096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcd00
+    lui $t2, 0x1001
+    sw $t0, -28032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5580
+    lui $t2, 0x1001
+    sw $t0, -27968($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xff40
+    lui $t2, 0x1001
+    sw $t0, -27904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e00
+    lui $t2, 0x1001
+    sw $t0, -27840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3100
+    lui $t2, 0x1001
+    sw $t0, -27776($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6440
+    lui $t2, 0x1001
+    sw $t0, -27712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1380
+    lui $t2, 0x1001
+    sw $t0, -27648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6b40
+    lui $t2, 0x1001
+    sw $t0, -27584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf980
+    lui $t2, 0x1001
+    sw $t0, -27520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8cc0
+    lui $t2, 0x1001
+    sw $t0, -27456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa040
+    lui $t2, 0x1001
+    sw $t0, -27392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe180
+    lui $t2, 0x1001
+    sw $t0, -27328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x96c0
+    lui $t2, 0x1001
+    sw $t0, -27264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4ac0
+    lui $t2, 0x1001
+    sw $t0, -27200($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9700
+    lui $t2, 0x1001
+    sw $t0, -27136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2bc0
+    lui $t2, 0x1001
+    sw $t0, -27072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9b00
+    lui $t2, 0x1001
+    sw $t0, -27008($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbc80
+    lui $t2, 0x1001
+    sw $t0, -26944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2740
+    lui $t2, 0x1001
+    sw $t0, -26880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb540
+    lui $t2, 0x1001
+    sw $t0, -26816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb980
+    lui $t2, 0x1001
+    sw $t0, -26752($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4a00
+    lui $t2, 0x1001
+    sw $t0, -26688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x23c0
+    lui $t2, 0x1001
+    sw $t0, -26624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3f40
+    lui $t2, 0x1001
+    sw $t0, -26560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d00
+    lui $t2, 0x1001
+    sw $t0, -26496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c80
+    lui $t2, 0x1001
+    sw $t0, -26432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3740
+    lui $t2, 0x1001
+    sw $t0, -26368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1b00
+    lui $t2, 0x1001
+    sw $t0, -26304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x52c0
+    lui $t2, 0x1001
+    sw $t0, -26240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc840
+    lui $t2, 0x1001
+    sw $t0, -26176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd5c0
+    lui $t2, 0x1001
+    sw $t0, -26112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd700
+    lui $t2, 0x1001
+    sw $t0, -26048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4b00
+    lui $t2, 0x1001
+    sw $t0, -25984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6300
+    lui $t2, 0x1001
+    sw $t0, -25920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3440
+    lui $t2, 0x1001
+    sw $t0, -25856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x70c0
+    lui $t2, 0x1001
+    sw $t0, -25792($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2d40
+    lui $t2, 0x1001
+    sw $t0, -25728($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3700
+    lui $t2, 0x1001
+    sw $t0, -25664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x95c0
+    lui $t2, 0x1001
+    sw $t0, -25600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a80
+    lui $t2, 0x1001
+    sw $t0, -25536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4cc0
+    lui $t2, 0x1001
+    sw $t0, -25472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb7c0
+    lui $t2, 0x1001
+    sw $t0, -25408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5840
+    lui $t2, 0x1001
+    sw $t0, -25344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd40
+    lui $t2, 0x1001
+    sw $t0, -25280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6000
+    lui $t2, 0x1001
+    sw $t0, -25216($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4380
+    lui $t2, 0x1001
+    sw $t0, -25152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7680
+    lui $t2, 0x1001
+    sw $t0, -25088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xad40
+    lui $t2, 0x1001
+    sw $t0, -25024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6840
+    lui $t2, 0x1001
+    sw $t0, -24960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf240
+    lui $t2, 0x1001
+    sw $t0, -24896($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x580
+    lui $t2, 0x1001
+    sw $t0, -24832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2780
+    lui $t2, 0x1001
+    sw $t0, -24768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7ec0
+    lui $t2, 0x1001
+    sw $t0, -24704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb4c0
+    lui $t2, 0x1001
+    sw $t0, -24640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xec00
+    lui $t2, 0x1001
+    sw $t0, -24576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe5c0
+    lui $t2, 0x1001
+    sw $t0, -24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x73c0
+    lui $t2, 0x1001
+    sw $t0, -24448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x12c0
+    lui $t2, 0x1001
+    sw $t0, -24384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2a80
+    lui $t2, 0x1001
+    sw $t0, -24320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f40
+    lui $t2, 0x1001
+    sw $t0, -24256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8580
+    lui $t2, 0x1001
+    sw $t0, -24192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2680
+    lui $t2, 0x1001
+    sw $t0, -24128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb940
+    lui $t2, 0x1001
+    sw $t0, -24064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe340
+    lui $t2, 0x1001
+    sw $t0, -24000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6e80
+    lui $t2, 0x1001
+    sw $t0, -23936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb140
+    lui $t2, 0x1001
+    sw $t0, -23872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf740
+    lui $t2, 0x1001
+    sw $t0, -23808($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5c0
+    lui $t2, 0x1001
+    sw $t0, -23744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xab80
+    lui $t2, 0x1001
+    sw $t0, -23680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2b80
+    lui $t2, 0x1001
+    sw $t0, -23616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x99c0
+    lui $t2, 0x1001
+    sw $t0, -23552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe040
+    lui $t2, 0x1001
+    sw $t0, -23488($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1680
+    lui $t2, 0x1001
+    sw $t0, -23424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xba80
+    lui $t2, 0x1001
+    sw $t0, -23360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2540
+    lui $t2, 0x1001
+    sw $t0, -23296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5880
+    lui $t2, 0x1001
+    sw $t0, -23232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7e40
+    lui $t2, 0x1001
+    sw $t0, -23168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd780
+    lui $t2, 0x1001
+    sw $t0, -23104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xba40
+    lui $t2, 0x1001
+    sw $t0, -23040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8a40
+    lui $t2, 0x1001
+    sw $t0, -22976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1b40
+    lui $t2, 0x1001
+    sw $t0, -22912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb9c0
+    lui $t2, 0x1001
+    sw $t0, -22848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3340
+    lui $t2, 0x1001
+    sw $t0, -22784($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x200
+    lui $t2, 0x1001
+    sw $t0, -22720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf780
+    lui $t2, 0x1001
+    sw $t0, -22656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1d40
+    lui $t2, 0x1001
+    sw $t0, -22592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1340
+    lui $t2, 0x1001
+    sw $t0, -22528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1440
+    lui $t2, 0x1001
+    sw $t0, -22464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a00
+    lui $t2, 0x1001
+    sw $t0, -22400($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb640
+    lui $t2, 0x1001
+    sw $t0, -22336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf80
+    lui $t2, 0x1001
+    sw $t0, -22272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7cc0
+    lui $t2, 0x1001
+    sw $t0, -22208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1dc0
+    lui $t2, 0x1001
+    sw $t0, -22144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xee00
+    lui $t2, 0x1001
+    sw $t0, -22080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1600
+    lui $t2, 0x1001
+    sw $t0, -22016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6f40
+    lui $t2, 0x1001
+    sw $t0, -21952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbe40
+    lui $t2, 0x1001
+    sw $t0, -21888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xae00
+    lui $t2, 0x1001
+    sw $t0, -21824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7bc0
+    lui $t2, 0x1001
+    sw $t0, -21760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x280
+    lui $t2, 0x1001
+    sw $t0, -21696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4740
+    lui $t2, 0x1001
+    sw $t0, -21632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xba40
+    lui $t2, 0x1001
+    sw $t0, -21568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7c0
+    lui $t2, 0x1001
+    sw $t0, -21504($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1c40
+    lui $t2, 0x1001
+    sw $t0, -21440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaa40
+    lui $t2, 0x1001
+    sw $t0, -21376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xae80
+    lui $t2, 0x1001
+    sw $t0, -21312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9240
+    lui $t2, 0x1001
+    sw $t0, -21248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa640
+    lui $t2, 0x1001
+    sw $t0, -21184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xebc0
+    lui $t2, 0x1001
+    sw $t0, -21120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x98c0
+    lui $t2, 0x1001
+    sw $t0, -21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8840
+    lui $t2, 0x1001
+    sw $t0, -20992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x51c0
+    lui $t2, 0x1001
+    sw $t0, -20928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x96c0
+    lui $t2, 0x1001
+    sw $t0, -20864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x30c0
+    lui $t2, 0x1001
+    sw $t0, -20800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb880
+    lui $t2, 0x1001
+    sw $t0, -20736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x51c0
+    lui $t2, 0x1001
+    sw $t0, -20672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3440
+    lui $t2, 0x1001
+    sw $t0, -20608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd800
+    lui $t2, 0x1001
+    sw $t0, -20544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x92c0
+    lui $t2, 0x1001
+    sw $t0, -20480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9e80
+    lui $t2, 0x1001
+    sw $t0, -20416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9ac0
+    lui $t2, 0x1001
+    sw $t0, -20352($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb600
+    lui $t2, 0x1001
+    sw $t0, -20288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc580
+    lui $t2, 0x1001
+    sw $t0, -20224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa8c0
+    lui $t2, 0x1001
+    sw $t0, -20160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa940
+    lui $t2, 0x1001
+    sw $t0, -20096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x92c0
+    lui $t2, 0x1001
+    sw $t0, -20032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c80
+    lui $t2, 0x1001
+    sw $t0, -19968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3a40
+    lui $t2, 0x1001
+    sw $t0, -19904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd240
+    lui $t2, 0x1001
+    sw $t0, -19840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4200
+    lui $t2, 0x1001
+    sw $t0, -19776($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1140
+    lui $t2, 0x1001
+    sw $t0, -19712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xda00
+    lui $t2, 0x1001
+    sw $t0, -19648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5cc0
+    lui $t2, 0x1001
+    sw $t0, -19584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf940
+    lui $t2, 0x1001
+    sw $t0, -19520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa500
+    lui $t2, 0x1001
+    sw $t0, -19456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbac0
+    lui $t2, 0x1001
+    sw $t0, -19392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5ac0
+    lui $t2, 0x1001
+    sw $t0, -19328($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8280
+    lui $t2, 0x1001
+    sw $t0, -19264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x19c0
+    lui $t2, 0x1001
+    sw $t0, -19200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d80
+    lui $t2, 0x1001
+    sw $t0, -19136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8ac0
+    lui $t2, 0x1001
+    sw $t0, -19072($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdac0
+    lui $t2, 0x1001
+    sw $t0, -19008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c0
+    lui $t2, 0x1001
+    sw $t0, -18944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb240
+    lui $t2, 0x1001
+    sw $t0, -18880($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd600
+    lui $t2, 0x1001
+    sw $t0, -18816($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2300
+    lui $t2, 0x1001
+    sw $t0, -18752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb340
+    lui $t2, 0x1001
+    sw $t0, -18688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4180
+    lui $t2, 0x1001
+    sw $t0, -18624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1d80
+    lui $t2, 0x1001
+    sw $t0, -18560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xecc0
+    lui $t2, 0x1001
+    sw $t0, -18496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb180
+    lui $t2, 0x1001
+    sw $t0, -18432($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7300
+    lui $t2, 0x1001
+    sw $t0, -18368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa4c0
+    lui $t2, 0x1001
+    sw $t0, -18304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe9c0
+    lui $t2, 0x1001
+    sw $t0, -18240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8d40
+    lui $t2, 0x1001
+    sw $t0, -18176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5680
+    lui $t2, 0x1001
+    sw $t0, -18112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6840
+    lui $t2, 0x1001
+    sw $t0, -18048($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6c80
+    lui $t2, 0x1001
+    sw $t0, -17984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe380
+    lui $t2, 0x1001
+    sw $t0, -17920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf2c0
+    lui $t2, 0x1001
+    sw $t0, -17856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1180
+    lui $t2, 0x1001
+    sw $t0, -17792($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xce40
+    lui $t2, 0x1001
+    sw $t0, -17728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9900
+    lui $t2, 0x1001
+    sw $t0, -17664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8c0
+    lui $t2, 0x1001
+    sw $t0, -17600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c80
+    lui $t2, 0x1001
+    sw $t0, -17536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x980
+    lui $t2, 0x1001
+    sw $t0, -17472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9b80
+    lui $t2, 0x1001
+    sw $t0, -17408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9a00
+    lui $t2, 0x1001
+    sw $t0, -17344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x200
+    lui $t2, 0x1001
+    sw $t0, -17280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5c00
+    lui $t2, 0x1001
+    sw $t0, -17216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7880
+    lui $t2, 0x1001
+    sw $t0, -17152($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8000
+    lui $t2, 0x1001
+    sw $t0, -17088($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3c00
+    lui $t2, 0x1001
+    sw $t0, -17024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb9c0
+    lui $t2, 0x1001
+    sw $t0, -16960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1c00
+    lui $t2, 0x1001
+    sw $t0, -16896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd080
+    lui $t2, 0x1001
+    sw $t0, -16832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6680
+    lui $t2, 0x1001
+    sw $t0, -16768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x140
+    lui $t2, 0x1001
+    sw $t0, -16704($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5180
+    lui $t2, 0x1001
+    sw $t0, -16640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xec80
+    lui $t2, 0x1001
+    sw $t0, -16576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4f40
+    lui $t2, 0x1001
+    sw $t0, -16512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1d00
+    lui $t2, 0x1001
+    sw $t0, -16448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x98c0
+    lui $t2, 0x1001
+    sw $t0, -16384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xacc0
+    lui $t2, 0x1001
+    sw $t0, -16320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2900
+    lui $t2, 0x1001
+    sw $t0, -16256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2f80
+    lui $t2, 0x1001
+    sw $t0, -16192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8800
+    lui $t2, 0x1001
+    sw $t0, -16128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9f40
+    lui $t2, 0x1001
+    sw $t0, -16064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2dc0
+    lui $t2, 0x1001
+    sw $t0, -16000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9680
+    lui $t2, 0x1001
+    sw $t0, -15936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1a80
+    lui $t2, 0x1001
+    sw $t0, -15872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1780
+    lui $t2, 0x1001
+    sw $t0, -15808($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xae80
+    lui $t2, 0x1001
+    sw $t0, -15744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d40
+    lui $t2, 0x1001
+    sw $t0, -15680($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1040
+    lui $t2, 0x1001
+    sw $t0, -15616($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa9c0
+    lui $t2, 0x1001
+    sw $t0, -15552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xea80
+    lui $t2, 0x1001
+    sw $t0, -15488($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbd80
+    lui $t2, 0x1001
+    sw $t0, -15424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xca00
+    lui $t2, 0x1001
+    sw $t0, -15360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9440
+    lui $t2, 0x1001
+    sw $t0, -15296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbc0
+    lui $t2, 0x1001
+    sw $t0, -15232($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4c00
+    lui $t2, 0x1001
+    sw $t0, -15168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xddc0
+    lui $t2, 0x1001
+    sw $t0, -15104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5f80
+    lui $t2, 0x1001
+    sw $t0, -15040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8900
+    lui $t2, 0x1001
+    sw $t0, -14976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x700
+    lui $t2, 0x1001
+    sw $t0, -14912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1fc0
+    lui $t2, 0x1001
+    sw $t0, -14848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2240
+    lui $t2, 0x1001
+    sw $t0, -14784($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7bc0
+    lui $t2, 0x1001
+    sw $t0, -14720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7780
+    lui $t2, 0x1001
+    sw $t0, -14656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5dc0
+    lui $t2, 0x1001
+    sw $t0, -14592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3300
+    lui $t2, 0x1001
+    sw $t0, -14528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7b40
+    lui $t2, 0x1001
+    sw $t0, -14464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcc00
+    lui $t2, 0x1001
+    sw $t0, -14400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x680
+    lui $t2, 0x1001
+    sw $t0, -14336($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x480
+    lui $t2, 0x1001
+    sw $t0, -14272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xde00
+    lui $t2, 0x1001
+    sw $t0, -14208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2640
+    lui $t2, 0x1001
+    sw $t0, -14144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xed40
+    lui $t2, 0x1001
+    sw $t0, -14080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe780
+    lui $t2, 0x1001
+    sw $t0, -14016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5780
+    lui $t2, 0x1001
+    sw $t0, -13952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd300
+    lui $t2, 0x1001
+    sw $t0, -13888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa240
+    lui $t2, 0x1001
+    sw $t0, -13824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1fc0
+    lui $t2, 0x1001
+    sw $t0, -13760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3500
+    lui $t2, 0x1001
+    sw $t0, -13696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6280
+    lui $t2, 0x1001
+    sw $t0, -13632($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9cc0
+    lui $t2, 0x1001
+    sw $t0, -13568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcd00
+    lui $t2, 0x1001
+    sw $t0, -13504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x41c0
+    lui $t2, 0x1001
+    sw $t0, -13440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb40
+    lui $t2, 0x1001
+    sw $t0, -13376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3ac0
+    lui $t2, 0x1001
+    sw $t0, -13312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9600
+    lui $t2, 0x1001
+    sw $t0, -13248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1540
+    lui $t2, 0x1001
+    sw $t0, -13184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x37c0
+    lui $t2, 0x1001
+    sw $t0, -13120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa100
+    lui $t2, 0x1001
+    sw $t0, -13056($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8340
+    lui $t2, 0x1001
+    sw $t0, -12992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2b80
+    lui $t2, 0x1001
+    sw $t0, -12928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa0c0
+    lui $t2, 0x1001
+    sw $t0, -12864($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8f40
+    lui $t2, 0x1001
+    sw $t0, -12800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa140
+    lui $t2, 0x1001
+    sw $t0, -12736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xeb00
+    lui $t2, 0x1001
+    sw $t0, -12672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7a00
+    lui $t2, 0x1001
+    sw $t0, -12608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x57c0
+    lui $t2, 0x1001
+    sw $t0, -12544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x30c0
+    lui $t2, 0x1001
+    sw $t0, -12480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x24c0
+    lui $t2, 0x1001
+    sw $t0, -12416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f40
+    lui $t2, 0x1001
+    sw $t0, -12352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbd00
+    lui $t2, 0x1001
+    sw $t0, -12288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaec0
+    lui $t2, 0x1001
+    sw $t0, -12224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa780
+    lui $t2, 0x1001
+    sw $t0, -12160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2b80
+    lui $t2, 0x1001
+    sw $t0, -12096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3780
+    lui $t2, 0x1001
+    sw $t0, -12032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6dc0
+    lui $t2, 0x1001
+    sw $t0, -11968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc700
+    lui $t2, 0x1001
+    sw $t0, -11904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8880
+    lui $t2, 0x1001
+    sw $t0, -11840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x74c0
+    lui $t2, 0x1001
+    sw $t0, -11776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4d40
+    lui $t2, 0x1001
+    sw $t0, -11712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3f00
+    lui $t2, 0x1001
+    sw $t0, -11648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6580
+    lui $t2, 0x1001
+    sw $t0, -11584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1ac0
+    lui $t2, 0x1001
+    sw $t0, -11520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdf80
+    lui $t2, 0x1001
+    sw $t0, -11456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xeec0
+    lui $t2, 0x1001
+    sw $t0, -11392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8180
+    lui $t2, 0x1001
+    sw $t0, -11328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8900
+    lui $t2, 0x1001
+    sw $t0, -11264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcfc0
+    lui $t2, 0x1001
+    sw $t0, -11200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe300
+    lui $t2, 0x1001
+    sw $t0, -11136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x66c0
+    lui $t2, 0x1001
+    sw $t0, -11072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2ac0
+    lui $t2, 0x1001
+    sw $t0, -11008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x77c0
+    lui $t2, 0x1001
+    sw $t0, -10944($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x93c0
+    lui $t2, 0x1001
+    sw $t0, -10880($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5240
+    lui $t2, 0x1001
+    sw $t0, -10816($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x13c0
+    lui $t2, 0x1001
+    sw $t0, -10752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa80
+    lui $t2, 0x1001
+    sw $t0, -10688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e00
+    lui $t2, 0x1001
+    sw $t0, -10624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdcc0
+    lui $t2, 0x1001
+    sw $t0, -10560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x27c0
+    lui $t2, 0x1001
+    sw $t0, -10496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4b40
+    lui $t2, 0x1001
+    sw $t0, -10432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3e40
+    lui $t2, 0x1001
+    sw $t0, -10368($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5500
+    lui $t2, 0x1001
+    sw $t0, -10304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6580
+    lui $t2, 0x1001
+    sw $t0, -10240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4bc0
+    lui $t2, 0x1001
+    sw $t0, -10176($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe00
+    lui $t2, 0x1001
+    sw $t0, -10112($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3000
+    lui $t2, 0x1001
+    sw $t0, -10048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8f00
+    lui $t2, 0x1001
+    sw $t0, -9984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x80c0
+    lui $t2, 0x1001
+    sw $t0, -9920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3c80
+    lui $t2, 0x1001
+    sw $t0, -9856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x34c0
+    lui $t2, 0x1001
+    sw $t0, -9792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d00
+    lui $t2, 0x1001
+    sw $t0, -9728($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb7c0
+    lui $t2, 0x1001
+    sw $t0, -9664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9c80
+    lui $t2, 0x1001
+    sw $t0, -9600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7a40
+    lui $t2, 0x1001
+    sw $t0, -9536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x71c0
+    lui $t2, 0x1001
+    sw $t0, -9472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8540
+    lui $t2, 0x1001
+    sw $t0, -9408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3100
+    lui $t2, 0x1001
+    sw $t0, -9344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x68c0
+    lui $t2, 0x1001
+    sw $t0, -9280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb3c0
+    lui $t2, 0x1001
+    sw $t0, -9216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf300
+    lui $t2, 0x1001
+    sw $t0, -9152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 64
+    lui $t2, 0x1001
+    sw $t0, -9088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5600
+    lui $t2, 0x1001
+    sw $t0, -9024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7380
+    lui $t2, 0x1001
+    sw $t0, -8960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4500
+    lui $t2, 0x1001
+    sw $t0, -8896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9180
+    lui $t2, 0x1001
+    sw $t0, -8832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb6c0
+    lui $t2, 0x1001
+    sw $t0, -8768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbf00
+    lui $t2, 0x1001
+    sw $t0, -8704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd380
+    lui $t2, 0x1001
+    sw $t0, -8640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9c40
+    lui $t2, 0x1001
+    sw $t0, -8576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ac0
+    lui $t2, 0x1001
+    sw $t0, -8512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4740
+    lui $t2, 0x1001
+    sw $t0, -8448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8b00
+    lui $t2, 0x1001
+    sw $t0, -8384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6540
+    lui $t2, 0x1001
+    sw $t0, -8320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3300
+    lui $t2, 0x1001
+    sw $t0, -8256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe980
+    lui $t2, 0x1001
+    sw $t0, -8192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb540
+    lui $t2, 0x1001
+    sw $t0, -8128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc9c0
+    lui $t2, 0x1001
+    sw $t0, -8064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5540
+    lui $t2, 0x1001
+    sw $t0, -8000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdd40
+    lui $t2, 0x1001
+    sw $t0, -7936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x22c0
+    lui $t2, 0x1001
+    sw $t0, -7872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfb00
+    lui $t2, 0x1001
+    sw $t0, -7808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1940
+    lui $t2, 0x1001
+    sw $t0, -7744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5440
+    lui $t2, 0x1001
+    sw $t0, -7680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d40
+    lui $t2, 0x1001
+    sw $t0, -7616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc800
+    lui $t2, 0x1001
+    sw $t0, -7552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2dc0
+    lui $t2, 0x1001
+    sw $t0, -7488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc140
+    lui $t2, 0x1001
+    sw $t0, -7424($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1c80
+    lui $t2, 0x1001
+    sw $t0, -7360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x61c0
+    lui $t2, 0x1001
+    sw $t0, -7296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdd40
+    lui $t2, 0x1001
+    sw $t0, -7232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe5c0
+    lui $t2, 0x1001
+    sw $t0, -7168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x75c0
+    lui $t2, 0x1001
+    sw $t0, -7104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc880
+    lui $t2, 0x1001
+    sw $t0, -7040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcdc0
+    lui $t2, 0x1001
+    sw $t0, -6976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x47c0
+    lui $t2, 0x1001
+    sw $t0, -6912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3380
+    lui $t2, 0x1001
+    sw $t0, -6848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd980
+    lui $t2, 0x1001
+    sw $t0, -6784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc180
+    lui $t2, 0x1001
+    sw $t0, -6720($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9700
+    lui $t2, 0x1001
+    sw $t0, -6656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb500
+    lui $t2, 0x1001
+    sw $t0, -6592($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xea80
+    lui $t2, 0x1001
+    sw $t0, -6528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb6c0
+    lui $t2, 0x1001
+    sw $t0, -6464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1580
+    lui $t2, 0x1001
+    sw $t0, -6400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xed00
+    lui $t2, 0x1001
+    sw $t0, -6336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9680
+    lui $t2, 0x1001
+    sw $t0, -6272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7f40
+    lui $t2, 0x1001
+    sw $t0, -6208($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcf00
+    lui $t2, 0x1001
+    sw $t0, -6144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfe40
+    lui $t2, 0x1001
+    sw $t0, -6080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x280
+    lui $t2, 0x1001
+    sw $t0, -6016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb700
+    lui $t2, 0x1001
+    sw $t0, -5952($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9c40
+    lui $t2, 0x1001
+    sw $t0, -5888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d00
+    lui $t2, 0x1001
+    sw $t0, -5824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1040
+    lui $t2, 0x1001
+    sw $t0, -5760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xeb00
+    lui $t2, 0x1001
+    sw $t0, -5696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9640
+    lui $t2, 0x1001
+    sw $t0, -5632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6740
+    lui $t2, 0x1001
+    sw $t0, -5568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3540
+    lui $t2, 0x1001
+    sw $t0, -5504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x63c0
+    lui $t2, 0x1001
+    sw $t0, -5440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ec0
+    lui $t2, 0x1001
+    sw $t0, -5376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3800
+    lui $t2, 0x1001
+    sw $t0, -5312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5080
+    lui $t2, 0x1001
+    sw $t0, -5248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7e00
+    lui $t2, 0x1001
+    sw $t0, -5184($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc6c0
+    lui $t2, 0x1001
+    sw $t0, -5120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3900
+    lui $t2, 0x1001
+    sw $t0, -5056($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6200
+    lui $t2, 0x1001
+    sw $t0, -4992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8440
+    lui $t2, 0x1001
+    sw $t0, -4928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xda80
+    lui $t2, 0x1001
+    sw $t0, -4864($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4700
+    lui $t2, 0x1001
+    sw $t0, -4800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6800
+    lui $t2, 0x1001
+    sw $t0, -4736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3180
+    lui $t2, 0x1001
+    sw $t0, -4672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc300
+    lui $t2, 0x1001
+    sw $t0, -4608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6f40
+    lui $t2, 0x1001
+    sw $t0, -4544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xca00
+    lui $t2, 0x1001
+    sw $t0, -4480($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3640
+    lui $t2, 0x1001
+    sw $t0, -4416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfd80
+    lui $t2, 0x1001
+    sw $t0, -4352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b80
+    lui $t2, 0x1001
+    sw $t0, -4288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa580
+    lui $t2, 0x1001
+    sw $t0, -4224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe480
+    lui $t2, 0x1001
+    sw $t0, -4160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd0c0
+    lui $t2, 0x1001
+    sw $t0, -4096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8a80
+    lui $t2, 0x1001
+    sw $t0, -4032($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2180
+    lui $t2, 0x1001
+    sw $t0, -3968($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1300
+    lui $t2, 0x1001
+    sw $t0, -3904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2a40
+    lui $t2, 0x1001
+    sw $t0, -3840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9880
+    lui $t2, 0x1001
+    sw $t0, -3776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xed80
+    lui $t2, 0x1001
+    sw $t0, -3712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdb80
+    lui $t2, 0x1001
+    sw $t0, -3648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1b80
+    lui $t2, 0x1001
+    sw $t0, -3584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8100
+    lui $t2, 0x1001
+    sw $t0, -3520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd7c0
+    lui $t2, 0x1001
+    sw $t0, -3456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7080
+    lui $t2, 0x1001
+    sw $t0, -3392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7d80
+    lui $t2, 0x1001
+    sw $t0, -3328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7940
+    lui $t2, 0x1001
+    sw $t0, -3264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb680
+    lui $t2, 0x1001
+    sw $t0, -3200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd480
+    lui $t2, 0x1001
+    sw $t0, -3136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc3c0
+    lui $t2, 0x1001
+    sw $t0, -3072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe740
+    lui $t2, 0x1001
+    sw $t0, -3008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbe80
+    lui $t2, 0x1001
+    sw $t0, -2944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb300
+    lui $t2, 0x1001
+    sw $t0, -2880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xec00
+    lui $t2, 0x1001
+    sw $t0, -2816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7f80
+    lui $t2, 0x1001
+    sw $t0, -2752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc080
+    lui $t2, 0x1001
+    sw $t0, -2688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfb40
+    lui $t2, 0x1001
+    sw $t0, -2624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x71c0
+    lui $t2, 0x1001
+    sw $t0, -2560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7380
+    lui $t2, 0x1001
+    sw $t0, -2496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9a80
+    lui $t2, 0x1001
+    sw $t0, -2432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc100
+    lui $t2, 0x1001
+    sw $t0, -2368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc7c0
+    lui $t2, 0x1001
+    sw $t0, -2304($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb940
+    lui $t2, 0x1001
+    sw $t0, -2240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe200
+    lui $t2, 0x1001
+    sw $t0, -2176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1f40
+    lui $t2, 0x1001
+    sw $t0, -2112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7d00
+    lui $t2, 0x1001
+    sw $t0, -2048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb7c0
+    lui $t2, 0x1001
+    sw $t0, -1984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2600
+    lui $t2, 0x1001
+    sw $t0, -1920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xec00
+    lui $t2, 0x1001
+    sw $t0, -1856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5a40
+    lui $t2, 0x1001
+    sw $t0, -1792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8600
+    lui $t2, 0x1001
+    sw $t0, -1728($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5880
+    lui $t2, 0x1001
+    sw $t0, -1664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3bc0
+    lui $t2, 0x1001
+    sw $t0, -1600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5980
+    lui $t2, 0x1001
+    sw $t0, -1536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd3c0
+    lui $t2, 0x1001
+    sw $t0, -1472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa440
+    lui $t2, 0x1001
+    sw $t0, -1408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x700
+    lui $t2, 0x1001
+    sw $t0, -1344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e80
+    lui $t2, 0x1001
+    sw $t0, -1280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe580
+    lui $t2, 0x1001
+    sw $t0, -1216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf900
+    lui $t2, 0x1001
+    sw $t0, -1152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3640
+    lui $t2, 0x1001
+    sw $t0, -1088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8080
+    lui $t2, 0x1001
+    sw $t0, -1024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6e00
+    lui $t2, 0x1001
+    sw $t0, -960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcc00
+    lui $t2, 0x1001
+    sw $t0, -896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2840
+    lui $t2, 0x1001
+    sw $t0, -832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1640
+    lui $t2, 0x1001
+    sw $t0, -768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xac00
+    lui $t2, 0x1001
+    sw $t0, -704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe800
+    lui $t2, 0x1001
+    sw $t0, -640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfbc0
+    lui $t2, 0x1001
+    sw $t0, -576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x61c0
+    lui $t2, 0x1001
+    sw $t0, -512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1c80
+    lui $t2, 0x1001
+    sw $t0, -448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb780
+    lui $t2, 0x1001
+    sw $t0, -384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5c40
+    lui $t2, 0x1001
+    sw $t0, -320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb740
+    lui $t2, 0x1001
+    sw $t0, -256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x72c0
+    lui $t2, 0x1001
+    sw $t0, -192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2d40
+    lui $t2, 0x1001
+    sw $t0, -128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2000
+    lui $t2, 0x1001
+    sw $t0, -64($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbc00
+    lui $t2, 0x1001
+    sw $t0, 0($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7240
+    lui $t2, 0x1001
+    sw $t0, 64($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1480
+    lui $t2, 0x1001
+    sw $t0, 128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9fc0
+    lui $t2, 0x1001
+    sw $t0, 192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7c0
+    lui $t2, 0x1001
+    sw $t0, 256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8940
+    lui $t2, 0x1001
+    sw $t0, 320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3880
+    lui $t2, 0x1001
+    sw $t0, 384($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6a80
+    lui $t2, 0x1001
+    sw $t0, 448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4d80
+    lui $t2, 0x1001
+    sw $t0, 512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8040
+    lui $t2, 0x1001
+    sw $t0, 576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4280
+    lui $t2, 0x1001
+    sw $t0, 640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfd40
+    lui $t2, 0x1001
+    sw $t0, 704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa700
+    lui $t2, 0x1001
+    sw $t0, 768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2c80
+    lui $t2, 0x1001
+    sw $t0, 832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8b00
+    lui $t2, 0x1001
+    sw $t0, 896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f80
+    lui $t2, 0x1001
+    sw $t0, 960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa200
+    lui $t2, 0x1001
+    sw $t0, 1024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6980
+    lui $t2, 0x1001
+    sw $t0, 1088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfc80
+    lui $t2, 0x1001
+    sw $t0, 1152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5ec0
+    lui $t2, 0x1001
+    sw $t0, 1216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8a40
+    lui $t2, 0x1001
+    sw $t0, 1280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x40c0
+    lui $t2, 0x1001
+    sw $t0, 1344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb980
+    lui $t2, 0x1001
+    sw $t0, 1408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8d00
+    lui $t2, 0x1001
+    sw $t0, 1472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbcc0
+    lui $t2, 0x1001
+    sw $t0, 1536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9800
+    lui $t2, 0x1001
+    sw $t0, 1600($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1980
+    lui $t2, 0x1001
+    sw $t0, 1664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf840
+    lui $t2, 0x1001
+    sw $t0, 1728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaf40
+    lui $t2, 0x1001
+    sw $t0, 1792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x69c0
+    lui $t2, 0x1001
+    sw $t0, 1856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6740
+    lui $t2, 0x1001
+    sw $t0, 1920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf6c0
+    lui $t2, 0x1001
+    sw $t0, 1984($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1540
+    lui $t2, 0x1001
+    sw $t0, 2048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa700
+    lui $t2, 0x1001
+    sw $t0, 2112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb840
+    lui $t2, 0x1001
+    sw $t0, 2176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc0c0
+    lui $t2, 0x1001
+    sw $t0, 2240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe3c0
+    lui $t2, 0x1001
+    sw $t0, 2304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x46c0
+    lui $t2, 0x1001
+    sw $t0, 2368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6c80
+    lui $t2, 0x1001
+    sw $t0, 2432($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd940
+    lui $t2, 0x1001
+    sw $t0, 2496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xef40
+    lui $t2, 0x1001
+    sw $t0, 2560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6a40
+    lui $t2, 0x1001
+    sw $t0, 2624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb040
+    lui $t2, 0x1001
+    sw $t0, 2688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf840
+    lui $t2, 0x1001
+    sw $t0, 2752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7a80
+    lui $t2, 0x1001
+    sw $t0, 2816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbac0
+    lui $t2, 0x1001
+    sw $t0, 2880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3bc0
+    lui $t2, 0x1001
+    sw $t0, 2944($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8680
+    lui $t2, 0x1001
+    sw $t0, 3008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd140
+    lui $t2, 0x1001
+    sw $t0, 3072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1f00
+    lui $t2, 0x1001
+    sw $t0, 3136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6d00
+    lui $t2, 0x1001
+    sw $t0, 3200($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa3c0
+    lui $t2, 0x1001
+    sw $t0, 3264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5a80
+    lui $t2, 0x1001
+    sw $t0, 3328($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbf00
+    lui $t2, 0x1001
+    sw $t0, 3392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3400
+    lui $t2, 0x1001
+    sw $t0, 3456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe800
+    lui $t2, 0x1001
+    sw $t0, 3520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x53c0
+    lui $t2, 0x1001
+    sw $t0, 3584($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb2c0
+    lui $t2, 0x1001
+    sw $t0, 3648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1200
+    lui $t2, 0x1001
+    sw $t0, 3712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf2c0
+    lui $t2, 0x1001
+    sw $t0, 3776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6600
+    lui $t2, 0x1001
+    sw $t0, 3840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2600
+    lui $t2, 0x1001
+    sw $t0, 3904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xeec0
+    lui $t2, 0x1001
+    sw $t0, 3968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7980
+    lui $t2, 0x1001
+    sw $t0, 4032($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1740
+    lui $t2, 0x1001
+    sw $t0, 4096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2f00
+    lui $t2, 0x1001
+    sw $t0, 4160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8e00
+    lui $t2, 0x1001
+    sw $t0, 4224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc840
+    lui $t2, 0x1001
+    sw $t0, 4288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xda40
+    lui $t2, 0x1001
+    sw $t0, 4352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x53c0
+    lui $t2, 0x1001
+    sw $t0, 4416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3940
+    lui $t2, 0x1001
+    sw $t0, 4480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4800
+    lui $t2, 0x1001
+    sw $t0, 4544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6680
+    lui $t2, 0x1001
+    sw $t0, 4608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xec40
+    lui $t2, 0x1001
+    sw $t0, 4672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9bc0
+    lui $t2, 0x1001
+    sw $t0, 4736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe580
+    lui $t2, 0x1001
+    sw $t0, 4800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5e00
+    lui $t2, 0x1001
+    sw $t0, 4864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xffc0
+    lui $t2, 0x1001
+    sw $t0, 4928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x88c0
+    lui $t2, 0x1001
+    sw $t0, 4992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa3c0
+    lui $t2, 0x1001
+    sw $t0, 5056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xff00
+    lui $t2, 0x1001
+    sw $t0, 5120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x39c0
+    lui $t2, 0x1001
+    sw $t0, 5184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1940
+    lui $t2, 0x1001
+    sw $t0, 5248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb000
+    lui $t2, 0x1001
+    sw $t0, 5312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3c80
+    lui $t2, 0x1001
+    sw $t0, 5376($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3000
+    lui $t2, 0x1001
+    sw $t0, 5440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e80
+    lui $t2, 0x1001
+    sw $t0, 5504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8100
+    lui $t2, 0x1001
+    sw $t0, 5568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1080
+    lui $t2, 0x1001
+    sw $t0, 5632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4340
+    lui $t2, 0x1001
+    sw $t0, 5696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb040
+    lui $t2, 0x1001
+    sw $t0, 5760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7a00
+    lui $t2, 0x1001
+    sw $t0, 5824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc2c0
+    lui $t2, 0x1001
+    sw $t0, 5888($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6940
+    lui $t2, 0x1001
+    sw $t0, 5952($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa080
+    lui $t2, 0x1001
+    sw $t0, 6016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2580
+    lui $t2, 0x1001
+    sw $t0, 6080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcd80
+    lui $t2, 0x1001
+    sw $t0, 6144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c00
+    lui $t2, 0x1001
+    sw $t0, 6208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa480
+    lui $t2, 0x1001
+    sw $t0, 6272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x95c0
+    lui $t2, 0x1001
+    sw $t0, 6336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4100
+    lui $t2, 0x1001
+    sw $t0, 6400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa700
+    lui $t2, 0x1001
+    sw $t0, 6464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd240
+    lui $t2, 0x1001
+    sw $t0, 6528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9480
+    lui $t2, 0x1001
+    sw $t0, 6592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9d40
+    lui $t2, 0x1001
+    sw $t0, 6656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8040
+    lui $t2, 0x1001
+    sw $t0, 6720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc180
+    lui $t2, 0x1001
+    sw $t0, 6784($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x67c0
+    lui $t2, 0x1001
+    sw $t0, 6848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc5c0
+    lui $t2, 0x1001
+    sw $t0, 6912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2980
+    lui $t2, 0x1001
+    sw $t0, 6976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdf40
+    lui $t2, 0x1001
+    sw $t0, 7040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5100
+    lui $t2, 0x1001
+    sw $t0, 7104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd500
+    lui $t2, 0x1001
+    sw $t0, 7168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8bc0
+    lui $t2, 0x1001
+    sw $t0, 7232($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7bc0
+    lui $t2, 0x1001
+    sw $t0, 7296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xddc0
+    lui $t2, 0x1001
+    sw $t0, 7360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xad80
+    lui $t2, 0x1001
+    sw $t0, 7424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfdc0
+    lui $t2, 0x1001
+    sw $t0, 7488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfc0
+    lui $t2, 0x1001
+    sw $t0, 7552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbc0
+    lui $t2, 0x1001
+    sw $t0, 7616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8580
+    lui $t2, 0x1001
+    sw $t0, 7680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc80
+    lui $t2, 0x1001
+    sw $t0, 7744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe640
+    lui $t2, 0x1001
+    sw $t0, 7808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1000
+    lui $t2, 0x1001
+    sw $t0, 7872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe600
+    lui $t2, 0x1001
+    sw $t0, 7936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5300
+    lui $t2, 0x1001
+    sw $t0, 8000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2c00
+    lui $t2, 0x1001
+    sw $t0, 8064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x47c0
+    lui $t2, 0x1001
+    sw $t0, 8128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5c0
+    lui $t2, 0x1001
+    sw $t0, 8192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb8c0
+    lui $t2, 0x1001
+    sw $t0, 8256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9f40
+    lui $t2, 0x1001
+    sw $t0, 8320($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3780
+    lui $t2, 0x1001
+    sw $t0, 8384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7d80
+    lui $t2, 0x1001
+    sw $t0, 8448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xce00
+    lui $t2, 0x1001
+    sw $t0, 8512($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x34c0
+    lui $t2, 0x1001
+    sw $t0, 8576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1680
+    lui $t2, 0x1001
+    sw $t0, 8640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf140
+    lui $t2, 0x1001
+    sw $t0, 8704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcec0
+    lui $t2, 0x1001
+    sw $t0, 8768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf180
+    lui $t2, 0x1001
+    sw $t0, 8832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf280
+    lui $t2, 0x1001
+    sw $t0, 8896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x36c0
+    lui $t2, 0x1001
+    sw $t0, 8960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9500
+    lui $t2, 0x1001
+    sw $t0, 9024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc580
+    lui $t2, 0x1001
+    sw $t0, 9088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe200
+    lui $t2, 0x1001
+    sw $t0, 9152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7840
+    lui $t2, 0x1001
+    sw $t0, 9216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf1c0
+    lui $t2, 0x1001
+    sw $t0, 9280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9740
+    lui $t2, 0x1001
+    sw $t0, 9344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4640
+    lui $t2, 0x1001
+    sw $t0, 9408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd840
+    lui $t2, 0x1001
+    sw $t0, 9472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8340
+    lui $t2, 0x1001
+    sw $t0, 9536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd400
+    lui $t2, 0x1001
+    sw $t0, 9600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4e00
+    lui $t2, 0x1001
+    sw $t0, 9664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9400
+    lui $t2, 0x1001
+    sw $t0, 9728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5240
+    lui $t2, 0x1001
+    sw $t0, 9792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5480
+    lui $t2, 0x1001
+    sw $t0, 9856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4500
+    lui $t2, 0x1001
+    sw $t0, 9920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7a40
+    lui $t2, 0x1001
+    sw $t0, 9984($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaac0
+    lui $t2, 0x1001
+    sw $t0, 10048($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x240
+    lui $t2, 0x1001
+    sw $t0, 10112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x25c0
+    lui $t2, 0x1001
+    sw $t0, 10176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4c80
+    lui $t2, 0x1001
+    sw $t0, 10240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe140
+    lui $t2, 0x1001
+    sw $t0, 10304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x180
+    lui $t2, 0x1001
+    sw $t0, 10368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcf40
+    lui $t2, 0x1001
+    sw $t0, 10432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6980
+    lui $t2, 0x1001
+    sw $t0, 10496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xef00
+    lui $t2, 0x1001
+    sw $t0, 10560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x60c0
+    lui $t2, 0x1001
+    sw $t0, 10624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9840
+    lui $t2, 0x1001
+    sw $t0, 10688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa40
+    lui $t2, 0x1001
+    sw $t0, 10752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x74c0
+    lui $t2, 0x1001
+    sw $t0, 10816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f00
+    lui $t2, 0x1001
+    sw $t0, 10880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf540
+    lui $t2, 0x1001
+    sw $t0, 10944($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb300
+    lui $t2, 0x1001
+    sw $t0, 11008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x86c0
+    lui $t2, 0x1001
+    sw $t0, 11072($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7600
+    lui $t2, 0x1001
+    sw $t0, 11136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7480
+    lui $t2, 0x1001
+    sw $t0, 11200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa980
+    lui $t2, 0x1001
+    sw $t0, 11264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcd80
+    lui $t2, 0x1001
+    sw $t0, 11328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x42c0
+    lui $t2, 0x1001
+    sw $t0, 11392($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6880
+    lui $t2, 0x1001
+    sw $t0, 11456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6f80
+    lui $t2, 0x1001
+    sw $t0, 11520($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4600
+    lui $t2, 0x1001
+    sw $t0, 11584($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xca40
+    lui $t2, 0x1001
+    sw $t0, 11648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd8c0
+    lui $t2, 0x1001
+    sw $t0, 11712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xed00
+    lui $t2, 0x1001
+    sw $t0, 11776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x32c0
+    lui $t2, 0x1001
+    sw $t0, 11840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xff40
+    lui $t2, 0x1001
+    sw $t0, 11904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x75c0
+    lui $t2, 0x1001
+    sw $t0, 11968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4fc0
+    lui $t2, 0x1001
+    sw $t0, 12032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8f80
+    lui $t2, 0x1001
+    sw $t0, 12096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7240
+    lui $t2, 0x1001
+    sw $t0, 12160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x70c0
+    lui $t2, 0x1001
+    sw $t0, 12224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb780
+    lui $t2, 0x1001
+    sw $t0, 12288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd980
+    lui $t2, 0x1001
+    sw $t0, 12352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6400
+    lui $t2, 0x1001
+    sw $t0, 12416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1f80
+    lui $t2, 0x1001
+    sw $t0, 12480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe6c0
+    lui $t2, 0x1001
+    sw $t0, 12544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xab40
+    lui $t2, 0x1001
+    sw $t0, 12608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xabc0
+    lui $t2, 0x1001
+    sw $t0, 12672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3480
+    lui $t2, 0x1001
+    sw $t0, 12736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf340
+    lui $t2, 0x1001
+    sw $t0, 12800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb680
+    lui $t2, 0x1001
+    sw $t0, 12864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2400
+    lui $t2, 0x1001
+    sw $t0, 12928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf880
+    lui $t2, 0x1001
+    sw $t0, 12992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc540
+    lui $t2, 0x1001
+    sw $t0, 13056($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc300
+    lui $t2, 0x1001
+    sw $t0, 13120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4c80
+    lui $t2, 0x1001
+    sw $t0, 13184($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdc00
+    lui $t2, 0x1001
+    sw $t0, 13248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x53c0
+    lui $t2, 0x1001
+    sw $t0, 13312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe100
+    lui $t2, 0x1001
+    sw $t0, 13376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3e80
+    lui $t2, 0x1001
+    sw $t0, 13440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb880
+    lui $t2, 0x1001
+    sw $t0, 13504($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb3c0
+    lui $t2, 0x1001
+    sw $t0, 13568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5800
+    lui $t2, 0x1001
+    sw $t0, 13632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3400
+    lui $t2, 0x1001
+    sw $t0, 13696($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4f80
+    lui $t2, 0x1001
+    sw $t0, 13760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b00
+    lui $t2, 0x1001
+    sw $t0, 13824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5100
+    lui $t2, 0x1001
+    sw $t0, 13888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5e80
+    lui $t2, 0x1001
+    sw $t0, 13952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc280
+    lui $t2, 0x1001
+    sw $t0, 14016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd0c0
+    lui $t2, 0x1001
+    sw $t0, 14080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb640
+    lui $t2, 0x1001
+    sw $t0, 14144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaac0
+    lui $t2, 0x1001
+    sw $t0, 14208($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6bc0
+    lui $t2, 0x1001
+    sw $t0, 14272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xff80
+    lui $t2, 0x1001
+    sw $t0, 14336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x66c0
+    lui $t2, 0x1001
+    sw $t0, 14400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1c00
+    lui $t2, 0x1001
+    sw $t0, 14464($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd940
+    lui $t2, 0x1001
+    sw $t0, 14528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4780
+    lui $t2, 0x1001
+    sw $t0, 14592($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xebc0
+    lui $t2, 0x1001
+    sw $t0, 14656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8480
+    lui $t2, 0x1001
+    sw $t0, 14720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x30c0
+    lui $t2, 0x1001
+    sw $t0, 14784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7800
+    lui $t2, 0x1001
+    sw $t0, 14848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9000
+    lui $t2, 0x1001
+    sw $t0, 14912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x90c0
+    lui $t2, 0x1001
+    sw $t0, 14976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd500
+    lui $t2, 0x1001
+    sw $t0, 15040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9c40
+    lui $t2, 0x1001
+    sw $t0, 15104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5340
+    lui $t2, 0x1001
+    sw $t0, 15168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4540
+    lui $t2, 0x1001
+    sw $t0, 15232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe0c0
+    lui $t2, 0x1001
+    sw $t0, 15296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2cc0
+    lui $t2, 0x1001
+    sw $t0, 15360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc5c0
+    lui $t2, 0x1001
+    sw $t0, 15424($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5fc0
+    lui $t2, 0x1001
+    sw $t0, 15488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9280
+    lui $t2, 0x1001
+    sw $t0, 15552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf240
+    lui $t2, 0x1001
+    sw $t0, 15616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7200
+    lui $t2, 0x1001
+    sw $t0, 15680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9500
+    lui $t2, 0x1001
+    sw $t0, 15744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd600
+    lui $t2, 0x1001
+    sw $t0, 15808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e80
+    lui $t2, 0x1001
+    sw $t0, 15872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbb40
+    lui $t2, 0x1001
+    sw $t0, 15936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6bc0
+    lui $t2, 0x1001
+    sw $t0, 16000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1800
+    lui $t2, 0x1001
+    sw $t0, 16064($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa2c0
+    lui $t2, 0x1001
+    sw $t0, 16128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5e80
+    lui $t2, 0x1001
+    sw $t0, 16192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1840
+    lui $t2, 0x1001
+    sw $t0, 16256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2280
+    lui $t2, 0x1001
+    sw $t0, 16320($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe380
+    lui $t2, 0x1001
+    sw $t0, 16384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x65c0
+    lui $t2, 0x1001
+    sw $t0, 16448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf440
+    lui $t2, 0x1001
+    sw $t0, 16512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb80
+    lui $t2, 0x1001
+    sw $t0, 16576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x90c0
+    lui $t2, 0x1001
+    sw $t0, 16640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2280
+    lui $t2, 0x1001
+    sw $t0, 16704($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x23c0
+    lui $t2, 0x1001
+    sw $t0, 16768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8080
+    lui $t2, 0x1001
+    sw $t0, 16832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc7c0
+    lui $t2, 0x1001
+    sw $t0, 16896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe880
+    lui $t2, 0x1001
+    sw $t0, 16960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5400
+    lui $t2, 0x1001
+    sw $t0, 17024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfd80
+    lui $t2, 0x1001
+    sw $t0, 17088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xda80
+    lui $t2, 0x1001
+    sw $t0, 17152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd100
+    lui $t2, 0x1001
+    sw $t0, 17216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe00
+    lui $t2, 0x1001
+    sw $t0, 17280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1e80
+    lui $t2, 0x1001
+    sw $t0, 17344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5f00
+    lui $t2, 0x1001
+    sw $t0, 17408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9c80
+    lui $t2, 0x1001
+    sw $t0, 17472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbf80
+    lui $t2, 0x1001
+    sw $t0, 17536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9880
+    lui $t2, 0x1001
+    sw $t0, 17600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x41c0
+    lui $t2, 0x1001
+    sw $t0, 17664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9b40
+    lui $t2, 0x1001
+    sw $t0, 17728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5740
+    lui $t2, 0x1001
+    sw $t0, 17792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe400
+    lui $t2, 0x1001
+    sw $t0, 17856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2cc0
+    lui $t2, 0x1001
+    sw $t0, 17920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa680
+    lui $t2, 0x1001
+    sw $t0, 17984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3180
+    lui $t2, 0x1001
+    sw $t0, 18048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa8c0
+    lui $t2, 0x1001
+    sw $t0, 18112($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfd00
+    lui $t2, 0x1001
+    sw $t0, 18176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe3c0
+    lui $t2, 0x1001
+    sw $t0, 18240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4980
+    lui $t2, 0x1001
+    sw $t0, 18304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f00
+    lui $t2, 0x1001
+    sw $t0, 18368($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6300
+    lui $t2, 0x1001
+    sw $t0, 18432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe280
+    lui $t2, 0x1001
+    sw $t0, 18496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa1c0
+    lui $t2, 0x1001
+    sw $t0, 18560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7c80
+    lui $t2, 0x1001
+    sw $t0, 18624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x36c0
+    lui $t2, 0x1001
+    sw $t0, 18688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x96c0
+    lui $t2, 0x1001
+    sw $t0, 18752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7f00
+    lui $t2, 0x1001
+    sw $t0, 18816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcf80
+    lui $t2, 0x1001
+    sw $t0, 18880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe500
+    lui $t2, 0x1001
+    sw $t0, 18944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb200
+    lui $t2, 0x1001
+    sw $t0, 19008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xac0
+    lui $t2, 0x1001
+    sw $t0, 19072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1500
+    lui $t2, 0x1001
+    sw $t0, 19136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2540
+    lui $t2, 0x1001
+    sw $t0, 19200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9040
+    lui $t2, 0x1001
+    sw $t0, 19264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb2c0
+    lui $t2, 0x1001
+    sw $t0, 19328($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfac0
+    lui $t2, 0x1001
+    sw $t0, 19392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4680
+    lui $t2, 0x1001
+    sw $t0, 19456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x15c0
+    lui $t2, 0x1001
+    sw $t0, 19520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc400
+    lui $t2, 0x1001
+    sw $t0, 19584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6240
+    lui $t2, 0x1001
+    sw $t0, 19648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2080
+    lui $t2, 0x1001
+    sw $t0, 19712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x11c0
+    lui $t2, 0x1001
+    sw $t0, 19776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa8c0
+    lui $t2, 0x1001
+    sw $t0, 19840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb540
+    lui $t2, 0x1001
+    sw $t0, 19904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa0c0
+    lui $t2, 0x1001
+    sw $t0, 19968($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc5c0
+    lui $t2, 0x1001
+    sw $t0, 20032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc780
+    lui $t2, 0x1001
+    sw $t0, 20096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa9c0
+    lui $t2, 0x1001
+    sw $t0, 20160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3b00
+    lui $t2, 0x1001
+    sw $t0, 20224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a40
+    lui $t2, 0x1001
+    sw $t0, 20288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3640
+    lui $t2, 0x1001
+    sw $t0, 20352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6e40
+    lui $t2, 0x1001
+    sw $t0, 20416($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2e40
+    lui $t2, 0x1001
+    sw $t0, 20480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb00
+    lui $t2, 0x1001
+    sw $t0, 20544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d40
+    lui $t2, 0x1001
+    sw $t0, 20608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfbc0
+    lui $t2, 0x1001
+    sw $t0, 20672($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4f00
+    lui $t2, 0x1001
+    sw $t0, 20736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd280
+    lui $t2, 0x1001
+    sw $t0, 20800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x35c0
+    lui $t2, 0x1001
+    sw $t0, 20864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7140
+    lui $t2, 0x1001
+    sw $t0, 20928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe340
+    lui $t2, 0x1001
+    sw $t0, 20992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5640
+    lui $t2, 0x1001
+    sw $t0, 21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc3c0
+    lui $t2, 0x1001
+    sw $t0, 21120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2780
+    lui $t2, 0x1001
+    sw $t0, 21184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1040
+    lui $t2, 0x1001
+    sw $t0, 21248($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7340
+    lui $t2, 0x1001
+    sw $t0, 21312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x18c0
+    lui $t2, 0x1001
+    sw $t0, 21376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xac00
+    lui $t2, 0x1001
+    sw $t0, 21440($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6780
+    lui $t2, 0x1001
+    sw $t0, 21504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x980
+    lui $t2, 0x1001
+    sw $t0, 21568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfb00
+    lui $t2, 0x1001
+    sw $t0, 21632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf900
+    lui $t2, 0x1001
+    sw $t0, 21696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd480
+    lui $t2, 0x1001
+    sw $t0, 21760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x51c0
+    lui $t2, 0x1001
+    sw $t0, 21824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7c80
+    lui $t2, 0x1001
+    sw $t0, 21888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5b80
+    lui $t2, 0x1001
+    sw $t0, 21952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf300
+    lui $t2, 0x1001
+    sw $t0, 22016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6200
+    lui $t2, 0x1001
+    sw $t0, 22080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfbc0
+    lui $t2, 0x1001
+    sw $t0, 22144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x90c0
+    lui $t2, 0x1001
+    sw $t0, 22208($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd800
+    lui $t2, 0x1001
+    sw $t0, 22272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2240
+    lui $t2, 0x1001
+    sw $t0, 22336($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x65c0
+    lui $t2, 0x1001
+    sw $t0, 22400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xefc0
+    lui $t2, 0x1001
+    sw $t0, 22464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbc00
+    lui $t2, 0x1001
+    sw $t0, 22528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9f00
+    lui $t2, 0x1001
+    sw $t0, 22592($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9380
+    lui $t2, 0x1001
+    sw $t0, 22656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xed00
+    lui $t2, 0x1001
+    sw $t0, 22720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfcc0
+    lui $t2, 0x1001
+    sw $t0, 22784($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa640
+    lui $t2, 0x1001
+    sw $t0, 22848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x180
+    lui $t2, 0x1001
+    sw $t0, 22912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5780
+    lui $t2, 0x1001
+    sw $t0, 22976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8980
+    lui $t2, 0x1001
+    sw $t0, 23040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1ac0
+    lui $t2, 0x1001
+    sw $t0, 23104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5900
+    lui $t2, 0x1001
+    sw $t0, 23168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf780
+    lui $t2, 0x1001
+    sw $t0, 23232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7900
+    lui $t2, 0x1001
+    sw $t0, 23296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8a80
+    lui $t2, 0x1001
+    sw $t0, 23360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb740
+    lui $t2, 0x1001
+    sw $t0, 23424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9900
+    lui $t2, 0x1001
+    sw $t0, 23488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b80
+    lui $t2, 0x1001
+    sw $t0, 23552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8700
+    lui $t2, 0x1001
+    sw $t0, 23616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5b00
+    lui $t2, 0x1001
+    sw $t0, 23680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd000
+    lui $t2, 0x1001
+    sw $t0, 23744($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5300
+    lui $t2, 0x1001
+    sw $t0, 23808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8040
+    lui $t2, 0x1001
+    sw $t0, 23872($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1f00
+    lui $t2, 0x1001
+    sw $t0, 23936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb400
+    lui $t2, 0x1001
+    sw $t0, 24000($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3880
+    lui $t2, 0x1001
+    sw $t0, 24064($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbec0
+    lui $t2, 0x1001
+    sw $t0, 24128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa280
+    lui $t2, 0x1001
+    sw $t0, 24192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9cc0
+    lui $t2, 0x1001
+    sw $t0, 24256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe400
+    lui $t2, 0x1001
+    sw $t0, 24320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xefc0
+    lui $t2, 0x1001
+    sw $t0, 24384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf580
+    lui $t2, 0x1001
+    sw $t0, 24448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8c00
+    lui $t2, 0x1001
+    sw $t0, 24512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x68c0
+    lui $t2, 0x1001
+    sw $t0, 24576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe40
+    lui $t2, 0x1001
+    sw $t0, 24640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9a00
+    lui $t2, 0x1001
+    sw $t0, 24704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbd40
+    lui $t2, 0x1001
+    sw $t0, 24768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcc0
+    lui $t2, 0x1001
+    sw $t0, 24832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8c00
+    lui $t2, 0x1001
+    sw $t0, 24896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfe80
+    lui $t2, 0x1001
+    sw $t0, 24960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa380
+    lui $t2, 0x1001
+    sw $t0, 25024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xeec0
+    lui $t2, 0x1001
+    sw $t0, 25088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9b00
+    lui $t2, 0x1001
+    sw $t0, 25152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe280
+    lui $t2, 0x1001
+    sw $t0, 25216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9c0
+    lui $t2, 0x1001
+    sw $t0, 25280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf580
+    lui $t2, 0x1001
+    sw $t0, 25344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe880
+    lui $t2, 0x1001
+    sw $t0, 25408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcd40
+    lui $t2, 0x1001
+    sw $t0, 25472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc7c0
+    lui $t2, 0x1001
+    sw $t0, 25536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x400
+    lui $t2, 0x1001
+    sw $t0, 25600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9380
+    lui $t2, 0x1001
+    sw $t0, 25664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8c80
+    lui $t2, 0x1001
+    sw $t0, 25728($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb000
+    lui $t2, 0x1001
+    sw $t0, 25792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcac0
+    lui $t2, 0x1001
+    sw $t0, 25856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3500
+    lui $t2, 0x1001
+    sw $t0, 25920($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc480
+    lui $t2, 0x1001
+    sw $t0, 25984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaa40
+    lui $t2, 0x1001
+    sw $t0, 26048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa80
+    lui $t2, 0x1001
+    sw $t0, 26112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb380
+    lui $t2, 0x1001
+    sw $t0, 26176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xff00
+    lui $t2, 0x1001
+    sw $t0, 26240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfd40
+    lui $t2, 0x1001
+    sw $t0, 26304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x54c0
+    lui $t2, 0x1001
+    sw $t0, 26368($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xec40
+    lui $t2, 0x1001
+    sw $t0, 26432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7f40
+    lui $t2, 0x1001
+    sw $t0, 26496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2500
+    lui $t2, 0x1001
+    sw $t0, 26560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7640
+    lui $t2, 0x1001
+    sw $t0, 26624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7d00
+    lui $t2, 0x1001
+    sw $t0, 26688($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcb40
+    lui $t2, 0x1001
+    sw $t0, 26752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x44c0
+    lui $t2, 0x1001
+    sw $t0, 26816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7300
+    lui $t2, 0x1001
+    sw $t0, 26880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4680
+    lui $t2, 0x1001
+    sw $t0, 26944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3780
+    lui $t2, 0x1001
+    sw $t0, 27008($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe600
+    lui $t2, 0x1001
+    sw $t0, 27072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4fc0
+    lui $t2, 0x1001
+    sw $t0, 27136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe680
+    lui $t2, 0x1001
+    sw $t0, 27200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x73c0
+    lui $t2, 0x1001
+    sw $t0, 27264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3fc0
+    lui $t2, 0x1001
+    sw $t0, 27328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4040
+    lui $t2, 0x1001
+    sw $t0, 27392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xef80
+    lui $t2, 0x1001
+    sw $t0, 27456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc480
+    lui $t2, 0x1001
+    sw $t0, 27520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4780
+    lui $t2, 0x1001
+    sw $t0, 27584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa980
+    lui $t2, 0x1001
+    sw $t0, 27648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5480
+    lui $t2, 0x1001
+    sw $t0, 27712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa5c0
+    lui $t2, 0x1001
+    sw $t0, 27776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc440
+    lui $t2, 0x1001
+    sw $t0, 27840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x880
+    lui $t2, 0x1001
+    sw $t0, 27904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6440
+    lui $t2, 0x1001
+    sw $t0, 27968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4100
+    lui $t2, 0x1001
+    sw $t0, 28032($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2e80
+    lui $t2, 0x1001
+    sw $t0, 28096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf7c0
+    lui $t2, 0x1001
+    sw $t0, 28160($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc400
+    lui $t2, 0x1001
+    sw $t0, 28224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4000
+    lui $t2, 0x1001
+    sw $t0, 28288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd00
+    lui $t2, 0x1001
+    sw $t0, 28352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8fc0
+    lui $t2, 0x1001
+    sw $t0, 28416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcb80
+    lui $t2, 0x1001
+    sw $t0, 28480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8180
+    lui $t2, 0x1001
+    sw $t0, 28544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1440
+    lui $t2, 0x1001
+    sw $t0, 28608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2b40
+    lui $t2, 0x1001
+    sw $t0, 28672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xca40
+    lui $t2, 0x1001
+    sw $t0, 28736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xee80
+    lui $t2, 0x1001
+    sw $t0, 28800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1d40
+    lui $t2, 0x1001
+    sw $t0, 28864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xef80
+    lui $t2, 0x1001
+    sw $t0, 28928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfc80
+    lui $t2, 0x1001
+    sw $t0, 28992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ec0
+    lui $t2, 0x1001
+    sw $t0, 29056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf4c0
+    lui $t2, 0x1001
+    sw $t0, 29120($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc380
+    lui $t2, 0x1001
+    sw $t0, 29184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbc40
+    lui $t2, 0x1001
+    sw $t0, 29248($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc280
+    lui $t2, 0x1001
+    sw $t0, 29312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcbc0
+    lui $t2, 0x1001
+    sw $t0, 29376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 64
+    lui $t2, 0x1001
+    sw $t0, 29440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1bc0
+    lui $t2, 0x1001
+    sw $t0, 29504($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2580
+    lui $t2, 0x1001
+    sw $t0, 29568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5600
+    lui $t2, 0x1001
+    sw $t0, 29632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd80
+    lui $t2, 0x1001
+    sw $t0, 29696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8840
+    lui $t2, 0x1001
+    sw $t0, 29760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xec00
+    lui $t2, 0x1001
+    sw $t0, 29824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5140
+    lui $t2, 0x1001
+    sw $t0, 29888($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd140
+    lui $t2, 0x1001
+    sw $t0, 29952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe240
+    lui $t2, 0x1001
+    sw $t0, 30016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7b00
+    lui $t2, 0x1001
+    sw $t0, 30080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1140
+    lui $t2, 0x1001
+    sw $t0, 30144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x57c0
+    lui $t2, 0x1001
+    sw $t0, 30208($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc240
+    lui $t2, 0x1001
+    sw $t0, 30272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xac40
+    lui $t2, 0x1001
+    sw $t0, 30336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd8c0
+    lui $t2, 0x1001
+    sw $t0, 30400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xecc0
+    lui $t2, 0x1001
+    sw $t0, 30464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9580
+    lui $t2, 0x1001
+    sw $t0, 30528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5200
+    lui $t2, 0x1001
+    sw $t0, 30592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7340
+    lui $t2, 0x1001
+    sw $t0, 30656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb140
+    lui $t2, 0x1001
+    sw $t0, 30720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4180
+    lui $t2, 0x1001
+    sw $t0, 30784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcdc0
+    lui $t2, 0x1001
+    sw $t0, 30848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa80
+    lui $t2, 0x1001
+    sw $t0, 30912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbec0
+    lui $t2, 0x1001
+    sw $t0, 30976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa2c0
+    lui $t2, 0x1001
+    sw $t0, 31040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd980
+    lui $t2, 0x1001
+    sw $t0, 31104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9500
+    lui $t2, 0x1001
+    sw $t0, 31168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b40
+    lui $t2, 0x1001
+    sw $t0, 31232($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9340
+    lui $t2, 0x1001
+    sw $t0, 31296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe280
+    lui $t2, 0x1001
+    sw $t0, 31360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd380
+    lui $t2, 0x1001
+    sw $t0, 31424($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xda80
+    lui $t2, 0x1001
+    sw $t0, 31488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x140
+    lui $t2, 0x1001
+    sw $t0, 31552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x92c0
+    lui $t2, 0x1001
+    sw $t0, 31616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdd40
+    lui $t2, 0x1001
+    sw $t0, 31680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1540
+    lui $t2, 0x1001
+    sw $t0, 31744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4e80
+    lui $t2, 0x1001
+    sw $t0, 31808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd180
+    lui $t2, 0x1001
+    sw $t0, 31872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x35c0
+    lui $t2, 0x1001
+    sw $t0, 31936($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2000
+    lui $t2, 0x1001
+    sw $t0, 32000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x58c0
+    lui $t2, 0x1001
+    sw $t0, 32064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5080
+    lui $t2, 0x1001
+    sw $t0, 32128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1680
+    lui $t2, 0x1001
+    sw $t0, 32192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8080
+    lui $t2, 0x1001
+    sw $t0, 32256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb140
+    lui $t2, 0x1001
+    sw $t0, 32320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a40
+    lui $t2, 0x1001
+    sw $t0, 32384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 128
+    lui $t2, 0x1001
+    sw $t0, 32448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6e80
+    lui $t2, 0x1001
+    sw $t0, 32512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb740
+    lui $t2, 0x1001
+    sw $t0, 32576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8040
+    lui $t2, 0x1001
+    sw $t0, 32640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf400
+    lui $t2, 0x1001
+    sw $t0, 32704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1400
+    lui $t2, 0x1002
+    sw $t0, -32768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbcc0
+    lui $t2, 0x1002
+    sw $t0, -32704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2c0
+    lui $t2, 0x1002
+    sw $t0, -32640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb400
+    lui $t2, 0x1002
+    sw $t0, -32576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfa40
+    lui $t2, 0x1002
+    sw $t0, -32512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc40
+    lui $t2, 0x1002
+    sw $t0, -32448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa900
+    lui $t2, 0x1002
+    sw $t0, -32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3000
+    lui $t2, 0x1002
+    sw $t0, -32320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc000
+    lui $t2, 0x1002
+    sw $t0, -32256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd600
+    lui $t2, 0x1002
+    sw $t0, -32192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4900
+    lui $t2, 0x1002
+    sw $t0, -32128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9740
+    lui $t2, 0x1002
+    sw $t0, -32064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7ac0
+    lui $t2, 0x1002
+    sw $t0, -32000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2680
+    lui $t2, 0x1002
+    sw $t0, -31936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbdc0
+    lui $t2, 0x1002
+    sw $t0, -31872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4a40
+    lui $t2, 0x1002
+    sw $t0, -31808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfe40
+    lui $t2, 0x1002
+    sw $t0, -31744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7480
+    lui $t2, 0x1002
+    sw $t0, -31680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5a00
+    lui $t2, 0x1002
+    sw $t0, -31616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9b40
+    lui $t2, 0x1002
+    sw $t0, -31552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa140
+    lui $t2, 0x1002
+    sw $t0, -31488($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5340
+    lui $t2, 0x1002
+    sw $t0, -31424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b00
+    lui $t2, 0x1002
+    sw $t0, -31360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7500
+    lui $t2, 0x1002
+    sw $t0, -31296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaf80
+    lui $t2, 0x1002
+    sw $t0, -31232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6600
+    lui $t2, 0x1002
+    sw $t0, -31168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8680
+    lui $t2, 0x1002
+    sw $t0, -31104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc900
+    lui $t2, 0x1002
+    sw $t0, -31040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x87c0
+    lui $t2, 0x1002
+    sw $t0, -30976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc9c0
+    lui $t2, 0x1002
+    sw $t0, -30912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd6c0
+    lui $t2, 0x1002
+    sw $t0, -30848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf700
+    lui $t2, 0x1002
+    sw $t0, -30784($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9f40
+    lui $t2, 0x1002
+    sw $t0, -30720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3800
+    lui $t2, 0x1002
+    sw $t0, -30656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4840
+    lui $t2, 0x1002
+    sw $t0, -30592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x500
+    lui $t2, 0x1002
+    sw $t0, -30528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x600
+    lui $t2, 0x1002
+    sw $t0, -30464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6480
+    lui $t2, 0x1002
+    sw $t0, -30400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2340
+    lui $t2, 0x1002
+    sw $t0, -30336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5500
+    lui $t2, 0x1002
+    sw $t0, -30272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd040
+    lui $t2, 0x1002
+    sw $t0, -30208($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xda40
+    lui $t2, 0x1002
+    sw $t0, -30144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xec0
+    lui $t2, 0x1002
+    sw $t0, -30080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a80
+    lui $t2, 0x1002
+    sw $t0, -30016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ac0
+    lui $t2, 0x1002
+    sw $t0, -29952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4940
+    lui $t2, 0x1002
+    sw $t0, -29888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc040
+    lui $t2, 0x1002
+    sw $t0, -29824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x98c0
+    lui $t2, 0x1002
+    sw $t0, -29760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3f80
+    lui $t2, 0x1002
+    sw $t0, -29696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2240
+    lui $t2, 0x1002
+    sw $t0, -29632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5b80
+    lui $t2, 0x1002
+    sw $t0, -29568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfc0
+    lui $t2, 0x1002
+    sw $t0, -29504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfa00
+    lui $t2, 0x1002
+    sw $t0, -29440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2500
+    lui $t2, 0x1002
+    sw $t0, -29376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7140
+    lui $t2, 0x1002
+    sw $t0, -29312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xec0
+    lui $t2, 0x1002
+    sw $t0, -29248($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x58c0
+    lui $t2, 0x1002
+    sw $t0, -29184($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8e40
+    lui $t2, 0x1002
+    sw $t0, -29120($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9500
+    lui $t2, 0x1002
+    sw $t0, -29056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb700
+    lui $t2, 0x1002
+    sw $t0, -28992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5380
+    lui $t2, 0x1002
+    sw $t0, -28928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5800
+    lui $t2, 0x1002
+    sw $t0, -28864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaa00
+    lui $t2, 0x1002
+    sw $t0, -28800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2500
+    lui $t2, 0x1002
+    sw $t0, -28736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe900
+    lui $t2, 0x1002
+    sw $t0, -28672($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x26c0
+    lui $t2, 0x1002
+    sw $t0, -28608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9c0
+    lui $t2, 0x1002
+    sw $t0, -28544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xccc0
+    lui $t2, 0x1002
+    sw $t0, -28480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x600
+    lui $t2, 0x1002
+    sw $t0, -28416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9dc0
+    lui $t2, 0x1002
+    sw $t0, -28352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb200
+    lui $t2, 0x1002
+    sw $t0, -28288($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x86c0
+    lui $t2, 0x1002
+    sw $t0, -28224($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd700
+    lui $t2, 0x1002
+    sw $t0, -28160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x800
+    lui $t2, 0x1002
+    sw $t0, -28096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc640
+    lui $t2, 0x1002
+    sw $t0, -28032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5c40
+    lui $t2, 0x1002
+    sw $t0, -27968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x580
+    lui $t2, 0x1002
+    sw $t0, -27904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5040
+    lui $t2, 0x1002
+    sw $t0, -27840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8180
+    lui $t2, 0x1002
+    sw $t0, -27776($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x840
+    lui $t2, 0x1002
+    sw $t0, -27712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2fc0
+    lui $t2, 0x1002
+    sw $t0, -27648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7c00
+    lui $t2, 0x1002
+    sw $t0, -27584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf640
+    lui $t2, 0x1002
+    sw $t0, -27520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8380
+    lui $t2, 0x1002
+    sw $t0, -27456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xabc0
+    lui $t2, 0x1002
+    sw $t0, -27392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb40
+    lui $t2, 0x1002
+    sw $t0, -27328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb140
+    lui $t2, 0x1002
+    sw $t0, -27264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd200
+    lui $t2, 0x1002
+    sw $t0, -27200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf7c0
+    lui $t2, 0x1002
+    sw $t0, -27136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9280
+    lui $t2, 0x1002
+    sw $t0, -27072($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe840
+    lui $t2, 0x1002
+    sw $t0, -27008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe940
+    lui $t2, 0x1002
+    sw $t0, -26944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1280
+    lui $t2, 0x1002
+    sw $t0, -26880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4300
+    lui $t2, 0x1002
+    sw $t0, -26816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1bc0
+    lui $t2, 0x1002
+    sw $t0, -26752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfe00
+    lui $t2, 0x1002
+    sw $t0, -26688($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbe40
+    lui $t2, 0x1002
+    sw $t0, -26624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4100
+    lui $t2, 0x1002
+    sw $t0, -26560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc340
+    lui $t2, 0x1002
+    sw $t0, -26496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa400
+    lui $t2, 0x1002
+    sw $t0, -26432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2840
+    lui $t2, 0x1002
+    sw $t0, -26368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xba80
+    lui $t2, 0x1002
+    sw $t0, -26304($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3ec0
+    lui $t2, 0x1002
+    sw $t0, -26240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc8c0
+    lui $t2, 0x1002
+    sw $t0, -26176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8b40
+    lui $t2, 0x1002
+    sw $t0, -26112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe500
+    lui $t2, 0x1002
+    sw $t0, -26048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3d40
+    lui $t2, 0x1002
+    sw $t0, -25984($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x41c0
+    lui $t2, 0x1002
+    sw $t0, -25920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8b80
+    lui $t2, 0x1002
+    sw $t0, -25856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa680
+    lui $t2, 0x1002
+    sw $t0, -25792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf9c0
+    lui $t2, 0x1002
+    sw $t0, -25728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f80
+    lui $t2, 0x1002
+    sw $t0, -25664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7cc0
+    lui $t2, 0x1002
+    sw $t0, -25600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbe00
+    lui $t2, 0x1002
+    sw $t0, -25536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3580
+    lui $t2, 0x1002
+    sw $t0, -25472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xca00
+    lui $t2, 0x1002
+    sw $t0, -25408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8140
+    lui $t2, 0x1002
+    sw $t0, -25344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd700
+    lui $t2, 0x1002
+    sw $t0, -25280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e40
+    lui $t2, 0x1002
+    sw $t0, -25216($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc740
+    lui $t2, 0x1002
+    sw $t0, -25152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x30c0
+    lui $t2, 0x1002
+    sw $t0, -25088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xedc0
+    lui $t2, 0x1002
+    sw $t0, -25024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd780
+    lui $t2, 0x1002
+    sw $t0, -24960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xedc0
+    lui $t2, 0x1002
+    sw $t0, -24896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb440
+    lui $t2, 0x1002
+    sw $t0, -24832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4dc0
+    lui $t2, 0x1002
+    sw $t0, -24768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc280
+    lui $t2, 0x1002
+    sw $t0, -24704($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3680
+    lui $t2, 0x1002
+    sw $t0, -24640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9a00
+    lui $t2, 0x1002
+    sw $t0, -24576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa980
+    lui $t2, 0x1002
+    sw $t0, -24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2840
+    lui $t2, 0x1002
+    sw $t0, -24448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x17c0
+    lui $t2, 0x1002
+    sw $t0, -24384($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb700
+    lui $t2, 0x1002
+    sw $t0, -24320($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6c0
+    lui $t2, 0x1002
+    sw $t0, -24256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdb00
+    lui $t2, 0x1002
+    sw $t0, -24192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc800
+    lui $t2, 0x1002
+    sw $t0, -24128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8340
+    lui $t2, 0x1002
+    sw $t0, -24064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2300
+    lui $t2, 0x1002
+    sw $t0, -24000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfe80
+    lui $t2, 0x1002
+    sw $t0, -23936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7640
+    lui $t2, 0x1002
+    sw $t0, -23872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1180
+    lui $t2, 0x1002
+    sw $t0, -23808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7e40
+    lui $t2, 0x1002
+    sw $t0, -23744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x63c0
+    lui $t2, 0x1002
+    sw $t0, -23680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5a00
+    lui $t2, 0x1002
+    sw $t0, -23616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e80
+    lui $t2, 0x1002
+    sw $t0, -23552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6c00
+    lui $t2, 0x1002
+    sw $t0, -23488($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf0c0
+    lui $t2, 0x1002
+    sw $t0, -23424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd780
+    lui $t2, 0x1002
+    sw $t0, -23360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc040
+    lui $t2, 0x1002
+    sw $t0, -23296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd540
+    lui $t2, 0x1002
+    sw $t0, -23232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1a40
+    lui $t2, 0x1002
+    sw $t0, -23168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7440
+    lui $t2, 0x1002
+    sw $t0, -23104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe9c0
+    lui $t2, 0x1002
+    sw $t0, -23040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xda00
+    lui $t2, 0x1002
+    sw $t0, -22976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xde40
+    lui $t2, 0x1002
+    sw $t0, -22912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe740
+    lui $t2, 0x1002
+    sw $t0, -22848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe240
+    lui $t2, 0x1002
+    sw $t0, -22784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7c40
+    lui $t2, 0x1002
+    sw $t0, -22720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x500
+    lui $t2, 0x1002
+    sw $t0, -22656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb780
+    lui $t2, 0x1002
+    sw $t0, -22592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8dc0
+    lui $t2, 0x1002
+    sw $t0, -22528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd080
+    lui $t2, 0x1002
+    sw $t0, -22464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9e00
+    lui $t2, 0x1002
+    sw $t0, -22400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8140
+    lui $t2, 0x1002
+    sw $t0, -22336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbd80
+    lui $t2, 0x1002
+    sw $t0, -22272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9440
+    lui $t2, 0x1002
+    sw $t0, -22208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb840
+    lui $t2, 0x1002
+    sw $t0, -22144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1cc0
+    lui $t2, 0x1002
+    sw $t0, -22080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x83c0
+    lui $t2, 0x1002
+    sw $t0, -22016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1640
+    lui $t2, 0x1002
+    sw $t0, -21952($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf180
+    lui $t2, 0x1002
+    sw $t0, -21888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9600
+    lui $t2, 0x1002
+    sw $t0, -21824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4400
+    lui $t2, 0x1002
+    sw $t0, -21760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3480
+    lui $t2, 0x1002
+    sw $t0, -21696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8800
+    lui $t2, 0x1002
+    sw $t0, -21632($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4140
+    lui $t2, 0x1002
+    sw $t0, -21568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2440
+    lui $t2, 0x1002
+    sw $t0, -21504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x45c0
+    lui $t2, 0x1002
+    sw $t0, -21440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2d80
+    lui $t2, 0x1002
+    sw $t0, -21376($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd580
+    lui $t2, 0x1002
+    sw $t0, -21312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8940
+    lui $t2, 0x1002
+    sw $t0, -21248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b40
+    lui $t2, 0x1002
+    sw $t0, -21184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6f80
+    lui $t2, 0x1002
+    sw $t0, -21120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc440
+    lui $t2, 0x1002
+    sw $t0, -21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4040
+    lui $t2, 0x1002
+    sw $t0, -20992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf6c0
+    lui $t2, 0x1002
+    sw $t0, -20928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7640
+    lui $t2, 0x1002
+    sw $t0, -20864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5d40
+    lui $t2, 0x1002
+    sw $t0, -20800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x240
+    lui $t2, 0x1002
+    sw $t0, -20736($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5fc0
+    lui $t2, 0x1002
+    sw $t0, -20672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1880
+    lui $t2, 0x1002
+    sw $t0, -20608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd640
+    lui $t2, 0x1002
+    sw $t0, -20544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2b40
+    lui $t2, 0x1002
+    sw $t0, -20480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe080
+    lui $t2, 0x1002
+    sw $t0, -20416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3b80
+    lui $t2, 0x1002
+    sw $t0, -20352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa880
+    lui $t2, 0x1002
+    sw $t0, -20288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2bc0
+    lui $t2, 0x1002
+    sw $t0, -20224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xff80
+    lui $t2, 0x1002
+    sw $t0, -20160($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7880
+    lui $t2, 0x1002
+    sw $t0, -20096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b00
+    lui $t2, 0x1002
+    sw $t0, -20032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5580
+    lui $t2, 0x1002
+    sw $t0, -19968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf7c0
+    lui $t2, 0x1002
+    sw $t0, -19904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2580
+    lui $t2, 0x1002
+    sw $t0, -19840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8700
+    lui $t2, 0x1002
+    sw $t0, -19776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3580
+    lui $t2, 0x1002
+    sw $t0, -19712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6080
+    lui $t2, 0x1002
+    sw $t0, -19648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x680
+    lui $t2, 0x1002
+    sw $t0, -19584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9280
+    lui $t2, 0x1002
+    sw $t0, -19520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x56c0
+    lui $t2, 0x1002
+    sw $t0, -19456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5180
+    lui $t2, 0x1002
+    sw $t0, -19392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd280
+    lui $t2, 0x1002
+    sw $t0, -19328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8640
+    lui $t2, 0x1002
+    sw $t0, -19264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb680
+    lui $t2, 0x1002
+    sw $t0, -19200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d80
+    lui $t2, 0x1002
+    sw $t0, -19136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5a80
+    lui $t2, 0x1002
+    sw $t0, -19072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xde40
+    lui $t2, 0x1002
+    sw $t0, -19008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5040
+    lui $t2, 0x1002
+    sw $t0, -18944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c0
+    lui $t2, 0x1002
+    sw $t0, -18880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd040
+    lui $t2, 0x1002
+    sw $t0, -18816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6800
+    lui $t2, 0x1002
+    sw $t0, -18752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6640
+    lui $t2, 0x1002
+    sw $t0, -18688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf80
+    lui $t2, 0x1002
+    sw $t0, -18624($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1640
+    lui $t2, 0x1002
+    sw $t0, -18560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5b40
+    lui $t2, 0x1002
+    sw $t0, -18496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x55c0
+    lui $t2, 0x1002
+    sw $t0, -18432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf640
+    lui $t2, 0x1002
+    sw $t0, -18368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6b40
+    lui $t2, 0x1002
+    sw $t0, -18304($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa100
+    lui $t2, 0x1002
+    sw $t0, -18240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbc40
+    lui $t2, 0x1002
+    sw $t0, -18176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9e80
+    lui $t2, 0x1002
+    sw $t0, -18112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb0c0
+    lui $t2, 0x1002
+    sw $t0, -18048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a40
+    lui $t2, 0x1002
+    sw $t0, -17984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfa40
+    lui $t2, 0x1002
+    sw $t0, -17920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6c40
+    lui $t2, 0x1002
+    sw $t0, -17856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1c0
+    lui $t2, 0x1002
+    sw $t0, -17792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x36c0
+    lui $t2, 0x1002
+    sw $t0, -17728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7880
+    lui $t2, 0x1002
+    sw $t0, -17664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8f40
+    lui $t2, 0x1002
+    sw $t0, -17600($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9640
+    lui $t2, 0x1002
+    sw $t0, -17536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb800
+    lui $t2, 0x1002
+    sw $t0, -17472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdb40
+    lui $t2, 0x1002
+    sw $t0, -17408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x21c0
+    lui $t2, 0x1002
+    sw $t0, -17344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4240
+    lui $t2, 0x1002
+    sw $t0, -17280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1500
+    lui $t2, 0x1002
+    sw $t0, -17216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe140
+    lui $t2, 0x1002
+    sw $t0, -17152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdc40
+    lui $t2, 0x1002
+    sw $t0, -17088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3940
+    lui $t2, 0x1002
+    sw $t0, -17024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6980
+    lui $t2, 0x1002
+    sw $t0, -16960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdb40
+    lui $t2, 0x1002
+    sw $t0, -16896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa880
+    lui $t2, 0x1002
+    sw $t0, -16832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd200
+    lui $t2, 0x1002
+    sw $t0, -16768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9a40
+    lui $t2, 0x1002
+    sw $t0, -16704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4280
+    lui $t2, 0x1002
+    sw $t0, -16640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf680
+    lui $t2, 0x1002
+    sw $t0, -16576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8400
+    lui $t2, 0x1002
+    sw $t0, -16512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2d00
+    lui $t2, 0x1002
+    sw $t0, -16448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbf80
+    lui $t2, 0x1002
+    sw $t0, -16384($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2100
+    lui $t2, 0x1002
+    sw $t0, -16320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfec0
+    lui $t2, 0x1002
+    sw $t0, -16256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4d80
+    lui $t2, 0x1002
+    sw $t0, -16192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9880
+    lui $t2, 0x1002
+    sw $t0, -16128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4640
+    lui $t2, 0x1002
+    sw $t0, -16064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x58c0
+    lui $t2, 0x1002
+    sw $t0, -16000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2440
+    lui $t2, 0x1002
+    sw $t0, -15936($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf540
+    lui $t2, 0x1002
+    sw $t0, -15872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1600
+    lui $t2, 0x1002
+    sw $t0, -15808($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8700
+    lui $t2, 0x1002
+    sw $t0, -15744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ec0
+    lui $t2, 0x1002
+    sw $t0, -15680($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x29c0
+    lui $t2, 0x1002
+    sw $t0, -15616($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7200
+    lui $t2, 0x1002
+    sw $t0, -15552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdd00
+    lui $t2, 0x1002
+    sw $t0, -15488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfc80
+    lui $t2, 0x1002
+    sw $t0, -15424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5000
+    lui $t2, 0x1002
+    sw $t0, -15360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9e00
+    lui $t2, 0x1002
+    sw $t0, -15296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb100
+    lui $t2, 0x1002
+    sw $t0, -15232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5680
+    lui $t2, 0x1002
+    sw $t0, -15168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f00
+    lui $t2, 0x1002
+    sw $t0, -15104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa0c0
+    lui $t2, 0x1002
+    sw $t0, -15040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe980
+    lui $t2, 0x1002
+    sw $t0, -14976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd80
+    lui $t2, 0x1002
+    sw $t0, -14912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2200
+    lui $t2, 0x1002
+    sw $t0, -14848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5140
+    lui $t2, 0x1002
+    sw $t0, -14784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1dc0
+    lui $t2, 0x1002
+    sw $t0, -14720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5a80
+    lui $t2, 0x1002
+    sw $t0, -14656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb480
+    lui $t2, 0x1002
+    sw $t0, -14592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5a00
+    lui $t2, 0x1002
+    sw $t0, -14528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2040
+    lui $t2, 0x1002
+    sw $t0, -14464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5400
+    lui $t2, 0x1002
+    sw $t0, -14400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe2c0
+    lui $t2, 0x1002
+    sw $t0, -14336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc8c0
+    lui $t2, 0x1002
+    sw $t0, -14272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa440
+    lui $t2, 0x1002
+    sw $t0, -14208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc000
+    lui $t2, 0x1002
+    sw $t0, -14144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x94c0
+    lui $t2, 0x1002
+    sw $t0, -14080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbc00
+    lui $t2, 0x1002
+    sw $t0, -14016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xba80
+    lui $t2, 0x1002
+    sw $t0, -13952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbd00
+    lui $t2, 0x1002
+    sw $t0, -13888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9440
+    lui $t2, 0x1002
+    sw $t0, -13824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x21c0
+    lui $t2, 0x1002
+    sw $t0, -13760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb880
+    lui $t2, 0x1002
+    sw $t0, -13696($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x380
+    lui $t2, 0x1002
+    sw $t0, -13632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf880
+    lui $t2, 0x1002
+    sw $t0, -13568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf480
+    lui $t2, 0x1002
+    sw $t0, -13504($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9c40
+    lui $t2, 0x1002
+    sw $t0, -13440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf3c0
+    lui $t2, 0x1002
+    sw $t0, -13376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd900
+    lui $t2, 0x1002
+    sw $t0, -13312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd9c0
+    lui $t2, 0x1002
+    sw $t0, -13248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb40
+    lui $t2, 0x1002
+    sw $t0, -13184($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4800
+    lui $t2, 0x1002
+    sw $t0, -13120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d00
+    lui $t2, 0x1002
+    sw $t0, -13056($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3c00
+    lui $t2, 0x1002
+    sw $t0, -12992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb240
+    lui $t2, 0x1002
+    sw $t0, -12928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1100
+    lui $t2, 0x1002
+    sw $t0, -12864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5280
+    lui $t2, 0x1002
+    sw $t0, -12800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9180
+    lui $t2, 0x1002
+    sw $t0, -12736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6c40
+    lui $t2, 0x1002
+    sw $t0, -12672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd900
+    lui $t2, 0x1002
+    sw $t0, -12608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9540
+    lui $t2, 0x1002
+    sw $t0, -12544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb3c0
+    lui $t2, 0x1002
+    sw $t0, -12480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3b40
+    lui $t2, 0x1002
+    sw $t0, -12416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe00
+    lui $t2, 0x1002
+    sw $t0, -12352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1140
+    lui $t2, 0x1002
+    sw $t0, -12288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2700
+    lui $t2, 0x1002
+    sw $t0, -12224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3980
+    lui $t2, 0x1002
+    sw $t0, -12160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4880
+    lui $t2, 0x1002
+    sw $t0, -12096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1080
+    lui $t2, 0x1002
+    sw $t0, -12032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xeb40
+    lui $t2, 0x1002
+    sw $t0, -11968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1000
+    lui $t2, 0x1002
+    sw $t0, -11904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2dc0
+    lui $t2, 0x1002
+    sw $t0, -11840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbbc0
+    lui $t2, 0x1002
+    sw $t0, -11776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x180
+    lui $t2, 0x1002
+    sw $t0, -11712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5c00
+    lui $t2, 0x1002
+    sw $t0, -11648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcd40
+    lui $t2, 0x1002
+    sw $t0, -11584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6800
+    lui $t2, 0x1002
+    sw $t0, -11520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8e00
+    lui $t2, 0x1002
+    sw $t0, -11456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3700
+    lui $t2, 0x1002
+    sw $t0, -11392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa740
+    lui $t2, 0x1002
+    sw $t0, -11328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb000
+    lui $t2, 0x1002
+    sw $t0, -11264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf200
+    lui $t2, 0x1002
+    sw $t0, -11200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa340
+    lui $t2, 0x1002
+    sw $t0, -11136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x740
+    lui $t2, 0x1002
+    sw $t0, -11072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7540
+    lui $t2, 0x1002
+    sw $t0, -11008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5340
+    lui $t2, 0x1002
+    sw $t0, -10944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6880
+    lui $t2, 0x1002
+    sw $t0, -10880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x240
+    lui $t2, 0x1002
+    sw $t0, -10816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbb80
+    lui $t2, 0x1002
+    sw $t0, -10752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6a00
+    lui $t2, 0x1002
+    sw $t0, -10688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc80
+    lui $t2, 0x1002
+    sw $t0, -10624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfd80
+    lui $t2, 0x1002
+    sw $t0, -10560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2940
+    lui $t2, 0x1002
+    sw $t0, -10496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdc80
+    lui $t2, 0x1002
+    sw $t0, -10432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1740
+    lui $t2, 0x1002
+    sw $t0, -10368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8ec0
+    lui $t2, 0x1002
+    sw $t0, -10304($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4800
+    lui $t2, 0x1002
+    sw $t0, -10240($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x99c0
+    lui $t2, 0x1002
+    sw $t0, -10176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4440
+    lui $t2, 0x1002
+    sw $t0, -10112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcbc0
+    lui $t2, 0x1002
+    sw $t0, -10048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6380
+    lui $t2, 0x1002
+    sw $t0, -9984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9bc0
+    lui $t2, 0x1002
+    sw $t0, -9920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7280
+    lui $t2, 0x1002
+    sw $t0, -9856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2280
+    lui $t2, 0x1002
+    sw $t0, -9792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5180
+    lui $t2, 0x1002
+    sw $t0, -9728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbec0
+    lui $t2, 0x1002
+    sw $t0, -9664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaec0
+    lui $t2, 0x1002
+    sw $t0, -9600($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x500
+    lui $t2, 0x1002
+    sw $t0, -9536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd300
+    lui $t2, 0x1002
+    sw $t0, -9472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf040
+    lui $t2, 0x1002
+    sw $t0, -9408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7740
+    lui $t2, 0x1002
+    sw $t0, -9344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3b00
+    lui $t2, 0x1002
+    sw $t0, -9280($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf240
+    lui $t2, 0x1002
+    sw $t0, -9216($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x97c0
+    lui $t2, 0x1002
+    sw $t0, -9152($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x27c0
+    lui $t2, 0x1002
+    sw $t0, -9088($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x84c0
+    lui $t2, 0x1002
+    sw $t0, -9024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa200
+    lui $t2, 0x1002
+    sw $t0, -8960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd480
+    lui $t2, 0x1002
+    sw $t0, -8896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcf00
+    lui $t2, 0x1002
+    sw $t0, -8832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7f80
+    lui $t2, 0x1002
+    sw $t0, -8768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe480
+    lui $t2, 0x1002
+    sw $t0, -8704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8c40
+    lui $t2, 0x1002
+    sw $t0, -8640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xadc0
+    lui $t2, 0x1002
+    sw $t0, -8576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xec40
+    lui $t2, 0x1002
+    sw $t0, -8512($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd900
+    lui $t2, 0x1002
+    sw $t0, -8448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7940
+    lui $t2, 0x1002
+    sw $t0, -8384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfa80
+    lui $t2, 0x1002
+    sw $t0, -8320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6a00
+    lui $t2, 0x1002
+    sw $t0, -8256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd2c0
+    lui $t2, 0x1002
+    sw $t0, -8192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc0c0
+    lui $t2, 0x1002
+    sw $t0, -8128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd40
+    lui $t2, 0x1002
+    sw $t0, -8064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e80
+    lui $t2, 0x1002
+    sw $t0, -8000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5c80
+    lui $t2, 0x1002
+    sw $t0, -7936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x19c0
+    lui $t2, 0x1002
+    sw $t0, -7872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6780
+    lui $t2, 0x1002
+    sw $t0, -7808($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9240
+    lui $t2, 0x1002
+    sw $t0, -7744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6580
+    lui $t2, 0x1002
+    sw $t0, -7680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5b00
+    lui $t2, 0x1002
+    sw $t0, -7616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd880
+    lui $t2, 0x1002
+    sw $t0, -7552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd5c0
+    lui $t2, 0x1002
+    sw $t0, -7488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x91c0
+    lui $t2, 0x1002
+    sw $t0, -7424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe1c0
+    lui $t2, 0x1002
+    sw $t0, -7360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3080
+    lui $t2, 0x1002
+    sw $t0, -7296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcc80
+    lui $t2, 0x1002
+    sw $t0, -7232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x740
+    lui $t2, 0x1002
+    sw $t0, -7168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1b40
+    lui $t2, 0x1002
+    sw $t0, -7104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x77c0
+    lui $t2, 0x1002
+    sw $t0, -7040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc40
+    lui $t2, 0x1002
+    sw $t0, -6976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x49c0
+    lui $t2, 0x1002
+    sw $t0, -6912($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfc80
+    lui $t2, 0x1002
+    sw $t0, -6848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4580
+    lui $t2, 0x1002
+    sw $t0, -6784($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x940
+    lui $t2, 0x1002
+    sw $t0, -6720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x97c0
+    lui $t2, 0x1002
+    sw $t0, -6656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a80
+    lui $t2, 0x1002
+    sw $t0, -6592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9040
+    lui $t2, 0x1002
+    sw $t0, -6528($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6700
+    lui $t2, 0x1002
+    sw $t0, -6464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf280
+    lui $t2, 0x1002
+    sw $t0, -6400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4ec0
+    lui $t2, 0x1002
+    sw $t0, -6336($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1740
+    lui $t2, 0x1002
+    sw $t0, -6272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5280
+    lui $t2, 0x1002
+    sw $t0, -6208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc1c0
+    lui $t2, 0x1002
+    sw $t0, -6144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb6c0
+    lui $t2, 0x1002
+    sw $t0, -6080($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbd40
+    lui $t2, 0x1002
+    sw $t0, -6016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa380
+    lui $t2, 0x1002
+    sw $t0, -5952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9a40
+    lui $t2, 0x1002
+    sw $t0, -5888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe640
+    lui $t2, 0x1002
+    sw $t0, -5824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8640
+    lui $t2, 0x1002
+    sw $t0, -5760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7140
+    lui $t2, 0x1002
+    sw $t0, -5696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xff40
+    lui $t2, 0x1002
+    sw $t0, -5632($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdd00
+    lui $t2, 0x1002
+    sw $t0, -5568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbf80
+    lui $t2, 0x1002
+    sw $t0, -5504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4280
+    lui $t2, 0x1002
+    sw $t0, -5440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4b40
+    lui $t2, 0x1002
+    sw $t0, -5376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1e80
+    lui $t2, 0x1002
+    sw $t0, -5312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9f80
+    lui $t2, 0x1002
+    sw $t0, -5248($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1ec0
+    lui $t2, 0x1002
+    sw $t0, -5184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2380
+    lui $t2, 0x1002
+    sw $t0, -5120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa540
+    lui $t2, 0x1002
+    sw $t0, -5056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa800
+    lui $t2, 0x1002
+    sw $t0, -4992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3980
+    lui $t2, 0x1002
+    sw $t0, -4928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x640
+    lui $t2, 0x1002
+    sw $t0, -4864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb980
+    lui $t2, 0x1002
+    sw $t0, -4800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe9c0
+    lui $t2, 0x1002
+    sw $t0, -4736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc180
+    lui $t2, 0x1002
+    sw $t0, -4672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2a80
+    lui $t2, 0x1002
+    sw $t0, -4608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4d00
+    lui $t2, 0x1002
+    sw $t0, -4544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x18c0
+    lui $t2, 0x1002
+    sw $t0, -4480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4380
+    lui $t2, 0x1002
+    sw $t0, -4416($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8ec0
+    lui $t2, 0x1002
+    sw $t0, -4352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x50c0
+    lui $t2, 0x1002
+    sw $t0, -4288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7780
+    lui $t2, 0x1002
+    sw $t0, -4224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdd80
+    lui $t2, 0x1002
+    sw $t0, -4160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2400
+    lui $t2, 0x1002
+    sw $t0, -4096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2340
+    lui $t2, 0x1002
+    sw $t0, -4032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a00
+    lui $t2, 0x1002
+    sw $t0, -3968($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa780
+    lui $t2, 0x1002
+    sw $t0, -3904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6340
+    lui $t2, 0x1002
+    sw $t0, -3840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x540
+    lui $t2, 0x1002
+    sw $t0, -3776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x840
+    lui $t2, 0x1002
+    sw $t0, -3712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xef40
+    lui $t2, 0x1002
+    sw $t0, -3648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6980
+    lui $t2, 0x1002
+    sw $t0, -3584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xed40
+    lui $t2, 0x1002
+    sw $t0, -3520($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x93c0
+    lui $t2, 0x1002
+    sw $t0, -3456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7480
+    lui $t2, 0x1002
+    sw $t0, -3392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6200
+    lui $t2, 0x1002
+    sw $t0, -3328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x76c0
+    lui $t2, 0x1002
+    sw $t0, -3264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb940
+    lui $t2, 0x1002
+    sw $t0, -3200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6040
+    lui $t2, 0x1002
+    sw $t0, -3136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b80
+    lui $t2, 0x1002
+    sw $t0, -3072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcdc0
+    lui $t2, 0x1002
+    sw $t0, -3008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6fc0
+    lui $t2, 0x1002
+    sw $t0, -2944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8cc0
+    lui $t2, 0x1002
+    sw $t0, -2880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5700
+    lui $t2, 0x1002
+    sw $t0, -2816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x53c0
+    lui $t2, 0x1002
+    sw $t0, -2752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7b80
+    lui $t2, 0x1002
+    sw $t0, -2688($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf500
+    lui $t2, 0x1002
+    sw $t0, -2624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ac0
+    lui $t2, 0x1002
+    sw $t0, -2560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd6c0
+    lui $t2, 0x1002
+    sw $t0, -2496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7fc0
+    lui $t2, 0x1002
+    sw $t0, -2432($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6dc0
+    lui $t2, 0x1002
+    sw $t0, -2368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6200
+    lui $t2, 0x1002
+    sw $t0, -2304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdcc0
+    lui $t2, 0x1002
+    sw $t0, -2240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd540
+    lui $t2, 0x1002
+    sw $t0, -2176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1300
+    lui $t2, 0x1002
+    sw $t0, -2112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc040
+    lui $t2, 0x1002
+    sw $t0, -2048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc700
+    lui $t2, 0x1002
+    sw $t0, -1984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x27c0
+    lui $t2, 0x1002
+    sw $t0, -1920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4580
+    lui $t2, 0x1002
+    sw $t0, -1856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6c0
+    lui $t2, 0x1002
+    sw $t0, -1792($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7000
+    lui $t2, 0x1002
+    sw $t0, -1728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6480
+    lui $t2, 0x1002
+    sw $t0, -1664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4300
+    lui $t2, 0x1002
+    sw $t0, -1600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x16c0
+    lui $t2, 0x1002
+    sw $t0, -1536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xac80
+    lui $t2, 0x1002
+    sw $t0, -1472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x23c0
+    lui $t2, 0x1002
+    sw $t0, -1408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xac40
+    lui $t2, 0x1002
+    sw $t0, -1344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4080
+    lui $t2, 0x1002
+    sw $t0, -1280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5280
+    lui $t2, 0x1002
+    sw $t0, -1216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x78c0
+    lui $t2, 0x1002
+    sw $t0, -1152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf4c0
+    lui $t2, 0x1002
+    sw $t0, -1088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa080
+    lui $t2, 0x1002
+    sw $t0, -1024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5240
+    lui $t2, 0x1002
+    sw $t0, -960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x49c0
+    lui $t2, 0x1002
+    sw $t0, -896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5c00
+    lui $t2, 0x1002
+    sw $t0, -832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf200
+    lui $t2, 0x1002
+    sw $t0, -768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xefc0
+    lui $t2, 0x1002
+    sw $t0, -704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf700
+    lui $t2, 0x1002
+    sw $t0, -640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2f40
+    lui $t2, 0x1002
+    sw $t0, -576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x840
+    lui $t2, 0x1002
+    sw $t0, -512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd9c0
+    lui $t2, 0x1002
+    sw $t0, -448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2740
+    lui $t2, 0x1002
+    sw $t0, -384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdbc0
+    lui $t2, 0x1002
+    sw $t0, -320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4780
+    lui $t2, 0x1002
+    sw $t0, -256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9cc0
+    lui $t2, 0x1002
+    sw $t0, -192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x87c0
+    lui $t2, 0x1002
+    sw $t0, -128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c80
+    lui $t2, 0x1002
+    sw $t0, -64($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x440
+    lui $t2, 0x1002
+    sw $t0, 0($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9e80
+    lui $t2, 0x1002
+    sw $t0, 64($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6940
+    lui $t2, 0x1002
+    sw $t0, 128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x13c0
+    lui $t2, 0x1002
+    sw $t0, 192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd880
+    lui $t2, 0x1002
+    sw $t0, 256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe080
+    lui $t2, 0x1002
+    sw $t0, 320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd280
+    lui $t2, 0x1002
+    sw $t0, 384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc080
+    lui $t2, 0x1002
+    sw $t0, 448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfc40
+    lui $t2, 0x1002
+    sw $t0, 512($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8240
+    lui $t2, 0x1002
+    sw $t0, 576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xacc0
+    lui $t2, 0x1002
+    sw $t0, 640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5440
+    lui $t2, 0x1002
+    sw $t0, 704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd5c0
+    lui $t2, 0x1002
+    sw $t0, 768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbfc0
+    lui $t2, 0x1002
+    sw $t0, 832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc940
+    lui $t2, 0x1002
+    sw $t0, 896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9a80
+    lui $t2, 0x1002
+    sw $t0, 960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6e00
+    lui $t2, 0x1002
+    sw $t0, 1024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2f40
+    lui $t2, 0x1002
+    sw $t0, 1088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7500
+    lui $t2, 0x1002
+    sw $t0, 1152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8b00
+    lui $t2, 0x1002
+    sw $t0, 1216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc3c0
+    lui $t2, 0x1002
+    sw $t0, 1280($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd2c0
+    lui $t2, 0x1002
+    sw $t0, 1344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc380
+    lui $t2, 0x1002
+    sw $t0, 1408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9d80
+    lui $t2, 0x1002
+    sw $t0, 1472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdc80
+    lui $t2, 0x1002
+    sw $t0, 1536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x66c0
+    lui $t2, 0x1002
+    sw $t0, 1600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd1c0
+    lui $t2, 0x1002
+    sw $t0, 1664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfcc0
+    lui $t2, 0x1002
+    sw $t0, 1728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd9c0
+    lui $t2, 0x1002
+    sw $t0, 1792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7800
+    lui $t2, 0x1002
+    sw $t0, 1856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa840
+    lui $t2, 0x1002
+    sw $t0, 1920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2100
+    lui $t2, 0x1002
+    sw $t0, 1984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf340
+    lui $t2, 0x1002
+    sw $t0, 2048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2d80
+    lui $t2, 0x1002
+    sw $t0, 2112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1f40
+    lui $t2, 0x1002
+    sw $t0, 2176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa7c0
+    lui $t2, 0x1002
+    sw $t0, 2240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xee00
+    lui $t2, 0x1002
+    sw $t0, 2304($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7e00
+    lui $t2, 0x1002
+    sw $t0, 2368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f00
+    lui $t2, 0x1002
+    sw $t0, 2432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x61c0
+    lui $t2, 0x1002
+    sw $t0, 2496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1ec0
+    lui $t2, 0x1002
+    sw $t0, 2560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3f00
+    lui $t2, 0x1002
+    sw $t0, 2624($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xebc0
+    lui $t2, 0x1002
+    sw $t0, 2688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xde80
+    lui $t2, 0x1002
+    sw $t0, 2752($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe5c0
+    lui $t2, 0x1002
+    sw $t0, 2816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xea00
+    lui $t2, 0x1002
+    sw $t0, 2880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf3c0
+    lui $t2, 0x1002
+    sw $t0, 2944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbb80
+    lui $t2, 0x1002
+    sw $t0, 3008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdc0
+    lui $t2, 0x1002
+    sw $t0, 3072($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9d40
+    lui $t2, 0x1002
+    sw $t0, 3136($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x42c0
+    lui $t2, 0x1002
+    sw $t0, 3200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xee40
+    lui $t2, 0x1002
+    sw $t0, 3264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf680
+    lui $t2, 0x1002
+    sw $t0, 3328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d80
+    lui $t2, 0x1002
+    sw $t0, 3392($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6340
+    lui $t2, 0x1002
+    sw $t0, 3456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3b40
+    lui $t2, 0x1002
+    sw $t0, 3520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3c0
+    lui $t2, 0x1002
+    sw $t0, 3584($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9e40
+    lui $t2, 0x1002
+    sw $t0, 3648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6cc0
+    lui $t2, 0x1002
+    sw $t0, 3712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd680
+    lui $t2, 0x1002
+    sw $t0, 3776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d40
+    lui $t2, 0x1002
+    sw $t0, 3840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc600
+    lui $t2, 0x1002
+    sw $t0, 3904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8940
+    lui $t2, 0x1002
+    sw $t0, 3968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x840
+    lui $t2, 0x1002
+    sw $t0, 4032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xea00
+    lui $t2, 0x1002
+    sw $t0, 4096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9740
+    lui $t2, 0x1002
+    sw $t0, 4160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7000
+    lui $t2, 0x1002
+    sw $t0, 4224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaa80
+    lui $t2, 0x1002
+    sw $t0, 4288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc7c0
+    lui $t2, 0x1002
+    sw $t0, 4352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1380
+    lui $t2, 0x1002
+    sw $t0, 4416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6780
+    lui $t2, 0x1002
+    sw $t0, 4480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb580
+    lui $t2, 0x1002
+    sw $t0, 4544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2fc0
+    lui $t2, 0x1002
+    sw $t0, 4608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa440
+    lui $t2, 0x1002
+    sw $t0, 4672($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2b40
+    lui $t2, 0x1002
+    sw $t0, 4736($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6500
+    lui $t2, 0x1002
+    sw $t0, 4800($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf8c0
+    lui $t2, 0x1002
+    sw $t0, 4864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8480
+    lui $t2, 0x1002
+    sw $t0, 4928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf400
+    lui $t2, 0x1002
+    sw $t0, 4992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1880
+    lui $t2, 0x1002
+    sw $t0, 5056($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf300
+    lui $t2, 0x1002
+    sw $t0, 5120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa840
+    lui $t2, 0x1002
+    sw $t0, 5184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfdc0
+    lui $t2, 0x1002
+    sw $t0, 5248($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf6c0
+    lui $t2, 0x1002
+    sw $t0, 5312($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4140
+    lui $t2, 0x1002
+    sw $t0, 5376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xab40
+    lui $t2, 0x1002
+    sw $t0, 5440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa7c0
+    lui $t2, 0x1002
+    sw $t0, 5504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1640
+    lui $t2, 0x1002
+    sw $t0, 5568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8a00
+    lui $t2, 0x1002
+    sw $t0, 5632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf180
+    lui $t2, 0x1002
+    sw $t0, 5696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5ec0
+    lui $t2, 0x1002
+    sw $t0, 5760($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8dc0
+    lui $t2, 0x1002
+    sw $t0, 5824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3dc0
+    lui $t2, 0x1002
+    sw $t0, 5888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf780
+    lui $t2, 0x1002
+    sw $t0, 5952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x59c0
+    lui $t2, 0x1002
+    sw $t0, 6016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1880
+    lui $t2, 0x1002
+    sw $t0, 6080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcc00
+    lui $t2, 0x1002
+    sw $t0, 6144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x140
+    lui $t2, 0x1002
+    sw $t0, 6208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe4c0
+    lui $t2, 0x1002
+    sw $t0, 6272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6ac0
+    lui $t2, 0x1002
+    sw $t0, 6336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x29c0
+    lui $t2, 0x1002
+    sw $t0, 6400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1940
+    lui $t2, 0x1002
+    sw $t0, 6464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x79c0
+    lui $t2, 0x1002
+    sw $t0, 6528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e80
+    lui $t2, 0x1002
+    sw $t0, 6592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8280
+    lui $t2, 0x1002
+    sw $t0, 6656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2180
+    lui $t2, 0x1002
+    sw $t0, 6720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1bc0
+    lui $t2, 0x1002
+    sw $t0, 6784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdc40
+    lui $t2, 0x1002
+    sw $t0, 6848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7040
+    lui $t2, 0x1002
+    sw $t0, 6912($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd680
+    lui $t2, 0x1002
+    sw $t0, 6976($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf880
+    lui $t2, 0x1002
+    sw $t0, 7040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xca80
+    lui $t2, 0x1002
+    sw $t0, 7104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8c40
+    lui $t2, 0x1002
+    sw $t0, 7168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc4c0
+    lui $t2, 0x1002
+    sw $t0, 7232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1dc0
+    lui $t2, 0x1002
+    sw $t0, 7296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9e40
+    lui $t2, 0x1002
+    sw $t0, 7360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2980
+    lui $t2, 0x1002
+    sw $t0, 7424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe740
+    lui $t2, 0x1002
+    sw $t0, 7488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb600
+    lui $t2, 0x1002
+    sw $t0, 7552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ec0
+    lui $t2, 0x1002
+    sw $t0, 7616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4980
+    lui $t2, 0x1002
+    sw $t0, 7680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcb40
+    lui $t2, 0x1002
+    sw $t0, 7744($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1400
+    lui $t2, 0x1002
+    sw $t0, 7808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9e40
+    lui $t2, 0x1002
+    sw $t0, 7872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb00
+    lui $t2, 0x1002
+    sw $t0, 7936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6380
+    lui $t2, 0x1002
+    sw $t0, 8000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb8c0
+    lui $t2, 0x1002
+    sw $t0, 8064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xad00
+    lui $t2, 0x1002
+    sw $t0, 8128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf700
+    lui $t2, 0x1002
+    sw $t0, 8192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x81c0
+    lui $t2, 0x1002
+    sw $t0, 8256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7340
+    lui $t2, 0x1002
+    sw $t0, 8320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe080
+    lui $t2, 0x1002
+    sw $t0, 8384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5cc0
+    lui $t2, 0x1002
+    sw $t0, 8448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x67c0
+    lui $t2, 0x1002
+    sw $t0, 8512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1280
+    lui $t2, 0x1002
+    sw $t0, 8576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c00
+    lui $t2, 0x1002
+    sw $t0, 8640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x400
+    lui $t2, 0x1002
+    sw $t0, 8704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf940
+    lui $t2, 0x1002
+    sw $t0, 8768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9ac0
+    lui $t2, 0x1002
+    sw $t0, 8832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9a40
+    lui $t2, 0x1002
+    sw $t0, 8896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6740
+    lui $t2, 0x1002
+    sw $t0, 8960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbfc0
+    lui $t2, 0x1002
+    sw $t0, 9024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdfc0
+    lui $t2, 0x1002
+    sw $t0, 9088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xce00
+    lui $t2, 0x1002
+    sw $t0, 9152($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1b80
+    lui $t2, 0x1002
+    sw $t0, 9216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3340
+    lui $t2, 0x1002
+    sw $t0, 9280($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x14c0
+    lui $t2, 0x1002
+    sw $t0, 9344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xad00
+    lui $t2, 0x1002
+    sw $t0, 9408($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5940
+    lui $t2, 0x1002
+    sw $t0, 9472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e00
+    lui $t2, 0x1002
+    sw $t0, 9536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcc40
+    lui $t2, 0x1002
+    sw $t0, 9600($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5500
+    lui $t2, 0x1002
+    sw $t0, 9664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2480
+    lui $t2, 0x1002
+    sw $t0, 9728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa280
+    lui $t2, 0x1002
+    sw $t0, 9792($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfa40
+    lui $t2, 0x1002
+    sw $t0, 9856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xea00
+    lui $t2, 0x1002
+    sw $t0, 9920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc200
+    lui $t2, 0x1002
+    sw $t0, 9984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaac0
+    lui $t2, 0x1002
+    sw $t0, 10048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c0
+    lui $t2, 0x1002
+    sw $t0, 10112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc240
+    lui $t2, 0x1002
+    sw $t0, 10176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a40
+    lui $t2, 0x1002
+    sw $t0, 10240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3840
+    lui $t2, 0x1002
+    sw $t0, 10304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8a40
+    lui $t2, 0x1002
+    sw $t0, 10368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcc80
+    lui $t2, 0x1002
+    sw $t0, 10432($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdfc0
+    lui $t2, 0x1002
+    sw $t0, 10496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2780
+    lui $t2, 0x1002
+    sw $t0, 10560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x60c0
+    lui $t2, 0x1002
+    sw $t0, 10624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a00
+    lui $t2, 0x1002
+    sw $t0, 10688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c0
+    lui $t2, 0x1002
+    sw $t0, 10752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf1c0
+    lui $t2, 0x1002
+    sw $t0, 10816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9940
+    lui $t2, 0x1002
+    sw $t0, 10880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbbc0
+    lui $t2, 0x1002
+    sw $t0, 10944($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x85c0
+    lui $t2, 0x1002
+    sw $t0, 11008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa580
+    lui $t2, 0x1002
+    sw $t0, 11072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9800
+    lui $t2, 0x1002
+    sw $t0, 11136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa900
+    lui $t2, 0x1002
+    sw $t0, 11200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3a00
+    lui $t2, 0x1002
+    sw $t0, 11264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4340
+    lui $t2, 0x1002
+    sw $t0, 11328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbe00
+    lui $t2, 0x1002
+    sw $t0, 11392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x45c0
+    lui $t2, 0x1002
+    sw $t0, 11456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8fc0
+    lui $t2, 0x1002
+    sw $t0, 11520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe380
+    lui $t2, 0x1002
+    sw $t0, 11584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6780
+    lui $t2, 0x1002
+    sw $t0, 11648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe1c0
+    lui $t2, 0x1002
+    sw $t0, 11712($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb500
+    lui $t2, 0x1002
+    sw $t0, 11776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3e80
+    lui $t2, 0x1002
+    sw $t0, 11840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbe40
+    lui $t2, 0x1002
+    sw $t0, 11904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9140
+    lui $t2, 0x1002
+    sw $t0, 11968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcbc0
+    lui $t2, 0x1002
+    sw $t0, 12032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3940
+    lui $t2, 0x1002
+    sw $t0, 12096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3d80
+    lui $t2, 0x1002
+    sw $t0, 12160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbc40
+    lui $t2, 0x1002
+    sw $t0, 12224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9fc0
+    lui $t2, 0x1002
+    sw $t0, 12288($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd9c0
+    lui $t2, 0x1002
+    sw $t0, 12352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x64c0
+    lui $t2, 0x1002
+    sw $t0, 12416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4c00
+    lui $t2, 0x1002
+    sw $t0, 12480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8480
+    lui $t2, 0x1002
+    sw $t0, 12544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa340
+    lui $t2, 0x1002
+    sw $t0, 12608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7100
+    lui $t2, 0x1002
+    sw $t0, 12672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x83c0
+    lui $t2, 0x1002
+    sw $t0, 12736($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7800
+    lui $t2, 0x1002
+    sw $t0, 12800($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7280
+    lui $t2, 0x1002
+    sw $t0, 12864($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb880
+    lui $t2, 0x1002
+    sw $t0, 12928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf80
+    lui $t2, 0x1002
+    sw $t0, 12992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3440
+    lui $t2, 0x1002
+    sw $t0, 13056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8fc0
+    lui $t2, 0x1002
+    sw $t0, 13120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4880
+    lui $t2, 0x1002
+    sw $t0, 13184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b40
+    lui $t2, 0x1002
+    sw $t0, 13248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb580
+    lui $t2, 0x1002
+    sw $t0, 13312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xebc0
+    lui $t2, 0x1002
+    sw $t0, 13376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x31c0
+    lui $t2, 0x1002
+    sw $t0, 13440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x49c0
+    lui $t2, 0x1002
+    sw $t0, 13504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2300
+    lui $t2, 0x1002
+    sw $t0, 13568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc780
+    lui $t2, 0x1002
+    sw $t0, 13632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9980
+    lui $t2, 0x1002
+    sw $t0, 13696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3300
+    lui $t2, 0x1002
+    sw $t0, 13760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdd00
+    lui $t2, 0x1002
+    sw $t0, 13824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfbc0
+    lui $t2, 0x1002
+    sw $t0, 13888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9380
+    lui $t2, 0x1002
+    sw $t0, 13952($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6640
+    lui $t2, 0x1002
+    sw $t0, 14016($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3c40
+    lui $t2, 0x1002
+    sw $t0, 14080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb900
+    lui $t2, 0x1002
+    sw $t0, 14144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x11c0
+    lui $t2, 0x1002
+    sw $t0, 14208($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x47c0
+    lui $t2, 0x1002
+    sw $t0, 14272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd180
+    lui $t2, 0x1002
+    sw $t0, 14336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6540
+    lui $t2, 0x1002
+    sw $t0, 14400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3840
+    lui $t2, 0x1002
+    sw $t0, 14464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6140
+    lui $t2, 0x1002
+    sw $t0, 14528($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7b80
+    lui $t2, 0x1002
+    sw $t0, 14592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcb00
+    lui $t2, 0x1002
+    sw $t0, 14656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1480
+    lui $t2, 0x1002
+    sw $t0, 14720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdac0
+    lui $t2, 0x1002
+    sw $t0, 14784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaa80
+    lui $t2, 0x1002
+    sw $t0, 14848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2500
+    lui $t2, 0x1002
+    sw $t0, 14912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd100
+    lui $t2, 0x1002
+    sw $t0, 14976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x300
+    lui $t2, 0x1002
+    sw $t0, 15040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x86c0
+    lui $t2, 0x1002
+    sw $t0, 15104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4700
+    lui $t2, 0x1002
+    sw $t0, 15168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe8c0
+    lui $t2, 0x1002
+    sw $t0, 15232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x38c0
+    lui $t2, 0x1002
+    sw $t0, 15296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbc0
+    lui $t2, 0x1002
+    sw $t0, 15360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb180
+    lui $t2, 0x1002
+    sw $t0, 15424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9680
+    lui $t2, 0x1002
+    sw $t0, 15488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4240
+    lui $t2, 0x1002
+    sw $t0, 15552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xffc0
+    lui $t2, 0x1002
+    sw $t0, 15616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xce00
+    lui $t2, 0x1002
+    sw $t0, 15680($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x62c0
+    lui $t2, 0x1002
+    sw $t0, 15744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcb00
+    lui $t2, 0x1002
+    sw $t0, 15808($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5940
+    lui $t2, 0x1002
+    sw $t0, 15872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8c0
+    lui $t2, 0x1002
+    sw $t0, 15936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa1c0
+    lui $t2, 0x1002
+    sw $t0, 16000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9200
+    lui $t2, 0x1002
+    sw $t0, 16064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1c40
+    lui $t2, 0x1002
+    sw $t0, 16128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdcc0
+    lui $t2, 0x1002
+    sw $t0, 16192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdec0
+    lui $t2, 0x1002
+    sw $t0, 16256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc4c0
+    lui $t2, 0x1002
+    sw $t0, 16320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c40
+    lui $t2, 0x1002
+    sw $t0, 16384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xed80
+    lui $t2, 0x1002
+    sw $t0, 16448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe280
+    lui $t2, 0x1002
+    sw $t0, 16512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3340
+    lui $t2, 0x1002
+    sw $t0, 16576($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3ec0
+    lui $t2, 0x1002
+    sw $t0, 16640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb800
+    lui $t2, 0x1002
+    sw $t0, 16704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfcc0
+    lui $t2, 0x1002
+    sw $t0, 16768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9780
+    lui $t2, 0x1002
+    sw $t0, 16832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2ec0
+    lui $t2, 0x1002
+    sw $t0, 16896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4a40
+    lui $t2, 0x1002
+    sw $t0, 16960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xee00
+    lui $t2, 0x1002
+    sw $t0, 17024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6540
+    lui $t2, 0x1002
+    sw $t0, 17088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7f80
+    lui $t2, 0x1002
+    sw $t0, 17152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x76c0
+    lui $t2, 0x1002
+    sw $t0, 17216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xed40
+    lui $t2, 0x1002
+    sw $t0, 17280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe540
+    lui $t2, 0x1002
+    sw $t0, 17344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9c00
+    lui $t2, 0x1002
+    sw $t0, 17408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5100
+    lui $t2, 0x1002
+    sw $t0, 17472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaec0
+    lui $t2, 0x1002
+    sw $t0, 17536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2780
+    lui $t2, 0x1002
+    sw $t0, 17600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3380
+    lui $t2, 0x1002
+    sw $t0, 17664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2380
+    lui $t2, 0x1002
+    sw $t0, 17728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x54c0
+    lui $t2, 0x1002
+    sw $t0, 17792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2880
+    lui $t2, 0x1002
+    sw $t0, 17856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3fc0
+    lui $t2, 0x1002
+    sw $t0, 17920($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb040
+    lui $t2, 0x1002
+    sw $t0, 17984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9840
+    lui $t2, 0x1002
+    sw $t0, 18048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb180
+    lui $t2, 0x1002
+    sw $t0, 18112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x89c0
+    lui $t2, 0x1002
+    sw $t0, 18176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa800
+    lui $t2, 0x1002
+    sw $t0, 18240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xea00
+    lui $t2, 0x1002
+    sw $t0, 18304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7580
+    lui $t2, 0x1002
+    sw $t0, 18368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9a80
+    lui $t2, 0x1002
+    sw $t0, 18432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd600
+    lui $t2, 0x1002
+    sw $t0, 18496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xac40
+    lui $t2, 0x1002
+    sw $t0, 18560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6a40
+    lui $t2, 0x1002
+    sw $t0, 18624($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe80
+    lui $t2, 0x1002
+    sw $t0, 18688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xac80
+    lui $t2, 0x1002
+    sw $t0, 18752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x89c0
+    lui $t2, 0x1002
+    sw $t0, 18816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x94c0
+    lui $t2, 0x1002
+    sw $t0, 18880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe40
+    lui $t2, 0x1002
+    sw $t0, 18944($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xae40
+    lui $t2, 0x1002
+    sw $t0, 19008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7ec0
+    lui $t2, 0x1002
+    sw $t0, 19072($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3440
+    lui $t2, 0x1002
+    sw $t0, 19136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4f80
+    lui $t2, 0x1002
+    sw $t0, 19200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd2c0
+    lui $t2, 0x1002
+    sw $t0, 19264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa580
+    lui $t2, 0x1002
+    sw $t0, 19328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc3c0
+    lui $t2, 0x1002
+    sw $t0, 19392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x92c0
+    lui $t2, 0x1002
+    sw $t0, 19456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7d40
+    lui $t2, 0x1002
+    sw $t0, 19520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdc0
+    lui $t2, 0x1002
+    sw $t0, 19584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xff00
+    lui $t2, 0x1002
+    sw $t0, 19648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8200
+    lui $t2, 0x1002
+    sw $t0, 19712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 192
+    lui $t2, 0x1002
+    sw $t0, 19776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf800
+    lui $t2, 0x1002
+    sw $t0, 19840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb340
+    lui $t2, 0x1002
+    sw $t0, 19904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbc0
+    lui $t2, 0x1002
+    sw $t0, 19968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9c80
+    lui $t2, 0x1002
+    sw $t0, 20032($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcd00
+    lui $t2, 0x1002
+    sw $t0, 20096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf700
+    lui $t2, 0x1002
+    sw $t0, 20160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xeac0
+    lui $t2, 0x1002
+    sw $t0, 20224($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2540
+    lui $t2, 0x1002
+    sw $t0, 20288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2f80
+    lui $t2, 0x1002
+    sw $t0, 20352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xff40
+    lui $t2, 0x1002
+    sw $t0, 20416($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1900
+    lui $t2, 0x1002
+    sw $t0, 20480($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5f80
+    lui $t2, 0x1002
+    sw $t0, 20544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xab40
+    lui $t2, 0x1002
+    sw $t0, 20608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe2c0
+    lui $t2, 0x1002
+    sw $t0, 20672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6380
+    lui $t2, 0x1002
+    sw $t0, 20736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa9c0
+    lui $t2, 0x1002
+    sw $t0, 20800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8ec0
+    lui $t2, 0x1002
+    sw $t0, 20864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdbc0
+    lui $t2, 0x1002
+    sw $t0, 20928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8ac0
+    lui $t2, 0x1002
+    sw $t0, 20992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x84c0
+    lui $t2, 0x1002
+    sw $t0, 21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb9c0
+    lui $t2, 0x1002
+    sw $t0, 21120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d00
+    lui $t2, 0x1002
+    sw $t0, 21184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe080
+    lui $t2, 0x1002
+    sw $t0, 21248($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8540
+    lui $t2, 0x1002
+    sw $t0, 21312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc640
+    lui $t2, 0x1002
+    sw $t0, 21376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2ac0
+    lui $t2, 0x1002
+    sw $t0, 21440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5f40
+    lui $t2, 0x1002
+    sw $t0, 21504($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x47c0
+    lui $t2, 0x1002
+    sw $t0, 21568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9c80
+    lui $t2, 0x1002
+    sw $t0, 21632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe440
+    lui $t2, 0x1002
+    sw $t0, 21696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3bc0
+    lui $t2, 0x1002
+    sw $t0, 21760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5780
+    lui $t2, 0x1002
+    sw $t0, 21824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf140
+    lui $t2, 0x1002
+    sw $t0, 21888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfac0
+    lui $t2, 0x1002
+    sw $t0, 21952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6cc0
+    lui $t2, 0x1002
+    sw $t0, 22016($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9080
+    lui $t2, 0x1002
+    sw $t0, 22080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3400
+    lui $t2, 0x1002
+    sw $t0, 22144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xda80
+    lui $t2, 0x1002
+    sw $t0, 22208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1e40
+    lui $t2, 0x1002
+    sw $t0, 22272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb5c0
+    lui $t2, 0x1002
+    sw $t0, 22336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7f00
+    lui $t2, 0x1002
+    sw $t0, 22400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2e00
+    lui $t2, 0x1002
+    sw $t0, 22464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3ec0
+    lui $t2, 0x1002
+    sw $t0, 22528($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xab80
+    lui $t2, 0x1002
+    sw $t0, 22592($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc700
+    lui $t2, 0x1002
+    sw $t0, 22656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfb40
+    lui $t2, 0x1002
+    sw $t0, 22720($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2480
+    lui $t2, 0x1002
+    sw $t0, 22784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd40
+    lui $t2, 0x1002
+    sw $t0, 22848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3140
+    lui $t2, 0x1002
+    sw $t0, 22912($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2300
+    lui $t2, 0x1002
+    sw $t0, 22976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd180
+    lui $t2, 0x1002
+    sw $t0, 23040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3dc0
+    lui $t2, 0x1002
+    sw $t0, 23104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5ac0
+    lui $t2, 0x1002
+    sw $t0, 23168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf940
+    lui $t2, 0x1002
+    sw $t0, 23232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x380
+    lui $t2, 0x1002
+    sw $t0, 23296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9300
+    lui $t2, 0x1002
+    sw $t0, 23360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb1c0
+    lui $t2, 0x1002
+    sw $t0, 23424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8240
+    lui $t2, 0x1002
+    sw $t0, 23488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfd00
+    lui $t2, 0x1002
+    sw $t0, 23552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd380
+    lui $t2, 0x1002
+    sw $t0, 23616($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb340
+    lui $t2, 0x1002
+    sw $t0, 23680($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5a40
+    lui $t2, 0x1002
+    sw $t0, 23744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2700
+    lui $t2, 0x1002
+    sw $t0, 23808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xae80
+    lui $t2, 0x1002
+    sw $t0, 23872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xea80
+    lui $t2, 0x1002
+    sw $t0, 23936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbb80
+    lui $t2, 0x1002
+    sw $t0, 24000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2400
+    lui $t2, 0x1002
+    sw $t0, 24064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6ec0
+    lui $t2, 0x1002
+    sw $t0, 24128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xeb40
+    lui $t2, 0x1002
+    sw $t0, 24192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbd40
+    lui $t2, 0x1002
+    sw $t0, 24256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcd80
+    lui $t2, 0x1002
+    sw $t0, 24320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xabc0
+    lui $t2, 0x1002
+    sw $t0, 24384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x75c0
+    lui $t2, 0x1002
+    sw $t0, 24448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xad40
+    lui $t2, 0x1002
+    sw $t0, 24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8dc0
+    lui $t2, 0x1002
+    sw $t0, 24576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8cc0
+    lui $t2, 0x1002
+    sw $t0, 24640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5c0
+    lui $t2, 0x1002
+    sw $t0, 24704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5e00
+    lui $t2, 0x1002
+    sw $t0, 24768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdc00
+    lui $t2, 0x1002
+    sw $t0, 24832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbfc0
+    lui $t2, 0x1002
+    sw $t0, 24896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9600
+    lui $t2, 0x1002
+    sw $t0, 24960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7c40
+    lui $t2, 0x1002
+    sw $t0, 25024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbdc0
+    lui $t2, 0x1002
+    sw $t0, 25088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe800
+    lui $t2, 0x1002
+    sw $t0, 25152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3b00
+    lui $t2, 0x1002
+    sw $t0, 25216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2d00
+    lui $t2, 0x1002
+    sw $t0, 25280($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe800
+    lui $t2, 0x1002
+    sw $t0, 25344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5dc0
+    lui $t2, 0x1002
+    sw $t0, 25408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7200
+    lui $t2, 0x1002
+    sw $t0, 25472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7040
+    lui $t2, 0x1002
+    sw $t0, 25536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x38c0
+    lui $t2, 0x1002
+    sw $t0, 25600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5c40
+    lui $t2, 0x1002
+    sw $t0, 25664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa480
+    lui $t2, 0x1002
+    sw $t0, 25728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8b00
+    lui $t2, 0x1002
+    sw $t0, 25792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3e80
+    lui $t2, 0x1002
+    sw $t0, 25856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb380
+    lui $t2, 0x1002
+    sw $t0, 25920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8e40
+    lui $t2, 0x1002
+    sw $t0, 25984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6c80
+    lui $t2, 0x1002
+    sw $t0, 26048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7b00
+    lui $t2, 0x1002
+    sw $t0, 26112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4700
+    lui $t2, 0x1002
+    sw $t0, 26176($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd540
+    lui $t2, 0x1002
+    sw $t0, 26240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5440
+    lui $t2, 0x1002
+    sw $t0, 26304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9000
+    lui $t2, 0x1002
+    sw $t0, 26368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb9c0
+    lui $t2, 0x1002
+    sw $t0, 26432($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd8c0
+    lui $t2, 0x1002
+    sw $t0, 26496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdf40
+    lui $t2, 0x1002
+    sw $t0, 26560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4500
+    lui $t2, 0x1002
+    sw $t0, 26624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9740
+    lui $t2, 0x1002
+    sw $t0, 26688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x56c0
+    lui $t2, 0x1002
+    sw $t0, 26752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7980
+    lui $t2, 0x1002
+    sw $t0, 26816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7ac0
+    lui $t2, 0x1002
+    sw $t0, 26880($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x33c0
+    lui $t2, 0x1002
+    sw $t0, 26944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb640
+    lui $t2, 0x1002
+    sw $t0, 27008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3800
+    lui $t2, 0x1002
+    sw $t0, 27072($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd0c0
+    lui $t2, 0x1002
+    sw $t0, 27136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcac0
+    lui $t2, 0x1002
+    sw $t0, 27200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7840
+    lui $t2, 0x1002
+    sw $t0, 27264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd840
+    lui $t2, 0x1002
+    sw $t0, 27328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8cc0
+    lui $t2, 0x1002
+    sw $t0, 27392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3d40
+    lui $t2, 0x1002
+    sw $t0, 27456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa4c0
+    lui $t2, 0x1002
+    sw $t0, 27520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1a80
+    lui $t2, 0x1002
+    sw $t0, 27584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b40
+    lui $t2, 0x1002
+    sw $t0, 27648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd640
+    lui $t2, 0x1002
+    sw $t0, 27712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb480
+    lui $t2, 0x1002
+    sw $t0, 27776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e40
+    lui $t2, 0x1002
+    sw $t0, 27840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x97c0
+    lui $t2, 0x1002
+    sw $t0, 27904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfd00
+    lui $t2, 0x1002
+    sw $t0, 27968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf000
+    lui $t2, 0x1002
+    sw $t0, 28032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbdc0
+    lui $t2, 0x1002
+    sw $t0, 28096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xca00
+    lui $t2, 0x1002
+    sw $t0, 28160($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbb40
+    lui $t2, 0x1002
+    sw $t0, 28224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2000
+    lui $t2, 0x1002
+    sw $t0, 28288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbac0
+    lui $t2, 0x1002
+    sw $t0, 28352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4600
+    lui $t2, 0x1002
+    sw $t0, 28416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x33c0
+    lui $t2, 0x1002
+    sw $t0, 28480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7580
+    lui $t2, 0x1002
+    sw $t0, 28544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3140
+    lui $t2, 0x1002
+    sw $t0, 28608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6900
+    lui $t2, 0x1002
+    sw $t0, 28672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcfc0
+    lui $t2, 0x1002
+    sw $t0, 28736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7600
+    lui $t2, 0x1002
+    sw $t0, 28800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x900
+    lui $t2, 0x1002
+    sw $t0, 28864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd400
+    lui $t2, 0x1002
+    sw $t0, 28928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa00
+    lui $t2, 0x1002
+    sw $t0, 28992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x11c0
+    lui $t2, 0x1002
+    sw $t0, 29056($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5ac0
+    lui $t2, 0x1002
+    sw $t0, 29120($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3e00
+    lui $t2, 0x1002
+    sw $t0, 29184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2d80
+    lui $t2, 0x1002
+    sw $t0, 29248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xad40
+    lui $t2, 0x1002
+    sw $t0, 29312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb600
+    lui $t2, 0x1002
+    sw $t0, 29376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4d40
+    lui $t2, 0x1002
+    sw $t0, 29440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2580
+    lui $t2, 0x1002
+    sw $t0, 29504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8f40
+    lui $t2, 0x1002
+    sw $t0, 29568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4f80
+    lui $t2, 0x1002
+    sw $t0, 29632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe580
+    lui $t2, 0x1002
+    sw $t0, 29696($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe480
+    lui $t2, 0x1002
+    sw $t0, 29760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd8c0
+    lui $t2, 0x1002
+    sw $t0, 29824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2b00
+    lui $t2, 0x1002
+    sw $t0, 29888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xab00
+    lui $t2, 0x1002
+    sw $t0, 29952($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xef40
+    lui $t2, 0x1002
+    sw $t0, 30016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf440
+    lui $t2, 0x1002
+    sw $t0, 30080($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x64c0
+    lui $t2, 0x1002
+    sw $t0, 30144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7580
+    lui $t2, 0x1002
+    sw $t0, 30208($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4580
+    lui $t2, 0x1002
+    sw $t0, 30272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7e40
+    lui $t2, 0x1002
+    sw $t0, 30336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9d80
+    lui $t2, 0x1002
+    sw $t0, 30400($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3a40
+    lui $t2, 0x1002
+    sw $t0, 30464($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9ec0
+    lui $t2, 0x1002
+    sw $t0, 30528($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb0c0
+    lui $t2, 0x1002
+    sw $t0, 30592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe0c0
+    lui $t2, 0x1002
+    sw $t0, 30656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x22c0
+    lui $t2, 0x1002
+    sw $t0, 30720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xde00
+    lui $t2, 0x1002
+    sw $t0, 30784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xef80
+    lui $t2, 0x1002
+    sw $t0, 30848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2400
+    lui $t2, 0x1002
+    sw $t0, 30912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf40
+    lui $t2, 0x1002
+    sw $t0, 30976($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd040
+    lui $t2, 0x1002
+    sw $t0, 31040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4e80
+    lui $t2, 0x1002
+    sw $t0, 31104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xee00
+    lui $t2, 0x1002
+    sw $t0, 31168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4dc0
+    lui $t2, 0x1002
+    sw $t0, 31232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf480
+    lui $t2, 0x1002
+    sw $t0, 31296($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa6c0
+    lui $t2, 0x1002
+    sw $t0, 31360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa500
+    lui $t2, 0x1002
+    sw $t0, 31424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcc40
+    lui $t2, 0x1002
+    sw $t0, 31488($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1bc0
+    lui $t2, 0x1002
+    sw $t0, 31552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7400
+    lui $t2, 0x1002
+    sw $t0, 31616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7a80
+    lui $t2, 0x1002
+    sw $t0, 31680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1700
+    lui $t2, 0x1002
+    sw $t0, 31744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfa00
+    lui $t2, 0x1002
+    sw $t0, 31808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf640
+    lui $t2, 0x1002
+    sw $t0, 31872($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5840
+    lui $t2, 0x1002
+    sw $t0, 31936($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9000
+    lui $t2, 0x1002
+    sw $t0, 32000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1100
+    lui $t2, 0x1002
+    sw $t0, 32064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6100
+    lui $t2, 0x1002
+    sw $t0, 32128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7380
+    lui $t2, 0x1002
+    sw $t0, 32192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd100
+    lui $t2, 0x1002
+    sw $t0, 32256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe00
+    lui $t2, 0x1002
+    sw $t0, 32320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2940
+    lui $t2, 0x1002
+    sw $t0, 32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa040
+    lui $t2, 0x1002
+    sw $t0, 32448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3000
+    lui $t2, 0x1002
+    sw $t0, 32512($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8ec0
+    lui $t2, 0x1002
+    sw $t0, 32576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xabc0
+    lui $t2, 0x1002
+    sw $t0, 32640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xff00
+    lui $t2, 0x1002
+    sw $t0, 32704($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3080
+    lui $t2, 0x1003
+    sw $t0, -32768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4000
+    lui $t2, 0x1003
+    sw $t0, -32704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaa00
+    lui $t2, 0x1003
+    sw $t0, -32640($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe600
+    lui $t2, 0x1003
+    sw $t0, -32576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a80
+    lui $t2, 0x1003
+    sw $t0, -32512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8300
+    lui $t2, 0x1003
+    sw $t0, -32448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf440
+    lui $t2, 0x1003
+    sw $t0, -32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f80
+    lui $t2, 0x1003
+    sw $t0, -32320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbe40
+    lui $t2, 0x1003
+    sw $t0, -32256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa2c0
+    lui $t2, 0x1003
+    sw $t0, -32192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6880
+    lui $t2, 0x1003
+    sw $t0, -32128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1fc0
+    lui $t2, 0x1003
+    sw $t0, -32064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b80
+    lui $t2, 0x1003
+    sw $t0, -32000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4cc0
+    lui $t2, 0x1003
+    sw $t0, -31936($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x73c0
+    lui $t2, 0x1003
+    sw $t0, -31872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9400
+    lui $t2, 0x1003
+    sw $t0, -31808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5740
+    lui $t2, 0x1003
+    sw $t0, -31744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb840
+    lui $t2, 0x1003
+    sw $t0, -31680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbe80
+    lui $t2, 0x1003
+    sw $t0, -31616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6900
+    lui $t2, 0x1003
+    sw $t0, -31552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6840
+    lui $t2, 0x1003
+    sw $t0, -31488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6940
+    lui $t2, 0x1003
+    sw $t0, -31424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6fc0
+    lui $t2, 0x1003
+    sw $t0, -31360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9c0
+    lui $t2, 0x1003
+    sw $t0, -31296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe200
+    lui $t2, 0x1003
+    sw $t0, -31232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa3c0
+    lui $t2, 0x1003
+    sw $t0, -31168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x69c0
+    lui $t2, 0x1003
+    sw $t0, -31104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5500
+    lui $t2, 0x1003
+    sw $t0, -31040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4d80
+    lui $t2, 0x1003
+    sw $t0, -30976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd200
+    lui $t2, 0x1003
+    sw $t0, -30912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4480
+    lui $t2, 0x1003
+    sw $t0, -30848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa3c0
+    lui $t2, 0x1003
+    sw $t0, -30784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1540
+    lui $t2, 0x1003
+    sw $t0, -30720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3040
+    lui $t2, 0x1003
+    sw $t0, -30656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6fc0
+    lui $t2, 0x1003
+    sw $t0, -30592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd140
+    lui $t2, 0x1003
+    sw $t0, -30528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa000
+    lui $t2, 0x1003
+    sw $t0, -30464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7280
+    lui $t2, 0x1003
+    sw $t0, -30400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6440
+    lui $t2, 0x1003
+    sw $t0, -30336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x12c0
+    lui $t2, 0x1003
+    sw $t0, -30272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6140
+    lui $t2, 0x1003
+    sw $t0, -30208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc200
+    lui $t2, 0x1003
+    sw $t0, -30144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8440
+    lui $t2, 0x1003
+    sw $t0, -30080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xeb40
+    lui $t2, 0x1003
+    sw $t0, -30016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x32c0
+    lui $t2, 0x1003
+    sw $t0, -29952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9bc0
+    lui $t2, 0x1003
+    sw $t0, -29888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d80
+    lui $t2, 0x1003
+    sw $t0, -29824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6740
+    lui $t2, 0x1003
+    sw $t0, -29760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x300
+    lui $t2, 0x1003
+    sw $t0, -29696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x72c0
+    lui $t2, 0x1003
+    sw $t0, -29632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xde80
+    lui $t2, 0x1003
+    sw $t0, -29568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd440
+    lui $t2, 0x1003
+    sw $t0, -29504($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xffc0
+    lui $t2, 0x1003
+    sw $t0, -29440($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd80
+    lui $t2, 0x1003
+    sw $t0, -29376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd680
+    lui $t2, 0x1003
+    sw $t0, -29312($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3dc0
+    lui $t2, 0x1003
+    sw $t0, -29248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x43c0
+    lui $t2, 0x1003
+    sw $t0, -29184($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfec0
+    lui $t2, 0x1003
+    sw $t0, -29120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf400
+    lui $t2, 0x1003
+    sw $t0, -29056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x40c0
+    lui $t2, 0x1003
+    sw $t0, -28992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xea40
+    lui $t2, 0x1003
+    sw $t0, -28928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa5c0
+    lui $t2, 0x1003
+    sw $t0, -28864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xeec0
+    lui $t2, 0x1003
+    sw $t0, -28800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfdc0
+    lui $t2, 0x1003
+    sw $t0, -28736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xad00
+    lui $t2, 0x1003
+    sw $t0, -28672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc00
+    lui $t2, 0x1003
+    sw $t0, -28608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf540
+    lui $t2, 0x1003
+    sw $t0, -28544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xefc0
+    lui $t2, 0x1003
+    sw $t0, -28480($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8a80
+    lui $t2, 0x1003
+    sw $t0, -28416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa40
+    lui $t2, 0x1003
+    sw $t0, -28352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x32c0
+    lui $t2, 0x1003
+    sw $t0, -28288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb080
+    lui $t2, 0x1003
+    sw $t0, -28224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6140
+    lui $t2, 0x1003
+    sw $t0, -28160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xacc0
+    lui $t2, 0x1003
+    sw $t0, -28096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1340
+    lui $t2, 0x1003
+    sw $t0, -28032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdec0
+    lui $t2, 0x1003
+    sw $t0, -27968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4c40
+    lui $t2, 0x1003
+    sw $t0, -27904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4580
+    lui $t2, 0x1003
+    sw $t0, -27840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7680
+    lui $t2, 0x1003
+    sw $t0, -27776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3880
+    lui $t2, 0x1003
+    sw $t0, -27712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a40
+    lui $t2, 0x1003
+    sw $t0, -27648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4380
+    lui $t2, 0x1003
+    sw $t0, -27584($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x780
+    lui $t2, 0x1003
+    sw $t0, -27520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2c40
+    lui $t2, 0x1003
+    sw $t0, -27456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc00
+    lui $t2, 0x1003
+    sw $t0, -27392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ac0
+    lui $t2, 0x1003
+    sw $t0, -27328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9b00
+    lui $t2, 0x1003
+    sw $t0, -27264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa400
+    lui $t2, 0x1003
+    sw $t0, -27200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2c40
+    lui $t2, 0x1003
+    sw $t0, -27136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x50c0
+    lui $t2, 0x1003
+    sw $t0, -27072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7680
+    lui $t2, 0x1003
+    sw $t0, -27008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9340
+    lui $t2, 0x1003
+    sw $t0, -26944($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xee40
+    lui $t2, 0x1003
+    sw $t0, -26880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7400
+    lui $t2, 0x1003
+    sw $t0, -26816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa040
+    lui $t2, 0x1003
+    sw $t0, -26752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa000
+    lui $t2, 0x1003
+    sw $t0, -26688($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1780
+    lui $t2, 0x1003
+    sw $t0, -26624($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1880
+    lui $t2, 0x1003
+    sw $t0, -26560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe940
+    lui $t2, 0x1003
+    sw $t0, -26496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa40
+    lui $t2, 0x1003
+    sw $t0, -26432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe5c0
+    lui $t2, 0x1003
+    sw $t0, -26368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a40
+    lui $t2, 0x1003
+    sw $t0, -26304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd340
+    lui $t2, 0x1003
+    sw $t0, -26240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdb80
+    lui $t2, 0x1003
+    sw $t0, -26176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb100
+    lui $t2, 0x1003
+    sw $t0, -26112($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3840
+    lui $t2, 0x1003
+    sw $t0, -26048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9880
+    lui $t2, 0x1003
+    sw $t0, -25984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x33c0
+    lui $t2, 0x1003
+    sw $t0, -25920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x42c0
+    lui $t2, 0x1003
+    sw $t0, -25856($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe3c0
+    lui $t2, 0x1003
+    sw $t0, -25792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8f00
+    lui $t2, 0x1003
+    sw $t0, -25728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd4c0
+    lui $t2, 0x1003
+    sw $t0, -25664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xda00
+    lui $t2, 0x1003
+    sw $t0, -25600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8500
+    lui $t2, 0x1003
+    sw $t0, -25536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3f40
+    lui $t2, 0x1003
+    sw $t0, -25472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3040
+    lui $t2, 0x1003
+    sw $t0, -25408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4900
+    lui $t2, 0x1003
+    sw $t0, -25344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe9c0
+    lui $t2, 0x1003
+    sw $t0, -25280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1400
+    lui $t2, 0x1003
+    sw $t0, -25216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbd80
+    lui $t2, 0x1003
+    sw $t0, -25152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2bc0
+    lui $t2, 0x1003
+    sw $t0, -25088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6ac0
+    lui $t2, 0x1003
+    sw $t0, -25024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd240
+    lui $t2, 0x1003
+    sw $t0, -24960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6c0
+    lui $t2, 0x1003
+    sw $t0, -24896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3540
+    lui $t2, 0x1003
+    sw $t0, -24832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcec0
+    lui $t2, 0x1003
+    sw $t0, -24768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xffc0
+    lui $t2, 0x1003
+    sw $t0, -24704($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3180
+    lui $t2, 0x1003
+    sw $t0, -24640($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x12c0
+    lui $t2, 0x1003
+    sw $t0, -24576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe7c0
+    lui $t2, 0x1003
+    sw $t0, -24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xac40
+    lui $t2, 0x1003
+    sw $t0, -24448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x44c0
+    lui $t2, 0x1003
+    sw $t0, -24384($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1b40
+    lui $t2, 0x1003
+    sw $t0, -24320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa300
+    lui $t2, 0x1003
+    sw $t0, -24256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa140
+    lui $t2, 0x1003
+    sw $t0, -24192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ac0
+    lui $t2, 0x1003
+    sw $t0, -24128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b80
+    lui $t2, 0x1003
+    sw $t0, -24064($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8a40
+    lui $t2, 0x1003
+    sw $t0, -24000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2e80
+    lui $t2, 0x1003
+    sw $t0, -23936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1800
+    lui $t2, 0x1003
+    sw $t0, -23872($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf780
+    lui $t2, 0x1003
+    sw $t0, -23808($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x13c0
+    lui $t2, 0x1003
+    sw $t0, -23744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe640
+    lui $t2, 0x1003
+    sw $t0, -23680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4900
+    lui $t2, 0x1003
+    sw $t0, -23616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc480
+    lui $t2, 0x1003
+    sw $t0, -23552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9d80
+    lui $t2, 0x1003
+    sw $t0, -23488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7900
+    lui $t2, 0x1003
+    sw $t0, -23424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfa40
+    lui $t2, 0x1003
+    sw $t0, -23360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb200
+    lui $t2, 0x1003
+    sw $t0, -23296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7040
+    lui $t2, 0x1003
+    sw $t0, -23232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6040
+    lui $t2, 0x1003
+    sw $t0, -23168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe040
+    lui $t2, 0x1003
+    sw $t0, -23104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaa00
+    lui $t2, 0x1003
+    sw $t0, -23040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7300
+    lui $t2, 0x1003
+    sw $t0, -22976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb280
+    lui $t2, 0x1003
+    sw $t0, -22912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9dc0
+    lui $t2, 0x1003
+    sw $t0, -22848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5ec0
+    lui $t2, 0x1003
+    sw $t0, -22784($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7c80
+    lui $t2, 0x1003
+    sw $t0, -22720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdac0
+    lui $t2, 0x1003
+    sw $t0, -22656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc180
+    lui $t2, 0x1003
+    sw $t0, -22592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e00
+    lui $t2, 0x1003
+    sw $t0, -22528($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc600
+    lui $t2, 0x1003
+    sw $t0, -22464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb500
+    lui $t2, 0x1003
+    sw $t0, -22400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa880
+    lui $t2, 0x1003
+    sw $t0, -22336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x94c0
+    lui $t2, 0x1003
+    sw $t0, -22272($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x980
+    lui $t2, 0x1003
+    sw $t0, -22208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb640
+    lui $t2, 0x1003
+    sw $t0, -22144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8200
+    lui $t2, 0x1003
+    sw $t0, -22080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b00
+    lui $t2, 0x1003
+    sw $t0, -22016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbc80
+    lui $t2, 0x1003
+    sw $t0, -21952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4900
+    lui $t2, 0x1003
+    sw $t0, -21888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x81c0
+    lui $t2, 0x1003
+    sw $t0, -21824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4e40
+    lui $t2, 0x1003
+    sw $t0, -21760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf5c0
+    lui $t2, 0x1003
+    sw $t0, -21696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xca40
+    lui $t2, 0x1003
+    sw $t0, -21632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8c40
+    lui $t2, 0x1003
+    sw $t0, -21568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdc00
+    lui $t2, 0x1003
+    sw $t0, -21504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5940
+    lui $t2, 0x1003
+    sw $t0, -21440($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4d00
+    lui $t2, 0x1003
+    sw $t0, -21376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6880
+    lui $t2, 0x1003
+    sw $t0, -21312($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7b00
+    lui $t2, 0x1003
+    sw $t0, -21248($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb8c0
+    lui $t2, 0x1003
+    sw $t0, -21184($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8d80
+    lui $t2, 0x1003
+    sw $t0, -21120($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xba00
+    lui $t2, 0x1003
+    sw $t0, -21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1240
+    lui $t2, 0x1003
+    sw $t0, -20992($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8240
+    lui $t2, 0x1003
+    sw $t0, -20928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa440
+    lui $t2, 0x1003
+    sw $t0, -20864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7480
+    lui $t2, 0x1003
+    sw $t0, -20800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x26c0
+    lui $t2, 0x1003
+    sw $t0, -20736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3900
+    lui $t2, 0x1003
+    sw $t0, -20672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x880
+    lui $t2, 0x1003
+    sw $t0, -20608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfa80
+    lui $t2, 0x1003
+    sw $t0, -20544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbb00
+    lui $t2, 0x1003
+    sw $t0, -20480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1380
+    lui $t2, 0x1003
+    sw $t0, -20416($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3740
+    lui $t2, 0x1003
+    sw $t0, -20352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2200
+    lui $t2, 0x1003
+    sw $t0, -20288($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1ac0
+    lui $t2, 0x1003
+    sw $t0, -20224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd4c0
+    lui $t2, 0x1003
+    sw $t0, -20160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5e00
+    lui $t2, 0x1003
+    sw $t0, -20096($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3540
+    lui $t2, 0x1003
+    sw $t0, -20032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbd00
+    lui $t2, 0x1003
+    sw $t0, -19968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xeb40
+    lui $t2, 0x1003
+    sw $t0, -19904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4b40
+    lui $t2, 0x1003
+    sw $t0, -19840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1a80
+    lui $t2, 0x1003
+    sw $t0, -19776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6440
+    lui $t2, 0x1003
+    sw $t0, -19712($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9480
+    lui $t2, 0x1003
+    sw $t0, -19648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3700
+    lui $t2, 0x1003
+    sw $t0, -19584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2100
+    lui $t2, 0x1003
+    sw $t0, -19520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9400
+    lui $t2, 0x1003
+    sw $t0, -19456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc200
+    lui $t2, 0x1003
+    sw $t0, -19392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2000
+    lui $t2, 0x1003
+    sw $t0, -19328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbc80
+    lui $t2, 0x1003
+    sw $t0, -19264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xac00
+    lui $t2, 0x1003
+    sw $t0, -19200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xec80
+    lui $t2, 0x1003
+    sw $t0, -19136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb780
+    lui $t2, 0x1003
+    sw $t0, -19072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x340
+    lui $t2, 0x1003
+    sw $t0, -19008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6bc0
+    lui $t2, 0x1003
+    sw $t0, -18944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7800
+    lui $t2, 0x1003
+    sw $t0, -18880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x680
+    lui $t2, 0x1003
+    sw $t0, -18816($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9f80
+    lui $t2, 0x1003
+    sw $t0, -18752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c0
+    lui $t2, 0x1003
+    sw $t0, -18688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7780
+    lui $t2, 0x1003
+    sw $t0, -18624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5d40
+    lui $t2, 0x1003
+    sw $t0, -18560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe40
+    lui $t2, 0x1003
+    sw $t0, -18496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf140
+    lui $t2, 0x1003
+    sw $t0, -18432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xad80
+    lui $t2, 0x1003
+    sw $t0, -18368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcf40
+    lui $t2, 0x1003
+    sw $t0, -18304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc480
+    lui $t2, 0x1003
+    sw $t0, -18240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1600
+    lui $t2, 0x1003
+    sw $t0, -18176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbf40
+    lui $t2, 0x1003
+    sw $t0, -18112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3880
+    lui $t2, 0x1003
+    sw $t0, -18048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa040
+    lui $t2, 0x1003
+    sw $t0, -17984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4c40
+    lui $t2, 0x1003
+    sw $t0, -17920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1c0
+    lui $t2, 0x1003
+    sw $t0, -17856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4200
+    lui $t2, 0x1003
+    sw $t0, -17792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2e40
+    lui $t2, 0x1003
+    sw $t0, -17728($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5a40
+    lui $t2, 0x1003
+    sw $t0, -17664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbcc0
+    lui $t2, 0x1003
+    sw $t0, -17600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1980
+    lui $t2, 0x1003
+    sw $t0, -17536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf3c0
+    lui $t2, 0x1003
+    sw $t0, -17472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x100
+    lui $t2, 0x1003
+    sw $t0, -17408($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe900
+    lui $t2, 0x1003
+    sw $t0, -17344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xeb80
+    lui $t2, 0x1003
+    sw $t0, -17280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xee80
+    lui $t2, 0x1003
+    sw $t0, -17216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd340
+    lui $t2, 0x1003
+    sw $t0, -17152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3a00
+    lui $t2, 0x1003
+    sw $t0, -17088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa540
+    lui $t2, 0x1003
+    sw $t0, -17024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3280
+    lui $t2, 0x1003
+    sw $t0, -16960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7180
+    lui $t2, 0x1003
+    sw $t0, -16896($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbc00
+    lui $t2, 0x1003
+    sw $t0, -16832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6480
+    lui $t2, 0x1003
+    sw $t0, -16768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbdc0
+    lui $t2, 0x1003
+    sw $t0, -16704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8680
+    lui $t2, 0x1003
+    sw $t0, -16640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaf80
+    lui $t2, 0x1003
+    sw $t0, -16576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfb00
+    lui $t2, 0x1003
+    sw $t0, -16512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9ac0
+    lui $t2, 0x1003
+    sw $t0, -16448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x80c0
+    lui $t2, 0x1003
+    sw $t0, -16384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3200
+    lui $t2, 0x1003
+    sw $t0, -16320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6f00
+    lui $t2, 0x1003
+    sw $t0, -16256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7fc0
+    lui $t2, 0x1003
+    sw $t0, -16192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd200
+    lui $t2, 0x1003
+    sw $t0, -16128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7dc0
+    lui $t2, 0x1003
+    sw $t0, -16064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8b40
+    lui $t2, 0x1003
+    sw $t0, -16000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7540
+    lui $t2, 0x1003
+    sw $t0, -15936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1780
+    lui $t2, 0x1003
+    sw $t0, -15872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfc40
+    lui $t2, 0x1003
+    sw $t0, -15808($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4bc0
+    lui $t2, 0x1003
+    sw $t0, -15744($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x20c0
+    lui $t2, 0x1003
+    sw $t0, -15680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf280
+    lui $t2, 0x1003
+    sw $t0, -15616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa5c0
+    lui $t2, 0x1003
+    sw $t0, -15552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaf00
+    lui $t2, 0x1003
+    sw $t0, -15488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x200
+    lui $t2, 0x1003
+    sw $t0, -15424($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd740
+    lui $t2, 0x1003
+    sw $t0, -15360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf980
+    lui $t2, 0x1003
+    sw $t0, -15296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4000
+    lui $t2, 0x1003
+    sw $t0, -15232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3840
+    lui $t2, 0x1003
+    sw $t0, -15168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4ac0
+    lui $t2, 0x1003
+    sw $t0, -15104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd7c0
+    lui $t2, 0x1003
+    sw $t0, -15040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xec80
+    lui $t2, 0x1003
+    sw $t0, -14976($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x15c0
+    lui $t2, 0x1003
+    sw $t0, -14912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf500
+    lui $t2, 0x1003
+    sw $t0, -14848($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4000
+    lui $t2, 0x1003
+    sw $t0, -14784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x46c0
+    lui $t2, 0x1003
+    sw $t0, -14720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x65c0
+    lui $t2, 0x1003
+    sw $t0, -14656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe040
+    lui $t2, 0x1003
+    sw $t0, -14592($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcf80
+    lui $t2, 0x1003
+    sw $t0, -14528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa180
+    lui $t2, 0x1003
+    sw $t0, -14464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3100
+    lui $t2, 0x1003
+    sw $t0, -14400($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2e00
+    lui $t2, 0x1003
+    sw $t0, -14336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1300
+    lui $t2, 0x1003
+    sw $t0, -14272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb1c0
+    lui $t2, 0x1003
+    sw $t0, -14208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x240
+    lui $t2, 0x1003
+    sw $t0, -14144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdec0
+    lui $t2, 0x1003
+    sw $t0, -14080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2140
+    lui $t2, 0x1003
+    sw $t0, -14016($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa400
+    lui $t2, 0x1003
+    sw $t0, -13952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9400
+    lui $t2, 0x1003
+    sw $t0, -13888($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x83c0
+    lui $t2, 0x1003
+    sw $t0, -13824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1240
+    lui $t2, 0x1003
+    sw $t0, -13760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4a80
+    lui $t2, 0x1003
+    sw $t0, -13696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe6c0
+    lui $t2, 0x1003
+    sw $t0, -13632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf40
+    lui $t2, 0x1003
+    sw $t0, -13568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb400
+    lui $t2, 0x1003
+    sw $t0, -13504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf000
+    lui $t2, 0x1003
+    sw $t0, -13440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3380
+    lui $t2, 0x1003
+    sw $t0, -13376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4cc0
+    lui $t2, 0x1003
+    sw $t0, -13312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7e80
+    lui $t2, 0x1003
+    sw $t0, -13248($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xef80
+    lui $t2, 0x1003
+    sw $t0, -13184($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3280
+    lui $t2, 0x1003
+    sw $t0, -13120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1580
+    lui $t2, 0x1003
+    sw $t0, -13056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbf40
+    lui $t2, 0x1003
+    sw $t0, -12992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xeb00
+    lui $t2, 0x1003
+    sw $t0, -12928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd100
+    lui $t2, 0x1003
+    sw $t0, -12864($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6500
+    lui $t2, 0x1003
+    sw $t0, -12800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa940
+    lui $t2, 0x1003
+    sw $t0, -12736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7980
+    lui $t2, 0x1003
+    sw $t0, -12672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5640
+    lui $t2, 0x1003
+    sw $t0, -12608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2800
+    lui $t2, 0x1003
+    sw $t0, -12544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x400
+    lui $t2, 0x1003
+    sw $t0, -12480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd1c0
+    lui $t2, 0x1003
+    sw $t0, -12416($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5e80
+    lui $t2, 0x1003
+    sw $t0, -12352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8800
+    lui $t2, 0x1003
+    sw $t0, -12288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbe80
+    lui $t2, 0x1003
+    sw $t0, -12224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3c00
+    lui $t2, 0x1003
+    sw $t0, -12160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa240
+    lui $t2, 0x1003
+    sw $t0, -12096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1ec0
+    lui $t2, 0x1003
+    sw $t0, -12032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7180
+    lui $t2, 0x1003
+    sw $t0, -11968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9d00
+    lui $t2, 0x1003
+    sw $t0, -11904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc880
+    lui $t2, 0x1003
+    sw $t0, -11840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4600
+    lui $t2, 0x1003
+    sw $t0, -11776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc700
+    lui $t2, 0x1003
+    sw $t0, -11712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb280
+    lui $t2, 0x1003
+    sw $t0, -11648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x97c0
+    lui $t2, 0x1003
+    sw $t0, -11584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe180
+    lui $t2, 0x1003
+    sw $t0, -11520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x72c0
+    lui $t2, 0x1003
+    sw $t0, -11456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc000
+    lui $t2, 0x1003
+    sw $t0, -11392($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x70c0
+    lui $t2, 0x1003
+    sw $t0, -11328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbb40
+    lui $t2, 0x1003
+    sw $t0, -11264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2700
+    lui $t2, 0x1003
+    sw $t0, -11200($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc880
+    lui $t2, 0x1003
+    sw $t0, -11136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x70c0
+    lui $t2, 0x1003
+    sw $t0, -11072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1680
+    lui $t2, 0x1003
+    sw $t0, -11008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf00
+    lui $t2, 0x1003
+    sw $t0, -10944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4f00
+    lui $t2, 0x1003
+    sw $t0, -10880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb340
+    lui $t2, 0x1003
+    sw $t0, -10816($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd140
+    lui $t2, 0x1003
+    sw $t0, -10752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 128
+    lui $t2, 0x1003
+    sw $t0, -10688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d80
+    lui $t2, 0x1003
+    sw $t0, -10624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc840
+    lui $t2, 0x1003
+    sw $t0, -10560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdf80
+    lui $t2, 0x1003
+    sw $t0, -10496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe940
+    lui $t2, 0x1003
+    sw $t0, -10432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x780
+    lui $t2, 0x1003
+    sw $t0, -10368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5980
+    lui $t2, 0x1003
+    sw $t0, -10304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c40
+    lui $t2, 0x1003
+    sw $t0, -10240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf800
+    lui $t2, 0x1003
+    sw $t0, -10176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe4c0
+    lui $t2, 0x1003
+    sw $t0, -10112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9800
+    lui $t2, 0x1003
+    sw $t0, -10048($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc6c0
+    lui $t2, 0x1003
+    sw $t0, -9984($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfac0
+    lui $t2, 0x1003
+    sw $t0, -9920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5640
+    lui $t2, 0x1003
+    sw $t0, -9856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3500
+    lui $t2, 0x1003
+    sw $t0, -9792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe680
+    lui $t2, 0x1003
+    sw $t0, -9728($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7f00
+    lui $t2, 0x1003
+    sw $t0, -9664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3d00
+    lui $t2, 0x1003
+    sw $t0, -9600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf0c0
+    lui $t2, 0x1003
+    sw $t0, -9536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7640
+    lui $t2, 0x1003
+    sw $t0, -9472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdd80
+    lui $t2, 0x1003
+    sw $t0, -9408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x34c0
+    lui $t2, 0x1003
+    sw $t0, -9344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfb80
+    lui $t2, 0x1003
+    sw $t0, -9280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x31c0
+    lui $t2, 0x1003
+    sw $t0, -9216($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcec0
+    lui $t2, 0x1003
+    sw $t0, -9152($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1e40
+    lui $t2, 0x1003
+    sw $t0, -9088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9d40
+    lui $t2, 0x1003
+    sw $t0, -9024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8d80
+    lui $t2, 0x1003
+    sw $t0, -8960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x51c0
+    lui $t2, 0x1003
+    sw $t0, -8896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8d80
+    lui $t2, 0x1003
+    sw $t0, -8832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc2c0
+    lui $t2, 0x1003
+    sw $t0, -8768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8c80
+    lui $t2, 0x1003
+    sw $t0, -8704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x40c0
+    lui $t2, 0x1003
+    sw $t0, -8640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xda40
+    lui $t2, 0x1003
+    sw $t0, -8576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8800
+    lui $t2, 0x1003
+    sw $t0, -8512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcb80
+    lui $t2, 0x1003
+    sw $t0, -8448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc500
+    lui $t2, 0x1003
+    sw $t0, -8384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x76c0
+    lui $t2, 0x1003
+    sw $t0, -8320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd340
+    lui $t2, 0x1003
+    sw $t0, -8256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfe00
+    lui $t2, 0x1003
+    sw $t0, -8192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2440
+    lui $t2, 0x1003
+    sw $t0, -8128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5fc0
+    lui $t2, 0x1003
+    sw $t0, -8064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaf40
+    lui $t2, 0x1003
+    sw $t0, -8000($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4740
+    lui $t2, 0x1003
+    sw $t0, -7936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7fc0
+    lui $t2, 0x1003
+    sw $t0, -7872($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6d40
+    lui $t2, 0x1003
+    sw $t0, -7808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x280
+    lui $t2, 0x1003
+    sw $t0, -7744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7a80
+    lui $t2, 0x1003
+    sw $t0, -7680($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5bc0
+    lui $t2, 0x1003
+    sw $t0, -7616($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcc40
+    lui $t2, 0x1003
+    sw $t0, -7552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa100
+    lui $t2, 0x1003
+    sw $t0, -7488($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x10c0
+    lui $t2, 0x1003
+    sw $t0, -7424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf9c0
+    lui $t2, 0x1003
+    sw $t0, -7360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9040
+    lui $t2, 0x1003
+    sw $t0, -7296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x64c0
+    lui $t2, 0x1003
+    sw $t0, -7232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2ec0
+    lui $t2, 0x1003
+    sw $t0, -7168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfac0
+    lui $t2, 0x1003
+    sw $t0, -7104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8840
+    lui $t2, 0x1003
+    sw $t0, -7040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2ac0
+    lui $t2, 0x1003
+    sw $t0, -6976($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbcc0
+    lui $t2, 0x1003
+    sw $t0, -6912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8480
+    lui $t2, 0x1003
+    sw $t0, -6848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd2c0
+    lui $t2, 0x1003
+    sw $t0, -6784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb80
+    lui $t2, 0x1003
+    sw $t0, -6720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x16c0
+    lui $t2, 0x1003
+    sw $t0, -6656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4680
+    lui $t2, 0x1003
+    sw $t0, -6592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc340
+    lui $t2, 0x1003
+    sw $t0, -6528($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5f00
+    lui $t2, 0x1003
+    sw $t0, -6464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4300
+    lui $t2, 0x1003
+    sw $t0, -6400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x69c0
+    lui $t2, 0x1003
+    sw $t0, -6336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb040
+    lui $t2, 0x1003
+    sw $t0, -6272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa340
+    lui $t2, 0x1003
+    sw $t0, -6208($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8980
+    lui $t2, 0x1003
+    sw $t0, -6144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xef00
+    lui $t2, 0x1003
+    sw $t0, -6080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9e80
+    lui $t2, 0x1003
+    sw $t0, -6016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8a00
+    lui $t2, 0x1003
+    sw $t0, -5952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1c40
+    lui $t2, 0x1003
+    sw $t0, -5888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf00
+    lui $t2, 0x1003
+    sw $t0, -5824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xacc0
+    lui $t2, 0x1003
+    sw $t0, -5760($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7200
+    lui $t2, 0x1003
+    sw $t0, -5696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf480
+    lui $t2, 0x1003
+    sw $t0, -5632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1e00
+    lui $t2, 0x1003
+    sw $t0, -5568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3e40
+    lui $t2, 0x1003
+    sw $t0, -5504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x48c0
+    lui $t2, 0x1003
+    sw $t0, -5440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6fc0
+    lui $t2, 0x1003
+    sw $t0, -5376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x680
+    lui $t2, 0x1003
+    sw $t0, -5312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6d80
+    lui $t2, 0x1003
+    sw $t0, -5248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9980
+    lui $t2, 0x1003
+    sw $t0, -5184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8240
+    lui $t2, 0x1003
+    sw $t0, -5120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd740
+    lui $t2, 0x1003
+    sw $t0, -5056($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfc40
+    lui $t2, 0x1003
+    sw $t0, -4992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5bc0
+    lui $t2, 0x1003
+    sw $t0, -4928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8e80
+    lui $t2, 0x1003
+    sw $t0, -4864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa00
+    lui $t2, 0x1003
+    sw $t0, -4800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8e40
+    lui $t2, 0x1003
+    sw $t0, -4736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd6c0
+    lui $t2, 0x1003
+    sw $t0, -4672($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8100
+    lui $t2, 0x1003
+    sw $t0, -4608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8a80
+    lui $t2, 0x1003
+    sw $t0, -4544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf580
+    lui $t2, 0x1003
+    sw $t0, -4480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x300
+    lui $t2, 0x1003
+    sw $t0, -4416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd440
+    lui $t2, 0x1003
+    sw $t0, -4352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4bc0
+    lui $t2, 0x1003
+    sw $t0, -4288($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc740
+    lui $t2, 0x1003
+    sw $t0, -4224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf040
+    lui $t2, 0x1003
+    sw $t0, -4160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9e40
+    lui $t2, 0x1003
+    sw $t0, -4096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x85c0
+    lui $t2, 0x1003
+    sw $t0, -4032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcf80
+    lui $t2, 0x1003
+    sw $t0, -3968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9cc0
+    lui $t2, 0x1003
+    sw $t0, -3904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xad00
+    lui $t2, 0x1003
+    sw $t0, -3840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc900
+    lui $t2, 0x1003
+    sw $t0, -3776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf500
+    lui $t2, 0x1003
+    sw $t0, -3712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe840
+    lui $t2, 0x1003
+    sw $t0, -3648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1140
+    lui $t2, 0x1003
+    sw $t0, -3584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc540
+    lui $t2, 0x1003
+    sw $t0, -3520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3b40
+    lui $t2, 0x1003
+    sw $t0, -3456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1200
+    lui $t2, 0x1003
+    sw $t0, -3392($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd4c0
+    lui $t2, 0x1003
+    sw $t0, -3328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c40
+    lui $t2, 0x1003
+    sw $t0, -3264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc100
+    lui $t2, 0x1003
+    sw $t0, -3200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f80
+    lui $t2, 0x1003
+    sw $t0, -3136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb2c0
+    lui $t2, 0x1003
+    sw $t0, -3072($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xafc0
+    lui $t2, 0x1003
+    sw $t0, -3008($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe3c0
+    lui $t2, 0x1003
+    sw $t0, -2944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x32c0
+    lui $t2, 0x1003
+    sw $t0, -2880($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfb40
+    lui $t2, 0x1003
+    sw $t0, -2816($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4200
+    lui $t2, 0x1003
+    sw $t0, -2752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4400
+    lui $t2, 0x1003
+    sw $t0, -2688($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7080
+    lui $t2, 0x1003
+    sw $t0, -2624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd300
+    lui $t2, 0x1003
+    sw $t0, -2560($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9680
+    lui $t2, 0x1003
+    sw $t0, -2496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc100
+    lui $t2, 0x1003
+    sw $t0, -2432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3c40
+    lui $t2, 0x1003
+    sw $t0, -2368($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9200
+    lui $t2, 0x1003
+    sw $t0, -2304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xef40
+    lui $t2, 0x1003
+    sw $t0, -2240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd840
+    lui $t2, 0x1003
+    sw $t0, -2176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c40
+    lui $t2, 0x1003
+    sw $t0, -2112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x540
+    lui $t2, 0x1003
+    sw $t0, -2048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xedc0
+    lui $t2, 0x1003
+    sw $t0, -1984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c0
+    lui $t2, 0x1003
+    sw $t0, -1920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5d80
+    lui $t2, 0x1003
+    sw $t0, -1856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c00
+    lui $t2, 0x1003
+    sw $t0, -1792($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf900
+    lui $t2, 0x1003
+    sw $t0, -1728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc640
+    lui $t2, 0x1003
+    sw $t0, -1664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf8c0
+    lui $t2, 0x1003
+    sw $t0, -1600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa300
+    lui $t2, 0x1003
+    sw $t0, -1536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaf00
+    lui $t2, 0x1003
+    sw $t0, -1472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4300
+    lui $t2, 0x1003
+    sw $t0, -1408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa300
+    lui $t2, 0x1003
+    sw $t0, -1344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5440
+    lui $t2, 0x1003
+    sw $t0, -1280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2880
+    lui $t2, 0x1003
+    sw $t0, -1216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb8c0
+    lui $t2, 0x1003
+    sw $t0, -1152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf8c0
+    lui $t2, 0x1003
+    sw $t0, -1088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9dc0
+    lui $t2, 0x1003
+    sw $t0, -1024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5d00
+    lui $t2, 0x1003
+    sw $t0, -960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2d00
+    lui $t2, 0x1003
+    sw $t0, -896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x13c0
+    lui $t2, 0x1003
+    sw $t0, -832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb6c0
+    lui $t2, 0x1003
+    sw $t0, -768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xff80
+    lui $t2, 0x1003
+    sw $t0, -704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe380
+    lui $t2, 0x1003
+    sw $t0, -640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe300
+    lui $t2, 0x1003
+    sw $t0, -576($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfc0
+    lui $t2, 0x1003
+    sw $t0, -512($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x20c0
+    lui $t2, 0x1003
+    sw $t0, -448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b80
+    lui $t2, 0x1003
+    sw $t0, -384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcc80
+    lui $t2, 0x1003
+    sw $t0, -320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd800
+    lui $t2, 0x1003
+    sw $t0, -256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe000
+    lui $t2, 0x1003
+    sw $t0, -192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7a40
+    lui $t2, 0x1003
+    sw $t0, -128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8400
+    lui $t2, 0x1003
+    sw $t0, -64($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b00
+    lui $t2, 0x1003
+    sw $t0, 0($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3d40
+    lui $t2, 0x1003
+    sw $t0, 64($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5f40
+    lui $t2, 0x1003
+    sw $t0, 128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2a00
+    lui $t2, 0x1003
+    sw $t0, 192($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1e80
+    lui $t2, 0x1003
+    sw $t0, 256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa180
+    lui $t2, 0x1003
+    sw $t0, 320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2340
+    lui $t2, 0x1003
+    sw $t0, 384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb1c0
+    lui $t2, 0x1003
+    sw $t0, 448($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x140
+    lui $t2, 0x1003
+    sw $t0, 512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2540
+    lui $t2, 0x1003
+    sw $t0, 576($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf480
+    lui $t2, 0x1003
+    sw $t0, 640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd840
+    lui $t2, 0x1003
+    sw $t0, 704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcd00
+    lui $t2, 0x1003
+    sw $t0, 768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1900
+    lui $t2, 0x1003
+    sw $t0, 832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5bc0
+    lui $t2, 0x1003
+    sw $t0, 896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfe80
+    lui $t2, 0x1003
+    sw $t0, 960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3980
+    lui $t2, 0x1003
+    sw $t0, 1024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf00
+    lui $t2, 0x1003
+    sw $t0, 1088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb900
+    lui $t2, 0x1003
+    sw $t0, 1152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8740
+    lui $t2, 0x1003
+    sw $t0, 1216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5c80
+    lui $t2, 0x1003
+    sw $t0, 1280($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc5c0
+    lui $t2, 0x1003
+    sw $t0, 1344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x900
+    lui $t2, 0x1003
+    sw $t0, 1408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x440
+    lui $t2, 0x1003
+    sw $t0, 1472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7700
+    lui $t2, 0x1003
+    sw $t0, 1536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7dc0
+    lui $t2, 0x1003
+    sw $t0, 1600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf740
+    lui $t2, 0x1003
+    sw $t0, 1664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe4c0
+    lui $t2, 0x1003
+    sw $t0, 1728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc300
+    lui $t2, 0x1003
+    sw $t0, 1792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xed00
+    lui $t2, 0x1003
+    sw $t0, 1856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe8c0
+    lui $t2, 0x1003
+    sw $t0, 1920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5800
+    lui $t2, 0x1003
+    sw $t0, 1984($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe100
+    lui $t2, 0x1003
+    sw $t0, 2048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6f80
+    lui $t2, 0x1003
+    sw $t0, 2112($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7000
+    lui $t2, 0x1003
+    sw $t0, 2176($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd3c0
+    lui $t2, 0x1003
+    sw $t0, 2240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcbc0
+    lui $t2, 0x1003
+    sw $t0, 2304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6000
+    lui $t2, 0x1003
+    sw $t0, 2368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1280
+    lui $t2, 0x1003
+    sw $t0, 2432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xedc0
+    lui $t2, 0x1003
+    sw $t0, 2496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa840
+    lui $t2, 0x1003
+    sw $t0, 2560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x740
+    lui $t2, 0x1003
+    sw $t0, 2624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf240
+    lui $t2, 0x1003
+    sw $t0, 2688($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8b80
+    lui $t2, 0x1003
+    sw $t0, 2752($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9200
+    lui $t2, 0x1003
+    sw $t0, 2816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfb80
+    lui $t2, 0x1003
+    sw $t0, 2880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb240
+    lui $t2, 0x1003
+    sw $t0, 2944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf80
+    lui $t2, 0x1003
+    sw $t0, 3008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb000
+    lui $t2, 0x1003
+    sw $t0, 3072($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc1c0
+    lui $t2, 0x1003
+    sw $t0, 3136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9b40
+    lui $t2, 0x1003
+    sw $t0, 3200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6e40
+    lui $t2, 0x1003
+    sw $t0, 3264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a80
+    lui $t2, 0x1003
+    sw $t0, 3328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3200
+    lui $t2, 0x1003
+    sw $t0, 3392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x46c0
+    lui $t2, 0x1003
+    sw $t0, 3456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4980
+    lui $t2, 0x1003
+    sw $t0, 3520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7180
+    lui $t2, 0x1003
+    sw $t0, 3584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x35c0
+    lui $t2, 0x1003
+    sw $t0, 3648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcd40
+    lui $t2, 0x1003
+    sw $t0, 3712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc580
+    lui $t2, 0x1003
+    sw $t0, 3776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbe80
+    lui $t2, 0x1003
+    sw $t0, 3840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb700
+    lui $t2, 0x1003
+    sw $t0, 3904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x57c0
+    lui $t2, 0x1003
+    sw $t0, 3968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3900
+    lui $t2, 0x1003
+    sw $t0, 4032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa7c0
+    lui $t2, 0x1003
+    sw $t0, 4096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb300
+    lui $t2, 0x1003
+    sw $t0, 4160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4800
+    lui $t2, 0x1003
+    sw $t0, 4224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5b00
+    lui $t2, 0x1003
+    sw $t0, 4288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6180
+    lui $t2, 0x1003
+    sw $t0, 4352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb800
+    lui $t2, 0x1003
+    sw $t0, 4416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xae00
+    lui $t2, 0x1003
+    sw $t0, 4480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcc0
+    lui $t2, 0x1003
+    sw $t0, 4544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbe00
+    lui $t2, 0x1003
+    sw $t0, 4608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x26c0
+    lui $t2, 0x1003
+    sw $t0, 4672($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf040
+    lui $t2, 0x1003
+    sw $t0, 4736($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x93c0
+    lui $t2, 0x1003
+    sw $t0, 4800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5140
+    lui $t2, 0x1003
+    sw $t0, 4864($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6080
+    lui $t2, 0x1003
+    sw $t0, 4928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xadc0
+    lui $t2, 0x1003
+    sw $t0, 4992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7cc0
+    lui $t2, 0x1003
+    sw $t0, 5056($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa800
+    lui $t2, 0x1003
+    sw $t0, 5120($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2480
+    lui $t2, 0x1003
+    sw $t0, 5184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8980
+    lui $t2, 0x1003
+    sw $t0, 5248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc600
+    lui $t2, 0x1003
+    sw $t0, 5312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x31c0
+    lui $t2, 0x1003
+    sw $t0, 5376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcc0
+    lui $t2, 0x1003
+    sw $t0, 5440($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x15c0
+    lui $t2, 0x1003
+    sw $t0, 5504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaf00
+    lui $t2, 0x1003
+    sw $t0, 5568($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8200
+    lui $t2, 0x1003
+    sw $t0, 5632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x300
+    lui $t2, 0x1003
+    sw $t0, 5696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7dc0
+    lui $t2, 0x1003
+    sw $t0, 5760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe180
+    lui $t2, 0x1003
+    sw $t0, 5824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x900
+    lui $t2, 0x1003
+    sw $t0, 5888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5e40
+    lui $t2, 0x1003
+    sw $t0, 5952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6d40
+    lui $t2, 0x1003
+    sw $t0, 6016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x33c0
+    lui $t2, 0x1003
+    sw $t0, 6080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x55c0
+    lui $t2, 0x1003
+    sw $t0, 6144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x89c0
+    lui $t2, 0x1003
+    sw $t0, 6208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb980
+    lui $t2, 0x1003
+    sw $t0, 6272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5400
+    lui $t2, 0x1003
+    sw $t0, 6336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe400
+    lui $t2, 0x1003
+    sw $t0, 6400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x14c0
+    lui $t2, 0x1003
+    sw $t0, 6464($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8f40
+    lui $t2, 0x1003
+    sw $t0, 6528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6500
+    lui $t2, 0x1003
+    sw $t0, 6592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5840
+    lui $t2, 0x1003
+    sw $t0, 6656($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9140
+    lui $t2, 0x1003
+    sw $t0, 6720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd000
+    lui $t2, 0x1003
+    sw $t0, 6784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ac0
+    lui $t2, 0x1003
+    sw $t0, 6848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb800
+    lui $t2, 0x1003
+    sw $t0, 6912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c40
+    lui $t2, 0x1003
+    sw $t0, 6976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x440
+    lui $t2, 0x1003
+    sw $t0, 7040($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5380
+    lui $t2, 0x1003
+    sw $t0, 7104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2040
+    lui $t2, 0x1003
+    sw $t0, 7168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1340
+    lui $t2, 0x1003
+    sw $t0, 7232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x180
+    lui $t2, 0x1003
+    sw $t0, 7296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x78c0
+    lui $t2, 0x1003
+    sw $t0, 7360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7ec0
+    lui $t2, 0x1003
+    sw $t0, 7424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ec0
+    lui $t2, 0x1003
+    sw $t0, 7488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2fc0
+    lui $t2, 0x1003
+    sw $t0, 7552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8540
+    lui $t2, 0x1003
+    sw $t0, 7616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa600
+    lui $t2, 0x1003
+    sw $t0, 7680($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6a80
+    lui $t2, 0x1003
+    sw $t0, 7744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x20c0
+    lui $t2, 0x1003
+    sw $t0, 7808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xce40
+    lui $t2, 0x1003
+    sw $t0, 7872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc900
+    lui $t2, 0x1003
+    sw $t0, 7936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6d80
+    lui $t2, 0x1003
+    sw $t0, 8000($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5dc0
+    lui $t2, 0x1003
+    sw $t0, 8064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc400
+    lui $t2, 0x1003
+    sw $t0, 8128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x39c0
+    lui $t2, 0x1003
+    sw $t0, 8192($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x59c0
+    lui $t2, 0x1003
+    sw $t0, 8256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6240
+    lui $t2, 0x1003
+    sw $t0, 8320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe680
+    lui $t2, 0x1003
+    sw $t0, 8384($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8140
+    lui $t2, 0x1003
+    sw $t0, 8448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x800
+    lui $t2, 0x1003
+    sw $t0, 8512($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4100
+    lui $t2, 0x1003
+    sw $t0, 8576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd7c0
+    lui $t2, 0x1003
+    sw $t0, 8640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcfc0
+    lui $t2, 0x1003
+    sw $t0, 8704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x56c0
+    lui $t2, 0x1003
+    sw $t0, 8768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8900
+    lui $t2, 0x1003
+    sw $t0, 8832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x91c0
+    lui $t2, 0x1003
+    sw $t0, 8896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf080
+    lui $t2, 0x1003
+    sw $t0, 8960($t2)
+    lui $t0, 0x1001
+    lui $t2, 0x1003
+    sw $t0, 9024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd180
+    lui $t2, 0x1003
+    sw $t0, 9088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x42c0
+    lui $t2, 0x1003
+    sw $t0, 9152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdc80
+    lui $t2, 0x1003
+    sw $t0, 9216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d80
+    lui $t2, 0x1003
+    sw $t0, 9280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf580
+    lui $t2, 0x1003
+    sw $t0, 9344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x73c0
+    lui $t2, 0x1003
+    sw $t0, 9408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc780
+    lui $t2, 0x1003
+    sw $t0, 9472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2680
+    lui $t2, 0x1003
+    sw $t0, 9536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7e80
+    lui $t2, 0x1003
+    sw $t0, 9600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb00
+    lui $t2, 0x1003
+    sw $t0, 9664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e80
+    lui $t2, 0x1003
+    sw $t0, 9728($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6c00
+    lui $t2, 0x1003
+    sw $t0, 9792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb2c0
+    lui $t2, 0x1003
+    sw $t0, 9856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7540
+    lui $t2, 0x1003
+    sw $t0, 9920($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9a40
+    lui $t2, 0x1003
+    sw $t0, 9984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7700
+    lui $t2, 0x1003
+    sw $t0, 10048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe780
+    lui $t2, 0x1003
+    sw $t0, 10112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x84c0
+    lui $t2, 0x1003
+    sw $t0, 10176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9100
+    lui $t2, 0x1003
+    sw $t0, 10240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf100
+    lui $t2, 0x1003
+    sw $t0, 10304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xad40
+    lui $t2, 0x1003
+    sw $t0, 10368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x96c0
+    lui $t2, 0x1003
+    sw $t0, 10432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4e00
+    lui $t2, 0x1003
+    sw $t0, 10496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f40
+    lui $t2, 0x1003
+    sw $t0, 10560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x37c0
+    lui $t2, 0x1003
+    sw $t0, 10624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xca80
+    lui $t2, 0x1003
+    sw $t0, 10688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x17c0
+    lui $t2, 0x1003
+    sw $t0, 10752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc940
+    lui $t2, 0x1003
+    sw $t0, 10816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcb00
+    lui $t2, 0x1003
+    sw $t0, 10880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9280
+    lui $t2, 0x1003
+    sw $t0, 10944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdc0
+    lui $t2, 0x1003
+    sw $t0, 11008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 192
+    lui $t2, 0x1003
+    sw $t0, 11072($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1080
+    lui $t2, 0x1003
+    sw $t0, 11136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x540
+    lui $t2, 0x1003
+    sw $t0, 11200($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4480
+    lui $t2, 0x1003
+    sw $t0, 11264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1900
+    lui $t2, 0x1003
+    sw $t0, 11328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x27c0
+    lui $t2, 0x1003
+    sw $t0, 11392($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa300
+    lui $t2, 0x1003
+    sw $t0, 11456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4a80
+    lui $t2, 0x1003
+    sw $t0, 11520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5f40
+    lui $t2, 0x1003
+    sw $t0, 11584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5980
+    lui $t2, 0x1003
+    sw $t0, 11648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8640
+    lui $t2, 0x1003
+    sw $t0, 11712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e00
+    lui $t2, 0x1003
+    sw $t0, 11776($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1c80
+    lui $t2, 0x1003
+    sw $t0, 11840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdb80
+    lui $t2, 0x1003
+    sw $t0, 11904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8740
+    lui $t2, 0x1003
+    sw $t0, 11968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xde40
+    lui $t2, 0x1003
+    sw $t0, 12032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x740
+    lui $t2, 0x1003
+    sw $t0, 12096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaf40
+    lui $t2, 0x1003
+    sw $t0, 12160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb0c0
+    lui $t2, 0x1003
+    sw $t0, 12224($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x700
+    lui $t2, 0x1003
+    sw $t0, 12288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3480
+    lui $t2, 0x1003
+    sw $t0, 12352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7040
+    lui $t2, 0x1003
+    sw $t0, 12416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf9c0
+    lui $t2, 0x1003
+    sw $t0, 12480($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8600
+    lui $t2, 0x1003
+    sw $t0, 12544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3c0
+    lui $t2, 0x1003
+    sw $t0, 12608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfe00
+    lui $t2, 0x1003
+    sw $t0, 12672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e00
+    lui $t2, 0x1003
+    sw $t0, 12736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x21c0
+    lui $t2, 0x1003
+    sw $t0, 12800($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x35c0
+    lui $t2, 0x1003
+    sw $t0, 12864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x93c0
+    lui $t2, 0x1003
+    sw $t0, 12928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x400
+    lui $t2, 0x1003
+    sw $t0, 12992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a00
+    lui $t2, 0x1003
+    sw $t0, 13056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8680
+    lui $t2, 0x1003
+    sw $t0, 13120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x18c0
+    lui $t2, 0x1003
+    sw $t0, 13184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1280
+    lui $t2, 0x1003
+    sw $t0, 13248($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5900
+    lui $t2, 0x1003
+    sw $t0, 13312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcac0
+    lui $t2, 0x1003
+    sw $t0, 13376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf080
+    lui $t2, 0x1003
+    sw $t0, 13440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ec0
+    lui $t2, 0x1003
+    sw $t0, 13504($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe8c0
+    lui $t2, 0x1003
+    sw $t0, 13568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe300
+    lui $t2, 0x1003
+    sw $t0, 13632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb100
+    lui $t2, 0x1003
+    sw $t0, 13696($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6400
+    lui $t2, 0x1003
+    sw $t0, 13760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x87c0
+    lui $t2, 0x1003
+    sw $t0, 13824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x44c0
+    lui $t2, 0x1003
+    sw $t0, 13888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x82c0
+    lui $t2, 0x1003
+    sw $t0, 13952($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4dc0
+    lui $t2, 0x1003
+    sw $t0, 14016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1800
+    lui $t2, 0x1003
+    sw $t0, 14080($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xca40
+    lui $t2, 0x1003
+    sw $t0, 14144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x82c0
+    lui $t2, 0x1003
+    sw $t0, 14208($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9f80
+    lui $t2, 0x1003
+    sw $t0, 14272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1cc0
+    lui $t2, 0x1003
+    sw $t0, 14336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8000
+    lui $t2, 0x1003
+    sw $t0, 14400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8dc0
+    lui $t2, 0x1003
+    sw $t0, 14464($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xea40
+    lui $t2, 0x1003
+    sw $t0, 14528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8bc0
+    lui $t2, 0x1003
+    sw $t0, 14592($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbd40
+    lui $t2, 0x1003
+    sw $t0, 14656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe6c0
+    lui $t2, 0x1003
+    sw $t0, 14720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb480
+    lui $t2, 0x1003
+    sw $t0, 14784($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8380
+    lui $t2, 0x1003
+    sw $t0, 14848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4640
+    lui $t2, 0x1003
+    sw $t0, 14912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8440
+    lui $t2, 0x1003
+    sw $t0, 14976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8500
+    lui $t2, 0x1003
+    sw $t0, 15040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6ec0
+    lui $t2, 0x1003
+    sw $t0, 15104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x25c0
+    lui $t2, 0x1003
+    sw $t0, 15168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7240
+    lui $t2, 0x1003
+    sw $t0, 15232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1500
+    lui $t2, 0x1003
+    sw $t0, 15296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x52c0
+    lui $t2, 0x1003
+    sw $t0, 15360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7740
+    lui $t2, 0x1003
+    sw $t0, 15424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc080
+    lui $t2, 0x1003
+    sw $t0, 15488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd00
+    lui $t2, 0x1003
+    sw $t0, 15552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6640
+    lui $t2, 0x1003
+    sw $t0, 15616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xda00
+    lui $t2, 0x1003
+    sw $t0, 15680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd980
+    lui $t2, 0x1003
+    sw $t0, 15744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb80
+    lui $t2, 0x1003
+    sw $t0, 15808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3640
+    lui $t2, 0x1003
+    sw $t0, 15872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8bc0
+    lui $t2, 0x1003
+    sw $t0, 15936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x24c0
+    lui $t2, 0x1003
+    sw $t0, 16000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4fc0
+    lui $t2, 0x1003
+    sw $t0, 16064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xef00
+    lui $t2, 0x1003
+    sw $t0, 16128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6e80
+    lui $t2, 0x1003
+    sw $t0, 16192($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4c80
+    lui $t2, 0x1003
+    sw $t0, 16256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbac0
+    lui $t2, 0x1003
+    sw $t0, 16320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdac0
+    lui $t2, 0x1003
+    sw $t0, 16384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ac0
+    lui $t2, 0x1003
+    sw $t0, 16448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8c40
+    lui $t2, 0x1003
+    sw $t0, 16512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd500
+    lui $t2, 0x1003
+    sw $t0, 16576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf0c0
+    lui $t2, 0x1003
+    sw $t0, 16640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8780
+    lui $t2, 0x1003
+    sw $t0, 16704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe640
+    lui $t2, 0x1003
+    sw $t0, 16768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa380
+    lui $t2, 0x1003
+    sw $t0, 16832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8780
+    lui $t2, 0x1003
+    sw $t0, 16896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd40
+    lui $t2, 0x1003
+    sw $t0, 16960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7700
+    lui $t2, 0x1003
+    sw $t0, 17024($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdf00
+    lui $t2, 0x1003
+    sw $t0, 17088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6b00
+    lui $t2, 0x1003
+    sw $t0, 17152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf4c0
+    lui $t2, 0x1003
+    sw $t0, 17216($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcc0
+    lui $t2, 0x1003
+    sw $t0, 17280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x84c0
+    lui $t2, 0x1003
+    sw $t0, 17344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b40
+    lui $t2, 0x1003
+    sw $t0, 17408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x67c0
+    lui $t2, 0x1003
+    sw $t0, 17472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9180
+    lui $t2, 0x1003
+    sw $t0, 17536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xba40
+    lui $t2, 0x1003
+    sw $t0, 17600($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf640
+    lui $t2, 0x1003
+    sw $t0, 17664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe440
+    lui $t2, 0x1003
+    sw $t0, 17728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf340
+    lui $t2, 0x1003
+    sw $t0, 17792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9340
+    lui $t2, 0x1003
+    sw $t0, 17856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2c00
+    lui $t2, 0x1003
+    sw $t0, 17920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6600
+    lui $t2, 0x1003
+    sw $t0, 17984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2c40
+    lui $t2, 0x1003
+    sw $t0, 18048($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x23c0
+    lui $t2, 0x1003
+    sw $t0, 18112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdf40
+    lui $t2, 0x1003
+    sw $t0, 18176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5d00
+    lui $t2, 0x1003
+    sw $t0, 18240($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbb40
+    lui $t2, 0x1003
+    sw $t0, 18304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5380
+    lui $t2, 0x1003
+    sw $t0, 18368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe900
+    lui $t2, 0x1003
+    sw $t0, 18432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6dc0
+    lui $t2, 0x1003
+    sw $t0, 18496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xeb80
+    lui $t2, 0x1003
+    sw $t0, 18560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x43c0
+    lui $t2, 0x1003
+    sw $t0, 18624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3480
+    lui $t2, 0x1003
+    sw $t0, 18688($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2640
+    lui $t2, 0x1003
+    sw $t0, 18752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9100
+    lui $t2, 0x1003
+    sw $t0, 18816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe840
+    lui $t2, 0x1003
+    sw $t0, 18880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5380
+    lui $t2, 0x1003
+    sw $t0, 18944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1f40
+    lui $t2, 0x1003
+    sw $t0, 19008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7740
+    lui $t2, 0x1003
+    sw $t0, 19072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdc00
+    lui $t2, 0x1003
+    sw $t0, 19136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7580
+    lui $t2, 0x1003
+    sw $t0, 19200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3080
+    lui $t2, 0x1003
+    sw $t0, 19264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd440
+    lui $t2, 0x1003
+    sw $t0, 19328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6100
+    lui $t2, 0x1003
+    sw $t0, 19392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1e00
+    lui $t2, 0x1003
+    sw $t0, 19456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3580
+    lui $t2, 0x1003
+    sw $t0, 19520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5180
+    lui $t2, 0x1003
+    sw $t0, 19584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3600
+    lui $t2, 0x1003
+    sw $t0, 19648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x16c0
+    lui $t2, 0x1003
+    sw $t0, 19712($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4e00
+    lui $t2, 0x1003
+    sw $t0, 19776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x60c0
+    lui $t2, 0x1003
+    sw $t0, 19840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b00
+    lui $t2, 0x1003
+    sw $t0, 19904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7600
+    lui $t2, 0x1003
+    sw $t0, 19968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8fc0
+    lui $t2, 0x1003
+    sw $t0, 20032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb7c0
+    lui $t2, 0x1003
+    sw $t0, 20096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcb00
+    lui $t2, 0x1003
+    sw $t0, 20160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f00
+    lui $t2, 0x1003
+    sw $t0, 20224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1c0
+    lui $t2, 0x1003
+    sw $t0, 20288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9f00
+    lui $t2, 0x1003
+    sw $t0, 20352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f00
+    lui $t2, 0x1003
+    sw $t0, 20416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xafc0
+    lui $t2, 0x1003
+    sw $t0, 20480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x340
+    lui $t2, 0x1003
+    sw $t0, 20544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9700
+    lui $t2, 0x1003
+    sw $t0, 20608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9980
+    lui $t2, 0x1003
+    sw $t0, 20672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x75c0
+    lui $t2, 0x1003
+    sw $t0, 20736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd380
+    lui $t2, 0x1003
+    sw $t0, 20800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb240
+    lui $t2, 0x1003
+    sw $t0, 20864($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1200
+    lui $t2, 0x1003
+    sw $t0, 20928($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x800
+    lui $t2, 0x1003
+    sw $t0, 20992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7bc0
+    lui $t2, 0x1003
+    sw $t0, 21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa680
+    lui $t2, 0x1003
+    sw $t0, 21120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9b80
+    lui $t2, 0x1003
+    sw $t0, 21184($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfc40
+    lui $t2, 0x1003
+    sw $t0, 21248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4f00
+    lui $t2, 0x1003
+    sw $t0, 21312($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3040
+    lui $t2, 0x1003
+    sw $t0, 21376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5900
+    lui $t2, 0x1003
+    sw $t0, 21440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x28c0
+    lui $t2, 0x1003
+    sw $t0, 21504($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2e00
+    lui $t2, 0x1003
+    sw $t0, 21568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf140
+    lui $t2, 0x1003
+    sw $t0, 21632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xddc0
+    lui $t2, 0x1003
+    sw $t0, 21696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x800
+    lui $t2, 0x1003
+    sw $t0, 21760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1a00
+    lui $t2, 0x1003
+    sw $t0, 21824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7440
+    lui $t2, 0x1003
+    sw $t0, 21888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1400
+    lui $t2, 0x1003
+    sw $t0, 21952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5800
+    lui $t2, 0x1003
+    sw $t0, 22016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdc40
+    lui $t2, 0x1003
+    sw $t0, 22080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7d40
+    lui $t2, 0x1003
+    sw $t0, 22144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xec0
+    lui $t2, 0x1003
+    sw $t0, 22208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a80
+    lui $t2, 0x1003
+    sw $t0, 22272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd000
+    lui $t2, 0x1003
+    sw $t0, 22336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x99c0
+    lui $t2, 0x1003
+    sw $t0, 22400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8280
+    lui $t2, 0x1003
+    sw $t0, 22464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9300
+    lui $t2, 0x1003
+    sw $t0, 22528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x54c0
+    lui $t2, 0x1003
+    sw $t0, 22592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5940
+    lui $t2, 0x1003
+    sw $t0, 22656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9d00
+    lui $t2, 0x1003
+    sw $t0, 22720($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x45c0
+    lui $t2, 0x1003
+    sw $t0, 22784($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1480
+    lui $t2, 0x1003
+    sw $t0, 22848($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8400
+    lui $t2, 0x1003
+    sw $t0, 22912($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaa40
+    lui $t2, 0x1003
+    sw $t0, 22976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x62c0
+    lui $t2, 0x1003
+    sw $t0, 23040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9140
+    lui $t2, 0x1003
+    sw $t0, 23104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1a00
+    lui $t2, 0x1003
+    sw $t0, 23168($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9480
+    lui $t2, 0x1003
+    sw $t0, 23232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x36c0
+    lui $t2, 0x1003
+    sw $t0, 23296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xbf40
+    lui $t2, 0x1003
+    sw $t0, 23360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a00
+    lui $t2, 0x1003
+    sw $t0, 23424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe340
+    lui $t2, 0x1003
+    sw $t0, 23488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xac80
+    lui $t2, 0x1003
+    sw $t0, 23552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1580
+    lui $t2, 0x1003
+    sw $t0, 23616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa1c0
+    lui $t2, 0x1003
+    sw $t0, 23680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x14c0
+    lui $t2, 0x1003
+    sw $t0, 23744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf100
+    lui $t2, 0x1003
+    sw $t0, 23808($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd3c0
+    lui $t2, 0x1003
+    sw $t0, 23872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x640
+    lui $t2, 0x1003
+    sw $t0, 23936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3ac0
+    lui $t2, 0x1003
+    sw $t0, 24000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2140
+    lui $t2, 0x1003
+    sw $t0, 24064($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8780
+    lui $t2, 0x1003
+    sw $t0, 24128($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3dc0
+    lui $t2, 0x1003
+    sw $t0, 24192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf900
+    lui $t2, 0x1003
+    sw $t0, 24256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc600
+    lui $t2, 0x1003
+    sw $t0, 24320($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xafc0
+    lui $t2, 0x1003
+    sw $t0, 24384($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1000
+    lui $t2, 0x1003
+    sw $t0, 24448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf100
+    lui $t2, 0x1003
+    sw $t0, 24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1180
+    lui $t2, 0x1003
+    sw $t0, 24576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5480
+    lui $t2, 0x1003
+    sw $t0, 24640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe80
+    lui $t2, 0x1003
+    sw $t0, 24704($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xac0
+    lui $t2, 0x1003
+    sw $t0, 24768($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc0c0
+    lui $t2, 0x1003
+    sw $t0, 24832($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb4c0
+    lui $t2, 0x1003
+    sw $t0, 24896($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfa00
+    lui $t2, 0x1003
+    sw $t0, 24960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1f80
+    lui $t2, 0x1003
+    sw $t0, 25024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8600
+    lui $t2, 0x1003
+    sw $t0, 25088($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf800
+    lui $t2, 0x1003
+    sw $t0, 25152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7c0
+    lui $t2, 0x1003
+    sw $t0, 25216($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xff80
+    lui $t2, 0x1003
+    sw $t0, 25280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7100
+    lui $t2, 0x1003
+    sw $t0, 25344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcb80
+    lui $t2, 0x1003
+    sw $t0, 25408($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2c00
+    lui $t2, 0x1003
+    sw $t0, 25472($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x43c0
+    lui $t2, 0x1003
+    sw $t0, 25536($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4700
+    lui $t2, 0x1003
+    sw $t0, 25600($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1840
+    lui $t2, 0x1003
+    sw $t0, 25664($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa400
+    lui $t2, 0x1003
+    sw $t0, 25728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd080
+    lui $t2, 0x1003
+    sw $t0, 25792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5400
+    lui $t2, 0x1003
+    sw $t0, 25856($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc440
+    lui $t2, 0x1003
+    sw $t0, 25920($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc8c0
+    lui $t2, 0x1003
+    sw $t0, 25984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc040
+    lui $t2, 0x1003
+    sw $t0, 26048($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2c0
+    lui $t2, 0x1003
+    sw $t0, 26112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfd40
+    lui $t2, 0x1003
+    sw $t0, 26176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x83c0
+    lui $t2, 0x1003
+    sw $t0, 26240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9f40
+    lui $t2, 0x1003
+    sw $t0, 26304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8400
+    lui $t2, 0x1003
+    sw $t0, 26368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcf00
+    lui $t2, 0x1003
+    sw $t0, 26432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3700
+    lui $t2, 0x1003
+    sw $t0, 26496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3040
+    lui $t2, 0x1003
+    sw $t0, 26560($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8300
+    lui $t2, 0x1003
+    sw $t0, 26624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4e40
+    lui $t2, 0x1003
+    sw $t0, 26688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb380
+    lui $t2, 0x1003
+    sw $t0, 26752($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1180
+    lui $t2, 0x1003
+    sw $t0, 26816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c80
+    lui $t2, 0x1003
+    sw $t0, 26880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8c00
+    lui $t2, 0x1003
+    sw $t0, 26944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4540
+    lui $t2, 0x1003
+    sw $t0, 27008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x82c0
+    lui $t2, 0x1003
+    sw $t0, 27072($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5b40
+    lui $t2, 0x1003
+    sw $t0, 27136($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xaf40
+    lui $t2, 0x1003
+    sw $t0, 27200($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7180
+    lui $t2, 0x1003
+    sw $t0, 27264($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6080
+    lui $t2, 0x1003
+    sw $t0, 27328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc00
+    lui $t2, 0x1003
+    sw $t0, 27392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc980
+    lui $t2, 0x1003
+    sw $t0, 27456($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x22c0
+    lui $t2, 0x1003
+    sw $t0, 27520($t2)
+    lui $t0, 0x1003
+    lui $t2, 0x1003
+    sw $t0, 27584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x17c0
+    lui $t2, 0x1003
+    sw $t0, 27648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4240
+    lui $t2, 0x1003
+    sw $t0, 27712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x79c0
+    lui $t2, 0x1003
+    sw $t0, 27776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e40
+    lui $t2, 0x1003
+    sw $t0, 27840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdf80
+    lui $t2, 0x1003
+    sw $t0, 27904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcd80
+    lui $t2, 0x1003
+    sw $t0, 27968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa900
+    lui $t2, 0x1003
+    sw $t0, 28032($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2280
+    lui $t2, 0x1003
+    sw $t0, 28096($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5e40
+    lui $t2, 0x1003
+    sw $t0, 28160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcdc0
+    lui $t2, 0x1003
+    sw $t0, 28224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7100
+    lui $t2, 0x1003
+    sw $t0, 28288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7240
+    lui $t2, 0x1003
+    sw $t0, 28352($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9dc0
+    lui $t2, 0x1003
+    sw $t0, 28416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4880
+    lui $t2, 0x1003
+    sw $t0, 28480($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7880
+    lui $t2, 0x1003
+    sw $t0, 28544($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb600
+    lui $t2, 0x1003
+    sw $t0, 28608($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x37c0
+    lui $t2, 0x1003
+    sw $t0, 28672($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4c00
+    lui $t2, 0x1003
+    sw $t0, 28736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x95c0
+    lui $t2, 0x1003
+    sw $t0, 28800($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe540
+    lui $t2, 0x1003
+    sw $t0, 28864($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xae40
+    lui $t2, 0x1003
+    sw $t0, 28928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb740
+    lui $t2, 0x1003
+    sw $t0, 28992($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7280
+    lui $t2, 0x1003
+    sw $t0, 29056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb940
+    lui $t2, 0x1003
+    sw $t0, 29120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc680
+    lui $t2, 0x1003
+    sw $t0, 29184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1900
+    lui $t2, 0x1003
+    sw $t0, 29248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa580
+    lui $t2, 0x1003
+    sw $t0, 29312($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe500
+    lui $t2, 0x1003
+    sw $t0, 29376($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6b40
+    lui $t2, 0x1003
+    sw $t0, 29440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe240
+    lui $t2, 0x1003
+    sw $t0, 29504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x55c0
+    lui $t2, 0x1003
+    sw $t0, 29568($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x600
+    lui $t2, 0x1003
+    sw $t0, 29632($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8000
+    lui $t2, 0x1003
+    sw $t0, 29696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1500
+    lui $t2, 0x1003
+    sw $t0, 29760($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6b80
+    lui $t2, 0x1003
+    sw $t0, 29824($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xed80
+    lui $t2, 0x1003
+    sw $t0, 29888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfc00
+    lui $t2, 0x1003
+    sw $t0, 29952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9fc0
+    lui $t2, 0x1003
+    sw $t0, 30016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1cc0
+    lui $t2, 0x1003
+    sw $t0, 30080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8e00
+    lui $t2, 0x1003
+    sw $t0, 30144($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1440
+    lui $t2, 0x1003
+    sw $t0, 30208($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x50c0
+    lui $t2, 0x1003
+    sw $t0, 30272($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf940
+    lui $t2, 0x1003
+    sw $t0, 30336($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8e00
+    lui $t2, 0x1003
+    sw $t0, 30400($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8580
+    lui $t2, 0x1003
+    sw $t0, 30464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x34c0
+    lui $t2, 0x1003
+    sw $t0, 30528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6cc0
+    lui $t2, 0x1003
+    sw $t0, 30592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd940
+    lui $t2, 0x1003
+    sw $t0, 30656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdd00
+    lui $t2, 0x1003
+    sw $t0, 30720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf100
+    lui $t2, 0x1003
+    sw $t0, 30784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x29c0
+    lui $t2, 0x1003
+    sw $t0, 30848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5000
+    lui $t2, 0x1003
+    sw $t0, 30912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5540
+    lui $t2, 0x1003
+    sw $t0, 30976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1d80
+    lui $t2, 0x1003
+    sw $t0, 31040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xca80
+    lui $t2, 0x1003
+    sw $t0, 31104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdbc0
+    lui $t2, 0x1003
+    sw $t0, 31168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaf80
+    lui $t2, 0x1003
+    sw $t0, 31232($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2e80
+    lui $t2, 0x1003
+    sw $t0, 31296($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd7c0
+    lui $t2, 0x1003
+    sw $t0, 31360($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3f00
+    lui $t2, 0x1003
+    sw $t0, 31424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xecc0
+    lui $t2, 0x1003
+    sw $t0, 31488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd240
+    lui $t2, 0x1003
+    sw $t0, 31552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb5c0
+    lui $t2, 0x1003
+    sw $t0, 31616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa480
+    lui $t2, 0x1003
+    sw $t0, 31680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa700
+    lui $t2, 0x1003
+    sw $t0, 31744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4340
+    lui $t2, 0x1003
+    sw $t0, 31808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe000
+    lui $t2, 0x1003
+    sw $t0, 31872($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7300
+    lui $t2, 0x1003
+    sw $t0, 31936($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2200
+    lui $t2, 0x1003
+    sw $t0, 32000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5cc0
+    lui $t2, 0x1003
+    sw $t0, 32064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1d00
+    lui $t2, 0x1003
+    sw $t0, 32128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe80
+    lui $t2, 0x1003
+    sw $t0, 32192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc380
+    lui $t2, 0x1003
+    sw $t0, 32256($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xab00
+    lui $t2, 0x1003
+    sw $t0, 32320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb280
+    lui $t2, 0x1003
+    sw $t0, 32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x69c0
+    lui $t2, 0x1003
+    sw $t0, 32448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6480
+    lui $t2, 0x1003
+    sw $t0, 32512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd540
+    lui $t2, 0x1003
+    sw $t0, 32576($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf980
+    lui $t2, 0x1003
+    sw $t0, 32640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1cc0
+    lui $t2, 0x1003
+    sw $t0, 32704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5700
+    lui $t2, 0x1004
+    sw $t0, -32768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3b80
+    lui $t2, 0x1004
+    sw $t0, -32704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7340
+    lui $t2, 0x1004
+    sw $t0, -32640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd940
+    lui $t2, 0x1004
+    sw $t0, -32576($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc780
+    lui $t2, 0x1004
+    sw $t0, -32512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2640
+    lui $t2, 0x1004
+    sw $t0, -32448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xdd40
+    lui $t2, 0x1004
+    sw $t0, -32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c00
+    lui $t2, 0x1004
+    sw $t0, -32320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7540
+    lui $t2, 0x1004
+    sw $t0, -32256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe480
+    lui $t2, 0x1004
+    sw $t0, -32192($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf380
+    lui $t2, 0x1004
+    sw $t0, -32128($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2440
+    lui $t2, 0x1004
+    sw $t0, -32064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f40
+    lui $t2, 0x1004
+    sw $t0, -32000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x640
+    lui $t2, 0x1004
+    sw $t0, -31936($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x38c0
+    lui $t2, 0x1004
+    sw $t0, -31872($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9940
+    lui $t2, 0x1004
+    sw $t0, -31808($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3e40
+    lui $t2, 0x1004
+    sw $t0, -31744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a00
+    lui $t2, 0x1004
+    sw $t0, -31680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9fc0
+    lui $t2, 0x1004
+    sw $t0, -31616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4740
+    lui $t2, 0x1004
+    sw $t0, -31552($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x500
+    lui $t2, 0x1004
+    sw $t0, -31488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c0
+    lui $t2, 0x1004
+    sw $t0, -31424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xee40
+    lui $t2, 0x1004
+    sw $t0, -31360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2200
+    lui $t2, 0x1004
+    sw $t0, -31296($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe700
+    lui $t2, 0x1004
+    sw $t0, -31232($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3d80
+    lui $t2, 0x1004
+    sw $t0, -31168($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc1c0
+    lui $t2, 0x1004
+    sw $t0, -31104($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa980
+    lui $t2, 0x1004
+    sw $t0, -31040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7780
+    lui $t2, 0x1004
+    sw $t0, -30976($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4ac0
+    lui $t2, 0x1004
+    sw $t0, -30912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc6c0
+    lui $t2, 0x1004
+    sw $t0, -30848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe500
+    lui $t2, 0x1004
+    sw $t0, -30784($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3200
+    lui $t2, 0x1004
+    sw $t0, -30720($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2e40
+    lui $t2, 0x1004
+    sw $t0, -30656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc140
+    lui $t2, 0x1004
+    sw $t0, -30592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6940
+    lui $t2, 0x1004
+    sw $t0, -30528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4400
+    lui $t2, 0x1004
+    sw $t0, -30464($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe700
+    lui $t2, 0x1004
+    sw $t0, -30400($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x25c0
+    lui $t2, 0x1004
+    sw $t0, -30336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc40
+    lui $t2, 0x1004
+    sw $t0, -30272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc340
+    lui $t2, 0x1004
+    sw $t0, -30208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd740
+    lui $t2, 0x1004
+    sw $t0, -30144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x74c0
+    lui $t2, 0x1004
+    sw $t0, -30080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3680
+    lui $t2, 0x1004
+    sw $t0, -30016($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2d40
+    lui $t2, 0x1004
+    sw $t0, -29952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaac0
+    lui $t2, 0x1004
+    sw $t0, -29888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd1c0
+    lui $t2, 0x1004
+    sw $t0, -29824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xce80
+    lui $t2, 0x1004
+    sw $t0, -29760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4a00
+    lui $t2, 0x1004
+    sw $t0, -29696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x48c0
+    lui $t2, 0x1004
+    sw $t0, -29632($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf200
+    lui $t2, 0x1004
+    sw $t0, -29568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdc80
+    lui $t2, 0x1004
+    sw $t0, -29504($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf340
+    lui $t2, 0x1004
+    sw $t0, -29440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6000
+    lui $t2, 0x1004
+    sw $t0, -29376($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xed40
+    lui $t2, 0x1004
+    sw $t0, -29312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x640
+    lui $t2, 0x1004
+    sw $t0, -29248($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd80
+    lui $t2, 0x1004
+    sw $t0, -29184($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x40c0
+    lui $t2, 0x1004
+    sw $t0, -29120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2f00
+    lui $t2, 0x1004
+    sw $t0, -29056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xab40
+    lui $t2, 0x1004
+    sw $t0, -28992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8280
+    lui $t2, 0x1004
+    sw $t0, -28928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f80
+    lui $t2, 0x1004
+    sw $t0, -28864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc640
+    lui $t2, 0x1004
+    sw $t0, -28800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1980
+    lui $t2, 0x1004
+    sw $t0, -28736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8c80
+    lui $t2, 0x1004
+    sw $t0, -28672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9580
+    lui $t2, 0x1004
+    sw $t0, -28608($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6b80
+    lui $t2, 0x1004
+    sw $t0, -28544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8b80
+    lui $t2, 0x1004
+    sw $t0, -28480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x24c0
+    lui $t2, 0x1004
+    sw $t0, -28416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6cc0
+    lui $t2, 0x1004
+    sw $t0, -28352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf000
+    lui $t2, 0x1004
+    sw $t0, -28288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8f80
+    lui $t2, 0x1004
+    sw $t0, -28224($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 128
+    lui $t2, 0x1004
+    sw $t0, -28160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3280
+    lui $t2, 0x1004
+    sw $t0, -28096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf980
+    lui $t2, 0x1004
+    sw $t0, -28032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6a80
+    lui $t2, 0x1004
+    sw $t0, -27968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d40
+    lui $t2, 0x1004
+    sw $t0, -27904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4340
+    lui $t2, 0x1004
+    sw $t0, -27840($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9540
+    lui $t2, 0x1004
+    sw $t0, -27776($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd500
+    lui $t2, 0x1004
+    sw $t0, -27712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3b80
+    lui $t2, 0x1004
+    sw $t0, -27648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfa80
+    lui $t2, 0x1004
+    sw $t0, -27584($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2c80
+    lui $t2, 0x1004
+    sw $t0, -27520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc8c0
+    lui $t2, 0x1004
+    sw $t0, -27456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2800
+    lui $t2, 0x1004
+    sw $t0, -27392($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x54c0
+    lui $t2, 0x1004
+    sw $t0, -27328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a40
+    lui $t2, 0x1004
+    sw $t0, -27264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x29c0
+    lui $t2, 0x1004
+    sw $t0, -27200($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa6c0
+    lui $t2, 0x1004
+    sw $t0, -27136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb280
+    lui $t2, 0x1004
+    sw $t0, -27072($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5bc0
+    lui $t2, 0x1004
+    sw $t0, -27008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4d00
+    lui $t2, 0x1004
+    sw $t0, -26944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe1c0
+    lui $t2, 0x1004
+    sw $t0, -26880($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7b80
+    lui $t2, 0x1004
+    sw $t0, -26816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa140
+    lui $t2, 0x1004
+    sw $t0, -26752($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5f80
+    lui $t2, 0x1004
+    sw $t0, -26688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x10c0
+    lui $t2, 0x1004
+    sw $t0, -26624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc740
+    lui $t2, 0x1004
+    sw $t0, -26560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6b00
+    lui $t2, 0x1004
+    sw $t0, -26496($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9c0
+    lui $t2, 0x1004
+    sw $t0, -26432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4200
+    lui $t2, 0x1004
+    sw $t0, -26368($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6e00
+    lui $t2, 0x1004
+    sw $t0, -26304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3c0
+    lui $t2, 0x1004
+    sw $t0, -26240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1580
+    lui $t2, 0x1004
+    sw $t0, -26176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2640
+    lui $t2, 0x1004
+    sw $t0, -26112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd580
+    lui $t2, 0x1004
+    sw $t0, -26048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdf00
+    lui $t2, 0x1004
+    sw $t0, -25984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe600
+    lui $t2, 0x1004
+    sw $t0, -25920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7a00
+    lui $t2, 0x1004
+    sw $t0, -25856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x68c0
+    lui $t2, 0x1004
+    sw $t0, -25792($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf400
+    lui $t2, 0x1004
+    sw $t0, -25728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2740
+    lui $t2, 0x1004
+    sw $t0, -25664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcb40
+    lui $t2, 0x1004
+    sw $t0, -25600($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9300
+    lui $t2, 0x1004
+    sw $t0, -25536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4d40
+    lui $t2, 0x1004
+    sw $t0, -25472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7400
+    lui $t2, 0x1004
+    sw $t0, -25408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe7c0
+    lui $t2, 0x1004
+    sw $t0, -25344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdfc0
+    lui $t2, 0x1004
+    sw $t0, -25280($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb080
+    lui $t2, 0x1004
+    sw $t0, -25216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2cc0
+    lui $t2, 0x1004
+    sw $t0, -25152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8e80
+    lui $t2, 0x1004
+    sw $t0, -25088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e40
+    lui $t2, 0x1004
+    sw $t0, -25024($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe780
+    lui $t2, 0x1004
+    sw $t0, -24960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa00
+    lui $t2, 0x1004
+    sw $t0, -24896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5dc0
+    lui $t2, 0x1004
+    sw $t0, -24832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xaf00
+    lui $t2, 0x1004
+    sw $t0, -24768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3780
+    lui $t2, 0x1004
+    sw $t0, -24704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4540
+    lui $t2, 0x1004
+    sw $t0, -24640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5880
+    lui $t2, 0x1004
+    sw $t0, -24576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1a40
+    lui $t2, 0x1004
+    sw $t0, -24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xba00
+    lui $t2, 0x1004
+    sw $t0, -24448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc680
+    lui $t2, 0x1004
+    sw $t0, -24384($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5700
+    lui $t2, 0x1004
+    sw $t0, -24320($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8180
+    lui $t2, 0x1004
+    sw $t0, -24256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1e00
+    lui $t2, 0x1004
+    sw $t0, -24192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x14c0
+    lui $t2, 0x1004
+    sw $t0, -24128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4940
+    lui $t2, 0x1004
+    sw $t0, -24064($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8580
+    lui $t2, 0x1004
+    sw $t0, -24000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d00
+    lui $t2, 0x1004
+    sw $t0, -23936($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3600
+    lui $t2, 0x1004
+    sw $t0, -23872($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa9c0
+    lui $t2, 0x1004
+    sw $t0, -23808($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcf40
+    lui $t2, 0x1004
+    sw $t0, -23744($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc980
+    lui $t2, 0x1004
+    sw $t0, -23680($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd640
+    lui $t2, 0x1004
+    sw $t0, -23616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xeb80
+    lui $t2, 0x1004
+    sw $t0, -23552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5200
+    lui $t2, 0x1004
+    sw $t0, -23488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe140
+    lui $t2, 0x1004
+    sw $t0, -23424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x20c0
+    lui $t2, 0x1004
+    sw $t0, -23360($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe240
+    lui $t2, 0x1004
+    sw $t0, -23296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x380
+    lui $t2, 0x1004
+    sw $t0, -23232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xab00
+    lui $t2, 0x1004
+    sw $t0, -23168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfa80
+    lui $t2, 0x1004
+    sw $t0, -23104($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4940
+    lui $t2, 0x1004
+    sw $t0, -23040($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1dc0
+    lui $t2, 0x1004
+    sw $t0, -22976($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6680
+    lui $t2, 0x1004
+    sw $t0, -22912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xde00
+    lui $t2, 0x1004
+    sw $t0, -22848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9380
+    lui $t2, 0x1004
+    sw $t0, -22784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4500
+    lui $t2, 0x1004
+    sw $t0, -22720($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf440
+    lui $t2, 0x1004
+    sw $t0, -22656($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1300
+    lui $t2, 0x1004
+    sw $t0, -22592($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb400
+    lui $t2, 0x1004
+    sw $t0, -22528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe440
+    lui $t2, 0x1004
+    sw $t0, -22464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x19c0
+    lui $t2, 0x1004
+    sw $t0, -22400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 64
+    lui $t2, 0x1004
+    sw $t0, -22336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4480
+    lui $t2, 0x1004
+    sw $t0, -22272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6ac0
+    lui $t2, 0x1004
+    sw $t0, -22208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd00
+    lui $t2, 0x1004
+    sw $t0, -22144($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x940
+    lui $t2, 0x1004
+    sw $t0, -22080($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8d80
+    lui $t2, 0x1004
+    sw $t0, -22016($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfe40
+    lui $t2, 0x1004
+    sw $t0, -21952($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x59c0
+    lui $t2, 0x1004
+    sw $t0, -21888($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x71c0
+    lui $t2, 0x1004
+    sw $t0, -21824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8380
+    lui $t2, 0x1004
+    sw $t0, -21760($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3e00
+    lui $t2, 0x1004
+    sw $t0, -21696($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6840
+    lui $t2, 0x1004
+    sw $t0, -21632($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3a80
+    lui $t2, 0x1004
+    sw $t0, -21568($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfe40
+    lui $t2, 0x1004
+    sw $t0, -21504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa4c0
+    lui $t2, 0x1004
+    sw $t0, -21440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xecc0
+    lui $t2, 0x1004
+    sw $t0, -21376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc580
+    lui $t2, 0x1004
+    sw $t0, -21312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe8c0
+    lui $t2, 0x1004
+    sw $t0, -21248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3ac0
+    lui $t2, 0x1004
+    sw $t0, -21184($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8740
+    lui $t2, 0x1004
+    sw $t0, -21120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xfb80
+    lui $t2, 0x1004
+    sw $t0, -21056($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb40
+    lui $t2, 0x1004
+    sw $t0, -20992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x28c0
+    lui $t2, 0x1004
+    sw $t0, -20928($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xea80
+    lui $t2, 0x1004
+    sw $t0, -20864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9ac0
+    lui $t2, 0x1004
+    sw $t0, -20800($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb440
+    lui $t2, 0x1004
+    sw $t0, -20736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9440
+    lui $t2, 0x1004
+    sw $t0, -20672($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x77c0
+    lui $t2, 0x1004
+    sw $t0, -20608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8d40
+    lui $t2, 0x1004
+    sw $t0, -20544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8900
+    lui $t2, 0x1004
+    sw $t0, -20480($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x81c0
+    lui $t2, 0x1004
+    sw $t0, -20416($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3a00
+    lui $t2, 0x1004
+    sw $t0, -20352($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd4c0
+    lui $t2, 0x1004
+    sw $t0, -20288($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa4c0
+    lui $t2, 0x1004
+    sw $t0, -20224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x24c0
+    lui $t2, 0x1004
+    sw $t0, -20160($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcb80
+    lui $t2, 0x1004
+    sw $t0, -20096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7e00
+    lui $t2, 0x1004
+    sw $t0, -20032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7680
+    lui $t2, 0x1004
+    sw $t0, -19968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe000
+    lui $t2, 0x1004
+    sw $t0, -19904($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1740
+    lui $t2, 0x1004
+    sw $t0, -19840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x900
+    lui $t2, 0x1004
+    sw $t0, -19776($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcc00
+    lui $t2, 0x1004
+    sw $t0, -19712($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbb80
+    lui $t2, 0x1004
+    sw $t0, -19648($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe7c0
+    lui $t2, 0x1004
+    sw $t0, -19584($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf880
+    lui $t2, 0x1004
+    sw $t0, -19520($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 192
+    lui $t2, 0x1004
+    sw $t0, -19456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x880
+    lui $t2, 0x1004
+    sw $t0, -19392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8640
+    lui $t2, 0x1004
+    sw $t0, -19328($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x28c0
+    lui $t2, 0x1004
+    sw $t0, -19264($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xd800
+    lui $t2, 0x1004
+    sw $t0, -19200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xae40
+    lui $t2, 0x1004
+    sw $t0, -19136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfdc0
+    lui $t2, 0x1004
+    sw $t0, -19072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2880
+    lui $t2, 0x1004
+    sw $t0, -19008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x57c0
+    lui $t2, 0x1004
+    sw $t0, -18944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa2c0
+    lui $t2, 0x1004
+    sw $t0, -18880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf380
+    lui $t2, 0x1004
+    sw $t0, -18816($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9580
+    lui $t2, 0x1004
+    sw $t0, -18752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8500
+    lui $t2, 0x1004
+    sw $t0, -18688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf40
+    lui $t2, 0x1004
+    sw $t0, -18624($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4440
+    lui $t2, 0x1004
+    sw $t0, -18560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x82c0
+    lui $t2, 0x1004
+    sw $t0, -18496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7000
+    lui $t2, 0x1004
+    sw $t0, -18432($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x76c0
+    lui $t2, 0x1004
+    sw $t0, -18368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc4c0
+    lui $t2, 0x1004
+    sw $t0, -18304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9c00
+    lui $t2, 0x1004
+    sw $t0, -18240($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x62c0
+    lui $t2, 0x1004
+    sw $t0, -18176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x940
+    lui $t2, 0x1004
+    sw $t0, -18112($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4440
+    lui $t2, 0x1004
+    sw $t0, -18048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x77c0
+    lui $t2, 0x1004
+    sw $t0, -17984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2a00
+    lui $t2, 0x1004
+    sw $t0, -17920($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5900
+    lui $t2, 0x1004
+    sw $t0, -17856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4dc0
+    lui $t2, 0x1004
+    sw $t0, -17792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa480
+    lui $t2, 0x1004
+    sw $t0, -17728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd0c0
+    lui $t2, 0x1004
+    sw $t0, -17664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf600
+    lui $t2, 0x1004
+    sw $t0, -17600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5340
+    lui $t2, 0x1004
+    sw $t0, -17536($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1f00
+    lui $t2, 0x1004
+    sw $t0, -17472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6180
+    lui $t2, 0x1004
+    sw $t0, -17408($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfc0
+    lui $t2, 0x1004
+    sw $t0, -17344($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5840
+    lui $t2, 0x1004
+    sw $t0, -17280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x18c0
+    lui $t2, 0x1004
+    sw $t0, -17216($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xab80
+    lui $t2, 0x1004
+    sw $t0, -17152($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x380
+    lui $t2, 0x1004
+    sw $t0, -17088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8f00
+    lui $t2, 0x1004
+    sw $t0, -17024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e40
+    lui $t2, 0x1004
+    sw $t0, -16960($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa180
+    lui $t2, 0x1004
+    sw $t0, -16896($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2a40
+    lui $t2, 0x1004
+    sw $t0, -16832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5fc0
+    lui $t2, 0x1004
+    sw $t0, -16768($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5d80
+    lui $t2, 0x1004
+    sw $t0, -16704($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x100
+    lui $t2, 0x1004
+    sw $t0, -16640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb200
+    lui $t2, 0x1004
+    sw $t0, -16576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2f80
+    lui $t2, 0x1004
+    sw $t0, -16512($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa780
+    lui $t2, 0x1004
+    sw $t0, -16448($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3280
+    lui $t2, 0x1004
+    sw $t0, -16384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7380
+    lui $t2, 0x1004
+    sw $t0, -16320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xea40
+    lui $t2, 0x1004
+    sw $t0, -16256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5040
+    lui $t2, 0x1004
+    sw $t0, -16192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8b80
+    lui $t2, 0x1004
+    sw $t0, -16128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xac80
+    lui $t2, 0x1004
+    sw $t0, -16064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9200
+    lui $t2, 0x1004
+    sw $t0, -16000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x980
+    lui $t2, 0x1004
+    sw $t0, -15936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xad80
+    lui $t2, 0x1004
+    sw $t0, -15872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x37c0
+    lui $t2, 0x1004
+    sw $t0, -15808($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xaec0
+    lui $t2, 0x1004
+    sw $t0, -15744($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xda40
+    lui $t2, 0x1004
+    sw $t0, -15680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8ac0
+    lui $t2, 0x1004
+    sw $t0, -15616($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa640
+    lui $t2, 0x1004
+    sw $t0, -15552($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x62c0
+    lui $t2, 0x1004
+    sw $t0, -15488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xccc0
+    lui $t2, 0x1004
+    sw $t0, -15424($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x100
+    lui $t2, 0x1004
+    sw $t0, -15360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8840
+    lui $t2, 0x1004
+    sw $t0, -15296($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4a00
+    lui $t2, 0x1004
+    sw $t0, -15232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa380
+    lui $t2, 0x1004
+    sw $t0, -15168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9240
+    lui $t2, 0x1004
+    sw $t0, -15104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xce40
+    lui $t2, 0x1004
+    sw $t0, -15040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc540
+    lui $t2, 0x1004
+    sw $t0, -14976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7700
+    lui $t2, 0x1004
+    sw $t0, -14912($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5200
+    lui $t2, 0x1004
+    sw $t0, -14848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd580
+    lui $t2, 0x1004
+    sw $t0, -14784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc280
+    lui $t2, 0x1004
+    sw $t0, -14720($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbf80
+    lui $t2, 0x1004
+    sw $t0, -14656($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5b80
+    lui $t2, 0x1004
+    sw $t0, -14592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7cc0
+    lui $t2, 0x1004
+    sw $t0, -14528($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa780
+    lui $t2, 0x1004
+    sw $t0, -14464($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8880
+    lui $t2, 0x1004
+    sw $t0, -14400($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5d80
+    lui $t2, 0x1004
+    sw $t0, -14336($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3600
+    lui $t2, 0x1004
+    sw $t0, -14272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1b80
+    lui $t2, 0x1004
+    sw $t0, -14208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6700
+    lui $t2, 0x1004
+    sw $t0, -14144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7d40
+    lui $t2, 0x1004
+    sw $t0, -14080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa6c0
+    lui $t2, 0x1004
+    sw $t0, -14016($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7500
+    lui $t2, 0x1004
+    sw $t0, -13952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb080
+    lui $t2, 0x1004
+    sw $t0, -13888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x780
+    lui $t2, 0x1004
+    sw $t0, -13824($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x48c0
+    lui $t2, 0x1004
+    sw $t0, -13760($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa540
+    lui $t2, 0x1004
+    sw $t0, -13696($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc6c0
+    lui $t2, 0x1004
+    sw $t0, -13632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7440
+    lui $t2, 0x1004
+    sw $t0, -13568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3fc0
+    lui $t2, 0x1004
+    sw $t0, -13504($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4a80
+    lui $t2, 0x1004
+    sw $t0, -13440($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb5c0
+    lui $t2, 0x1004
+    sw $t0, -13376($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xddc0
+    lui $t2, 0x1004
+    sw $t0, -13312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x90c0
+    lui $t2, 0x1004
+    sw $t0, -13248($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc680
+    lui $t2, 0x1004
+    sw $t0, -13184($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xb480
+    lui $t2, 0x1004
+    sw $t0, -13120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc940
+    lui $t2, 0x1004
+    sw $t0, -13056($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x52c0
+    lui $t2, 0x1004
+    sw $t0, -12992($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4680
+    lui $t2, 0x1004
+    sw $t0, -12928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4180
+    lui $t2, 0x1004
+    sw $t0, -12864($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf200
+    lui $t2, 0x1004
+    sw $t0, -12800($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x78c0
+    lui $t2, 0x1004
+    sw $t0, -12736($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5640
+    lui $t2, 0x1004
+    sw $t0, -12672($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc0c0
+    lui $t2, 0x1004
+    sw $t0, -12608($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xce80
+    lui $t2, 0x1004
+    sw $t0, -12544($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xd6c0
+    lui $t2, 0x1004
+    sw $t0, -12480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6040
+    lui $t2, 0x1004
+    sw $t0, -12416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9780
+    lui $t2, 0x1004
+    sw $t0, -12352($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdbc0
+    lui $t2, 0x1004
+    sw $t0, -12288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe100
+    lui $t2, 0x1004
+    sw $t0, -12224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8d00
+    lui $t2, 0x1004
+    sw $t0, -12160($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbd80
+    lui $t2, 0x1004
+    sw $t0, -12096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3600
+    lui $t2, 0x1004
+    sw $t0, -12032($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x98c0
+    lui $t2, 0x1004
+    sw $t0, -11968($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa100
+    lui $t2, 0x1004
+    sw $t0, -11904($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4840
+    lui $t2, 0x1004
+    sw $t0, -11840($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x1d80
+    lui $t2, 0x1004
+    sw $t0, -11776($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa900
+    lui $t2, 0x1004
+    sw $t0, -11712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9e00
+    lui $t2, 0x1004
+    sw $t0, -11648($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa5c0
+    lui $t2, 0x1004
+    sw $t0, -11584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2080
+    lui $t2, 0x1004
+    sw $t0, -11520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7b40
+    lui $t2, 0x1004
+    sw $t0, -11456($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd740
+    lui $t2, 0x1004
+    sw $t0, -11392($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x21c0
+    lui $t2, 0x1004
+    sw $t0, -11328($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9780
+    lui $t2, 0x1004
+    sw $t0, -11264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8f80
+    lui $t2, 0x1004
+    sw $t0, -11200($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5600
+    lui $t2, 0x1004
+    sw $t0, -11136($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x17c0
+    lui $t2, 0x1004
+    sw $t0, -11072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb440
+    lui $t2, 0x1004
+    sw $t0, -11008($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6b80
+    lui $t2, 0x1004
+    sw $t0, -10944($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6340
+    lui $t2, 0x1004
+    sw $t0, -10880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfec0
+    lui $t2, 0x1004
+    sw $t0, -10816($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc240
+    lui $t2, 0x1004
+    sw $t0, -10752($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x3100
+    lui $t2, 0x1004
+    sw $t0, -10688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7c00
+    lui $t2, 0x1004
+    sw $t0, -10624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe540
+    lui $t2, 0x1004
+    sw $t0, -10560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf5c0
+    lui $t2, 0x1004
+    sw $t0, -10496($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf00
+    lui $t2, 0x1004
+    sw $t0, -10432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8000
+    lui $t2, 0x1004
+    sw $t0, -10368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbb00
+    lui $t2, 0x1004
+    sw $t0, -10304($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x95c0
+    lui $t2, 0x1004
+    sw $t0, -10240($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7840
+    lui $t2, 0x1004
+    sw $t0, -10176($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7400
+    lui $t2, 0x1004
+    sw $t0, -10112($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2f00
+    lui $t2, 0x1004
+    sw $t0, -10048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2840
+    lui $t2, 0x1004
+    sw $t0, -9984($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2ec0
+    lui $t2, 0x1004
+    sw $t0, -9920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3300
+    lui $t2, 0x1004
+    sw $t0, -9856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe100
+    lui $t2, 0x1004
+    sw $t0, -9792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xbd00
+    lui $t2, 0x1004
+    sw $t0, -9728($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xba00
+    lui $t2, 0x1004
+    sw $t0, -9664($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb840
+    lui $t2, 0x1004
+    sw $t0, -9600($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x74c0
+    lui $t2, 0x1004
+    sw $t0, -9536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4140
+    lui $t2, 0x1004
+    sw $t0, -9472($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8300
+    lui $t2, 0x1004
+    sw $t0, -9408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xab00
+    lui $t2, 0x1004
+    sw $t0, -9344($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6240
+    lui $t2, 0x1004
+    sw $t0, -9280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4280
+    lui $t2, 0x1004
+    sw $t0, -9216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x10c0
+    lui $t2, 0x1004
+    sw $t0, -9152($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc500
+    lui $t2, 0x1004
+    sw $t0, -9088($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8a00
+    lui $t2, 0x1004
+    sw $t0, -9024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe000
+    lui $t2, 0x1004
+    sw $t0, -8960($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf040
+    lui $t2, 0x1004
+    sw $t0, -8896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfe00
+    lui $t2, 0x1004
+    sw $t0, -8832($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9140
+    lui $t2, 0x1004
+    sw $t0, -8768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x8140
+    lui $t2, 0x1004
+    sw $t0, -8704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c80
+    lui $t2, 0x1004
+    sw $t0, -8640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xbf00
+    lui $t2, 0x1004
+    sw $t0, -8576($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xe6c0
+    lui $t2, 0x1004
+    sw $t0, -8512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3740
+    lui $t2, 0x1004
+    sw $t0, -8448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf740
+    lui $t2, 0x1004
+    sw $t0, -8384($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x1d40
+    lui $t2, 0x1004
+    sw $t0, -8320($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa280
+    lui $t2, 0x1004
+    sw $t0, -8256($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x4980
+    lui $t2, 0x1004
+    sw $t0, -8192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5140
+    lui $t2, 0x1004
+    sw $t0, -8128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xde00
+    lui $t2, 0x1004
+    sw $t0, -8064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8e80
+    lui $t2, 0x1004
+    sw $t0, -8000($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x38c0
+    lui $t2, 0x1004
+    sw $t0, -7936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2180
+    lui $t2, 0x1004
+    sw $t0, -7872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8940
+    lui $t2, 0x1004
+    sw $t0, -7808($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xcf40
+    lui $t2, 0x1004
+    sw $t0, -7744($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x60c0
+    lui $t2, 0x1004
+    sw $t0, -7680($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xec40
+    lui $t2, 0x1004
+    sw $t0, -7616($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6d80
+    lui $t2, 0x1004
+    sw $t0, -7552($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x79c0
+    lui $t2, 0x1004
+    sw $t0, -7488($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x46c0
+    lui $t2, 0x1004
+    sw $t0, -7424($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3140
+    lui $t2, 0x1004
+    sw $t0, -7360($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4c0
+    lui $t2, 0x1004
+    sw $t0, -7296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x580
+    lui $t2, 0x1004
+    sw $t0, -7232($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6e40
+    lui $t2, 0x1004
+    sw $t0, -7168($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6d00
+    lui $t2, 0x1004
+    sw $t0, -7104($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4a40
+    lui $t2, 0x1004
+    sw $t0, -7040($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xf840
+    lui $t2, 0x1004
+    sw $t0, -6976($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x59c0
+    lui $t2, 0x1004
+    sw $t0, -6912($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xb580
+    lui $t2, 0x1004
+    sw $t0, -6848($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9d40
+    lui $t2, 0x1004
+    sw $t0, -6784($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x8500
+    lui $t2, 0x1004
+    sw $t0, -6720($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xd640
+    lui $t2, 0x1004
+    sw $t0, -6656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3680
+    lui $t2, 0x1004
+    sw $t0, -6592($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7600
+    lui $t2, 0x1004
+    sw $t0, -6528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd1c0
+    lui $t2, 0x1004
+    sw $t0, -6464($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9c00
+    lui $t2, 0x1004
+    sw $t0, -6400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x440
+    lui $t2, 0x1004
+    sw $t0, -6336($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa940
+    lui $t2, 0x1004
+    sw $t0, -6272($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xba00
+    lui $t2, 0x1004
+    sw $t0, -6208($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xfc00
+    lui $t2, 0x1004
+    sw $t0, -6144($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x480
+    lui $t2, 0x1004
+    sw $t0, -6080($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2380
+    lui $t2, 0x1004
+    sw $t0, -6016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdb40
+    lui $t2, 0x1004
+    sw $t0, -5952($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x79c0
+    lui $t2, 0x1004
+    sw $t0, -5888($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7940
+    lui $t2, 0x1004
+    sw $t0, -5824($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xcfc0
+    lui $t2, 0x1004
+    sw $t0, -5760($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xf000
+    lui $t2, 0x1004
+    sw $t0, -5696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c80
+    lui $t2, 0x1004
+    sw $t0, -5632($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x6dc0
+    lui $t2, 0x1004
+    sw $t0, -5568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d80
+    lui $t2, 0x1004
+    sw $t0, -5504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6640
+    lui $t2, 0x1004
+    sw $t0, -5440($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x16c0
+    lui $t2, 0x1004
+    sw $t0, -5376($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x2b00
+    lui $t2, 0x1004
+    sw $t0, -5312($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x7980
+    lui $t2, 0x1004
+    sw $t0, -5248($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xe2c0
+    lui $t2, 0x1004
+    sw $t0, -5184($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xe2c0
+    lui $t2, 0x1004
+    sw $t0, -5120($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x5980
+    lui $t2, 0x1004
+    sw $t0, -5056($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa600
+    lui $t2, 0x1004
+    sw $t0, -4992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d40
+    lui $t2, 0x1004
+    sw $t0, -4928($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2940
+    lui $t2, 0x1004
+    sw $t0, -4864($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa80
+    lui $t2, 0x1004
+    sw $t0, -4800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a80
+    lui $t2, 0x1004
+    sw $t0, -4736($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3c40
+    lui $t2, 0x1004
+    sw $t0, -4672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa240
+    lui $t2, 0x1004
+    sw $t0, -4608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d00
+    lui $t2, 0x1004
+    sw $t0, -4544($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc80
+    lui $t2, 0x1004
+    sw $t0, -4480($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x6180
+    lui $t2, 0x1004
+    sw $t0, -4416($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x7440
+    lui $t2, 0x1004
+    sw $t0, -4352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x67c0
+    lui $t2, 0x1004
+    sw $t0, -4288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x22c0
+    lui $t2, 0x1004
+    sw $t0, -4224($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x4180
+    lui $t2, 0x1004
+    sw $t0, -4160($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xee80
+    lui $t2, 0x1004
+    sw $t0, -4096($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdc0
+    lui $t2, 0x1004
+    sw $t0, -4032($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5e40
+    lui $t2, 0x1004
+    sw $t0, -3968($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc380
+    lui $t2, 0x1004
+    sw $t0, -3904($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xb080
+    lui $t2, 0x1004
+    sw $t0, -3840($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfb00
+    lui $t2, 0x1004
+    sw $t0, -3776($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1b00
+    lui $t2, 0x1004
+    sw $t0, -3712($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc940
+    lui $t2, 0x1004
+    sw $t0, -3648($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7740
+    lui $t2, 0x1004
+    sw $t0, -3584($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc4c0
+    lui $t2, 0x1004
+    sw $t0, -3520($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x4e80
+    lui $t2, 0x1004
+    sw $t0, -3456($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x5d00
+    lui $t2, 0x1004
+    sw $t0, -3392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xec0
+    lui $t2, 0x1004
+    sw $t0, -3328($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xde80
+    lui $t2, 0x1004
+    sw $t0, -3264($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1100
+    lui $t2, 0x1004
+    sw $t0, -3200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1800
+    lui $t2, 0x1004
+    sw $t0, -3136($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc100
+    lui $t2, 0x1004
+    sw $t0, -3072($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x2740
+    lui $t2, 0x1004
+    sw $t0, -3008($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x8bc0
+    lui $t2, 0x1004
+    sw $t0, -2944($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc080
+    lui $t2, 0x1004
+    sw $t0, -2880($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xa200
+    lui $t2, 0x1004
+    sw $t0, -2816($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9240
+    lui $t2, 0x1004
+    sw $t0, -2752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6000
+    lui $t2, 0x1004
+    sw $t0, -2688($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x12c0
+    lui $t2, 0x1004
+    sw $t0, -2624($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x89c0
+    lui $t2, 0x1004
+    sw $t0, -2560($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9840
+    lui $t2, 0x1004
+    sw $t0, -2496($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9bc0
+    lui $t2, 0x1004
+    sw $t0, -2432($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xa940
+    lui $t2, 0x1004
+    sw $t0, -2368($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x700
+    lui $t2, 0x1004
+    sw $t0, -2304($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xee40
+    lui $t2, 0x1004
+    sw $t0, -2240($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x5000
+    lui $t2, 0x1004
+    sw $t0, -2176($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xc200
+    lui $t2, 0x1004
+    sw $t0, -2112($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x9000
+    lui $t2, 0x1004
+    sw $t0, -2048($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9540
+    lui $t2, 0x1004
+    sw $t0, -1984($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xdd80
+    lui $t2, 0x1004
+    sw $t0, -1920($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3bc0
+    lui $t2, 0x1004
+    sw $t0, -1856($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x66c0
+    lui $t2, 0x1004
+    sw $t0, -1792($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x2c80
+    lui $t2, 0x1004
+    sw $t0, -1728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc80
+    lui $t2, 0x1004
+    sw $t0, -1664($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa000
+    lui $t2, 0x1004
+    sw $t0, -1600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc300
+    lui $t2, 0x1004
+    sw $t0, -1536($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x3240
+    lui $t2, 0x1004
+    sw $t0, -1472($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xca80
+    lui $t2, 0x1004
+    sw $t0, -1408($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xa340
+    lui $t2, 0x1004
+    sw $t0, -1344($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xc800
+    lui $t2, 0x1004
+    sw $t0, -1280($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9800
+    lui $t2, 0x1004
+    sw $t0, -1216($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7d80
+    lui $t2, 0x1004
+    sw $t0, -1152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf800
+    lui $t2, 0x1004
+    sw $t0, -1088($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3fc0
+    lui $t2, 0x1004
+    sw $t0, -1024($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x1940
+    lui $t2, 0x1004
+    sw $t0, -960($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xed80
+    lui $t2, 0x1004
+    sw $t0, -896($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0xf2c0
+    lui $t2, 0x1004
+    sw $t0, -832($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x6300
+    lui $t2, 0x1004
+    sw $t0, -768($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xdf40
+    lui $t2, 0x1004
+    sw $t0, -704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe040
+    lui $t2, 0x1004
+    sw $t0, -640($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x9e00
+    lui $t2, 0x1004
+    sw $t0, -576($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x9f80
+    lui $t2, 0x1004
+    sw $t0, -512($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xc500
+    lui $t2, 0x1004
+    sw $t0, -448($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0x7100
+    lui $t2, 0x1004
+    sw $t0, -384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe340
+    lui $t2, 0x1004
+    sw $t0, -320($t2)
+    lui $t0, 0x1001
+    ori $t0, $t0, 0x61c0
+    lui $t2, 0x1004
+    sw $t0, -256($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0xcf80
+    lui $t2, 0x1004
+    sw $t0, -192($t2)
+    lui $t0, 0x1003
+    ori $t0, $t0, 0x3380
+    lui $t2, 0x1004
+    sw $t0, -128($t2)
+    lui $t0, 0x1002
+    ori $t0, $t0, 0xfd00
+    lui $t2, 0x1004
+    sw $t0, -64($t2)
+    addu $t0, $s0, $zero
+loop:
+    lw $t0, 0($t0)
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
@@ -0,0 +1,16388 @@
+3c101000
+34094000
+3c081002
+35083f40
+3c0a1000
+ad480000
+3c081001
+35082900
+3c0a1000
+ad480040
+3c081003
+35088380
+3c0a1000
+ad480080
+3c081003
+3508a500
+3c0a1000
+ad4800c0
+3c081001
+35084b80
+3c0a1000
+ad480100
+3c081003
+35085680
+3c0a1000
+ad480140
+3c081002
+350868c0
+3c0a1000
+ad480180
+3c081001
+35086280
+3c0a1000
+ad4801c0
+3c081000
+35088700
+3c0a1000
+ad480200
+3c081003
+350811c0
+3c0a1000
+ad480240
+3c081001
+3508e440
+3c0a1000
+ad480280
+3c081003
+35084b00
+3c0a1000
+ad4802c0
+3c081002
+35083240
+3c0a1000
+ad480300
+3c081000
+3508c000
+3c0a1000
+ad480340
+3c081001
+35082340
+3c0a1000
+ad480380
+3c081002
+35081b00
+3c0a1000
+ad4803c0
+3c081002
+35083a80
+3c0a1000
+ad480400
+3c081002
+35083d00
+3c0a1000
+ad480440
+3c081003
+35089d80
+3c0a1000
+ad480480
+3c081002
+35085580
+3c0a1000
+ad4804c0
+3c081000
+35085c40
+3c0a1000
+ad480500
+3c081001
+3508d280
+3c0a1000
+ad480540
+3c081000
+35081000
+3c0a1000
+ad480580
+3c081002
+35089180
+3c0a1000
+ad4805c0
+3c081002
+3508eb00
+3c0a1000
+ad480600
+3c081003
+35080c40
+3c0a1000
+ad480640
+3c081002
+35085540
+3c0a1000
+ad480680
+3c081001
+3508d580
+3c0a1000
+ad4806c0
+3c081003
+3508d5c0
+3c0a1000
+ad480700
+3c081002
+35089340
+3c0a1000
+ad480740
+3c081001
+35080f40
+3c0a1000
+ad480780
+3c081001
+3508f1c0
+3c0a1000
+ad4807c0
+3c081000
+35089080
+3c0a1000
+ad480800
+3c081002
+35089640
+3c0a1000
+ad480840
+3c081000
+3508ce40
+3c0a1000
+ad480880
+3c081000
+350885c0
+3c0a1000
+ad4808c0
+3c081002
+3508cc40
+3c0a1000
+ad480900
+3c081001
+35082680
+3c0a1000
+ad480940
+3c081002
+35082a80
+3c0a1000
+ad480980
+3c081000
+3508aa80
+3c0a1000
+ad4809c0
+3c081002
+35088c00
+3c0a1000
+ad480a00
+3c081003
+3508f740
+3c0a1000
+ad480a40
+3c081002
+35086c00
+3c0a1000
+ad480a80
+3c081003
+35086b00
+3c0a1000
+ad480ac0
+3c081000
+35081c00
+3c0a1000
+ad480b00
+3c081001
+3508d040
+3c0a1000
+ad480b40
+3c081000
+35080200
+3c0a1000
+ad480b80
+3c081001
+35081f80
+3c0a1000
+ad480bc0
+3c081000
+3508ba40
+3c0a1000
+ad480c00
+3c081000
+35089980
+3c0a1000
+ad480c40
+3c081003
+350826c0
+3c0a1000
+ad480c80
+3c081000
+3508e880
+3c0a1000
+ad480cc0
+3c081003
+3508f5c0
+3c0a1000
+ad480d00
+3c081001
+35086ec0
+3c0a1000
+ad480d40
+3c081003
+3508db40
+3c0a1000
+ad480d80
+3c081002
+3508fd40
+3c0a1000
+ad480dc0
+3c081001
+3508df00
+3c0a1000
+ad480e00
+3c081002
+35084f40
+3c0a1000
+ad480e40
+3c081002
+3508aa40
+3c0a1000
+ad480e80
+3c081002
+350831c0
+3c0a1000
+ad480ec0
+3c081001
+3508d000
+3c0a1000
+ad480f00
+3c081003
+3508fc00
+3c0a1000
+ad480f40
+3c081001
+35089100
+3c0a1000
+ad480f80
+3c081000
+35081f40
+3c0a1000
+ad480fc0
+3c081000
+35082f80
+3c0a1000
+ad481000
+3c081001
+35082880
+3c0a1000
+ad481040
+3c081003
+35081480
+3c0a1000
+ad481080
+3c081003
+35080a40
+3c0a1000
+ad4810c0
+3c081002
+350865c0
+3c0a1000
+ad481100
+3c081003
+35087900
+3c0a1000
+ad481140
+3c081001
+35082380
+3c0a1000
+ad481180
+3c081002
+3c0a1000
+ad4811c0
+3c081003
+3508dfc0
+3c0a1000
+ad481200
+3c081000
+35084440
+3c0a1000
+ad481240
+3c081000
+3508e700
+3c0a1000
+ad481280
+3c081001
+35082040
+3c0a1000
+ad4812c0
+3c081001
+35082080
+3c0a1000
+ad481300
+3c081001
+350804c0
+3c0a1000
+ad481340
+3c081003
+35088b40
+3c0a1000
+ad481380
+3c081003
+3508b5c0
+3c0a1000
+ad4813c0
+3c081002
+3508e1c0
+3c0a1000
+ad481400
+3c081001
+3508c540
+3c0a1000
+ad481440
+3c081002
+35082f40
+3c0a1000
+ad481480
+3c081000
+35080480
+3c0a1000
+ad4814c0
+3c081000
+3508e180
+3c0a1000
+ad481500
+3c081001
+3508f080
+3c0a1000
+ad481540
+3c081003
+350844c0
+3c0a1000
+ad481580
+3c081003
+35086d00
+3c0a1000
+ad4815c0
+3c081001
+3508ae00
+3c0a1000
+ad481600
+3c081003
+3508b4c0
+3c0a1000
+ad481640
+3c081001
+3508ba80
+3c0a1000
+ad481680
+3c081000
+3508a6c0
+3c0a1000
+ad4816c0
+3c081000
+35081f80
+3c0a1000
+ad481700
+3c081003
+3508a740
+3c0a1000
+ad481740
+3c081003
+35083240
+3c0a1000
+ad481780
+3c081003
+3508a7c0
+3c0a1000
+ad4817c0
+3c081002
+35086400
+3c0a1000
+ad481800
+3c081000
+35087500
+3c0a1000
+ad481840
+3c081001
+3508e300
+3c0a1000
+ad481880
+3c081003
+3508dec0
+3c0a1000
+ad4818c0
+3c081001
+3508f180
+3c0a1000
+ad481900
+3c081001
+3508c900
+3c0a1000
+ad481940
+3c081001
+3508a600
+3c0a1000
+ad481980
+3c081001
+35086240
+3c0a1000
+ad4819c0
+3c081002
+35086a40
+3c0a1000
+ad481a00
+3c081000
+35081700
+3c0a1000
+ad481a40
+3c081002
+35085780
+3c0a1000
+ad481a80
+3c081003
+35086040
+3c0a1000
+ad481ac0
+3c081000
+3508eac0
+3c0a1000
+ad481b00
+3c081000
+3508f380
+3c0a1000
+ad481b40
+3c081000
+3508f0c0
+3c0a1000
+ad481b80
+3c081001
+35087c00
+3c0a1000
+ad481bc0
+3c081000
+350828c0
+3c0a1000
+ad481c00
+3c081001
+3508a740
+3c0a1000
+ad481c40
+3c081000
+3508c2c0
+3c0a1000
+ad481c80
+3c081002
+35086680
+3c0a1000
+ad481cc0
+3c081000
+3508fcc0
+3c0a1000
+ad481d00
+3c081001
+3508f3c0
+3c0a1000
+ad481d40
+3c081000
+35083d40
+3c0a1000
+ad481d80
+3c081002
+3508e780
+3c0a1000
+ad481dc0
+3c081000
+3508ac00
+3c0a1000
+ad481e00
+3c081000
+35083240
+3c0a1000
+ad481e40
+3c081002
+3508ee80
+3c0a1000
+ad481e80
+3c081000
+3508c880
+3c0a1000
+ad481ec0
+3c081002
+35082480
+3c0a1000
+ad481f00
+3c081000
+35089c00
+3c0a1000
+ad481f40
+3c081001
+35084540
+3c0a1000
+ad481f80
+3c081000
+350815c0
+3c0a1000
+ad481fc0
+3c081003
+3508c400
+3c0a1000
+ad482000
+3c081002
+35080a00
+3c0a1000
+ad482040
+3c081001
+35086c40
+3c0a1000
+ad482080
+3c081002
+3508e400
+3c0a1000
+ad4820c0
+3c081001
+350841c0
+3c0a1000
+ad482100
+3c081001
+35080580
+3c0a1000
+ad482140
+3c081003
+3508aa00
+3c0a1000
+ad482180
+3c081000
+35088e40
+3c0a1000
+ad4821c0
+3c081002
+35082040
+3c0a1000
+ad482200
+3c081003
+3508f600
+3c0a1000
+ad482240
+3c081003
+3508e140
+3c0a1000
+ad482280
+3c081002
+3508fb40
+3c0a1000
+ad4822c0
+3c081003
+35082800
+3c0a1000
+ad482300
+3c081001
+35083540
+3c0a1000
+ad482340
+3c081003
+35086a00
+3c0a1000
+ad482380
+3c081002
+3508bbc0
+3c0a1000
+ad4823c0
+3c081000
+350845c0
+3c0a1000
+ad482400
+3c081000
+35089600
+3c0a1000
+ad482440
+3c081003
+35088600
+3c0a1000
+ad482480
+3c081002
+3508a740
+3c0a1000
+ad4824c0
+3c081003
+3508f6c0
+3c0a1000
+ad482500
+3c081002
+35084380
+3c0a1000
+ad482540
+3c081002
+3508b1c0
+3c0a1000
+ad482580
+3c081001
+35084ec0
+3c0a1000
+ad4825c0
+3c081002
+3508bec0
+3c0a1000
+ad482600
+3c081001
+35088080
+3c0a1000
+ad482640
+3c081002
+35080940
+3c0a1000
+ad482680
+3c081001
+35081240
+3c0a1000
+ad4826c0
+3c081003
+35086700
+3c0a1000
+ad482700
+3c081001
+35081600
+3c0a1000
+ad482740
+3c081002
+35087d00
+3c0a1000
+ad482780
+3c081000
+35089ec0
+3c0a1000
+ad4827c0
+3c081002
+35081780
+3c0a1000
+ad482800
+3c081001
+35084880
+3c0a1000
+ad482840
+3c081002
+350880c0
+3c0a1000
+ad482880
+3c081003
+3508f680
+3c0a1000
+ad4828c0
+3c081003
+35082900
+3c0a1000
+ad482900
+3c081001
+35084040
+3c0a1000
+ad482940
+3c081002
+3508e700
+3c0a1000
+ad482980
+3c081002
+3508eb80
+3c0a1000
+ad4829c0
+3c081001
+35086f00
+3c0a1000
+ad482a00
+3c081001
+35083a40
+3c0a1000
+ad482a40
+3c081000
+3508ce00
+3c0a1000
+ad482a80
+3c081001
+35083cc0
+3c0a1000
+ad482ac0
+3c081003
+35084ec0
+3c0a1000
+ad482b00
+3c081000
+350800c0
+3c0a1000
+ad482b40
+3c081001
+3508c680
+3c0a1000
+ad482b80
+3c081003
+35086540
+3c0a1000
+ad482bc0
+3c081000
+35088440
+3c0a1000
+ad482c00
+3c081003
+35081440
+3c0a1000
+ad482c40
+3c081002
+35083580
+3c0a1000
+ad482c80
+3c081001
+3508e0c0
+3c0a1000
+ad482cc0
+3c081000
+35083b80
+3c0a1000
+ad482d00
+3c081000
+35089b80
+3c0a1000
+ad482d40
+3c081002
+35089f00
+3c0a1000
+ad482d80
+3c081001
+3508e980
+3c0a1000
+ad482dc0
+3c081001
+3508b680
+3c0a1000
+ad482e00
+3c081000
+3508bf40
+3c0a1000
+ad482e40
+3c081002
+35080ac0
+3c0a1000
+ad482e80
+3c081003
+350802c0
+3c0a1000
+ad482ec0
+3c081003
+35082600
+3c0a1000
+ad482f00
+3c081002
+35088d40
+3c0a1000
+ad482f40
+3c081000
+350850c0
+3c0a1000
+ad482f80
+3c081000
+3508b3c0
+3c0a1000
+ad482fc0
+3c081003
+3508a640
+3c0a1000
+ad483000
+3c081001
+35086340
+3c0a1000
+ad483040
+3c081001
+35088b40
+3c0a1000
+ad483080
+3c081003
+350880c0
+3c0a1000
+ad4830c0
+3c081002
+3508b580
+3c0a1000
+ad483100
+3c081001
+35086100
+3c0a1000
+ad483140
+3c081000
+3508e0c0
+3c0a1000
+ad483180
+3c081000
+3508a1c0
+3c0a1000
+ad4831c0
+3c081000
+35088a00
+3c0a1000
+ad483200
+3c081003
+35080d00
+3c0a1000
+ad483240
+3c081001
+35082100
+3c0a1000
+ad483280
+3c081000
+35086c00
+3c0a1000
+ad4832c0
+3c081002
+3508f280
+3c0a1000
+ad483300
+3c081002
+35082800
+3c0a1000
+ad483340
+3c081002
+35087ac0
+3c0a1000
+ad483380
+3c081000
+35080780
+3c0a1000
+ad4833c0
+3c081003
+3508c980
+3c0a1000
+ad483400
+3c081002
+350872c0
+3c0a1000
+ad483440
+3c081001
+3508ae80
+3c0a1000
+ad483480
+3c081000
+35083500
+3c0a1000
+ad4834c0
+3c081000
+35084fc0
+3c0a1000
+ad483500
+3c081002
+35083cc0
+3c0a1000
+ad483540
+3c081003
+35082140
+3c0a1000
+ad483580
+3c081000
+35080ac0
+3c0a1000
+ad4835c0
+3c081001
+35085580
+3c0a1000
+ad483600
+3c081000
+35082e00
+3c0a1000
+ad483640
+3c081000
+35086f40
+3c0a1000
+ad483680
+3c081003
+3508f9c0
+3c0a1000
+ad4836c0
+3c081002
+35080600
+3c0a1000
+ad483700
+3c081000
+35088880
+3c0a1000
+ad483740
+3c081000
+35089640
+3c0a1000
+ad483780
+3c081003
+3508c2c0
+3c0a1000
+ad4837c0
+3c081000
+35085300
+3c0a1000
+ad483800
+3c081003
+35089940
+3c0a1000
+ad483840
+3c081001
+3508d400
+3c0a1000
+ad483880
+3c081000
+35082e40
+3c0a1000
+ad4838c0
+3c081001
+350848c0
+3c0a1000
+ad483900
+3c081003
+3508b900
+3c0a1000
+ad483940
+3c081003
+3508ccc0
+3c0a1000
+ad483980
+3c081000
+35083cc0
+3c0a1000
+ad4839c0
+3c081003
+35083a80
+3c0a1000
+ad483a00
+3c081003
+35081240
+3c0a1000
+ad483a40
+3c081002
+35082bc0
+3c0a1000
+ad483a80
+3c081000
+3508f540
+3c0a1000
+ad483ac0
+3c081000
+35089d00
+3c0a1000
+ad483b00
+3c081003
+35081a40
+3c0a1000
+ad483b40
+3c081002
+3508b500
+3c0a1000
+ad483b80
+3c081001
+35088980
+3c0a1000
+ad483bc0
+3c081002
+35086500
+3c0a1000
+ad483c00
+3c081001
+3508b4c0
+3c0a1000
+ad483c40
+3c081001
+35088ac0
+3c0a1000
+ad483c80
+3c081000
+3508c440
+3c0a1000
+ad483cc0
+3c081002
+3508bb00
+3c0a1000
+ad483d00
+3c081000
+35085f00
+3c0a1000
+ad483d40
+3c081000
+3508a880
+3c0a1000
+ad483d80
+3c081000
+3508fb80
+3c0a1000
+ad483dc0
+3c081000
+35086900
+3c0a1000
+ad483e00
+3c081003
+3508b540
+3c0a1000
+ad483e40
+3c081002
+35082600
+3c0a1000
+ad483e80
+3c081001
+35080340
+3c0a1000
+ad483ec0
+3c081001
+35087f40
+3c0a1000
+ad483f00
+3c081002
+35080b00
+3c0a1000
+ad483f40
+3c081002
+35085600
+3c0a1000
+ad483f80
+3c081002
+35081700
+3c0a1000
+ad483fc0
+3c081000
+35081380
+3c0a1000
+ad484000
+3c081000
+35088740
+3c0a1000
+ad484040
+3c081001
+35089840
+3c0a1000
+ad484080
+3c081003
+35080e40
+3c0a1000
+ad4840c0
+3c081001
+35082240
+3c0a1000
+ad484100
+3c081002
+35084040
+3c0a1000
+ad484140
+3c081001
+35085540
+3c0a1000
+ad484180
+3c081000
+35084080
+3c0a1000
+ad4841c0
+3c081003
+35086600
+3c0a1000
+ad484200
+3c081001
+35087080
+3c0a1000
+ad484240
+3c081002
+35084cc0
+3c0a1000
+ad484280
+3c081002
+35089580
+3c0a1000
+ad4842c0
+3c081000
+3508f080
+3c0a1000
+ad484300
+3c081001
+3508afc0
+3c0a1000
+ad484340
+3c081003
+35083d00
+3c0a1000
+ad484380
+3c081001
+35086400
+3c0a1000
+ad4843c0
+3c081002
+35081e40
+3c0a1000
+ad484400
+3c081001
+35080880
+3c0a1000
+ad484440
+3c081001
+35080c00
+3c0a1000
+ad484480
+3c081001
+35086bc0
+3c0a1000
+ad4844c0
+3c081000
+350852c0
+3c0a1000
+ad484500
+3c081001
+3508bc80
+3c0a1000
+ad484540
+3c081002
+3508fec0
+3c0a1000
+ad484580
+3c081001
+35083c80
+3c0a1000
+ad4845c0
+3c081003
+3508e580
+3c0a1000
+ad484600
+3c081003
+3508d480
+3c0a1000
+ad484640
+3c081002
+35084b00
+3c0a1000
+ad484680
+3c081001
+35087e80
+3c0a1000
+ad4846c0
+3c081003
+35089780
+3c0a1000
+ad484700
+3c081001
+35082980
+3c0a1000
+ad484740
+3c081001
+3508b0c0
+3c0a1000
+ad484780
+3c081001
+350863c0
+3c0a1000
+ad4847c0
+3c081002
+3508a680
+3c0a1000
+ad484800
+3c081002
+3508b180
+3c0a1000
+ad484840
+3c081001
+350839c0
+3c0a1000
+ad484880
+3c081003
+35089040
+3c0a1000
+ad4848c0
+3c081003
+350888c0
+3c0a1000
+ad484900
+3c081000
+3508a540
+3c0a1000
+ad484940
+3c081000
+35083180
+3c0a1000
+ad484980
+3c081000
+35086800
+3c0a1000
+ad4849c0
+3c081001
+35085700
+3c0a1000
+ad484a00
+3c081001
+35089b80
+3c0a1000
+ad484a40
+3c081003
+35083140
+3c0a1000
+ad484a80
+3c081000
+35085080
+3c0a1000
+ad484ac0
+3c081001
+3508a080
+3c0a1000
+ad484b00
+3c081003
+35085cc0
+3c0a1000
+ad484b40
+3c081000
+3508a800
+3c0a1000
+ad484b80
+3c081003
+3508a180
+3c0a1000
+ad484bc0
+3c081003
+3508d080
+3c0a1000
+ad484c00
+3c081003
+35084140
+3c0a1000
+ad484c40
+3c081002
+35088880
+3c0a1000
+ad484c80
+3c081000
+35084640
+3c0a1000
+ad484cc0
+3c081002
+3508eac0
+3c0a1000
+ad484d00
+3c081000
+350891c0
+3c0a1000
+ad484d40
+3c081002
+3508f1c0
+3c0a1000
+ad484d80
+3c081000
+3508e840
+3c0a1000
+ad484dc0
+3c081000
+3508f500
+3c0a1000
+ad484e00
+3c081001
+3508f300
+3c0a1000
+ad484e40
+3c081003
+35086f40
+3c0a1000
+ad484e80
+3c081002
+35083680
+3c0a1000
+ad484ec0
+3c081001
+35085000
+3c0a1000
+ad484f00
+3c081002
+350863c0
+3c0a1000
+ad484f40
+3c081003
+3508d780
+3c0a1000
+ad484f80
+3c081003
+3508d900
+3c0a1000
+ad484fc0
+3c081001
+3508e940
+3c0a1000
+ad485000
+3c081001
+350885c0
+3c0a1000
+ad485040
+3c081002
+35089080
+3c0a1000
+ad485080
+3c081000
+3508db00
+3c0a1000
+ad4850c0
+3c081000
+35087080
+3c0a1000
+ad485100
+3c081001
+3508ad80
+3c0a1000
+ad485140
+3c081000
+35088540
+3c0a1000
+ad485180
+3c081000
+3508fd80
+3c0a1000
+ad4851c0
+3c081003
+3508c140
+3c0a1000
+ad485200
+3c081000
+35082ec0
+3c0a1000
+ad485240
+3c081002
+35083940
+3c0a1000
+ad485280
+3c081002
+3508c1c0
+3c0a1000
+ad4852c0
+3c081002
+3508fc00
+3c0a1000
+ad485300
+3c081003
+350804c0
+3c0a1000
+ad485340
+3c081001
+35087140
+3c0a1000
+ad485380
+3c081002
+350843c0
+3c0a1000
+ad4853c0
+3c081002
+3508cd40
+3c0a1000
+ad485400
+3c081000
+350810c0
+3c0a1000
+ad485440
+3c081000
+3508af80
+3c0a1000
+ad485480
+3c081002
+3508e200
+3c0a1000
+ad4854c0
+3c081002
+35089700
+3c0a1000
+ad485500
+3c081000
+35084840
+3c0a1000
+ad485540
+3c081003
+35080340
+3c0a1000
+ad485580
+3c081002
+3508f2c0
+3c0a1000
+ad4855c0
+3c081001
+350864c0
+3c0a1000
+ad485600
+3c081003
+3508db00
+3c0a1000
+ad485640
+3c081000
+350839c0
+3c0a1000
+ad485680
+3c081000
+35082980
+3c0a1000
+ad4856c0
+3c081001
+35085740
+3c0a1000
+ad485700
+3c081002
+35086100
+3c0a1000
+ad485740
+3c081002
+35086080
+3c0a1000
+ad485780
+3c081001
+35086300
+3c0a1000
+ad4857c0
+3c081003
+3508a000
+3c0a1000
+ad485800
+3c081003
+350849c0
+3c0a1000
+ad485840
+3c081000
+35088340
+3c0a1000
+ad485880
+3c081001
+35087fc0
+3c0a1000
+ad4858c0
+3c081002
+3508e880
+3c0a1000
+ad485900
+3c081000
+35089480
+3c0a1000
+ad485940
+3c081000
+3508db80
+3c0a1000
+ad485980
+3c081000
+35080e80
+3c0a1000
+ad4859c0
+3c081000
+3508c500
+3c0a1000
+ad485a00
+3c081003
+35084b80
+3c0a1000
+ad485a40
+3c081002
+35081080
+3c0a1000
+ad485a80
+3c081001
+35082b00
+3c0a1000
+ad485ac0
+3c081001
+3508f600
+3c0a1000
+ad485b00
+3c081001
+35087c40
+3c0a1000
+ad485b40
+3c081003
+3508c9c0
+3c0a1000
+ad485b80
+3c081001
+35081fc0
+3c0a1000
+ad485bc0
+3c081001
+35088c80
+3c0a1000
+ad485c00
+3c081002
+3508c840
+3c0a1000
+ad485c40
+3c081002
+35084b80
+3c0a1000
+ad485c80
+3c081001
+3508cac0
+3c0a1000
+ad485cc0
+3c081001
+35083080
+3c0a1000
+ad485d00
+3c081001
+3508bb00
+3c0a1000
+ad485d40
+3c081003
+35083e00
+3c0a1000
+ad485d80
+3c081001
+3508b380
+3c0a1000
+ad485dc0
+3c081003
+350871c0
+3c0a1000
+ad485e00
+3c081000
+35084f40
+3c0a1000
+ad485e40
+3c081002
+35086280
+3c0a1000
+ad485e80
+3c081003
+35089ec0
+3c0a1000
+ad485ec0
+3c081001
+35085480
+3c0a1000
+ad485f00
+3c081002
+35082a40
+3c0a1000
+ad485f40
+3c081002
+3508c340
+3c0a1000
+ad485f80
+3c081001
+35085f00
+3c0a1000
+ad485fc0
+3c081003
+35084480
+3c0a1000
+ad486000
+3c081000
+3508d700
+3c0a1000
+ad486040
+3c081001
+35083740
+3c0a1000
+ad486080
+3c081000
+35085100
+3c0a1000
+ad4860c0
+3c081000
+35085c00
+3c0a1000
+ad486100
+3c081000
+3508d680
+3c0a1000
+ad486140
+3c081002
+35086d40
+3c0a1000
+ad486180
+3c081000
+3508b100
+3c0a1000
+ad4861c0
+3c081003
+35081100
+3c0a1000
+ad486200
+3c081003
+3508dcc0
+3c0a1000
+ad486240
+3c081003
+35088f80
+3c0a1000
+ad486280
+3c081003
+3508f380
+3c0a1000
+ad4862c0
+3c081003
+35084f40
+3c0a1000
+ad486300
+3c081001
+35082140
+3c0a1000
+ad486340
+3c081003
+35082dc0
+3c0a1000
+ad486380
+3c081001
+35084c40
+3c0a1000
+ad4863c0
+3c081000
+350825c0
+3c0a1000
+ad486400
+3c081001
+3508fa00
+3c0a1000
+ad486440
+3c081001
+3508ec80
+3c0a1000
+ad486480
+3c081002
+350888c0
+3c0a1000
+ad4864c0
+3c081003
+350899c0
+3c0a1000
+ad486500
+3c081001
+3508ce80
+3c0a1000
+ad486540
+3c081001
+35086380
+3c0a1000
+ad486580
+3c081001
+35087b40
+3c0a1000
+ad4865c0
+3c081001
+3508be00
+3c0a1000
+ad486600
+3c081000
+3508e980
+3c0a1000
+ad486640
+3c081002
+350891c0
+3c0a1000
+ad486680
+3c081001
+35084240
+3c0a1000
+ad4866c0
+3c081003
+35086f00
+3c0a1000
+ad486700
+3c081001
+35083340
+3c0a1000
+ad486740
+3c081001
+35085680
+3c0a1000
+ad486780
+3c081002
+35083f80
+3c0a1000
+ad4867c0
+3c081000
+3508f7c0
+3c0a1000
+ad486800
+3c081001
+35089ec0
+3c0a1000
+ad486840
+3c081003
+35085b40
+3c0a1000
+ad486880
+3c081003
+3508c800
+3c0a1000
+ad4868c0
+3c081001
+3508e900
+3c0a1000
+ad486900
+3c081001
+35086700
+3c0a1000
+ad486940
+3c081003
+35086180
+3c0a1000
+ad486980
+3c081000
+35081b00
+3c0a1000
+ad4869c0
+3c081000
+350887c0
+3c0a1000
+ad486a00
+3c081001
+35089d00
+3c0a1000
+ad486a40
+3c081003
+3508ea40
+3c0a1000
+ad486a80
+3c081002
+3508aa80
+3c0a1000
+ad486ac0
+3c081001
+3508f840
+3c0a1000
+ad486b00
+3c081003
+3508ce80
+3c0a1000
+ad486b40
+3c081003
+35086280
+3c0a1000
+ad486b80
+3c081000
+3508c240
+3c0a1000
+ad486bc0
+3c081000
+35087840
+3c0a1000
+ad486c00
+3c081000
+3508f5c0
+3c0a1000
+ad486c40
+3c081001
+3508eac0
+3c0a1000
+ad486c80
+3c081001
+3508e740
+3c0a1000
+ad486cc0
+3c081000
+35084600
+3c0a1000
+ad486d00
+3c081000
+35080040
+3c0a1000
+ad486d40
+3c081001
+35083900
+3c0a1000
+ad486d80
+3c081001
+35081040
+3c0a1000
+ad486dc0
+3c081000
+35089300
+3c0a1000
+ad486e00
+3c081000
+35080b80
+3c0a1000
+ad486e40
+3c081001
+35081c00
+3c0a1000
+ad486e80
+3c081002
+350808c0
+3c0a1000
+ad486ec0
+3c081001
+35084bc0
+3c0a1000
+ad486f00
+3c081000
+3508c140
+3c0a1000
+ad486f40
+3c081001
+350808c0
+3c0a1000
+ad486f80
+3c081001
+3508a8c0
+3c0a1000
+ad486fc0
+3c081001
+350881c0
+3c0a1000
+ad487000
+3c081001
+35081340
+3c0a1000
+ad487040
+3c081000
+3508c980
+3c0a1000
+ad487080
+3c081003
+3508df00
+3c0a1000
+ad4870c0
+3c081002
+35083800
+3c0a1000
+ad487100
+3c081003
+3508b440
+3c0a1000
+ad487140
+3c081002
+35084780
+3c0a1000
+ad487180
+3c081003
+35085300
+3c0a1000
+ad4871c0
+3c081000
+35082b40
+3c0a1000
+ad487200
+3c081001
+3508d300
+3c0a1000
+ad487240
+3c081000
+3508c9c0
+3c0a1000
+ad487280
+3c081001
+35089b40
+3c0a1000
+ad4872c0
+3c081003
+3508bc40
+3c0a1000
+ad487300
+3c081000
+35086a00
+3c0a1000
+ad487340
+3c081000
+350888c0
+3c0a1000
+ad487380
+3c081003
+3508de40
+3c0a1000
+ad4873c0
+3c081003
+3508a200
+3c0a1000
+ad487400
+3c081000
+35088f00
+3c0a1000
+ad487440
+3c081001
+3508cb40
+3c0a1000
+ad487480
+3c081001
+35085c80
+3c0a1000
+ad4874c0
+3c081001
+3508e540
+3c0a1000
+ad487500
+3c081003
+35089900
+3c0a1000
+ad487540
+3c081001
+35085d40
+3c0a1000
+ad487580
+3c081001
+35086580
+3c0a1000
+ad4875c0
+3c081003
+3508cc80
+3c0a1000
+ad487600
+3c081000
+3508bf00
+3c0a1000
+ad487640
+3c081000
+3508a600
+3c0a1000
+ad487680
+3c081000
+3508f680
+3c0a1000
+ad4876c0
+3c081003
+3508dd80
+3c0a1000
+ad487700
+3c081000
+3508a280
+3c0a1000
+ad487740
+3c081001
+3508d340
+3c0a1000
+ad487780
+3c081003
+3508ae00
+3c0a1000
+ad4877c0
+3c081003
+35088e80
+3c0a1000
+ad487800
+3c081000
+350886c0
+3c0a1000
+ad487840
+3c081001
+35081840
+3c0a1000
+ad487880
+3c081001
+35080540
+3c0a1000
+ad4878c0
+3c081001
+3508a240
+3c0a1000
+ad487900
+3c081001
+35085200
+3c0a1000
+ad487940
+3c081001
+3508adc0
+3c0a1000
+ad487980
+3c081003
+35082080
+3c0a1000
+ad4879c0
+3c081001
+3508dc40
+3c0a1000
+ad487a00
+3c081003
+3508adc0
+3c0a1000
+ad487a40
+3c081000
+35086140
+3c0a1000
+ad487a80
+3c081003
+35083f80
+3c0a1000
+ad487ac0
+3c081002
+35082a00
+3c0a1000
+ad487b00
+3c081002
+35081840
+3c0a1000
+ad487b40
+3c081002
+35089a80
+3c0a1000
+ad487b80
+3c081001
+35088200
+3c0a1000
+ad487bc0
+3c081001
+35082fc0
+3c0a1000
+ad487c00
+3c081003
+35089a00
+3c0a1000
+ad487c40
+3c081003
+35088d00
+3c0a1000
+ad487c80
+3c081001
+3508ae40
+3c0a1000
+ad487cc0
+3c081003
+35081700
+3c0a1000
+ad487d00
+3c081002
+35087900
+3c0a1000
+ad487d40
+3c081000
+3508de80
+3c0a1000
+ad487d80
+3c081001
+35088780
+3c0a1000
+ad487dc0
+3c081000
+35083e40
+3c0a1000
+ad487e00
+3c081000
+35085740
+3c0a1000
+ad487e40
+3c081002
+3508f600
+3c0a1000
+ad487e80
+3c081001
+3508a0c0
+3c0a1000
+ad487ec0
+3c081000
+35080100
+3c0a1000
+ad487f00
+3c081003
+3508cf00
+3c0a1000
+ad487f40
+3c081000
+3508d880
+3c0a1000
+ad487f80
+3c081003
+35084080
+3c0a1000
+ad487fc0
+3c081002
+35082900
+3c0a1001
+ad488000
+3c081003
+35085080
+3c0a1001
+ad488040
+3c081001
+35089b00
+3c0a1001
+ad488080
+3c081001
+35083200
+3c0a1001
+ad4880c0
+3c081001
+35086900
+3c0a1001
+ad488100
+3c081001
+3508e4c0
+3c0a1001
+ad488140
+3c081001
+35082cc0
+3c0a1001
+ad488180
+3c081000
+35082940
+3c0a1001
+ad4881c0
+3c081001
+35083980
+3c0a1001
+ad488200
+3c081001
+350878c0
+3c0a1001
+ad488240
+3c081002
+35081200
+3c0a1001
+ad488280
+3c081000
+35085240
+3c0a1001
+ad4882c0
+3c081000
+35087940
+3c0a1001
+ad488300
+3c081001
+3508e680
+3c0a1001
+ad488340
+3c081002
+3508a840
+3c0a1001
+ad488380
+3c081000
+3508bfc0
+3c0a1001
+ad4883c0
+3c081003
+35082700
+3c0a1001
+ad488400
+3c081002
+350819c0
+3c0a1001
+ad488440
+3c081003
+35083cc0
+3c0a1001
+ad488480
+3c081003
+35089f00
+3c0a1001
+ad4884c0
+3c081000
+35086b40
+3c0a1001
+ad488500
+3c081001
+35080480
+3c0a1001
+ad488540
+3c081002
+35088d00
+3c0a1001
+ad488580
+3c081001
+35080280
+3c0a1001
+ad4885c0
+3c081001
+3508d440
+3c0a1001
+ad488600
+3c081002
+3508c740
+3c0a1001
+ad488640
+3c081000
+3508a080
+3c0a1001
+ad488680
+3c081001
+35084840
+3c0a1001
+ad4886c0
+3c081001
+35081980
+3c0a1001
+ad488700
+3c081003
+35080080
+3c0a1001
+ad488740
+3c081003
+3508f8c0
+3c0a1001
+ad488780
+3c081002
+35084e40
+3c0a1001
+ad4887c0
+3c081003
+35084940
+3c0a1001
+ad488800
+3c081000
+350856c0
+3c0a1001
+ad488840
+3c081003
+350858c0
+3c0a1001
+ad488880
+3c081002
+35084080
+3c0a1001
+ad4888c0
+3c081001
+3508df80
+3c0a1001
+ad488900
+3c081003
+35083d80
+3c0a1001
+ad488940
+3c081001
+3508bbc0
+3c0a1001
+ad488980
+3c081000
+3c0a1001
+ad4889c0
+3c081003
+3508cec0
+3c0a1001
+ad488a00
+3c081000
+35083400
+3c0a1001
+ad488a40
+3c081003
+35082180
+3c0a1001
+ad488a80
+3c081001
+3508f4c0
+3c0a1001
+ad488ac0
+3c081002
+35089100
+3c0a1001
+ad488b00
+3c081002
+3508d400
+3c0a1001
+ad488b40
+3c081002
+3508db00
+3c0a1001
+ad488b80
+3c081002
+35087dc0
+3c0a1001
+ad488bc0
+3c081002
+35089900
+3c0a1001
+ad488c00
+3c081002
+3508ef00
+3c0a1001
+ad488c40
+3c081003
+35081d00
+3c0a1001
+ad488c80
+3c081001
+35085040
+3c0a1001
+ad488cc0
+3c081001
+3508ab80
+3c0a1001
+ad488d00
+3c081000
+35089540
+3c0a1001
+ad488d40
+3c081003
+35085280
+3c0a1001
+ad488d80
+3c081003
+35089080
+3c0a1001
+ad488dc0
+3c081003
+35088d40
+3c0a1001
+ad488e00
+3c081002
+3508a500
+3c0a1001
+ad488e40
+3c081000
+350855c0
+3c0a1001
+ad488e80
+3c081002
+35084400
+3c0a1001
+ad488ec0
+3c081003
+3508e7c0
+3c0a1001
+ad488f00
+3c081002
+3508ccc0
+3c0a1001
+ad488f40
+3c081000
+35088300
+3c0a1001
+ad488f80
+3c081002
+35085880
+3c0a1001
+ad488fc0
+3c081002
+35081a00
+3c0a1001
+ad489000
+3c081001
+3508b900
+3c0a1001
+ad489040
+3c081003
+350894c0
+3c0a1001
+ad489080
+3c081003
+3508fe80
+3c0a1001
+ad4890c0
+3c081000
+35089940
+3c0a1001
+ad489100
+3c081000
+3508d3c0
+3c0a1001
+ad489140
+3c081000
+35084c40
+3c0a1001
+ad489180
+3c081001
+35088100
+3c0a1001
+ad4891c0
+3c081001
+3508b300
+3c0a1001
+ad489200
+3c081003
+3508d880
+3c0a1001
+ad489240
+3c081001
+3508cd00
+3c0a1001
+ad489280
+3c081003
+35085580
+3c0a1001
+ad4892c0
+3c081001
+3508ff40
+3c0a1001
+ad489300
+3c081000
+35087e00
+3c0a1001
+ad489340
+3c081001
+35083100
+3c0a1001
+ad489380
+3c081003
+35086440
+3c0a1001
+ad4893c0
+3c081002
+35081380
+3c0a1001
+ad489400
+3c081001
+35086b40
+3c0a1001
+ad489440
+3c081002
+3508f980
+3c0a1001
+ad489480
+3c081001
+35088cc0
+3c0a1001
+ad4894c0
+3c081001
+3508a040
+3c0a1001
+ad489500
+3c081001
+3508e180
+3c0a1001
+ad489540
+3c081003
+350896c0
+3c0a1001
+ad489580
+3c081001
+35084ac0
+3c0a1001
+ad4895c0
+3c081001
+35089700
+3c0a1001
+ad489600
+3c081001
+35082bc0
+3c0a1001
+ad489640
+3c081000
+35089b00
+3c0a1001
+ad489680
+3c081002
+3508bc80
+3c0a1001
+ad4896c0
+3c081003
+35082740
+3c0a1001
+ad489700
+3c081000
+3508b540
+3c0a1001
+ad489740
+3c081001
+3508b980
+3c0a1001
+ad489780
+3c081003
+35084a00
+3c0a1001
+ad4897c0
+3c081001
+350823c0
+3c0a1001
+ad489800
+3c081001
+35083f40
+3c0a1001
+ad489840
+3c081000
+35087d00
+3c0a1001
+ad489880
+3c081000
+35086c80
+3c0a1001
+ad4898c0
+3c081002
+35083740
+3c0a1001
+ad489900
+3c081003
+35081b00
+3c0a1001
+ad489940
+3c081003
+350852c0
+3c0a1001
+ad489980
+3c081003
+3508c840
+3c0a1001
+ad4899c0
+3c081000
+3508d5c0
+3c0a1001
+ad489a00
+3c081002
+3508d700
+3c0a1001
+ad489a40
+3c081001
+35084b00
+3c0a1001
+ad489a80
+3c081000
+35086300
+3c0a1001
+ad489ac0
+3c081002
+35083440
+3c0a1001
+ad489b00
+3c081001
+350870c0
+3c0a1001
+ad489b40
+3c081003
+35082d40
+3c0a1001
+ad489b80
+3c081001
+35083700
+3c0a1001
+ad489bc0
+3c081002
+350895c0
+3c0a1001
+ad489c00
+3c081000
+35082a80
+3c0a1001
+ad489c40
+3c081003
+35084cc0
+3c0a1001
+ad489c80
+3c081002
+3508b7c0
+3c0a1001
+ad489cc0
+3c081003
+35085840
+3c0a1001
+ad489d00
+3c081000
+35080d40
+3c0a1001
+ad489d40
+3c081001
+35086000
+3c0a1001
+ad489d80
+3c081001
+35084380
+3c0a1001
+ad489dc0
+3c081003
+35087680
+3c0a1001
+ad489e00
+3c081000
+3508ad40
+3c0a1001
+ad489e40
+3c081001
+35086840
+3c0a1001
+ad489e80
+3c081000
+3508f240
+3c0a1001
+ad489ec0
+3c081003
+35080580
+3c0a1001
+ad489f00
+3c081001
+35082780
+3c0a1001
+ad489f40
+3c081003
+35087ec0
+3c0a1001
+ad489f80
+3c081000
+3508b4c0
+3c0a1001
+ad489fc0
+3c081003
+3508ec00
+3c0a1001
+ad48a000
+3c081001
+3508e5c0
+3c0a1001
+ad48a040
+3c081000
+350873c0
+3c0a1001
+ad48a080
+3c081000
+350812c0
+3c0a1001
+ad48a0c0
+3c081001
+35082a80
+3c0a1001
+ad48a100
+3c081000
+35083f40
+3c0a1001
+ad48a140
+3c081003
+35088580
+3c0a1001
+ad48a180
+3c081002
+35082680
+3c0a1001
+ad48a1c0
+3c081003
+3508b940
+3c0a1001
+ad48a200
+3c081003
+3508e340
+3c0a1001
+ad48a240
+3c081001
+35086e80
+3c0a1001
+ad48a280
+3c081001
+3508b140
+3c0a1001
+ad48a2c0
+3c081000
+3508f740
+3c0a1001
+ad48a300
+3c081001
+350805c0
+3c0a1001
+ad48a340
+3c081000
+3508ab80
+3c0a1001
+ad48a380
+3c081001
+35082b80
+3c0a1001
+ad48a3c0
+3c081001
+350899c0
+3c0a1001
+ad48a400
+3c081002
+3508e040
+3c0a1001
+ad48a440
+3c081003
+35081680
+3c0a1001
+ad48a480
+3c081003
+3508ba80
+3c0a1001
+ad48a4c0
+3c081002
+35082540
+3c0a1001
+ad48a500
+3c081000
+35085880
+3c0a1001
+ad48a540
+3c081001
+35087e40
+3c0a1001
+ad48a580
+3c081002
+3508d780
+3c0a1001
+ad48a5c0
+3c081003
+3508ba40
+3c0a1001
+ad48a600
+3c081002
+35088a40
+3c0a1001
+ad48a640
+3c081002
+35081b40
+3c0a1001
+ad48a680
+3c081003
+3508b9c0
+3c0a1001
+ad48a6c0
+3c081002
+35083340
+3c0a1001
+ad48a700
+3c081002
+35080200
+3c0a1001
+ad48a740
+3c081002
+3508f780
+3c0a1001
+ad48a780
+3c081003
+35081d40
+3c0a1001
+ad48a7c0
+3c081003
+35081340
+3c0a1001
+ad48a800
+3c081000
+35081440
+3c0a1001
+ad48a840
+3c081000
+35082a00
+3c0a1001
+ad48a880
+3c081003
+3508b640
+3c0a1001
+ad48a8c0
+3c081002
+35080f80
+3c0a1001
+ad48a900
+3c081001
+35087cc0
+3c0a1001
+ad48a940
+3c081001
+35081dc0
+3c0a1001
+ad48a980
+3c081002
+3508ee00
+3c0a1001
+ad48a9c0
+3c081000
+35081600
+3c0a1001
+ad48aa00
+3c081002
+35086f40
+3c0a1001
+ad48aa40
+3c081001
+3508be40
+3c0a1001
+ad48aa80
+3c081000
+3508ae00
+3c0a1001
+ad48aac0
+3c081000
+35087bc0
+3c0a1001
+ad48ab00
+3c081003
+35080280
+3c0a1001
+ad48ab40
+3c081000
+35084740
+3c0a1001
+ad48ab80
+3c081002
+3508ba40
+3c0a1001
+ad48abc0
+3c081002
+350807c0
+3c0a1001
+ad48ac00
+3c081002
+35081c40
+3c0a1001
+ad48ac40
+3c081000
+3508aa40
+3c0a1001
+ad48ac80
+3c081000
+3508ae80
+3c0a1001
+ad48acc0
+3c081001
+35089240
+3c0a1001
+ad48ad00
+3c081000
+3508a640
+3c0a1001
+ad48ad40
+3c081000
+3508ebc0
+3c0a1001
+ad48ad80
+3c081003
+350898c0
+3c0a1001
+ad48adc0
+3c081000
+35088840
+3c0a1001
+ad48ae00
+3c081002
+350851c0
+3c0a1001
+ad48ae40
+3c081002
+350896c0
+3c0a1001
+ad48ae80
+3c081002
+350830c0
+3c0a1001
+ad48aec0
+3c081000
+3508b880
+3c0a1001
+ad48af00
+3c081003
+350851c0
+3c0a1001
+ad48af40
+3c081001
+35083440
+3c0a1001
+ad48af80
+3c081001
+3508d800
+3c0a1001
+ad48afc0
+3c081003
+350892c0
+3c0a1001
+ad48b000
+3c081003
+35089e80
+3c0a1001
+ad48b040
+3c081001
+35089ac0
+3c0a1001
+ad48b080
+3c081002
+3508b600
+3c0a1001
+ad48b0c0
+3c081002
+3508c580
+3c0a1001
+ad48b100
+3c081002
+3508a8c0
+3c0a1001
+ad48b140
+3c081002
+3508a940
+3c0a1001
+ad48b180
+3c081002
+350892c0
+3c0a1001
+ad48b1c0
+3c081000
+35083c80
+3c0a1001
+ad48b200
+3c081002
+35083a40
+3c0a1001
+ad48b240
+3c081001
+3508d240
+3c0a1001
+ad48b280
+3c081001
+35084200
+3c0a1001
+ad48b2c0
+3c081003
+35081140
+3c0a1001
+ad48b300
+3c081003
+3508da00
+3c0a1001
+ad48b340
+3c081002
+35085cc0
+3c0a1001
+ad48b380
+3c081003
+3508f940
+3c0a1001
+ad48b3c0
+3c081000
+3508a500
+3c0a1001
+ad48b400
+3c081000
+3508bac0
+3c0a1001
+ad48b440
+3c081001
+35085ac0
+3c0a1001
+ad48b480
+3c081001
+35088280
+3c0a1001
+ad48b4c0
+3c081001
+350819c0
+3c0a1001
+ad48b500
+3c081000
+35082d80
+3c0a1001
+ad48b540
+3c081002
+35088ac0
+3c0a1001
+ad48b580
+3c081003
+3508dac0
+3c0a1001
+ad48b5c0
+3c081000
+350807c0
+3c0a1001
+ad48b600
+3c081001
+3508b240
+3c0a1001
+ad48b640
+3c081003
+3508d600
+3c0a1001
+ad48b680
+3c081003
+35082300
+3c0a1001
+ad48b6c0
+3c081000
+3508b340
+3c0a1001
+ad48b700
+3c081001
+35084180
+3c0a1001
+ad48b740
+3c081001
+35081d80
+3c0a1001
+ad48b780
+3c081003
+3508ecc0
+3c0a1001
+ad48b7c0
+3c081000
+3508b180
+3c0a1001
+ad48b800
+3c081001
+35087300
+3c0a1001
+ad48b840
+3c081001
+3508a4c0
+3c0a1001
+ad48b880
+3c081001
+3508e9c0
+3c0a1001
+ad48b8c0
+3c081001
+35088d40
+3c0a1001
+ad48b900
+3c081002
+35085680
+3c0a1001
+ad48b940
+3c081000
+35086840
+3c0a1001
+ad48b980
+3c081002
+35086c80
+3c0a1001
+ad48b9c0
+3c081003
+3508e380
+3c0a1001
+ad48ba00
+3c081000
+3508f2c0
+3c0a1001
+ad48ba40
+3c081003
+35081180
+3c0a1001
+ad48ba80
+3c081001
+3508ce40
+3c0a1001
+ad48bac0
+3c081000
+35089900
+3c0a1001
+ad48bb00
+3c081003
+350808c0
+3c0a1001
+ad48bb40
+3c081000
+35084c80
+3c0a1001
+ad48bb80
+3c081001
+35080980
+3c0a1001
+ad48bbc0
+3c081002
+35089b80
+3c0a1001
+ad48bc00
+3c081000
+35089a00
+3c0a1001
+ad48bc40
+3c081003
+35080200
+3c0a1001
+ad48bc80
+3c081003
+35085c00
+3c0a1001
+ad48bcc0
+3c081003
+35087880
+3c0a1001
+ad48bd00
+3c081002
+35088000
+3c0a1001
+ad48bd40
+3c081002
+35083c00
+3c0a1001
+ad48bd80
+3c081002
+3508b9c0
+3c0a1001
+ad48bdc0
+3c081003
+35081c00
+3c0a1001
+ad48be00
+3c081001
+3508d080
+3c0a1001
+ad48be40
+3c081000
+35086680
+3c0a1001
+ad48be80
+3c081003
+35080140
+3c0a1001
+ad48bec0
+3c081003
+35085180
+3c0a1001
+ad48bf00
+3c081003
+3508ec80
+3c0a1001
+ad48bf40
+3c081001
+35084f40
+3c0a1001
+ad48bf80
+3c081001
+35081d00
+3c0a1001
+ad48bfc0
+3c081001
+350898c0
+3c0a1001
+ad48c000
+3c081001
+3508acc0
+3c0a1001
+ad48c040
+3c081000
+35082900
+3c0a1001
+ad48c080
+3c081003
+35082f80
+3c0a1001
+ad48c0c0
+3c081002
+35088800
+3c0a1001
+ad48c100
+3c081002
+35089f40
+3c0a1001
+ad48c140
+3c081002
+35082dc0
+3c0a1001
+ad48c180
+3c081000
+35089680
+3c0a1001
+ad48c1c0
+3c081002
+35081a80
+3c0a1001
+ad48c200
+3c081003
+35081780
+3c0a1001
+ad48c240
+3c081002
+3508ae80
+3c0a1001
+ad48c280
+3c081000
+35085d40
+3c0a1001
+ad48c2c0
+3c081002
+35081040
+3c0a1001
+ad48c300
+3c081003
+3508a9c0
+3c0a1001
+ad48c340
+3c081002
+3508ea80
+3c0a1001
+ad48c380
+3c081003
+3508bd80
+3c0a1001
+ad48c3c0
+3c081003
+3508ca00
+3c0a1001
+ad48c400
+3c081001
+35089440
+3c0a1001
+ad48c440
+3c081000
+35080bc0
+3c0a1001
+ad48c480
+3c081003
+35084c00
+3c0a1001
+ad48c4c0
+3c081003
+3508ddc0
+3c0a1001
+ad48c500
+3c081001
+35085f80
+3c0a1001
+ad48c540
+3c081003
+35088900
+3c0a1001
+ad48c580
+3c081000
+35080700
+3c0a1001
+ad48c5c0
+3c081003
+35081fc0
+3c0a1001
+ad48c600
+3c081002
+35082240
+3c0a1001
+ad48c640
+3c081002
+35087bc0
+3c0a1001
+ad48c680
+3c081001
+35087780
+3c0a1001
+ad48c6c0
+3c081002
+35085dc0
+3c0a1001
+ad48c700
+3c081003
+35083300
+3c0a1001
+ad48c740
+3c081003
+35087b40
+3c0a1001
+ad48c780
+3c081001
+3508cc00
+3c0a1001
+ad48c7c0
+3c081001
+35080680
+3c0a1001
+ad48c800
+3c081003
+35080480
+3c0a1001
+ad48c840
+3c081001
+3508de00
+3c0a1001
+ad48c880
+3c081001
+35082640
+3c0a1001
+ad48c8c0
+3c081003
+3508ed40
+3c0a1001
+ad48c900
+3c081000
+3508e780
+3c0a1001
+ad48c940
+3c081003
+35085780
+3c0a1001
+ad48c980
+3c081000
+3508d300
+3c0a1001
+ad48c9c0
+3c081002
+3508a240
+3c0a1001
+ad48ca00
+3c081002
+35081fc0
+3c0a1001
+ad48ca40
+3c081003
+35083500
+3c0a1001
+ad48ca80
+3c081000
+35086280
+3c0a1001
+ad48cac0
+3c081001
+35089cc0
+3c0a1001
+ad48cb00
+3c081003
+3508cd00
+3c0a1001
+ad48cb40
+3c081003
+350841c0
+3c0a1001
+ad48cb80
+3c081002
+35080b40
+3c0a1001
+ad48cbc0
+3c081001
+35083ac0
+3c0a1001
+ad48cc00
+3c081003
+35089600
+3c0a1001
+ad48cc40
+3c081003
+35081540
+3c0a1001
+ad48cc80
+3c081002
+350837c0
+3c0a1001
+ad48ccc0
+3c081000
+3508a100
+3c0a1001
+ad48cd00
+3c081001
+35088340
+3c0a1001
+ad48cd40
+3c081002
+35082b80
+3c0a1001
+ad48cd80
+3c081000
+3508a0c0
+3c0a1001
+ad48cdc0
+3c081003
+35088f40
+3c0a1001
+ad48ce00
+3c081001
+3508a140
+3c0a1001
+ad48ce40
+3c081003
+3508eb00
+3c0a1001
+ad48ce80
+3c081001
+35087a00
+3c0a1001
+ad48cec0
+3c081002
+350857c0
+3c0a1001
+ad48cf00
+3c081001
+350830c0
+3c0a1001
+ad48cf40
+3c081001
+350824c0
+3c0a1001
+ad48cf80
+3c081000
+35082f40
+3c0a1001
+ad48cfc0
+3c081001
+3508bd00
+3c0a1001
+ad48d000
+3c081003
+3508aec0
+3c0a1001
+ad48d040
+3c081000
+3508a780
+3c0a1001
+ad48d080
+3c081003
+35082b80
+3c0a1001
+ad48d0c0
+3c081003
+35083780
+3c0a1001
+ad48d100
+3c081000
+35086dc0
+3c0a1001
+ad48d140
+3c081003
+3508c700
+3c0a1001
+ad48d180
+3c081001
+35088880
+3c0a1001
+ad48d1c0
+3c081001
+350874c0
+3c0a1001
+ad48d200
+3c081002
+35084d40
+3c0a1001
+ad48d240
+3c081002
+35083f00
+3c0a1001
+ad48d280
+3c081000
+35086580
+3c0a1001
+ad48d2c0
+3c081003
+35081ac0
+3c0a1001
+ad48d300
+3c081002
+3508df80
+3c0a1001
+ad48d340
+3c081003
+3508eec0
+3c0a1001
+ad48d380
+3c081000
+35088180
+3c0a1001
+ad48d3c0
+3c081000
+35088900
+3c0a1001
+ad48d400
+3c081000
+3508cfc0
+3c0a1001
+ad48d440
+3c081003
+3508e300
+3c0a1001
+ad48d480
+3c081000
+350866c0
+3c0a1001
+ad48d4c0
+3c081002
+35082ac0
+3c0a1001
+ad48d500
+3c081001
+350877c0
+3c0a1001
+ad48d540
+3c081002
+350893c0
+3c0a1001
+ad48d580
+3c081003
+35085240
+3c0a1001
+ad48d5c0
+3c081003
+350813c0
+3c0a1001
+ad48d600
+3c081002
+35080a80
+3c0a1001
+ad48d640
+3c081000
+35083e00
+3c0a1001
+ad48d680
+3c081001
+3508dcc0
+3c0a1001
+ad48d6c0
+3c081003
+350827c0
+3c0a1001
+ad48d700
+3c081001
+35084b40
+3c0a1001
+ad48d740
+3c081003
+35083e40
+3c0a1001
+ad48d780
+3c081002
+35085500
+3c0a1001
+ad48d7c0
+3c081003
+35086580
+3c0a1001
+ad48d800
+3c081000
+35084bc0
+3c0a1001
+ad48d840
+3c081001
+35080e00
+3c0a1001
+ad48d880
+3c081003
+35083000
+3c0a1001
+ad48d8c0
+3c081001
+35088f00
+3c0a1001
+ad48d900
+3c081000
+350880c0
+3c0a1001
+ad48d940
+3c081002
+35083c80
+3c0a1001
+ad48d980
+3c081000
+350834c0
+3c0a1001
+ad48d9c0
+3c081000
+35083d00
+3c0a1001
+ad48da00
+3c081001
+3508b7c0
+3c0a1001
+ad48da40
+3c081003
+35089c80
+3c0a1001
+ad48da80
+3c081002
+35087a40
+3c0a1001
+ad48dac0
+3c081000
+350871c0
+3c0a1001
+ad48db00
+3c081001
+35088540
+3c0a1001
+ad48db40
+3c081000
+35083100
+3c0a1001
+ad48db80
+3c081003
+350868c0
+3c0a1001
+ad48dbc0
+3c081003
+3508b3c0
+3c0a1001
+ad48dc00
+3c081002
+3508f300
+3c0a1001
+ad48dc40
+3c081001
+35080040
+3c0a1001
+ad48dc80
+3c081003
+35085600
+3c0a1001
+ad48dcc0
+3c081003
+35087380
+3c0a1001
+ad48dd00
+3c081002
+35084500
+3c0a1001
+ad48dd40
+3c081000
+35089180
+3c0a1001
+ad48dd80
+3c081001
+3508b6c0
+3c0a1001
+ad48ddc0
+3c081002
+3508bf00
+3c0a1001
+ad48de00
+3c081002
+3508d380
+3c0a1001
+ad48de40
+3c081000
+35089c40
+3c0a1001
+ad48de80
+3c081000
+35084ac0
+3c0a1001
+ad48dec0
+3c081003
+35084740
+3c0a1001
+ad48df00
+3c081000
+35088b00
+3c0a1001
+ad48df40
+3c081001
+35086540
+3c0a1001
+ad48df80
+3c081002
+35083300
+3c0a1001
+ad48dfc0
+3c081003
+3508e980
+3c0a1001
+ad48e000
+3c081002
+3508b540
+3c0a1001
+ad48e040
+3c081002
+3508c9c0
+3c0a1001
+ad48e080
+3c081003
+35085540
+3c0a1001
+ad48e0c0
+3c081000
+3508dd40
+3c0a1001
+ad48e100
+3c081001
+350822c0
+3c0a1001
+ad48e140
+3c081000
+3508fb00
+3c0a1001
+ad48e180
+3c081003
+35081940
+3c0a1001
+ad48e1c0
+3c081003
+35085440
+3c0a1001
+ad48e200
+3c081000
+35082d40
+3c0a1001
+ad48e240
+3c081002
+3508c800
+3c0a1001
+ad48e280
+3c081000
+35082dc0
+3c0a1001
+ad48e2c0
+3c081002
+3508c140
+3c0a1001
+ad48e300
+3c081002
+35081c80
+3c0a1001
+ad48e340
+3c081000
+350861c0
+3c0a1001
+ad48e380
+3c081002
+3508dd40
+3c0a1001
+ad48e3c0
+3c081000
+3508e5c0
+3c0a1001
+ad48e400
+3c081000
+350875c0
+3c0a1001
+ad48e440
+3c081002
+3508c880
+3c0a1001
+ad48e480
+3c081001
+3508cdc0
+3c0a1001
+ad48e4c0
+3c081000
+350847c0
+3c0a1001
+ad48e500
+3c081002
+35083380
+3c0a1001
+ad48e540
+3c081001
+3508d980
+3c0a1001
+ad48e580
+3c081003
+3508c180
+3c0a1001
+ad48e5c0
+3c081003
+35089700
+3c0a1001
+ad48e600
+3c081000
+3508b500
+3c0a1001
+ad48e640
+3c081001
+3508ea80
+3c0a1001
+ad48e680
+3c081000
+3508b6c0
+3c0a1001
+ad48e6c0
+3c081000
+35081580
+3c0a1001
+ad48e700
+3c081002
+3508ed00
+3c0a1001
+ad48e740
+3c081002
+35089680
+3c0a1001
+ad48e780
+3c081002
+35087f40
+3c0a1001
+ad48e7c0
+3c081002
+3508cf00
+3c0a1001
+ad48e800
+3c081001
+3508fe40
+3c0a1001
+ad48e840
+3c081002
+35080280
+3c0a1001
+ad48e880
+3c081000
+3508b700
+3c0a1001
+ad48e8c0
+3c081003
+35089c40
+3c0a1001
+ad48e900
+3c081000
+35086d00
+3c0a1001
+ad48e940
+3c081003
+35081040
+3c0a1001
+ad48e980
+3c081001
+3508eb00
+3c0a1001
+ad48e9c0
+3c081001
+35089640
+3c0a1001
+ad48ea00
+3c081000
+35086740
+3c0a1001
+ad48ea40
+3c081003
+35083540
+3c0a1001
+ad48ea80
+3c081003
+350863c0
+3c0a1001
+ad48eac0
+3c081000
+35084ec0
+3c0a1001
+ad48eb00
+3c081003
+35083800
+3c0a1001
+ad48eb40
+3c081001
+35085080
+3c0a1001
+ad48eb80
+3c081003
+35087e00
+3c0a1001
+ad48ebc0
+3c081003
+3508c6c0
+3c0a1001
+ad48ec00
+3c081003
+35083900
+3c0a1001
+ad48ec40
+3c081001
+35086200
+3c0a1001
+ad48ec80
+3c081001
+35088440
+3c0a1001
+ad48ecc0
+3c081001
+3508da80
+3c0a1001
+ad48ed00
+3c081001
+35084700
+3c0a1001
+ad48ed40
+3c081003
+35086800
+3c0a1001
+ad48ed80
+3c081002
+35083180
+3c0a1001
+ad48edc0
+3c081003
+3508c300
+3c0a1001
+ad48ee00
+3c081001
+35086f40
+3c0a1001
+ad48ee40
+3c081000
+3508ca00
+3c0a1001
+ad48ee80
+3c081002
+35083640
+3c0a1001
+ad48eec0
+3c081002
+3508fd80
+3c0a1001
+ad48ef00
+3c081000
+35085b80
+3c0a1001
+ad48ef40
+3c081002
+3508a580
+3c0a1001
+ad48ef80
+3c081002
+3508e480
+3c0a1001
+ad48efc0
+3c081002
+3508d0c0
+3c0a1001
+ad48f000
+3c081003
+35088a80
+3c0a1001
+ad48f040
+3c081002
+35082180
+3c0a1001
+ad48f080
+3c081001
+35081300
+3c0a1001
+ad48f0c0
+3c081001
+35082a40
+3c0a1001
+ad48f100
+3c081003
+35089880
+3c0a1001
+ad48f140
+3c081000
+3508ed80
+3c0a1001
+ad48f180
+3c081003
+3508db80
+3c0a1001
+ad48f1c0
+3c081001
+35081b80
+3c0a1001
+ad48f200
+3c081003
+35088100
+3c0a1001
+ad48f240
+3c081000
+3508d7c0
+3c0a1001
+ad48f280
+3c081003
+35087080
+3c0a1001
+ad48f2c0
+3c081003
+35087d80
+3c0a1001
+ad48f300
+3c081002
+35087940
+3c0a1001
+ad48f340
+3c081003
+3508b680
+3c0a1001
+ad48f380
+3c081002
+3508d480
+3c0a1001
+ad48f3c0
+3c081001
+3508c3c0
+3c0a1001
+ad48f400
+3c081000
+3508e740
+3c0a1001
+ad48f440
+3c081001
+3508be80
+3c0a1001
+ad48f480
+3c081003
+3508b300
+3c0a1001
+ad48f4c0
+3c081002
+3508ec00
+3c0a1001
+ad48f500
+3c081002
+35087f80
+3c0a1001
+ad48f540
+3c081000
+3508c080
+3c0a1001
+ad48f580
+3c081000
+3508fb40
+3c0a1001
+ad48f5c0
+3c081001
+350871c0
+3c0a1001
+ad48f600
+3c081001
+35087380
+3c0a1001
+ad48f640
+3c081001
+35089a80
+3c0a1001
+ad48f680
+3c081000
+3508c100
+3c0a1001
+ad48f6c0
+3c081001
+3508c7c0
+3c0a1001
+ad48f700
+3c081002
+3508b940
+3c0a1001
+ad48f740
+3c081001
+3508e200
+3c0a1001
+ad48f780
+3c081003
+35081f40
+3c0a1001
+ad48f7c0
+3c081001
+35087d00
+3c0a1001
+ad48f800
+3c081003
+3508b7c0
+3c0a1001
+ad48f840
+3c081000
+35082600
+3c0a1001
+ad48f880
+3c081001
+3508ec00
+3c0a1001
+ad48f8c0
+3c081003
+35085a40
+3c0a1001
+ad48f900
+3c081000
+35088600
+3c0a1001
+ad48f940
+3c081001
+35085880
+3c0a1001
+ad48f980
+3c081003
+35083bc0
+3c0a1001
+ad48f9c0
+3c081001
+35085980
+3c0a1001
+ad48fa00
+3c081002
+3508d3c0
+3c0a1001
+ad48fa40
+3c081002
+3508a440
+3c0a1001
+ad48fa80
+3c081001
+35080700
+3c0a1001
+ad48fac0
+3c081000
+35085e80
+3c0a1001
+ad48fb00
+3c081001
+3508e580
+3c0a1001
+ad48fb40
+3c081000
+3508f900
+3c0a1001
+ad48fb80
+3c081001
+35083640
+3c0a1001
+ad48fbc0
+3c081003
+35088080
+3c0a1001
+ad48fc00
+3c081003
+35086e00
+3c0a1001
+ad48fc40
+3c081000
+3508cc00
+3c0a1001
+ad48fc80
+3c081001
+35082840
+3c0a1001
+ad48fcc0
+3c081001
+35081640
+3c0a1001
+ad48fd00
+3c081002
+3508ac00
+3c0a1001
+ad48fd40
+3c081000
+3508e800
+3c0a1001
+ad48fd80
+3c081002
+3508fbc0
+3c0a1001
+ad48fdc0
+3c081002
+350861c0
+3c0a1001
+ad48fe00
+3c081001
+35081c80
+3c0a1001
+ad48fe40
+3c081003
+3508b780
+3c0a1001
+ad48fe80
+3c081001
+35085c40
+3c0a1001
+ad48fec0
+3c081002
+3508b740
+3c0a1001
+ad48ff00
+3c081003
+350872c0
+3c0a1001
+ad48ff40
+3c081002
+35082d40
+3c0a1001
+ad48ff80
+3c081001
+35082000
+3c0a1001
+ad48ffc0
+3c081000
+3508bc00
+3c0a1001
+ad480000
+3c081000
+35087240
+3c0a1001
+ad480040
+3c081000
+35081480
+3c0a1001
+ad480080
+3c081000
+35089fc0
+3c0a1001
+ad4800c0
+3c081003
+350807c0
+3c0a1001
+ad480100
+3c081002
+35088940
+3c0a1001
+ad480140
+3c081000
+35083880
+3c0a1001
+ad480180
+3c081003
+35086a80
+3c0a1001
+ad4801c0
+3c081002
+35084d80
+3c0a1001
+ad480200
+3c081003
+35088040
+3c0a1001
+ad480240
+3c081002
+35084280
+3c0a1001
+ad480280
+3c081000
+3508fd40
+3c0a1001
+ad4802c0
+3c081000
+3508a700
+3c0a1001
+ad480300
+3c081001
+35082c80
+3c0a1001
+ad480340
+3c081003
+35088b00
+3c0a1001
+ad480380
+3c081000
+35086f80
+3c0a1001
+ad4803c0
+3c081001
+3508a200
+3c0a1001
+ad480400
+3c081002
+35086980
+3c0a1001
+ad480440
+3c081003
+3508fc80
+3c0a1001
+ad480480
+3c081003
+35085ec0
+3c0a1001
+ad4804c0
+3c081003
+35088a40
+3c0a1001
+ad480500
+3c081000
+350840c0
+3c0a1001
+ad480540
+3c081003
+3508b980
+3c0a1001
+ad480580
+3c081001
+35088d00
+3c0a1001
+ad4805c0
+3c081001
+3508bcc0
+3c0a1001
+ad480600
+3c081001
+35089800
+3c0a1001
+ad480640
+3c081003
+35081980
+3c0a1001
+ad480680
+3c081002
+3508f840
+3c0a1001
+ad4806c0
+3c081000
+3508af40
+3c0a1001
+ad480700
+3c081002
+350869c0
+3c0a1001
+ad480740
+3c081001
+35086740
+3c0a1001
+ad480780
+3c081000
+3508f6c0
+3c0a1001
+ad4807c0
+3c081002
+35081540
+3c0a1001
+ad480800
+3c081003
+3508a700
+3c0a1001
+ad480840
+3c081001
+3508b840
+3c0a1001
+ad480880
+3c081000
+3508c0c0
+3c0a1001
+ad4808c0
+3c081000
+3508e3c0
+3c0a1001
+ad480900
+3c081001
+350846c0
+3c0a1001
+ad480940
+3c081001
+35086c80
+3c0a1001
+ad480980
+3c081001
+3508d940
+3c0a1001
+ad4809c0
+3c081001
+3508ef40
+3c0a1001
+ad480a00
+3c081003
+35086a40
+3c0a1001
+ad480a40
+3c081000
+3508b040
+3c0a1001
+ad480a80
+3c081000
+3508f840
+3c0a1001
+ad480ac0
+3c081002
+35087a80
+3c0a1001
+ad480b00
+3c081001
+3508bac0
+3c0a1001
+ad480b40
+3c081000
+35083bc0
+3c0a1001
+ad480b80
+3c081002
+35088680
+3c0a1001
+ad480bc0
+3c081000
+3508d140
+3c0a1001
+ad480c00
+3c081002
+35081f00
+3c0a1001
+ad480c40
+3c081002
+35086d00
+3c0a1001
+ad480c80
+3c081001
+3508a3c0
+3c0a1001
+ad480cc0
+3c081003
+35085a80
+3c0a1001
+ad480d00
+3c081001
+3508bf00
+3c0a1001
+ad480d40
+3c081001
+35083400
+3c0a1001
+ad480d80
+3c081001
+3508e800
+3c0a1001
+ad480dc0
+3c081002
+350853c0
+3c0a1001
+ad480e00
+3c081001
+3508b2c0
+3c0a1001
+ad480e40
+3c081000
+35081200
+3c0a1001
+ad480e80
+3c081003
+3508f2c0
+3c0a1001
+ad480ec0
+3c081001
+35086600
+3c0a1001
+ad480f00
+3c081001
+35082600
+3c0a1001
+ad480f40
+3c081001
+3508eec0
+3c0a1001
+ad480f80
+3c081000
+35087980
+3c0a1001
+ad480fc0
+3c081002
+35081740
+3c0a1001
+ad481000
+3c081002
+35082f00
+3c0a1001
+ad481040
+3c081002
+35088e00
+3c0a1001
+ad481080
+3c081001
+3508c840
+3c0a1001
+ad4810c0
+3c081000
+3508da40
+3c0a1001
+ad481100
+3c081000
+350853c0
+3c0a1001
+ad481140
+3c081001
+35083940
+3c0a1001
+ad481180
+3c081000
+35084800
+3c0a1001
+ad4811c0
+3c081003
+35086680
+3c0a1001
+ad481200
+3c081000
+3508ec40
+3c0a1001
+ad481240
+3c081003
+35089bc0
+3c0a1001
+ad481280
+3c081000
+3508e580
+3c0a1001
+ad4812c0
+3c081001
+35085e00
+3c0a1001
+ad481300
+3c081000
+3508ffc0
+3c0a1001
+ad481340
+3c081001
+350888c0
+3c0a1001
+ad481380
+3c081003
+3508a3c0
+3c0a1001
+ad4813c0
+3c081000
+3508ff00
+3c0a1001
+ad481400
+3c081002
+350839c0
+3c0a1001
+ad481440
+3c081002
+35081940
+3c0a1001
+ad481480
+3c081003
+3508b000
+3c0a1001
+ad4814c0
+3c081003
+35083c80
+3c0a1001
+ad481500
+3c081002
+35083000
+3c0a1001
+ad481540
+3c081000
+35082e80
+3c0a1001
+ad481580
+3c081000
+35088100
+3c0a1001
+ad4815c0
+3c081001
+35081080
+3c0a1001
+ad481600
+3c081000
+35084340
+3c0a1001
+ad481640
+3c081002
+3508b040
+3c0a1001
+ad481680
+3c081003
+35087a00
+3c0a1001
+ad4816c0
+3c081001
+3508c2c0
+3c0a1001
+ad481700
+3c081001
+35086940
+3c0a1001
+ad481740
+3c081002
+3508a080
+3c0a1001
+ad481780
+3c081000
+35082580
+3c0a1001
+ad4817c0
+3c081000
+3508cd80
+3c0a1001
+ad481800
+3c081000
+35082c00
+3c0a1001
+ad481840
+3c081001
+3508a480
+3c0a1001
+ad481880
+3c081000
+350895c0
+3c0a1001
+ad4818c0
+3c081000
+35084100
+3c0a1001
+ad481900
+3c081002
+3508a700
+3c0a1001
+ad481940
+3c081000
+3508d240
+3c0a1001
+ad481980
+3c081003
+35089480
+3c0a1001
+ad4819c0
+3c081002
+35089d40
+3c0a1001
+ad481a00
+3c081001
+35088040
+3c0a1001
+ad481a40
+3c081002
+3508c180
+3c0a1001
+ad481a80
+3c081002
+350867c0
+3c0a1001
+ad481ac0
+3c081000
+3508c5c0
+3c0a1001
+ad481b00
+3c081002
+35082980
+3c0a1001
+ad481b40
+3c081000
+3508df40
+3c0a1001
+ad481b80
+3c081003
+35085100
+3c0a1001
+ad481bc0
+3c081001
+3508d500
+3c0a1001
+ad481c00
+3c081000
+35088bc0
+3c0a1001
+ad481c40
+3c081003
+35087bc0
+3c0a1001
+ad481c80
+3c081001
+3508ddc0
+3c0a1001
+ad481cc0
+3c081002
+3508ad80
+3c0a1001
+ad481d00
+3c081003
+3508fdc0
+3c0a1001
+ad481d40
+3c081001
+35080fc0
+3c0a1001
+ad481d80
+3c081003
+35080bc0
+3c0a1001
+ad481dc0
+3c081000
+35088580
+3c0a1001
+ad481e00
+3c081003
+35080c80
+3c0a1001
+ad481e40
+3c081002
+3508e640
+3c0a1001
+ad481e80
+3c081003
+35081000
+3c0a1001
+ad481ec0
+3c081000
+3508e600
+3c0a1001
+ad481f00
+3c081002
+35085300
+3c0a1001
+ad481f40
+3c081001
+35082c00
+3c0a1001
+ad481f80
+3c081003
+350847c0
+3c0a1001
+ad481fc0
+3c081003
+350805c0
+3c0a1001
+ad482000
+3c081003
+3508b8c0
+3c0a1001
+ad482040
+3c081003
+35089f40
+3c0a1001
+ad482080
+3c081001
+35083780
+3c0a1001
+ad4820c0
+3c081001
+35087d80
+3c0a1001
+ad482100
+3c081003
+3508ce00
+3c0a1001
+ad482140
+3c081002
+350834c0
+3c0a1001
+ad482180
+3c081002
+35081680
+3c0a1001
+ad4821c0
+3c081002
+3508f140
+3c0a1001
+ad482200
+3c081002
+3508cec0
+3c0a1001
+ad482240
+3c081000
+3508f180
+3c0a1001
+ad482280
+3c081001
+3508f280
+3c0a1001
+ad4822c0
+3c081001
+350836c0
+3c0a1001
+ad482300
+3c081000
+35089500
+3c0a1001
+ad482340
+3c081001
+3508c580
+3c0a1001
+ad482380
+3c081003
+3508e200
+3c0a1001
+ad4823c0
+3c081001
+35087840
+3c0a1001
+ad482400
+3c081003
+3508f1c0
+3c0a1001
+ad482440
+3c081000
+35089740
+3c0a1001
+ad482480
+3c081002
+35084640
+3c0a1001
+ad4824c0
+3c081003
+3508d840
+3c0a1001
+ad482500
+3c081003
+35088340
+3c0a1001
+ad482540
+3c081003
+3508d400
+3c0a1001
+ad482580
+3c081002
+35084e00
+3c0a1001
+ad4825c0
+3c081002
+35089400
+3c0a1001
+ad482600
+3c081002
+35085240
+3c0a1001
+ad482640
+3c081000
+35085480
+3c0a1001
+ad482680
+3c081003
+35084500
+3c0a1001
+ad4826c0
+3c081001
+35087a40
+3c0a1001
+ad482700
+3c081002
+3508aac0
+3c0a1001
+ad482740
+3c081002
+35080240
+3c0a1001
+ad482780
+3c081002
+350825c0
+3c0a1001
+ad4827c0
+3c081003
+35084c80
+3c0a1001
+ad482800
+3c081001
+3508e140
+3c0a1001
+ad482840
+3c081001
+35080180
+3c0a1001
+ad482880
+3c081003
+3508cf40
+3c0a1001
+ad4828c0
+3c081003
+35086980
+3c0a1001
+ad482900
+3c081001
+3508ef00
+3c0a1001
+ad482940
+3c081001
+350860c0
+3c0a1001
+ad482980
+3c081000
+35089840
+3c0a1001
+ad4829c0
+3c081000
+35080a40
+3c0a1001
+ad482a00
+3c081000
+350874c0
+3c0a1001
+ad482a40
+3c081000
+35081f00
+3c0a1001
+ad482a80
+3c081001
+3508f540
+3c0a1001
+ad482ac0
+3c081002
+3508b300
+3c0a1001
+ad482b00
+3c081003
+350886c0
+3c0a1001
+ad482b40
+3c081001
+35087600
+3c0a1001
+ad482b80
+3c081001
+35087480
+3c0a1001
+ad482bc0
+3c081000
+3508a980
+3c0a1001
+ad482c00
+3c081002
+3508cd80
+3c0a1001
+ad482c40
+3c081000
+350842c0
+3c0a1001
+ad482c80
+3c081002
+35086880
+3c0a1001
+ad482cc0
+3c081001
+35086f80
+3c0a1001
+ad482d00
+3c081003
+35084600
+3c0a1001
+ad482d40
+3c081001
+3508ca40
+3c0a1001
+ad482d80
+3c081002
+3508d8c0
+3c0a1001
+ad482dc0
+3c081003
+3508ed00
+3c0a1001
+ad482e00
+3c081002
+350832c0
+3c0a1001
+ad482e40
+3c081002
+3508ff40
+3c0a1001
+ad482e80
+3c081001
+350875c0
+3c0a1001
+ad482ec0
+3c081003
+35084fc0
+3c0a1001
+ad482f00
+3c081001
+35088f80
+3c0a1001
+ad482f40
+3c081001
+35087240
+3c0a1001
+ad482f80
+3c081003
+350870c0
+3c0a1001
+ad482fc0
+3c081001
+3508b780
+3c0a1001
+ad483000
+3c081003
+3508d980
+3c0a1001
+ad483040
+3c081000
+35086400
+3c0a1001
+ad483080
+3c081002
+35081f80
+3c0a1001
+ad4830c0
+3c081000
+3508e6c0
+3c0a1001
+ad483100
+3c081003
+3508ab40
+3c0a1001
+ad483140
+3c081001
+3508abc0
+3c0a1001
+ad483180
+3c081000
+35083480
+3c0a1001
+ad4831c0
+3c081002
+3508f340
+3c0a1001
+ad483200
+3c081000
+3508b680
+3c0a1001
+ad483240
+3c081000
+35082400
+3c0a1001
+ad483280
+3c081002
+3508f880
+3c0a1001
+ad4832c0
+3c081002
+3508c540
+3c0a1001
+ad483300
+3c081001
+3508c300
+3c0a1001
+ad483340
+3c081002
+35084c80
+3c0a1001
+ad483380
+3c081003
+3508dc00
+3c0a1001
+ad4833c0
+3c081003
+350853c0
+3c0a1001
+ad483400
+3c081001
+3508e100
+3c0a1001
+ad483440
+3c081003
+35083e80
+3c0a1001
+ad483480
+3c081002
+3508b880
+3c0a1001
+ad4834c0
+3c081002
+3508b3c0
+3c0a1001
+ad483500
+3c081000
+35085800
+3c0a1001
+ad483540
+3c081003
+35083400
+3c0a1001
+ad483580
+3c081003
+35084f80
+3c0a1001
+ad4835c0
+3c081000
+35087b00
+3c0a1001
+ad483600
+3c081002
+35085100
+3c0a1001
+ad483640
+3c081002
+35085e80
+3c0a1001
+ad483680
+3c081000
+3508c280
+3c0a1001
+ad4836c0
+3c081003
+3508d0c0
+3c0a1001
+ad483700
+3c081002
+3508b640
+3c0a1001
+ad483740
+3c081003
+3508aac0
+3c0a1001
+ad483780
+3c081002
+35086bc0
+3c0a1001
+ad4837c0
+3c081002
+3508ff80
+3c0a1001
+ad483800
+3c081001
+350866c0
+3c0a1001
+ad483840
+3c081002
+35081c00
+3c0a1001
+ad483880
+3c081002
+3508d940
+3c0a1001
+ad4838c0
+3c081001
+35084780
+3c0a1001
+ad483900
+3c081001
+3508ebc0
+3c0a1001
+ad483940
+3c081003
+35088480
+3c0a1001
+ad483980
+3c081000
+350830c0
+3c0a1001
+ad4839c0
+3c081003
+35087800
+3c0a1001
+ad483a00
+3c081001
+35089000
+3c0a1001
+ad483a40
+3c081003
+350890c0
+3c0a1001
+ad483a80
+3c081000
+3508d500
+3c0a1001
+ad483ac0
+3c081001
+35089c40
+3c0a1001
+ad483b00
+3c081002
+35085340
+3c0a1001
+ad483b40
+3c081002
+35084540
+3c0a1001
+ad483b80
+3c081002
+3508e0c0
+3c0a1001
+ad483bc0
+3c081000
+35082cc0
+3c0a1001
+ad483c00
+3c081003
+3508c5c0
+3c0a1001
+ad483c40
+3c081002
+35085fc0
+3c0a1001
+ad483c80
+3c081001
+35089280
+3c0a1001
+ad483cc0
+3c081003
+3508f240
+3c0a1001
+ad483d00
+3c081001
+35087200
+3c0a1001
+ad483d40
+3c081003
+35089500
+3c0a1001
+ad483d80
+3c081002
+3508d600
+3c0a1001
+ad483dc0
+3c081000
+35084e80
+3c0a1001
+ad483e00
+3c081002
+3508bb40
+3c0a1001
+ad483e40
+3c081000
+35086bc0
+3c0a1001
+ad483e80
+3c081001
+35081800
+3c0a1001
+ad483ec0
+3c081001
+3508a2c0
+3c0a1001
+ad483f00
+3c081001
+35085e80
+3c0a1001
+ad483f40
+3c081000
+35081840
+3c0a1001
+ad483f80
+3c081000
+35082280
+3c0a1001
+ad483fc0
+3c081001
+3508e380
+3c0a1001
+ad484000
+3c081000
+350865c0
+3c0a1001
+ad484040
+3c081000
+3508f440
+3c0a1001
+ad484080
+3c081001
+35080b80
+3c0a1001
+ad4840c0
+3c081001
+350890c0
+3c0a1001
+ad484100
+3c081002
+35082280
+3c0a1001
+ad484140
+3c081003
+350823c0
+3c0a1001
+ad484180
+3c081000
+35088080
+3c0a1001
+ad4841c0
+3c081000
+3508c7c0
+3c0a1001
+ad484200
+3c081001
+3508e880
+3c0a1001
+ad484240
+3c081001
+35085400
+3c0a1001
+ad484280
+3c081001
+3508fd80
+3c0a1001
+ad4842c0
+3c081000
+3508da80
+3c0a1001
+ad484300
+3c081003
+3508d100
+3c0a1001
+ad484340
+3c081003
+35080e00
+3c0a1001
+ad484380
+3c081003
+35081e80
+3c0a1001
+ad4843c0
+3c081003
+35085f00
+3c0a1001
+ad484400
+3c081001
+35089c80
+3c0a1001
+ad484440
+3c081000
+3508bf80
+3c0a1001
+ad484480
+3c081000
+35089880
+3c0a1001
+ad4844c0
+3c081000
+350841c0
+3c0a1001
+ad484500
+3c081003
+35089b40
+3c0a1001
+ad484540
+3c081002
+35085740
+3c0a1001
+ad484580
+3c081000
+3508e400
+3c0a1001
+ad4845c0
+3c081003
+35082cc0
+3c0a1001
+ad484600
+3c081001
+3508a680
+3c0a1001
+ad484640
+3c081001
+35083180
+3c0a1001
+ad484680
+3c081003
+3508a8c0
+3c0a1001
+ad4846c0
+3c081003
+3508fd00
+3c0a1001
+ad484700
+3c081003
+3508e3c0
+3c0a1001
+ad484740
+3c081003
+35084980
+3c0a1001
+ad484780
+3c081000
+35083f00
+3c0a1001
+ad4847c0
+3c081002
+35086300
+3c0a1001
+ad484800
+3c081002
+3508e280
+3c0a1001
+ad484840
+3c081003
+3508a1c0
+3c0a1001
+ad484880
+3c081003
+35087c80
+3c0a1001
+ad4848c0
+3c081003
+350836c0
+3c0a1001
+ad484900
+3c081001
+350896c0
+3c0a1001
+ad484940
+3c081001
+35087f00
+3c0a1001
+ad484980
+3c081002
+3508cf80
+3c0a1001
+ad4849c0
+3c081002
+3508e500
+3c0a1001
+ad484a00
+3c081001
+3508b200
+3c0a1001
+ad484a40
+3c081003
+35080ac0
+3c0a1001
+ad484a80
+3c081002
+35081500
+3c0a1001
+ad484ac0
+3c081001
+35082540
+3c0a1001
+ad484b00
+3c081002
+35089040
+3c0a1001
+ad484b40
+3c081003
+3508b2c0
+3c0a1001
+ad484b80
+3c081001
+3508fac0
+3c0a1001
+ad484bc0
+3c081003
+35084680
+3c0a1001
+ad484c00
+3c081002
+350815c0
+3c0a1001
+ad484c40
+3c081002
+3508c400
+3c0a1001
+ad484c80
+3c081000
+35086240
+3c0a1001
+ad484cc0
+3c081002
+35082080
+3c0a1001
+ad484d00
+3c081000
+350811c0
+3c0a1001
+ad484d40
+3c081000
+3508a8c0
+3c0a1001
+ad484d80
+3c081001
+3508b540
+3c0a1001
+ad484dc0
+3c081003
+3508a0c0
+3c0a1001
+ad484e00
+3c081001
+3508c5c0
+3c0a1001
+ad484e40
+3c081000
+3508c780
+3c0a1001
+ad484e80
+3c081002
+3508a9c0
+3c0a1001
+ad484ec0
+3c081002
+35083b00
+3c0a1001
+ad484f00
+3c081000
+35082a40
+3c0a1001
+ad484f40
+3c081003
+35083640
+3c0a1001
+ad484f80
+3c081003
+35086e40
+3c0a1001
+ad484fc0
+3c081003
+35082e40
+3c0a1001
+ad485000
+3c081001
+35080b00
+3c0a1001
+ad485040
+3c081000
+35084d40
+3c0a1001
+ad485080
+3c081003
+3508fbc0
+3c0a1001
+ad4850c0
+3c081002
+35084f00
+3c0a1001
+ad485100
+3c081002
+3508d280
+3c0a1001
+ad485140
+3c081000
+350835c0
+3c0a1001
+ad485180
+3c081002
+35087140
+3c0a1001
+ad4851c0
+3c081002
+3508e340
+3c0a1001
+ad485200
+3c081003
+35085640
+3c0a1001
+ad485240
+3c081000
+3508c3c0
+3c0a1001
+ad485280
+3c081000
+35082780
+3c0a1001
+ad4852c0
+3c081000
+35081040
+3c0a1001
+ad485300
+3c081002
+35087340
+3c0a1001
+ad485340
+3c081001
+350818c0
+3c0a1001
+ad485380
+3c081003
+3508ac00
+3c0a1001
+ad4853c0
+3c081001
+35086780
+3c0a1001
+ad485400
+3c081003
+35080980
+3c0a1001
+ad485440
+3c081003
+3508fb00
+3c0a1001
+ad485480
+3c081002
+3508f900
+3c0a1001
+ad4854c0
+3c081001
+3508d480
+3c0a1001
+ad485500
+3c081000
+350851c0
+3c0a1001
+ad485540
+3c081001
+35087c80
+3c0a1001
+ad485580
+3c081002
+35085b80
+3c0a1001
+ad4855c0
+3c081000
+3508f300
+3c0a1001
+ad485600
+3c081002
+35086200
+3c0a1001
+ad485640
+3c081000
+3508fbc0
+3c0a1001
+ad485680
+3c081002
+350890c0
+3c0a1001
+ad4856c0
+3c081003
+3508d800
+3c0a1001
+ad485700
+3c081003
+35082240
+3c0a1001
+ad485740
+3c081003
+350865c0
+3c0a1001
+ad485780
+3c081001
+3508efc0
+3c0a1001
+ad4857c0
+3c081001
+3508bc00
+3c0a1001
+ad485800
+3c081001
+35089f00
+3c0a1001
+ad485840
+3c081001
+35089380
+3c0a1001
+ad485880
+3c081001
+3508ed00
+3c0a1001
+ad4858c0
+3c081001
+3508fcc0
+3c0a1001
+ad485900
+3c081001
+3508a640
+3c0a1001
+ad485940
+3c081003
+35080180
+3c0a1001
+ad485980
+3c081000
+35085780
+3c0a1001
+ad4859c0
+3c081000
+35088980
+3c0a1001
+ad485a00
+3c081002
+35081ac0
+3c0a1001
+ad485a40
+3c081000
+35085900
+3c0a1001
+ad485a80
+3c081000
+3508f780
+3c0a1001
+ad485ac0
+3c081001
+35087900
+3c0a1001
+ad485b00
+3c081000
+35088a80
+3c0a1001
+ad485b40
+3c081003
+3508b740
+3c0a1001
+ad485b80
+3c081001
+35089900
+3c0a1001
+ad485bc0
+3c081000
+35081b80
+3c0a1001
+ad485c00
+3c081002
+35088700
+3c0a1001
+ad485c40
+3c081001
+35085b00
+3c0a1001
+ad485c80
+3c081003
+3508d000
+3c0a1001
+ad485cc0
+3c081001
+35085300
+3c0a1001
+ad485d00
+3c081000
+35088040
+3c0a1001
+ad485d40
+3c081001
+35081f00
+3c0a1001
+ad485d80
+3c081002
+3508b400
+3c0a1001
+ad485dc0
+3c081003
+35083880
+3c0a1001
+ad485e00
+3c081001
+3508bec0
+3c0a1001
+ad485e40
+3c081003
+3508a280
+3c0a1001
+ad485e80
+3c081003
+35089cc0
+3c0a1001
+ad485ec0
+3c081003
+3508e400
+3c0a1001
+ad485f00
+3c081003
+3508efc0
+3c0a1001
+ad485f40
+3c081002
+3508f580
+3c0a1001
+ad485f80
+3c081001
+35088c00
+3c0a1001
+ad485fc0
+3c081001
+350868c0
+3c0a1001
+ad486000
+3c081002
+35080e40
+3c0a1001
+ad486040
+3c081001
+35089a00
+3c0a1001
+ad486080
+3c081000
+3508bd40
+3c0a1001
+ad4860c0
+3c081002
+35080cc0
+3c0a1001
+ad486100
+3c081003
+35088c00
+3c0a1001
+ad486140
+3c081001
+3508fe80
+3c0a1001
+ad486180
+3c081001
+3508a380
+3c0a1001
+ad4861c0
+3c081000
+3508eec0
+3c0a1001
+ad486200
+3c081003
+35089b00
+3c0a1001
+ad486240
+3c081003
+3508e280
+3c0a1001
+ad486280
+3c081003
+350809c0
+3c0a1001
+ad4862c0
+3c081003
+3508f580
+3c0a1001
+ad486300
+3c081003
+3508e880
+3c0a1001
+ad486340
+3c081000
+3508cd40
+3c0a1001
+ad486380
+3c081003
+3508c7c0
+3c0a1001
+ad4863c0
+3c081002
+35080400
+3c0a1001
+ad486400
+3c081000
+35089380
+3c0a1001
+ad486440
+3c081002
+35088c80
+3c0a1001
+ad486480
+3c081001
+3508b000
+3c0a1001
+ad4864c0
+3c081000
+3508cac0
+3c0a1001
+ad486500
+3c081001
+35083500
+3c0a1001
+ad486540
+3c081003
+3508c480
+3c0a1001
+ad486580
+3c081003
+3508aa40
+3c0a1001
+ad4865c0
+3c081000
+35080a80
+3c0a1001
+ad486600
+3c081000
+3508b380
+3c0a1001
+ad486640
+3c081002
+3508ff00
+3c0a1001
+ad486680
+3c081003
+3508fd40
+3c0a1001
+ad4866c0
+3c081003
+350854c0
+3c0a1001
+ad486700
+3c081002
+3508ec40
+3c0a1001
+ad486740
+3c081003
+35087f40
+3c0a1001
+ad486780
+3c081001
+35082500
+3c0a1001
+ad4867c0
+3c081002
+35087640
+3c0a1001
+ad486800
+3c081003
+35087d00
+3c0a1001
+ad486840
+3c081002
+3508cb40
+3c0a1001
+ad486880
+3c081002
+350844c0
+3c0a1001
+ad4868c0
+3c081000
+35087300
+3c0a1001
+ad486900
+3c081001
+35084680
+3c0a1001
+ad486940
+3c081000
+35083780
+3c0a1001
+ad486980
+3c081002
+3508e600
+3c0a1001
+ad4869c0
+3c081002
+35084fc0
+3c0a1001
+ad486a00
+3c081002
+3508e680
+3c0a1001
+ad486a40
+3c081002
+350873c0
+3c0a1001
+ad486a80
+3c081001
+35083fc0
+3c0a1001
+ad486ac0
+3c081003
+35084040
+3c0a1001
+ad486b00
+3c081001
+3508ef80
+3c0a1001
+ad486b40
+3c081002
+3508c480
+3c0a1001
+ad486b80
+3c081000
+35084780
+3c0a1001
+ad486bc0
+3c081002
+3508a980
+3c0a1001
+ad486c00
+3c081003
+35085480
+3c0a1001
+ad486c40
+3c081002
+3508a5c0
+3c0a1001
+ad486c80
+3c081001
+3508c440
+3c0a1001
+ad486cc0
+3c081002
+35080880
+3c0a1001
+ad486d00
+3c081002
+35086440
+3c0a1001
+ad486d40
+3c081003
+35084100
+3c0a1001
+ad486d80
+3c081002
+35082e80
+3c0a1001
+ad486dc0
+3c081001
+3508f7c0
+3c0a1001
+ad486e00
+3c081001
+3508c400
+3c0a1001
+ad486e40
+3c081002
+35084000
+3c0a1001
+ad486e80
+3c081000
+35080d00
+3c0a1001
+ad486ec0
+3c081003
+35088fc0
+3c0a1001
+ad486f00
+3c081002
+3508cb80
+3c0a1001
+ad486f40
+3c081001
+35088180
+3c0a1001
+ad486f80
+3c081002
+35081440
+3c0a1001
+ad486fc0
+3c081003
+35082b40
+3c0a1001
+ad487000
+3c081000
+3508ca40
+3c0a1001
+ad487040
+3c081000
+3508ee80
+3c0a1001
+ad487080
+3c081001
+35081d40
+3c0a1001
+ad4870c0
+3c081000
+3508ef80
+3c0a1001
+ad487100
+3c081000
+3508fc80
+3c0a1001
+ad487140
+3c081000
+35083ec0
+3c0a1001
+ad487180
+3c081002
+3508f4c0
+3c0a1001
+ad4871c0
+3c081001
+3508c380
+3c0a1001
+ad487200
+3c081000
+3508bc40
+3c0a1001
+ad487240
+3c081002
+3508c280
+3c0a1001
+ad487280
+3c081001
+3508cbc0
+3c0a1001
+ad4872c0
+3c081003
+35080040
+3c0a1001
+ad487300
+3c081002
+35081bc0
+3c0a1001
+ad487340
+3c081001
+35082580
+3c0a1001
+ad487380
+3c081000
+35085600
+3c0a1001
+ad4873c0
+3c081003
+35080d80
+3c0a1001
+ad487400
+3c081001
+35088840
+3c0a1001
+ad487440
+3c081000
+3508ec00
+3c0a1001
+ad487480
+3c081001
+35085140
+3c0a1001
+ad4874c0
+3c081001
+3508d140
+3c0a1001
+ad487500
+3c081000
+3508e240
+3c0a1001
+ad487540
+3c081003
+35087b00
+3c0a1001
+ad487580
+3c081001
+35081140
+3c0a1001
+ad4875c0
+3c081001
+350857c0
+3c0a1001
+ad487600
+3c081003
+3508c240
+3c0a1001
+ad487640
+3c081002
+3508ac40
+3c0a1001
+ad487680
+3c081000
+3508d8c0
+3c0a1001
+ad4876c0
+3c081000
+3508ecc0
+3c0a1001
+ad487700
+3c081000
+35089580
+3c0a1001
+ad487740
+3c081000
+35085200
+3c0a1001
+ad487780
+3c081003
+35087340
+3c0a1001
+ad4877c0
+3c081000
+3508b140
+3c0a1001
+ad487800
+3c081002
+35084180
+3c0a1001
+ad487840
+3c081003
+3508cdc0
+3c0a1001
+ad487880
+3c081001
+35080a80
+3c0a1001
+ad4878c0
+3c081003
+3508bec0
+3c0a1001
+ad487900
+3c081002
+3508a2c0
+3c0a1001
+ad487940
+3c081002
+3508d980
+3c0a1001
+ad487980
+3c081002
+35089500
+3c0a1001
+ad4879c0
+3c081000
+35083b40
+3c0a1001
+ad487a00
+3c081003
+35089340
+3c0a1001
+ad487a40
+3c081001
+3508e280
+3c0a1001
+ad487a80
+3c081000
+3508d380
+3c0a1001
+ad487ac0
+3c081002
+3508da80
+3c0a1001
+ad487b00
+3c081002
+35080140
+3c0a1001
+ad487b40
+3c081001
+350892c0
+3c0a1001
+ad487b80
+3c081001
+3508dd40
+3c0a1001
+ad487bc0
+3c081001
+35081540
+3c0a1001
+ad487c00
+3c081003
+35084e80
+3c0a1001
+ad487c40
+3c081003
+3508d180
+3c0a1001
+ad487c80
+3c081002
+350835c0
+3c0a1001
+ad487cc0
+3c081003
+35082000
+3c0a1001
+ad487d00
+3c081002
+350858c0
+3c0a1001
+ad487d40
+3c081002
+35085080
+3c0a1001
+ad487d80
+3c081001
+35081680
+3c0a1001
+ad487dc0
+3c081002
+35088080
+3c0a1001
+ad487e00
+3c081003
+3508b140
+3c0a1001
+ad487e40
+3c081000
+35086a40
+3c0a1001
+ad487e80
+3c081002
+35080080
+3c0a1001
+ad487ec0
+3c081003
+35086e80
+3c0a1001
+ad487f00
+3c081001
+3508b740
+3c0a1001
+ad487f40
+3c081002
+35088040
+3c0a1001
+ad487f80
+3c081002
+3508f400
+3c0a1001
+ad487fc0
+3c081002
+35081400
+3c0a1002
+ad488000
+3c081000
+3508bcc0
+3c0a1002
+ad488040
+3c081002
+350802c0
+3c0a1002
+ad488080
+3c081000
+3508b400
+3c0a1002
+ad4880c0
+3c081002
+3508fa40
+3c0a1002
+ad488100
+3c081000
+35080c40
+3c0a1002
+ad488140
+3c081001
+3508a900
+3c0a1002
+ad488180
+3c081000
+35083000
+3c0a1002
+ad4881c0
+3c081003
+3508c000
+3c0a1002
+ad488200
+3c081001
+3508d600
+3c0a1002
+ad488240
+3c081002
+35084900
+3c0a1002
+ad488280
+3c081002
+35089740
+3c0a1002
+ad4882c0
+3c081003
+35087ac0
+3c0a1002
+ad488300
+3c081000
+35082680
+3c0a1002
+ad488340
+3c081001
+3508bdc0
+3c0a1002
+ad488380
+3c081003
+35084a40
+3c0a1002
+ad4883c0
+3c081000
+3508fe40
+3c0a1002
+ad488400
+3c081000
+35087480
+3c0a1002
+ad488440
+3c081003
+35085a00
+3c0a1002
+ad488480
+3c081002
+35089b40
+3c0a1002
+ad4884c0
+3c081003
+3508a140
+3c0a1002
+ad488500
+3c081003
+35085340
+3c0a1002
+ad488540
+3c081000
+35084b00
+3c0a1002
+ad488580
+3c081001
+35087500
+3c0a1002
+ad4885c0
+3c081002
+3508af80
+3c0a1002
+ad488600
+3c081002
+35086600
+3c0a1002
+ad488640
+3c081003
+35088680
+3c0a1002
+ad488680
+3c081000
+3508c900
+3c0a1002
+ad4886c0
+3c081002
+350887c0
+3c0a1002
+ad488700
+3c081001
+3508c9c0
+3c0a1002
+ad488740
+3c081003
+3508d6c0
+3c0a1002
+ad488780
+3c081000
+3508f700
+3c0a1002
+ad4887c0
+3c081001
+35089f40
+3c0a1002
+ad488800
+3c081001
+35083800
+3c0a1002
+ad488840
+3c081002
+35084840
+3c0a1002
+ad488880
+3c081000
+35080500
+3c0a1002
+ad4888c0
+3c081000
+35080600
+3c0a1002
+ad488900
+3c081001
+35086480
+3c0a1002
+ad488940
+3c081000
+35082340
+3c0a1002
+ad488980
+3c081000
+35085500
+3c0a1002
+ad4889c0
+3c081002
+3508d040
+3c0a1002
+ad488a00
+3c081002
+3508da40
+3c0a1002
+ad488a40
+3c081003
+35080ec0
+3c0a1002
+ad488a80
+3c081000
+35086a80
+3c0a1002
+ad488ac0
+3c081000
+35086ac0
+3c0a1002
+ad488b00
+3c081000
+35084940
+3c0a1002
+ad488b40
+3c081000
+3508c040
+3c0a1002
+ad488b80
+3c081000
+350898c0
+3c0a1002
+ad488bc0
+3c081001
+35083f80
+3c0a1002
+ad488c00
+3c081000
+35082240
+3c0a1002
+ad488c40
+3c081003
+35085b80
+3c0a1002
+ad488c80
+3c081000
+35080fc0
+3c0a1002
+ad488cc0
+3c081000
+3508fa00
+3c0a1002
+ad488d00
+3c081002
+35082500
+3c0a1002
+ad488d40
+3c081000
+35087140
+3c0a1002
+ad488d80
+3c081001
+35080ec0
+3c0a1002
+ad488dc0
+3c081001
+350858c0
+3c0a1002
+ad488e00
+3c081003
+35088e40
+3c0a1002
+ad488e40
+3c081001
+35089500
+3c0a1002
+ad488e80
+3c081002
+3508b700
+3c0a1002
+ad488ec0
+3c081003
+35085380
+3c0a1002
+ad488f00
+3c081003
+35085800
+3c0a1002
+ad488f40
+3c081002
+3508aa00
+3c0a1002
+ad488f80
+3c081003
+35082500
+3c0a1002
+ad488fc0
+3c081000
+3508e900
+3c0a1002
+ad489000
+3c081002
+350826c0
+3c0a1002
+ad489040
+3c081002
+350809c0
+3c0a1002
+ad489080
+3c081001
+3508ccc0
+3c0a1002
+ad4890c0
+3c081003
+35080600
+3c0a1002
+ad489100
+3c081001
+35089dc0
+3c0a1002
+ad489140
+3c081000
+3508b200
+3c0a1002
+ad489180
+3c081001
+350886c0
+3c0a1002
+ad4891c0
+3c081003
+3508d700
+3c0a1002
+ad489200
+3c081000
+35080800
+3c0a1002
+ad489240
+3c081003
+3508c640
+3c0a1002
+ad489280
+3c081003
+35085c40
+3c0a1002
+ad4892c0
+3c081002
+35080580
+3c0a1002
+ad489300
+3c081002
+35085040
+3c0a1002
+ad489340
+3c081002
+35088180
+3c0a1002
+ad489380
+3c081003
+35080840
+3c0a1002
+ad4893c0
+3c081002
+35082fc0
+3c0a1002
+ad489400
+3c081002
+35087c00
+3c0a1002
+ad489440
+3c081003
+3508f640
+3c0a1002
+ad489480
+3c081000
+35088380
+3c0a1002
+ad4894c0
+3c081000
+3508abc0
+3c0a1002
+ad489500
+3c081000
+35080b40
+3c0a1002
+ad489540
+3c081002
+3508b140
+3c0a1002
+ad489580
+3c081003
+3508d200
+3c0a1002
+ad4895c0
+3c081002
+3508f7c0
+3c0a1002
+ad489600
+3c081002
+35089280
+3c0a1002
+ad489640
+3c081003
+3508e840
+3c0a1002
+ad489680
+3c081000
+3508e940
+3c0a1002
+ad4896c0
+3c081000
+35081280
+3c0a1002
+ad489700
+3c081002
+35084300
+3c0a1002
+ad489740
+3c081001
+35081bc0
+3c0a1002
+ad489780
+3c081000
+3508fe00
+3c0a1002
+ad4897c0
+3c081002
+3508be40
+3c0a1002
+ad489800
+3c081001
+35084100
+3c0a1002
+ad489840
+3c081001
+3508c340
+3c0a1002
+ad489880
+3c081003
+3508a400
+3c0a1002
+ad4898c0
+3c081002
+35082840
+3c0a1002
+ad489900
+3c081000
+3508ba80
+3c0a1002
+ad489940
+3c081002
+35083ec0
+3c0a1002
+ad489980
+3c081000
+3508c8c0
+3c0a1002
+ad4899c0
+3c081000
+35088b40
+3c0a1002
+ad489a00
+3c081000
+3508e500
+3c0a1002
+ad489a40
+3c081001
+35083d40
+3c0a1002
+ad489a80
+3c081002
+350841c0
+3c0a1002
+ad489ac0
+3c081000
+35088b80
+3c0a1002
+ad489b00
+3c081003
+3508a680
+3c0a1002
+ad489b40
+3c081000
+3508f9c0
+3c0a1002
+ad489b80
+3c081000
+35085f80
+3c0a1002
+ad489bc0
+3c081003
+35087cc0
+3c0a1002
+ad489c00
+3c081002
+3508be00
+3c0a1002
+ad489c40
+3c081003
+35083580
+3c0a1002
+ad489c80
+3c081001
+3508ca00
+3c0a1002
+ad489cc0
+3c081000
+35088140
+3c0a1002
+ad489d00
+3c081001
+3508d700
+3c0a1002
+ad489d40
+3c081000
+35084e40
+3c0a1002
+ad489d80
+3c081001
+3508c740
+3c0a1002
+ad489dc0
+3c081003
+350830c0
+3c0a1002
+ad489e00
+3c081000
+3508edc0
+3c0a1002
+ad489e40
+3c081001
+3508d780
+3c0a1002
+ad489e80
+3c081002
+3508edc0
+3c0a1002
+ad489ec0
+3c081001
+3508b440
+3c0a1002
+ad489f00
+3c081003
+35084dc0
+3c0a1002
+ad489f40
+3c081001
+3508c280
+3c0a1002
+ad489f80
+3c081003
+35083680
+3c0a1002
+ad489fc0
+3c081002
+35089a00
+3c0a1002
+ad48a000
+3c081001
+3508a980
+3c0a1002
+ad48a040
+3c081000
+35082840
+3c0a1002
+ad48a080
+3c081001
+350817c0
+3c0a1002
+ad48a0c0
+3c081003
+3508b700
+3c0a1002
+ad48a100
+3c081001
+350806c0
+3c0a1002
+ad48a140
+3c081001
+3508db00
+3c0a1002
+ad48a180
+3c081000
+3508c800
+3c0a1002
+ad48a1c0
+3c081002
+35088340
+3c0a1002
+ad48a200
+3c081002
+35082300
+3c0a1002
+ad48a240
+3c081002
+3508fe80
+3c0a1002
+ad48a280
+3c081001
+35087640
+3c0a1002
+ad48a2c0
+3c081002
+35081180
+3c0a1002
+ad48a300
+3c081003
+35087e40
+3c0a1002
+ad48a340
+3c081000
+350863c0
+3c0a1002
+ad48a380
+3c081001
+35085a00
+3c0a1002
+ad48a3c0
+3c081000
+35087e80
+3c0a1002
+ad48a400
+3c081001
+35086c00
+3c0a1002
+ad48a440
+3c081003
+3508f0c0
+3c0a1002
+ad48a480
+3c081000
+3508d780
+3c0a1002
+ad48a4c0
+3c081003
+3508c040
+3c0a1002
+ad48a500
+3c081002
+3508d540
+3c0a1002
+ad48a540
+3c081002
+35081a40
+3c0a1002
+ad48a580
+3c081003
+35087440
+3c0a1002
+ad48a5c0
+3c081003
+3508e9c0
+3c0a1002
+ad48a600
+3c081002
+3508da00
+3c0a1002
+ad48a640
+3c081001
+3508de40
+3c0a1002
+ad48a680
+3c081002
+3508e740
+3c0a1002
+ad48a6c0
+3c081002
+3508e240
+3c0a1002
+ad48a700
+3c081003
+35087c40
+3c0a1002
+ad48a740
+3c081002
+35080500
+3c0a1002
+ad48a780
+3c081002
+3508b780
+3c0a1002
+ad48a7c0
+3c081003
+35088dc0
+3c0a1002
+ad48a800
+3c081000
+3508d080
+3c0a1002
+ad48a840
+3c081001
+35089e00
+3c0a1002
+ad48a880
+3c081001
+35088140
+3c0a1002
+ad48a8c0
+3c081001
+3508bd80
+3c0a1002
+ad48a900
+3c081000
+35089440
+3c0a1002
+ad48a940
+3c081000
+3508b840
+3c0a1002
+ad48a980
+3c081001
+35081cc0
+3c0a1002
+ad48a9c0
+3c081000
+350883c0
+3c0a1002
+ad48aa00
+3c081000
+35081640
+3c0a1002
+ad48aa40
+3c081002
+3508f180
+3c0a1002
+ad48aa80
+3c081002
+35089600
+3c0a1002
+ad48aac0
+3c081001
+35084400
+3c0a1002
+ad48ab00
+3c081003
+35083480
+3c0a1002
+ad48ab40
+3c081001
+35088800
+3c0a1002
+ad48ab80
+3c081001
+35084140
+3c0a1002
+ad48abc0
+3c081003
+35082440
+3c0a1002
+ad48ac00
+3c081003
+350845c0
+3c0a1002
+ad48ac40
+3c081003
+35082d80
+3c0a1002
+ad48ac80
+3c081002
+3508d580
+3c0a1002
+ad48acc0
+3c081003
+35088940
+3c0a1002
+ad48ad00
+3c081000
+35085b40
+3c0a1002
+ad48ad40
+3c081002
+35086f80
+3c0a1002
+ad48ad80
+3c081003
+3508c440
+3c0a1002
+ad48adc0
+3c081000
+35084040
+3c0a1002
+ad48ae00
+3c081001
+3508f6c0
+3c0a1002
+ad48ae40
+3c081000
+35087640
+3c0a1002
+ad48ae80
+3c081002
+35085d40
+3c0a1002
+ad48aec0
+3c081003
+35080240
+3c0a1002
+ad48af00
+3c081001
+35085fc0
+3c0a1002
+ad48af40
+3c081001
+35081880
+3c0a1002
+ad48af80
+3c081002
+3508d640
+3c0a1002
+ad48afc0
+3c081001
+35082b40
+3c0a1002
+ad48b000
+3c081003
+3508e080
+3c0a1002
+ad48b040
+3c081001
+35083b80
+3c0a1002
+ad48b080
+3c081003
+3508a880
+3c0a1002
+ad48b0c0
+3c081000
+35082bc0
+3c0a1002
+ad48b100
+3c081000
+3508ff80
+3c0a1002
+ad48b140
+3c081001
+35087880
+3c0a1002
+ad48b180
+3c081000
+35082b00
+3c0a1002
+ad48b1c0
+3c081000
+35085580
+3c0a1002
+ad48b200
+3c081003
+3508f7c0
+3c0a1002
+ad48b240
+3c081002
+35082580
+3c0a1002
+ad48b280
+3c081003
+35088700
+3c0a1002
+ad48b2c0
+3c081001
+35083580
+3c0a1002
+ad48b300
+3c081000
+35086080
+3c0a1002
+ad48b340
+3c081003
+35080680
+3c0a1002
+ad48b380
+3c081003
+35089280
+3c0a1002
+ad48b3c0
+3c081002
+350856c0
+3c0a1002
+ad48b400
+3c081002
+35085180
+3c0a1002
+ad48b440
+3c081000
+3508d280
+3c0a1002
+ad48b480
+3c081002
+35088640
+3c0a1002
+ad48b4c0
+3c081002
+3508b680
+3c0a1002
+ad48b500
+3c081000
+35087d80
+3c0a1002
+ad48b540
+3c081002
+35085a80
+3c0a1002
+ad48b580
+3c081000
+3508de40
+3c0a1002
+ad48b5c0
+3c081003
+35085040
+3c0a1002
+ad48b600
+3c081000
+350802c0
+3c0a1002
+ad48b640
+3c081000
+3508d040
+3c0a1002
+ad48b680
+3c081001
+35086800
+3c0a1002
+ad48b6c0
+3c081001
+35086640
+3c0a1002
+ad48b700
+3c081000
+35080f80
+3c0a1002
+ad48b740
+3c081002
+35081640
+3c0a1002
+ad48b780
+3c081001
+35085b40
+3c0a1002
+ad48b7c0
+3c081002
+350855c0
+3c0a1002
+ad48b800
+3c081002
+3508f640
+3c0a1002
+ad48b840
+3c081003
+35086b40
+3c0a1002
+ad48b880
+3c081002
+3508a100
+3c0a1002
+ad48b8c0
+3c081001
+3508bc40
+3c0a1002
+ad48b900
+3c081002
+35089e80
+3c0a1002
+ad48b940
+3c081000
+3508b0c0
+3c0a1002
+ad48b980
+3c081000
+35087a40
+3c0a1002
+ad48b9c0
+3c081001
+3508fa40
+3c0a1002
+ad48ba00
+3c081002
+35086c40
+3c0a1002
+ad48ba40
+3c081003
+350801c0
+3c0a1002
+ad48ba80
+3c081002
+350836c0
+3c0a1002
+ad48bac0
+3c081000
+35087880
+3c0a1002
+ad48bb00
+3c081001
+35088f40
+3c0a1002
+ad48bb40
+3c081003
+35089640
+3c0a1002
+ad48bb80
+3c081002
+3508b800
+3c0a1002
+ad48bbc0
+3c081002
+3508db40
+3c0a1002
+ad48bc00
+3c081001
+350821c0
+3c0a1002
+ad48bc40
+3c081002
+35084240
+3c0a1002
+ad48bc80
+3c081003
+35081500
+3c0a1002
+ad48bcc0
+3c081002
+3508e140
+3c0a1002
+ad48bd00
+3c081000
+3508dc40
+3c0a1002
+ad48bd40
+3c081000
+35083940
+3c0a1002
+ad48bd80
+3c081000
+35086980
+3c0a1002
+ad48bdc0
+3c081001
+3508db40
+3c0a1002
+ad48be00
+3c081002
+3508a880
+3c0a1002
+ad48be40
+3c081001
+3508d200
+3c0a1002
+ad48be80
+3c081001
+35089a40
+3c0a1002
+ad48bec0
+3c081001
+35084280
+3c0a1002
+ad48bf00
+3c081001
+3508f680
+3c0a1002
+ad48bf40
+3c081000
+35088400
+3c0a1002
+ad48bf80
+3c081003
+35082d00
+3c0a1002
+ad48bfc0
+3c081001
+3508bf80
+3c0a1002
+ad48c000
+3c081003
+35082100
+3c0a1002
+ad48c040
+3c081003
+3508fec0
+3c0a1002
+ad48c080
+3c081001
+35084d80
+3c0a1002
+ad48c0c0
+3c081002
+35089880
+3c0a1002
+ad48c100
+3c081001
+35084640
+3c0a1002
+ad48c140
+3c081000
+350858c0
+3c0a1002
+ad48c180
+3c081002
+35082440
+3c0a1002
+ad48c1c0
+3c081003
+3508f540
+3c0a1002
+ad48c200
+3c081002
+35081600
+3c0a1002
+ad48c240
+3c081001
+35088700
+3c0a1002
+ad48c280
+3c081000
+35087ec0
+3c0a1002
+ad48c2c0
+3c081002
+350829c0
+3c0a1002
+ad48c300
+3c081003
+35087200
+3c0a1002
+ad48c340
+3c081002
+3508dd00
+3c0a1002
+ad48c380
+3c081002
+3508fc80
+3c0a1002
+ad48c3c0
+3c081000
+35085000
+3c0a1002
+ad48c400
+3c081002
+35089e00
+3c0a1002
+ad48c440
+3c081001
+3508b100
+3c0a1002
+ad48c480
+3c081000
+35085680
+3c0a1002
+ad48c4c0
+3c081000
+35087f00
+3c0a1002
+ad48c500
+3c081002
+3508a0c0
+3c0a1002
+ad48c540
+3c081002
+3508e980
+3c0a1002
+ad48c580
+3c081000
+35080d80
+3c0a1002
+ad48c5c0
+3c081000
+35082200
+3c0a1002
+ad48c600
+3c081002
+35085140
+3c0a1002
+ad48c640
+3c081003
+35081dc0
+3c0a1002
+ad48c680
+3c081001
+35085a80
+3c0a1002
+ad48c6c0
+3c081003
+3508b480
+3c0a1002
+ad48c700
+3c081002
+35085a00
+3c0a1002
+ad48c740
+3c081000
+35082040
+3c0a1002
+ad48c780
+3c081000
+35085400
+3c0a1002
+ad48c7c0
+3c081000
+3508e2c0
+3c0a1002
+ad48c800
+3c081002
+3508c8c0
+3c0a1002
+ad48c840
+3c081000
+3508a440
+3c0a1002
+ad48c880
+3c081001
+3508c000
+3c0a1002
+ad48c8c0
+3c081001
+350894c0
+3c0a1002
+ad48c900
+3c081002
+3508bc00
+3c0a1002
+ad48c940
+3c081002
+3508ba80
+3c0a1002
+ad48c980
+3c081000
+3508bd00
+3c0a1002
+ad48c9c0
+3c081002
+35089440
+3c0a1002
+ad48ca00
+3c081003
+350821c0
+3c0a1002
+ad48ca40
+3c081003
+3508b880
+3c0a1002
+ad48ca80
+3c081003
+35080380
+3c0a1002
+ad48cac0
+3c081000
+3508f880
+3c0a1002
+ad48cb00
+3c081001
+3508f480
+3c0a1002
+ad48cb40
+3c081002
+35089c40
+3c0a1002
+ad48cb80
+3c081002
+3508f3c0
+3c0a1002
+ad48cbc0
+3c081001
+3508d900
+3c0a1002
+ad48cc00
+3c081003
+3508d9c0
+3c0a1002
+ad48cc40
+3c081003
+35080b40
+3c0a1002
+ad48cc80
+3c081001
+35084800
+3c0a1002
+ad48ccc0
+3c081000
+35082d00
+3c0a1002
+ad48cd00
+3c081003
+35083c00
+3c0a1002
+ad48cd40
+3c081000
+3508b240
+3c0a1002
+ad48cd80
+3c081002
+35081100
+3c0a1002
+ad48cdc0
+3c081002
+35085280
+3c0a1002
+ad48ce00
+3c081003
+35089180
+3c0a1002
+ad48ce40
+3c081003
+35086c40
+3c0a1002
+ad48ce80
+3c081000
+3508d900
+3c0a1002
+ad48cec0
+3c081002
+35089540
+3c0a1002
+ad48cf00
+3c081001
+3508b3c0
+3c0a1002
+ad48cf40
+3c081001
+35083b40
+3c0a1002
+ad48cf80
+3c081002
+35080e00
+3c0a1002
+ad48cfc0
+3c081000
+35081140
+3c0a1002
+ad48d000
+3c081002
+35082700
+3c0a1002
+ad48d040
+3c081002
+35083980
+3c0a1002
+ad48d080
+3c081003
+35084880
+3c0a1002
+ad48d0c0
+3c081000
+35081080
+3c0a1002
+ad48d100
+3c081001
+3508eb40
+3c0a1002
+ad48d140
+3c081002
+35081000
+3c0a1002
+ad48d180
+3c081001
+35082dc0
+3c0a1002
+ad48d1c0
+3c081003
+3508bbc0
+3c0a1002
+ad48d200
+3c081000
+35080180
+3c0a1002
+ad48d240
+3c081002
+35085c00
+3c0a1002
+ad48d280
+3c081003
+3508cd40
+3c0a1002
+ad48d2c0
+3c081002
+35086800
+3c0a1002
+ad48d300
+3c081001
+35088e00
+3c0a1002
+ad48d340
+3c081002
+35083700
+3c0a1002
+ad48d380
+3c081000
+3508a740
+3c0a1002
+ad48d3c0
+3c081002
+3508b000
+3c0a1002
+ad48d400
+3c081000
+3508f200
+3c0a1002
+ad48d440
+3c081003
+3508a340
+3c0a1002
+ad48d480
+3c081002
+35080740
+3c0a1002
+ad48d4c0
+3c081000
+35087540
+3c0a1002
+ad48d500
+3c081001
+35085340
+3c0a1002
+ad48d540
+3c081001
+35086880
+3c0a1002
+ad48d580
+3c081001
+35080240
+3c0a1002
+ad48d5c0
+3c081000
+3508bb80
+3c0a1002
+ad48d600
+3c081001
+35086a00
+3c0a1002
+ad48d640
+3c081001
+35080c80
+3c0a1002
+ad48d680
+3c081003
+3508fd80
+3c0a1002
+ad48d6c0
+3c081003
+35082940
+3c0a1002
+ad48d700
+3c081003
+3508dc80
+3c0a1002
+ad48d740
+3c081000
+35081740
+3c0a1002
+ad48d780
+3c081000
+35088ec0
+3c0a1002
+ad48d7c0
+3c081002
+35084800
+3c0a1002
+ad48d800
+3c081002
+350899c0
+3c0a1002
+ad48d840
+3c081002
+35084440
+3c0a1002
+ad48d880
+3c081000
+3508cbc0
+3c0a1002
+ad48d8c0
+3c081000
+35086380
+3c0a1002
+ad48d900
+3c081000
+35089bc0
+3c0a1002
+ad48d940
+3c081000
+35087280
+3c0a1002
+ad48d980
+3c081001
+35082280
+3c0a1002
+ad48d9c0
+3c081000
+35085180
+3c0a1002
+ad48da00
+3c081000
+3508bec0
+3c0a1002
+ad48da40
+3c081000
+3508aec0
+3c0a1002
+ad48da80
+3c081003
+35080500
+3c0a1002
+ad48dac0
+3c081002
+3508d300
+3c0a1002
+ad48db00
+3c081003
+3508f040
+3c0a1002
+ad48db40
+3c081003
+35087740
+3c0a1002
+ad48db80
+3c081001
+35083b00
+3c0a1002
+ad48dbc0
+3c081002
+3508f240
+3c0a1002
+ad48dc00
+3c081001
+350897c0
+3c0a1002
+ad48dc40
+3c081002
+350827c0
+3c0a1002
+ad48dc80
+3c081002
+350884c0
+3c0a1002
+ad48dcc0
+3c081000
+3508a200
+3c0a1002
+ad48dd00
+3c081000
+3508d480
+3c0a1002
+ad48dd40
+3c081001
+3508cf00
+3c0a1002
+ad48dd80
+3c081003
+35087f80
+3c0a1002
+ad48ddc0
+3c081001
+3508e480
+3c0a1002
+ad48de00
+3c081001
+35088c40
+3c0a1002
+ad48de40
+3c081000
+3508adc0
+3c0a1002
+ad48de80
+3c081001
+3508ec40
+3c0a1002
+ad48dec0
+3c081002
+3508d900
+3c0a1002
+ad48df00
+3c081001
+35087940
+3c0a1002
+ad48df40
+3c081002
+3508fa80
+3c0a1002
+ad48df80
+3c081002
+35086a00
+3c0a1002
+ad48dfc0
+3c081001
+3508d2c0
+3c0a1002
+ad48e000
+3c081002
+3508c0c0
+3c0a1002
+ad48e040
+3c081002
+35080d40
+3c0a1002
+ad48e080
+3c081000
+35081e80
+3c0a1002
+ad48e0c0
+3c081002
+35085c80
+3c0a1002
+ad48e100
+3c081000
+350819c0
+3c0a1002
+ad48e140
+3c081003
+35086780
+3c0a1002
+ad48e180
+3c081002
+35089240
+3c0a1002
+ad48e1c0
+3c081002
+35086580
+3c0a1002
+ad48e200
+3c081003
+35085b00
+3c0a1002
+ad48e240
+3c081001
+3508d880
+3c0a1002
+ad48e280
+3c081001
+3508d5c0
+3c0a1002
+ad48e2c0
+3c081001
+350891c0
+3c0a1002
+ad48e300
+3c081001
+3508e1c0
+3c0a1002
+ad48e340
+3c081000
+35083080
+3c0a1002
+ad48e380
+3c081001
+3508cc80
+3c0a1002
+ad48e3c0
+3c081001
+35080740
+3c0a1002
+ad48e400
+3c081001
+35081b40
+3c0a1002
+ad48e440
+3c081000
+350877c0
+3c0a1002
+ad48e480
+3c081001
+35080c40
+3c0a1002
+ad48e4c0
+3c081000
+350849c0
+3c0a1002
+ad48e500
+3c081001
+3508fc80
+3c0a1002
+ad48e540
+3c081002
+35084580
+3c0a1002
+ad48e580
+3c081001
+35080940
+3c0a1002
+ad48e5c0
+3c081002
+350897c0
+3c0a1002
+ad48e600
+3c081000
+35081a80
+3c0a1002
+ad48e640
+3c081000
+35089040
+3c0a1002
+ad48e680
+3c081002
+35086700
+3c0a1002
+ad48e6c0
+3c081003
+3508f280
+3c0a1002
+ad48e700
+3c081002
+35084ec0
+3c0a1002
+ad48e740
+3c081003
+35081740
+3c0a1002
+ad48e780
+3c081001
+35085280
+3c0a1002
+ad48e7c0
+3c081000
+3508c1c0
+3c0a1002
+ad48e800
+3c081003
+3508b6c0
+3c0a1002
+ad48e840
+3c081003
+3508bd40
+3c0a1002
+ad48e880
+3c081002
+3508a380
+3c0a1002
+ad48e8c0
+3c081000
+35089a40
+3c0a1002
+ad48e900
+3c081000
+3508e640
+3c0a1002
+ad48e940
+3c081003
+35088640
+3c0a1002
+ad48e980
+3c081003
+35087140
+3c0a1002
+ad48e9c0
+3c081000
+3508ff40
+3c0a1002
+ad48ea00
+3c081001
+3508dd00
+3c0a1002
+ad48ea40
+3c081002
+3508bf80
+3c0a1002
+ad48ea80
+3c081003
+35084280
+3c0a1002
+ad48eac0
+3c081003
+35084b40
+3c0a1002
+ad48eb00
+3c081001
+35081e80
+3c0a1002
+ad48eb40
+3c081000
+35089f80
+3c0a1002
+ad48eb80
+3c081001
+35081ec0
+3c0a1002
+ad48ebc0
+3c081000
+35082380
+3c0a1002
+ad48ec00
+3c081002
+3508a540
+3c0a1002
+ad48ec40
+3c081002
+3508a800
+3c0a1002
+ad48ec80
+3c081000
+35083980
+3c0a1002
+ad48ecc0
+3c081003
+35080640
+3c0a1002
+ad48ed00
+3c081002
+3508b980
+3c0a1002
+ad48ed40
+3c081000
+3508e9c0
+3c0a1002
+ad48ed80
+3c081000
+3508c180
+3c0a1002
+ad48edc0
+3c081003
+35082a80
+3c0a1002
+ad48ee00
+3c081002
+35084d00
+3c0a1002
+ad48ee40
+3c081002
+350818c0
+3c0a1002
+ad48ee80
+3c081000
+35084380
+3c0a1002
+ad48eec0
+3c081003
+35088ec0
+3c0a1002
+ad48ef00
+3c081003
+350850c0
+3c0a1002
+ad48ef40
+3c081000
+35087780
+3c0a1002
+ad48ef80
+3c081000
+3508dd80
+3c0a1002
+ad48efc0
+3c081002
+35082400
+3c0a1002
+ad48f000
+3c081002
+35082340
+3c0a1002
+ad48f040
+3c081000
+35081a00
+3c0a1002
+ad48f080
+3c081001
+3508a780
+3c0a1002
+ad48f0c0
+3c081000
+35086340
+3c0a1002
+ad48f100
+3c081003
+35080540
+3c0a1002
+ad48f140
+3c081001
+35080840
+3c0a1002
+ad48f180
+3c081000
+3508ef40
+3c0a1002
+ad48f1c0
+3c081001
+35086980
+3c0a1002
+ad48f200
+3c081000
+3508ed40
+3c0a1002
+ad48f240
+3c081003
+350893c0
+3c0a1002
+ad48f280
+3c081003
+35087480
+3c0a1002
+ad48f2c0
+3c081003
+35086200
+3c0a1002
+ad48f300
+3c081003
+350876c0
+3c0a1002
+ad48f340
+3c081001
+3508b940
+3c0a1002
+ad48f380
+3c081000
+35086040
+3c0a1002
+ad48f3c0
+3c081000
+35087b80
+3c0a1002
+ad48f400
+3c081002
+3508cdc0
+3c0a1002
+ad48f440
+3c081003
+35086fc0
+3c0a1002
+ad48f480
+3c081003
+35088cc0
+3c0a1002
+ad48f4c0
+3c081000
+35085700
+3c0a1002
+ad48f500
+3c081001
+350853c0
+3c0a1002
+ad48f540
+3c081001
+35087b80
+3c0a1002
+ad48f580
+3c081002
+3508f500
+3c0a1002
+ad48f5c0
+3c081000
+35081ac0
+3c0a1002
+ad48f600
+3c081002
+3508d6c0
+3c0a1002
+ad48f640
+3c081002
+35087fc0
+3c0a1002
+ad48f680
+3c081001
+35086dc0
+3c0a1002
+ad48f6c0
+3c081000
+35086200
+3c0a1002
+ad48f700
+3c081000
+3508dcc0
+3c0a1002
+ad48f740
+3c081000
+3508d540
+3c0a1002
+ad48f780
+3c081003
+35081300
+3c0a1002
+ad48f7c0
+3c081002
+3508c040
+3c0a1002
+ad48f800
+3c081000
+3508c700
+3c0a1002
+ad48f840
+3c081001
+350827c0
+3c0a1002
+ad48f880
+3c081000
+35084580
+3c0a1002
+ad48f8c0
+3c081002
+350806c0
+3c0a1002
+ad48f900
+3c081001
+35087000
+3c0a1002
+ad48f940
+3c081002
+35086480
+3c0a1002
+ad48f980
+3c081001
+35084300
+3c0a1002
+ad48f9c0
+3c081001
+350816c0
+3c0a1002
+ad48fa00
+3c081001
+3508ac80
+3c0a1002
+ad48fa40
+3c081000
+350823c0
+3c0a1002
+ad48fa80
+3c081001
+3508ac40
+3c0a1002
+ad48fac0
+3c081001
+35084080
+3c0a1002
+ad48fb00
+3c081000
+35085280
+3c0a1002
+ad48fb40
+3c081000
+350878c0
+3c0a1002
+ad48fb80
+3c081003
+3508f4c0
+3c0a1002
+ad48fbc0
+3c081003
+3508a080
+3c0a1002
+ad48fc00
+3c081001
+35085240
+3c0a1002
+ad48fc40
+3c081001
+350849c0
+3c0a1002
+ad48fc80
+3c081001
+35085c00
+3c0a1002
+ad48fcc0
+3c081003
+3508f200
+3c0a1002
+ad48fd00
+3c081002
+3508efc0
+3c0a1002
+ad48fd40
+3c081001
+3508f700
+3c0a1002
+ad48fd80
+3c081003
+35082f40
+3c0a1002
+ad48fdc0
+3c081002
+35080840
+3c0a1002
+ad48fe00
+3c081000
+3508d9c0
+3c0a1002
+ad48fe40
+3c081000
+35082740
+3c0a1002
+ad48fe80
+3c081000
+3508dbc0
+3c0a1002
+ad48fec0
+3c081003
+35084780
+3c0a1002
+ad48ff00
+3c081000
+35089cc0
+3c0a1002
+ad48ff40
+3c081003
+350887c0
+3c0a1002
+ad48ff80
+3c081000
+35081c80
+3c0a1002
+ad48ffc0
+3c081002
+35080440
+3c0a1002
+ad480000
+3c081000
+35089e80
+3c0a1002
+ad480040
+3c081003
+35086940
+3c0a1002
+ad480080
+3c081002
+350813c0
+3c0a1002
+ad4800c0
+3c081002
+3508d880
+3c0a1002
+ad480100
+3c081001
+3508e080
+3c0a1002
+ad480140
+3c081003
+3508d280
+3c0a1002
+ad480180
+3c081002
+3508c080
+3c0a1002
+ad4801c0
+3c081000
+3508fc40
+3c0a1002
+ad480200
+3c081001
+35088240
+3c0a1002
+ad480240
+3c081000
+3508acc0
+3c0a1002
+ad480280
+3c081002
+35085440
+3c0a1002
+ad4802c0
+3c081002
+3508d5c0
+3c0a1002
+ad480300
+3c081001
+3508bfc0
+3c0a1002
+ad480340
+3c081002
+3508c940
+3c0a1002
+ad480380
+3c081000
+35089a80
+3c0a1002
+ad4803c0
+3c081002
+35086e00
+3c0a1002
+ad480400
+3c081001
+35082f40
+3c0a1002
+ad480440
+3c081003
+35087500
+3c0a1002
+ad480480
+3c081001
+35088b00
+3c0a1002
+ad4804c0
+3c081003
+3508c3c0
+3c0a1002
+ad480500
+3c081002
+3508d2c0
+3c0a1002
+ad480540
+3c081003
+3508c380
+3c0a1002
+ad480580
+3c081000
+35089d80
+3c0a1002
+ad4805c0
+3c081001
+3508dc80
+3c0a1002
+ad480600
+3c081002
+350866c0
+3c0a1002
+ad480640
+3c081002
+3508d1c0
+3c0a1002
+ad480680
+3c081003
+3508fcc0
+3c0a1002
+ad4806c0
+3c081002
+3508d9c0
+3c0a1002
+ad480700
+3c081002
+35087800
+3c0a1002
+ad480740
+3c081000
+3508a840
+3c0a1002
+ad480780
+3c081002
+35082100
+3c0a1002
+ad4807c0
+3c081003
+3508f340
+3c0a1002
+ad480800
+3c081001
+35082d80
+3c0a1002
+ad480840
+3c081002
+35081f40
+3c0a1002
+ad480880
+3c081002
+3508a7c0
+3c0a1002
+ad4808c0
+3c081001
+3508ee00
+3c0a1002
+ad480900
+3c081002
+35087e00
+3c0a1002
+ad480940
+3c081000
+35084f00
+3c0a1002
+ad480980
+3c081003
+350861c0
+3c0a1002
+ad4809c0
+3c081002
+35081ec0
+3c0a1002
+ad480a00
+3c081001
+35083f00
+3c0a1002
+ad480a40
+3c081002
+3508ebc0
+3c0a1002
+ad480a80
+3c081001
+3508de80
+3c0a1002
+ad480ac0
+3c081003
+3508e5c0
+3c0a1002
+ad480b00
+3c081002
+3508ea00
+3c0a1002
+ad480b40
+3c081000
+3508f3c0
+3c0a1002
+ad480b80
+3c081003
+3508bb80
+3c0a1002
+ad480bc0
+3c081003
+35080dc0
+3c0a1002
+ad480c00
+3c081001
+35089d40
+3c0a1002
+ad480c40
+3c081003
+350842c0
+3c0a1002
+ad480c80
+3c081000
+3508ee40
+3c0a1002
+ad480cc0
+3c081002
+3508f680
+3c0a1002
+ad480d00
+3c081000
+35085d80
+3c0a1002
+ad480d40
+3c081002
+35086340
+3c0a1002
+ad480d80
+3c081003
+35083b40
+3c0a1002
+ad480dc0
+3c081002
+350803c0
+3c0a1002
+ad480e00
+3c081001
+35089e40
+3c0a1002
+ad480e40
+3c081002
+35086cc0
+3c0a1002
+ad480e80
+3c081002
+3508d680
+3c0a1002
+ad480ec0
+3c081000
+35087d40
+3c0a1002
+ad480f00
+3c081000
+3508c600
+3c0a1002
+ad480f40
+3c081001
+35088940
+3c0a1002
+ad480f80
+3c081000
+35080840
+3c0a1002
+ad480fc0
+3c081003
+3508ea00
+3c0a1002
+ad481000
+3c081003
+35089740
+3c0a1002
+ad481040
+3c081000
+35087000
+3c0a1002
+ad481080
+3c081001
+3508aa80
+3c0a1002
+ad4810c0
+3c081002
+3508c7c0
+3c0a1002
+ad481100
+3c081003
+35081380
+3c0a1002
+ad481140
+3c081002
+35086780
+3c0a1002
+ad481180
+3c081001
+3508b580
+3c0a1002
+ad4811c0
+3c081003
+35082fc0
+3c0a1002
+ad481200
+3c081001
+3508a440
+3c0a1002
+ad481240
+3c081002
+35082b40
+3c0a1002
+ad481280
+3c081001
+35086500
+3c0a1002
+ad4812c0
+3c081002
+3508f8c0
+3c0a1002
+ad481300
+3c081000
+35088480
+3c0a1002
+ad481340
+3c081000
+3508f400
+3c0a1002
+ad481380
+3c081000
+35081880
+3c0a1002
+ad4813c0
+3c081003
+3508f300
+3c0a1002
+ad481400
+3c081003
+3508a840
+3c0a1002
+ad481440
+3c081002
+3508fdc0
+3c0a1002
+ad481480
+3c081002
+3508f6c0
+3c0a1002
+ad4814c0
+3c081002
+35084140
+3c0a1002
+ad481500
+3c081000
+3508ab40
+3c0a1002
+ad481540
+3c081000
+3508a7c0
+3c0a1002
+ad481580
+3c081003
+35081640
+3c0a1002
+ad4815c0
+3c081003
+35088a00
+3c0a1002
+ad481600
+3c081003
+3508f180
+3c0a1002
+ad481640
+3c081002
+35085ec0
+3c0a1002
+ad481680
+3c081002
+35088dc0
+3c0a1002
+ad4816c0
+3c081001
+35083dc0
+3c0a1002
+ad481700
+3c081003
+3508f780
+3c0a1002
+ad481740
+3c081000
+350859c0
+3c0a1002
+ad481780
+3c081003
+35081880
+3c0a1002
+ad4817c0
+3c081002
+3508cc00
+3c0a1002
+ad481800
+3c081000
+35080140
+3c0a1002
+ad481840
+3c081000
+3508e4c0
+3c0a1002
+ad481880
+3c081002
+35086ac0
+3c0a1002
+ad4818c0
+3c081000
+350829c0
+3c0a1002
+ad481900
+3c081000
+35081940
+3c0a1002
+ad481940
+3c081000
+350879c0
+3c0a1002
+ad481980
+3c081000
+35083e80
+3c0a1002
+ad4819c0
+3c081003
+35088280
+3c0a1002
+ad481a00
+3c081001
+35082180
+3c0a1002
+ad481a40
+3c081000
+35081bc0
+3c0a1002
+ad481a80
+3c081003
+3508dc40
+3c0a1002
+ad481ac0
+3c081001
+35087040
+3c0a1002
+ad481b00
+3c081001
+3508d680
+3c0a1002
+ad481b40
+3c081003
+3508f880
+3c0a1002
+ad481b80
+3c081000
+3508ca80
+3c0a1002
+ad481bc0
+3c081000
+35088c40
+3c0a1002
+ad481c00
+3c081003
+3508c4c0
+3c0a1002
+ad481c40
+3c081000
+35081dc0
+3c0a1002
+ad481c80
+3c081002
+35089e40
+3c0a1002
+ad481cc0
+3c081003
+35082980
+3c0a1002
+ad481d00
+3c081003
+3508e740
+3c0a1002
+ad481d40
+3c081000
+3508b600
+3c0a1002
+ad481d80
+3c081000
+35085ec0
+3c0a1002
+ad481dc0
+3c081002
+35084980
+3c0a1002
+ad481e00
+3c081003
+3508cb40
+3c0a1002
+ad481e40
+3c081001
+35081400
+3c0a1002
+ad481e80
+3c081003
+35089e40
+3c0a1002
+ad481ec0
+3c081003
+35080b00
+3c0a1002
+ad481f00
+3c081002
+35086380
+3c0a1002
+ad481f40
+3c081002
+3508b8c0
+3c0a1002
+ad481f80
+3c081002
+3508ad00
+3c0a1002
+ad481fc0
+3c081002
+3508f700
+3c0a1002
+ad482000
+3c081000
+350881c0
+3c0a1002
+ad482040
+3c081001
+35087340
+3c0a1002
+ad482080
+3c081000
+3508e080
+3c0a1002
+ad4820c0
+3c081001
+35085cc0
+3c0a1002
+ad482100
+3c081001
+350867c0
+3c0a1002
+ad482140
+3c081003
+35081280
+3c0a1002
+ad482180
+3c081000
+35083c00
+3c0a1002
+ad4821c0
+3c081003
+35080400
+3c0a1002
+ad482200
+3c081002
+3508f940
+3c0a1002
+ad482240
+3c081002
+35089ac0
+3c0a1002
+ad482280
+3c081002
+35089a40
+3c0a1002
+ad4822c0
+3c081002
+35086740
+3c0a1002
+ad482300
+3c081002
+3508bfc0
+3c0a1002
+ad482340
+3c081000
+3508dfc0
+3c0a1002
+ad482380
+3c081001
+3508ce00
+3c0a1002
+ad4823c0
+3c081002
+35081b80
+3c0a1002
+ad482400
+3c081003
+35083340
+3c0a1002
+ad482440
+3c081002
+350814c0
+3c0a1002
+ad482480
+3c081001
+3508ad00
+3c0a1002
+ad4824c0
+3c081002
+35085940
+3c0a1002
+ad482500
+3c081000
+35084e00
+3c0a1002
+ad482540
+3c081000
+3508cc40
+3c0a1002
+ad482580
+3c081003
+35085500
+3c0a1002
+ad4825c0
+3c081000
+35082480
+3c0a1002
+ad482600
+3c081002
+3508a280
+3c0a1002
+ad482640
+3c081003
+3508fa40
+3c0a1002
+ad482680
+3c081000
+3508ea00
+3c0a1002
+ad4826c0
+3c081001
+3508c200
+3c0a1002
+ad482700
+3c081000
+3508aac0
+3c0a1002
+ad482740
+3c081000
+350801c0
+3c0a1002
+ad482780
+3c081001
+3508c240
+3c0a1002
+ad4827c0
+3c081000
+35085a40
+3c0a1002
+ad482800
+3c081001
+35083840
+3c0a1002
+ad482840
+3c081000
+35088a40
+3c0a1002
+ad482880
+3c081000
+3508cc80
+3c0a1002
+ad4828c0
+3c081001
+3508dfc0
+3c0a1002
+ad482900
+3c081002
+35082780
+3c0a1002
+ad482940
+3c081000
+350860c0
+3c0a1002
+ad482980
+3c081000
+35083a00
+3c0a1002
+ad4829c0
+3c081000
+350805c0
+3c0a1002
+ad482a00
+3c081000
+3508f1c0
+3c0a1002
+ad482a40
+3c081002
+35089940
+3c0a1002
+ad482a80
+3c081000
+3508bbc0
+3c0a1002
+ad482ac0
+3c081002
+350885c0
+3c0a1002
+ad482b00
+3c081001
+3508a580
+3c0a1002
+ad482b40
+3c081000
+35089800
+3c0a1002
+ad482b80
+3c081002
+3508a900
+3c0a1002
+ad482bc0
+3c081003
+35083a00
+3c0a1002
+ad482c00
+3c081001
+35084340
+3c0a1002
+ad482c40
+3c081003
+3508be00
+3c0a1002
+ad482c80
+3c081001
+350845c0
+3c0a1002
+ad482cc0
+3c081001
+35088fc0
+3c0a1002
+ad482d00
+3c081002
+3508e380
+3c0a1002
+ad482d40
+3c081000
+35086780
+3c0a1002
+ad482d80
+3c081003
+3508e1c0
+3c0a1002
+ad482dc0
+3c081001
+3508b500
+3c0a1002
+ad482e00
+3c081001
+35083e80
+3c0a1002
+ad482e40
+3c081003
+3508be40
+3c0a1002
+ad482e80
+3c081000
+35089140
+3c0a1002
+ad482ec0
+3c081002
+3508cbc0
+3c0a1002
+ad482f00
+3c081003
+35083940
+3c0a1002
+ad482f40
+3c081001
+35083d80
+3c0a1002
+ad482f80
+3c081002
+3508bc40
+3c0a1002
+ad482fc0
+3c081002
+35089fc0
+3c0a1002
+ad483000
+3c081001
+3508d9c0
+3c0a1002
+ad483040
+3c081000
+350864c0
+3c0a1002
+ad483080
+3c081001
+35084c00
+3c0a1002
+ad4830c0
+3c081001
+35088480
+3c0a1002
+ad483100
+3c081002
+3508a340
+3c0a1002
+ad483140
+3c081003
+35087100
+3c0a1002
+ad483180
+3c081003
+350883c0
+3c0a1002
+ad4831c0
+3c081001
+35087800
+3c0a1002
+ad483200
+3c081002
+35087280
+3c0a1002
+ad483240
+3c081001
+3508b880
+3c0a1002
+ad483280
+3c081001
+35080f80
+3c0a1002
+ad4832c0
+3c081000
+35083440
+3c0a1002
+ad483300
+3c081000
+35088fc0
+3c0a1002
+ad483340
+3c081002
+35084880
+3c0a1002
+ad483380
+3c081000
+35087b40
+3c0a1002
+ad4833c0
+3c081000
+3508b580
+3c0a1002
+ad483400
+3c081003
+3508ebc0
+3c0a1002
+ad483440
+3c081003
+350831c0
+3c0a1002
+ad483480
+3c081002
+350849c0
+3c0a1002
+ad4834c0
+3c081000
+35082300
+3c0a1002
+ad483500
+3c081003
+3508c780
+3c0a1002
+ad483540
+3c081002
+35089980
+3c0a1002
+ad483580
+3c081001
+35083300
+3c0a1002
+ad4835c0
+3c081003
+3508dd00
+3c0a1002
+ad483600
+3c081001
+3508fbc0
+3c0a1002
+ad483640
+3c081002
+35089380
+3c0a1002
+ad483680
+3c081003
+35086640
+3c0a1002
+ad4836c0
+3c081001
+35083c40
+3c0a1002
+ad483700
+3c081002
+3508b900
+3c0a1002
+ad483740
+3c081002
+350811c0
+3c0a1002
+ad483780
+3c081002
+350847c0
+3c0a1002
+ad4837c0
+3c081001
+3508d180
+3c0a1002
+ad483800
+3c081002
+35086540
+3c0a1002
+ad483840
+3c081000
+35083840
+3c0a1002
+ad483880
+3c081003
+35086140
+3c0a1002
+ad4838c0
+3c081002
+35087b80
+3c0a1002
+ad483900
+3c081003
+3508cb00
+3c0a1002
+ad483940
+3c081002
+35081480
+3c0a1002
+ad483980
+3c081002
+3508dac0
+3c0a1002
+ad4839c0
+3c081003
+3508aa80
+3c0a1002
+ad483a00
+3c081000
+35082500
+3c0a1002
+ad483a40
+3c081000
+3508d100
+3c0a1002
+ad483a80
+3c081002
+35080300
+3c0a1002
+ad483ac0
+3c081002
+350886c0
+3c0a1002
+ad483b00
+3c081003
+35084700
+3c0a1002
+ad483b40
+3c081002
+3508e8c0
+3c0a1002
+ad483b80
+3c081002
+350838c0
+3c0a1002
+ad483bc0
+3c081001
+35080bc0
+3c0a1002
+ad483c00
+3c081003
+3508b180
+3c0a1002
+ad483c40
+3c081001
+35089680
+3c0a1002
+ad483c80
+3c081000
+35084240
+3c0a1002
+ad483cc0
+3c081002
+3508ffc0
+3c0a1002
+ad483d00
+3c081002
+3508ce00
+3c0a1002
+ad483d40
+3c081002
+350862c0
+3c0a1002
+ad483d80
+3c081002
+3508cb00
+3c0a1002
+ad483dc0
+3c081001
+35085940
+3c0a1002
+ad483e00
+3c081000
+350808c0
+3c0a1002
+ad483e40
+3c081001
+3508a1c0
+3c0a1002
+ad483e80
+3c081001
+35089200
+3c0a1002
+ad483ec0
+3c081003
+35081c40
+3c0a1002
+ad483f00
+3c081002
+3508dcc0
+3c0a1002
+ad483f40
+3c081002
+3508dec0
+3c0a1002
+ad483f80
+3c081001
+3508c4c0
+3c0a1002
+ad483fc0
+3c081000
+35086c40
+3c0a1002
+ad484000
+3c081002
+3508ed80
+3c0a1002
+ad484040
+3c081000
+3508e280
+3c0a1002
+ad484080
+3c081000
+35083340
+3c0a1002
+ad4840c0
+3c081003
+35083ec0
+3c0a1002
+ad484100
+3c081001
+3508b800
+3c0a1002
+ad484140
+3c081002
+3508fcc0
+3c0a1002
+ad484180
+3c081001
+35089780
+3c0a1002
+ad4841c0
+3c081001
+35082ec0
+3c0a1002
+ad484200
+3c081001
+35084a40
+3c0a1002
+ad484240
+3c081003
+3508ee00
+3c0a1002
+ad484280
+3c081000
+35086540
+3c0a1002
+ad4842c0
+3c081001
+35087f80
+3c0a1002
+ad484300
+3c081001
+350876c0
+3c0a1002
+ad484340
+3c081002
+3508ed40
+3c0a1002
+ad484380
+3c081000
+3508e540
+3c0a1002
+ad4843c0
+3c081003
+35089c00
+3c0a1002
+ad484400
+3c081001
+35085100
+3c0a1002
+ad484440
+3c081001
+3508aec0
+3c0a1002
+ad484480
+3c081003
+35082780
+3c0a1002
+ad4844c0
+3c081001
+35083380
+3c0a1002
+ad484500
+3c081003
+35082380
+3c0a1002
+ad484540
+3c081002
+350854c0
+3c0a1002
+ad484580
+3c081002
+35082880
+3c0a1002
+ad4845c0
+3c081002
+35083fc0
+3c0a1002
+ad484600
+3c081003
+3508b040
+3c0a1002
+ad484640
+3c081003
+35089840
+3c0a1002
+ad484680
+3c081001
+3508b180
+3c0a1002
+ad4846c0
+3c081000
+350889c0
+3c0a1002
+ad484700
+3c081003
+3508a800
+3c0a1002
+ad484740
+3c081001
+3508ea00
+3c0a1002
+ad484780
+3c081001
+35087580
+3c0a1002
+ad4847c0
+3c081003
+35089a80
+3c0a1002
+ad484800
+3c081000
+3508d600
+3c0a1002
+ad484840
+3c081003
+3508ac40
+3c0a1002
+ad484880
+3c081001
+35086a40
+3c0a1002
+ad4848c0
+3c081002
+35080e80
+3c0a1002
+ad484900
+3c081003
+3508ac80
+3c0a1002
+ad484940
+3c081002
+350889c0
+3c0a1002
+ad484980
+3c081002
+350894c0
+3c0a1002
+ad4849c0
+3c081000
+35080e40
+3c0a1002
+ad484a00
+3c081002
+3508ae40
+3c0a1002
+ad484a40
+3c081001
+35087ec0
+3c0a1002
+ad484a80
+3c081003
+35083440
+3c0a1002
+ad484ac0
+3c081001
+35084f80
+3c0a1002
+ad484b00
+3c081000
+3508d2c0
+3c0a1002
+ad484b40
+3c081000
+3508a580
+3c0a1002
+ad484b80
+3c081002
+3508c3c0
+3c0a1002
+ad484bc0
+3c081000
+350892c0
+3c0a1002
+ad484c00
+3c081003
+35087d40
+3c0a1002
+ad484c40
+3c081002
+35080dc0
+3c0a1002
+ad484c80
+3c081003
+3508ff00
+3c0a1002
+ad484cc0
+3c081000
+35088200
+3c0a1002
+ad484d00
+3c081002
+350800c0
+3c0a1002
+ad484d40
+3c081001
+3508f800
+3c0a1002
+ad484d80
+3c081002
+3508b340
+3c0a1002
+ad484dc0
+3c081002
+35080bc0
+3c0a1002
+ad484e00
+3c081002
+35089c80
+3c0a1002
+ad484e40
+3c081002
+3508cd00
+3c0a1002
+ad484e80
+3c081003
+3508f700
+3c0a1002
+ad484ec0
+3c081003
+3508eac0
+3c0a1002
+ad484f00
+3c081003
+35082540
+3c0a1002
+ad484f40
+3c081002
+35082f80
+3c0a1002
+ad484f80
+3c081003
+3508ff40
+3c0a1002
+ad484fc0
+3c081003
+35081900
+3c0a1002
+ad485000
+3c081002
+35085f80
+3c0a1002
+ad485040
+3c081001
+3508ab40
+3c0a1002
+ad485080
+3c081003
+3508e2c0
+3c0a1002
+ad4850c0
+3c081003
+35086380
+3c0a1002
+ad485100
+3c081000
+3508a9c0
+3c0a1002
+ad485140
+3c081001
+35088ec0
+3c0a1002
+ad485180
+3c081002
+3508dbc0
+3c0a1002
+ad4851c0
+3c081000
+35088ac0
+3c0a1002
+ad485200
+3c081003
+350884c0
+3c0a1002
+ad485240
+3c081000
+3508b9c0
+3c0a1002
+ad485280
+3c081000
+35081d00
+3c0a1002
+ad4852c0
+3c081002
+3508e080
+3c0a1002
+ad485300
+3c081002
+35088540
+3c0a1002
+ad485340
+3c081001
+3508c640
+3c0a1002
+ad485380
+3c081003
+35082ac0
+3c0a1002
+ad4853c0
+3c081002
+35085f40
+3c0a1002
+ad485400
+3c081001
+350847c0
+3c0a1002
+ad485440
+3c081000
+35089c80
+3c0a1002
+ad485480
+3c081003
+3508e440
+3c0a1002
+ad4854c0
+3c081002
+35083bc0
+3c0a1002
+ad485500
+3c081001
+35085780
+3c0a1002
+ad485540
+3c081003
+3508f140
+3c0a1002
+ad485580
+3c081000
+3508fac0
+3c0a1002
+ad4855c0
+3c081000
+35086cc0
+3c0a1002
+ad485600
+3c081001
+35089080
+3c0a1002
+ad485640
+3c081002
+35083400
+3c0a1002
+ad485680
+3c081003
+3508da80
+3c0a1002
+ad4856c0
+3c081001
+35081e40
+3c0a1002
+ad485700
+3c081000
+3508b5c0
+3c0a1002
+ad485740
+3c081002
+35087f00
+3c0a1002
+ad485780
+3c081001
+35082e00
+3c0a1002
+ad4857c0
+3c081001
+35083ec0
+3c0a1002
+ad485800
+3c081002
+3508ab80
+3c0a1002
+ad485840
+3c081001
+3508c700
+3c0a1002
+ad485880
+3c081003
+3508fb40
+3c0a1002
+ad4858c0
+3c081003
+35082480
+3c0a1002
+ad485900
+3c081003
+35080d40
+3c0a1002
+ad485940
+3c081000
+35083140
+3c0a1002
+ad485980
+3c081001
+35082300
+3c0a1002
+ad4859c0
+3c081000
+3508d180
+3c0a1002
+ad485a00
+3c081000
+35083dc0
+3c0a1002
+ad485a40
+3c081002
+35085ac0
+3c0a1002
+ad485a80
+3c081000
+3508f940
+3c0a1002
+ad485ac0
+3c081002
+35080380
+3c0a1002
+ad485b00
+3c081001
+35089300
+3c0a1002
+ad485b40
+3c081003
+3508b1c0
+3c0a1002
+ad485b80
+3c081000
+35088240
+3c0a1002
+ad485bc0
+3c081001
+3508fd00
+3c0a1002
+ad485c00
+3c081001
+3508d380
+3c0a1002
+ad485c40
+3c081003
+3508b340
+3c0a1002
+ad485c80
+3c081002
+35085a40
+3c0a1002
+ad485cc0
+3c081000
+35082700
+3c0a1002
+ad485d00
+3c081003
+3508ae80
+3c0a1002
+ad485d40
+3c081000
+3508ea80
+3c0a1002
+ad485d80
+3c081001
+3508bb80
+3c0a1002
+ad485dc0
+3c081001
+35082400
+3c0a1002
+ad485e00
+3c081002
+35086ec0
+3c0a1002
+ad485e40
+3c081002
+3508eb40
+3c0a1002
+ad485e80
+3c081002
+3508bd40
+3c0a1002
+ad485ec0
+3c081001
+3508cd80
+3c0a1002
+ad485f00
+3c081003
+3508abc0
+3c0a1002
+ad485f40
+3c081002
+350875c0
+3c0a1002
+ad485f80
+3c081002
+3508ad40
+3c0a1002
+ad485fc0
+3c081000
+35088dc0
+3c0a1002
+ad486000
+3c081000
+35088cc0
+3c0a1002
+ad486040
+3c081002
+350805c0
+3c0a1002
+ad486080
+3c081002
+35085e00
+3c0a1002
+ad4860c0
+3c081001
+3508dc00
+3c0a1002
+ad486100
+3c081003
+3508bfc0
+3c0a1002
+ad486140
+3c081001
+35089600
+3c0a1002
+ad486180
+3c081002
+35087c40
+3c0a1002
+ad4861c0
+3c081002
+3508bdc0
+3c0a1002
+ad486200
+3c081003
+3508e800
+3c0a1002
+ad486240
+3c081003
+35083b00
+3c0a1002
+ad486280
+3c081002
+35082d00
+3c0a1002
+ad4862c0
+3c081002
+3508e800
+3c0a1002
+ad486300
+3c081001
+35085dc0
+3c0a1002
+ad486340
+3c081000
+35087200
+3c0a1002
+ad486380
+3c081003
+35087040
+3c0a1002
+ad4863c0
+3c081000
+350838c0
+3c0a1002
+ad486400
+3c081002
+35085c40
+3c0a1002
+ad486440
+3c081003
+3508a480
+3c0a1002
+ad486480
+3c081002
+35088b00
+3c0a1002
+ad4864c0
+3c081002
+35083e80
+3c0a1002
+ad486500
+3c081002
+3508b380
+3c0a1002
+ad486540
+3c081002
+35088e40
+3c0a1002
+ad486580
+3c081003
+35086c80
+3c0a1002
+ad4865c0
+3c081001
+35087b00
+3c0a1002
+ad486600
+3c081000
+35084700
+3c0a1002
+ad486640
+3c081001
+3508d540
+3c0a1002
+ad486680
+3c081001
+35085440
+3c0a1002
+ad4866c0
+3c081000
+35089000
+3c0a1002
+ad486700
+3c081001
+3508b9c0
+3c0a1002
+ad486740
+3c081001
+3508d8c0
+3c0a1002
+ad486780
+3c081003
+3508df40
+3c0a1002
+ad4867c0
+3c081001
+35084500
+3c0a1002
+ad486800
+3c081001
+35089740
+3c0a1002
+ad486840
+3c081003
+350856c0
+3c0a1002
+ad486880
+3c081001
+35087980
+3c0a1002
+ad4868c0
+3c081001
+35087ac0
+3c0a1002
+ad486900
+3c081003
+350833c0
+3c0a1002
+ad486940
+3c081000
+3508b640
+3c0a1002
+ad486980
+3c081000
+35083800
+3c0a1002
+ad4869c0
+3c081001
+3508d0c0
+3c0a1002
+ad486a00
+3c081002
+3508cac0
+3c0a1002
+ad486a40
+3c081003
+35087840
+3c0a1002
+ad486a80
+3c081002
+3508d840
+3c0a1002
+ad486ac0
+3c081002
+35088cc0
+3c0a1002
+ad486b00
+3c081003
+35083d40
+3c0a1002
+ad486b40
+3c081000
+3508a4c0
+3c0a1002
+ad486b80
+3c081001
+35081a80
+3c0a1002
+ad486bc0
+3c081000
+35084b40
+3c0a1002
+ad486c00
+3c081000
+3508d640
+3c0a1002
+ad486c40
+3c081000
+3508b480
+3c0a1002
+ad486c80
+3c081000
+35087e40
+3c0a1002
+ad486cc0
+3c081000
+350897c0
+3c0a1002
+ad486d00
+3c081000
+3508fd00
+3c0a1002
+ad486d40
+3c081003
+3508f000
+3c0a1002
+ad486d80
+3c081003
+3508bdc0
+3c0a1002
+ad486dc0
+3c081002
+3508ca00
+3c0a1002
+ad486e00
+3c081001
+3508bb40
+3c0a1002
+ad486e40
+3c081002
+35082000
+3c0a1002
+ad486e80
+3c081002
+3508bac0
+3c0a1002
+ad486ec0
+3c081001
+35084600
+3c0a1002
+ad486f00
+3c081000
+350833c0
+3c0a1002
+ad486f40
+3c081003
+35087580
+3c0a1002
+ad486f80
+3c081002
+35083140
+3c0a1002
+ad486fc0
+3c081003
+35086900
+3c0a1002
+ad487000
+3c081001
+3508cfc0
+3c0a1002
+ad487040
+3c081003
+35087600
+3c0a1002
+ad487080
+3c081001
+35080900
+3c0a1002
+ad4870c0
+3c081000
+3508d400
+3c0a1002
+ad487100
+3c081001
+35080a00
+3c0a1002
+ad487140
+3c081001
+350811c0
+3c0a1002
+ad487180
+3c081003
+35085ac0
+3c0a1002
+ad4871c0
+3c081002
+35083e00
+3c0a1002
+ad487200
+3c081002
+35082d80
+3c0a1002
+ad487240
+3c081003
+3508ad40
+3c0a1002
+ad487280
+3c081001
+3508b600
+3c0a1002
+ad4872c0
+3c081001
+35084d40
+3c0a1002
+ad487300
+3c081003
+35082580
+3c0a1002
+ad487340
+3c081000
+35088f40
+3c0a1002
+ad487380
+3c081002
+35084f80
+3c0a1002
+ad4873c0
+3c081002
+3508e580
+3c0a1002
+ad487400
+3c081003
+3508e480
+3c0a1002
+ad487440
+3c081003
+3508d8c0
+3c0a1002
+ad487480
+3c081002
+35082b00
+3c0a1002
+ad4874c0
+3c081003
+3508ab00
+3c0a1002
+ad487500
+3c081002
+3508ef40
+3c0a1002
+ad487540
+3c081002
+3508f440
+3c0a1002
+ad487580
+3c081003
+350864c0
+3c0a1002
+ad4875c0
+3c081000
+35087580
+3c0a1002
+ad487600
+3c081003
+35084580
+3c0a1002
+ad487640
+3c081002
+35087e40
+3c0a1002
+ad487680
+3c081001
+35089d80
+3c0a1002
+ad4876c0
+3c081003
+35083a40
+3c0a1002
+ad487700
+3c081002
+35089ec0
+3c0a1002
+ad487740
+3c081002
+3508b0c0
+3c0a1002
+ad487780
+3c081003
+3508e0c0
+3c0a1002
+ad4877c0
+3c081003
+350822c0
+3c0a1002
+ad487800
+3c081002
+3508de00
+3c0a1002
+ad487840
+3c081003
+3508ef80
+3c0a1002
+ad487880
+3c081003
+35082400
+3c0a1002
+ad4878c0
+3c081002
+35080f40
+3c0a1002
+ad487900
+3c081003
+3508d040
+3c0a1002
+ad487940
+3c081001
+35084e80
+3c0a1002
+ad487980
+3c081000
+3508ee00
+3c0a1002
+ad4879c0
+3c081001
+35084dc0
+3c0a1002
+ad487a00
+3c081000
+3508f480
+3c0a1002
+ad487a40
+3c081003
+3508a6c0
+3c0a1002
+ad487a80
+3c081001
+3508a500
+3c0a1002
+ad487ac0
+3c081001
+3508cc40
+3c0a1002
+ad487b00
+3c081003
+35081bc0
+3c0a1002
+ad487b40
+3c081001
+35087400
+3c0a1002
+ad487b80
+3c081001
+35087a80
+3c0a1002
+ad487bc0
+3c081001
+35081700
+3c0a1002
+ad487c00
+3c081003
+3508fa00
+3c0a1002
+ad487c40
+3c081000
+3508f640
+3c0a1002
+ad487c80
+3c081001
+35085840
+3c0a1002
+ad487cc0
+3c081003
+35089000
+3c0a1002
+ad487d00
+3c081000
+35081100
+3c0a1002
+ad487d40
+3c081003
+35086100
+3c0a1002
+ad487d80
+3c081002
+35087380
+3c0a1002
+ad487dc0
+3c081002
+3508d100
+3c0a1002
+ad487e00
+3c081000
+35080e00
+3c0a1002
+ad487e40
+3c081002
+35082940
+3c0a1002
+ad487e80
+3c081000
+3508a040
+3c0a1002
+ad487ec0
+3c081001
+35083000
+3c0a1002
+ad487f00
+3c081002
+35088ec0
+3c0a1002
+ad487f40
+3c081002
+3508abc0
+3c0a1002
+ad487f80
+3c081001
+3508ff00
+3c0a1002
+ad487fc0
+3c081003
+35083080
+3c0a1003
+ad488000
+3c081003
+35084000
+3c0a1003
+ad488040
+3c081000
+3508aa00
+3c0a1003
+ad488080
+3c081001
+3508e600
+3c0a1003
+ad4880c0
+3c081000
+35084a80
+3c0a1003
+ad488100
+3c081003
+35088300
+3c0a1003
+ad488140
+3c081001
+3508f440
+3c0a1003
+ad488180
+3c081000
+35083f80
+3c0a1003
+ad4881c0
+3c081000
+3508be40
+3c0a1003
+ad488200
+3c081000
+3508a2c0
+3c0a1003
+ad488240
+3c081003
+35086880
+3c0a1003
+ad488280
+3c081000
+35081fc0
+3c0a1003
+ad4882c0
+3c081000
+35084b80
+3c0a1003
+ad488300
+3c081001
+35084cc0
+3c0a1003
+ad488340
+3c081001
+350873c0
+3c0a1003
+ad488380
+3c081003
+35089400
+3c0a1003
+ad4883c0
+3c081003
+35085740
+3c0a1003
+ad488400
+3c081002
+3508b840
+3c0a1003
+ad488440
+3c081000
+3508be80
+3c0a1003
+ad488480
+3c081002
+35086900
+3c0a1003
+ad4884c0
+3c081003
+35086840
+3c0a1003
+ad488500
+3c081002
+35086940
+3c0a1003
+ad488540
+3c081001
+35086fc0
+3c0a1003
+ad488580
+3c081000
+350809c0
+3c0a1003
+ad4885c0
+3c081000
+3508e200
+3c0a1003
+ad488600
+3c081002
+3508a3c0
+3c0a1003
+ad488640
+3c081003
+350869c0
+3c0a1003
+ad488680
+3c081001
+35085500
+3c0a1003
+ad4886c0
+3c081003
+35084d80
+3c0a1003
+ad488700
+3c081002
+3508d200
+3c0a1003
+ad488740
+3c081000
+35084480
+3c0a1003
+ad488780
+3c081000
+3508a3c0
+3c0a1003
+ad4887c0
+3c081000
+35081540
+3c0a1003
+ad488800
+3c081000
+35083040
+3c0a1003
+ad488840
+3c081000
+35086fc0
+3c0a1003
+ad488880
+3c081002
+3508d140
+3c0a1003
+ad4888c0
+3c081000
+3508a000
+3c0a1003
+ad488900
+3c081003
+35087280
+3c0a1003
+ad488940
+3c081000
+35086440
+3c0a1003
+ad488980
+3c081001
+350812c0
+3c0a1003
+ad4889c0
+3c081001
+35086140
+3c0a1003
+ad488a00
+3c081000
+3508c200
+3c0a1003
+ad488a40
+3c081003
+35088440
+3c0a1003
+ad488a80
+3c081000
+3508eb40
+3c0a1003
+ad488ac0
+3c081003
+350832c0
+3c0a1003
+ad488b00
+3c081001
+35089bc0
+3c0a1003
+ad488b40
+3c081000
+35083d80
+3c0a1003
+ad488b80
+3c081003
+35086740
+3c0a1003
+ad488bc0
+3c081001
+35080300
+3c0a1003
+ad488c00
+3c081000
+350872c0
+3c0a1003
+ad488c40
+3c081002
+3508de80
+3c0a1003
+ad488c80
+3c081002
+3508d440
+3c0a1003
+ad488cc0
+3c081001
+3508ffc0
+3c0a1003
+ad488d00
+3c081001
+35080d80
+3c0a1003
+ad488d40
+3c081003
+3508d680
+3c0a1003
+ad488d80
+3c081002
+35083dc0
+3c0a1003
+ad488dc0
+3c081000
+350843c0
+3c0a1003
+ad488e00
+3c081001
+3508fec0
+3c0a1003
+ad488e40
+3c081003
+3508f400
+3c0a1003
+ad488e80
+3c081002
+350840c0
+3c0a1003
+ad488ec0
+3c081001
+3508ea40
+3c0a1003
+ad488f00
+3c081001
+3508a5c0
+3c0a1003
+ad488f40
+3c081002
+3508eec0
+3c0a1003
+ad488f80
+3c081000
+3508fdc0
+3c0a1003
+ad488fc0
+3c081000
+3508ad00
+3c0a1003
+ad489000
+3c081003
+35080c00
+3c0a1003
+ad489040
+3c081002
+3508f540
+3c0a1003
+ad489080
+3c081000
+3508efc0
+3c0a1003
+ad4890c0
+3c081002
+35088a80
+3c0a1003
+ad489100
+3c081001
+35080a40
+3c0a1003
+ad489140
+3c081001
+350832c0
+3c0a1003
+ad489180
+3c081003
+3508b080
+3c0a1003
+ad4891c0
+3c081002
+35086140
+3c0a1003
+ad489200
+3c081002
+3508acc0
+3c0a1003
+ad489240
+3c081000
+35081340
+3c0a1003
+ad489280
+3c081000
+3508dec0
+3c0a1003
+ad4892c0
+3c081002
+35084c40
+3c0a1003
+ad489300
+3c081001
+35084580
+3c0a1003
+ad489340
+3c081001
+35087680
+3c0a1003
+ad489380
+3c081001
+35083880
+3c0a1003
+ad4893c0
+3c081000
+35083a40
+3c0a1003
+ad489400
+3c081003
+35084380
+3c0a1003
+ad489440
+3c081001
+35080780
+3c0a1003
+ad489480
+3c081002
+35082c40
+3c0a1003
+ad4894c0
+3c081002
+35080c00
+3c0a1003
+ad489500
+3c081000
+35087ac0
+3c0a1003
+ad489540
+3c081002
+35089b00
+3c0a1003
+ad489580
+3c081000
+3508a400
+3c0a1003
+ad4895c0
+3c081003
+35082c40
+3c0a1003
+ad489600
+3c081001
+350850c0
+3c0a1003
+ad489640
+3c081002
+35087680
+3c0a1003
+ad489680
+3c081001
+35089340
+3c0a1003
+ad4896c0
+3c081002
+3508ee40
+3c0a1003
+ad489700
+3c081000
+35087400
+3c0a1003
+ad489740
+3c081002
+3508a040
+3c0a1003
+ad489780
+3c081002
+3508a000
+3c0a1003
+ad4897c0
+3c081001
+35081780
+3c0a1003
+ad489800
+3c081002
+35081880
+3c0a1003
+ad489840
+3c081003
+3508e940
+3c0a1003
+ad489880
+3c081002
+35080a40
+3c0a1003
+ad4898c0
+3c081002
+3508e5c0
+3c0a1003
+ad489900
+3c081000
+35081a40
+3c0a1003
+ad489940
+3c081003
+3508d340
+3c0a1003
+ad489980
+3c081001
+3508db80
+3c0a1003
+ad4899c0
+3c081002
+3508b100
+3c0a1003
+ad489a00
+3c081003
+35083840
+3c0a1003
+ad489a40
+3c081001
+35089880
+3c0a1003
+ad489a80
+3c081001
+350833c0
+3c0a1003
+ad489ac0
+3c081002
+350842c0
+3c0a1003
+ad489b00
+3c081001
+3508e3c0
+3c0a1003
+ad489b40
+3c081002
+35088f00
+3c0a1003
+ad489b80
+3c081000
+3508d4c0
+3c0a1003
+ad489bc0
+3c081001
+3508da00
+3c0a1003
+ad489c00
+3c081000
+35088500
+3c0a1003
+ad489c40
+3c081003
+35083f40
+3c0a1003
+ad489c80
+3c081001
+35083040
+3c0a1003
+ad489cc0
+3c081003
+35084900
+3c0a1003
+ad489d00
+3c081002
+3508e9c0
+3c0a1003
+ad489d40
+3c081000
+35081400
+3c0a1003
+ad489d80
+3c081000
+3508bd80
+3c0a1003
+ad489dc0
+3c081003
+35082bc0
+3c0a1003
+ad489e00
+3c081001
+35086ac0
+3c0a1003
+ad489e40
+3c081003
+3508d240
+3c0a1003
+ad489e80
+3c081003
+350806c0
+3c0a1003
+ad489ec0
+3c081000
+35083540
+3c0a1003
+ad489f00
+3c081000
+3508cec0
+3c0a1003
+ad489f40
+3c081003
+3508ffc0
+3c0a1003
+ad489f80
+3c081003
+35083180
+3c0a1003
+ad489fc0
+3c081002
+350812c0
+3c0a1003
+ad48a000
+3c081002
+3508e7c0
+3c0a1003
+ad48a040
+3c081000
+3508ac40
+3c0a1003
+ad48a080
+3c081000
+350844c0
+3c0a1003
+ad48a0c0
+3c081003
+35081b40
+3c0a1003
+ad48a100
+3c081002
+3508a300
+3c0a1003
+ad48a140
+3c081002
+3508a140
+3c0a1003
+ad48a180
+3c081000
+35085ac0
+3c0a1003
+ad48a1c0
+3c081000
+35086b80
+3c0a1003
+ad48a200
+3c081001
+35088a40
+3c0a1003
+ad48a240
+3c081001
+35082e80
+3c0a1003
+ad48a280
+3c081002
+35081800
+3c0a1003
+ad48a2c0
+3c081001
+3508f780
+3c0a1003
+ad48a300
+3c081001
+350813c0
+3c0a1003
+ad48a340
+3c081003
+3508e640
+3c0a1003
+ad48a380
+3c081001
+35084900
+3c0a1003
+ad48a3c0
+3c081001
+3508c480
+3c0a1003
+ad48a400
+3c081002
+35089d80
+3c0a1003
+ad48a440
+3c081000
+35087900
+3c0a1003
+ad48a480
+3c081000
+3508fa40
+3c0a1003
+ad48a4c0
+3c081002
+3508b200
+3c0a1003
+ad48a500
+3c081002
+35087040
+3c0a1003
+ad48a540
+3c081002
+35086040
+3c0a1003
+ad48a580
+3c081001
+3508e040
+3c0a1003
+ad48a5c0
+3c081001
+3508aa00
+3c0a1003
+ad48a600
+3c081003
+35087300
+3c0a1003
+ad48a640
+3c081001
+3508b280
+3c0a1003
+ad48a680
+3c081003
+35089dc0
+3c0a1003
+ad48a6c0
+3c081001
+35085ec0
+3c0a1003
+ad48a700
+3c081002
+35087c80
+3c0a1003
+ad48a740
+3c081001
+3508dac0
+3c0a1003
+ad48a780
+3c081001
+3508c180
+3c0a1003
+ad48a7c0
+3c081000
+35086e00
+3c0a1003
+ad48a800
+3c081001
+3508c600
+3c0a1003
+ad48a840
+3c081003
+3508b500
+3c0a1003
+ad48a880
+3c081001
+3508a880
+3c0a1003
+ad48a8c0
+3c081000
+350894c0
+3c0a1003
+ad48a900
+3c081002
+35080980
+3c0a1003
+ad48a940
+3c081001
+3508b640
+3c0a1003
+ad48a980
+3c081002
+35088200
+3c0a1003
+ad48a9c0
+3c081000
+35086b00
+3c0a1003
+ad48aa00
+3c081000
+3508bc80
+3c0a1003
+ad48aa40
+3c081000
+35084900
+3c0a1003
+ad48aa80
+3c081002
+350881c0
+3c0a1003
+ad48aac0
+3c081001
+35084e40
+3c0a1003
+ad48ab00
+3c081001
+3508f5c0
+3c0a1003
+ad48ab40
+3c081002
+3508ca40
+3c0a1003
+ad48ab80
+3c081003
+35088c40
+3c0a1003
+ad48abc0
+3c081002
+3508dc00
+3c0a1003
+ad48ac00
+3c081000
+35085940
+3c0a1003
+ad48ac40
+3c081001
+35084d00
+3c0a1003
+ad48ac80
+3c081000
+35086880
+3c0a1003
+ad48acc0
+3c081002
+35087b00
+3c0a1003
+ad48ad00
+3c081001
+3508b8c0
+3c0a1003
+ad48ad40
+3c081003
+35088d80
+3c0a1003
+ad48ad80
+3c081001
+3508ba00
+3c0a1003
+ad48adc0
+3c081000
+35081240
+3c0a1003
+ad48ae00
+3c081003
+35088240
+3c0a1003
+ad48ae40
+3c081003
+3508a440
+3c0a1003
+ad48ae80
+3c081002
+35087480
+3c0a1003
+ad48aec0
+3c081000
+350826c0
+3c0a1003
+ad48af00
+3c081002
+35083900
+3c0a1003
+ad48af40
+3c081000
+35080880
+3c0a1003
+ad48af80
+3c081000
+3508fa80
+3c0a1003
+ad48afc0
+3c081000
+3508bb00
+3c0a1003
+ad48b000
+3c081001
+35081380
+3c0a1003
+ad48b040
+3c081003
+35083740
+3c0a1003
+ad48b080
+3c081003
+35082200
+3c0a1003
+ad48b0c0
+3c081001
+35081ac0
+3c0a1003
+ad48b100
+3c081001
+3508d4c0
+3c0a1003
+ad48b140
+3c081003
+35085e00
+3c0a1003
+ad48b180
+3c081002
+35083540
+3c0a1003
+ad48b1c0
+3c081003
+3508bd00
+3c0a1003
+ad48b200
+3c081003
+3508eb40
+3c0a1003
+ad48b240
+3c081002
+35084b40
+3c0a1003
+ad48b280
+3c081003
+35081a80
+3c0a1003
+ad48b2c0
+3c081001
+35086440
+3c0a1003
+ad48b300
+3c081001
+35089480
+3c0a1003
+ad48b340
+3c081000
+35083700
+3c0a1003
+ad48b380
+3c081000
+35082100
+3c0a1003
+ad48b3c0
+3c081000
+35089400
+3c0a1003
+ad48b400
+3c081003
+3508c200
+3c0a1003
+ad48b440
+3c081000
+35082000
+3c0a1003
+ad48b480
+3c081003
+3508bc80
+3c0a1003
+ad48b4c0
+3c081001
+3508ac00
+3c0a1003
+ad48b500
+3c081000
+3508ec80
+3c0a1003
+ad48b540
+3c081000
+3508b780
+3c0a1003
+ad48b580
+3c081002
+35080340
+3c0a1003
+ad48b5c0
+3c081003
+35086bc0
+3c0a1003
+ad48b600
+3c081000
+35087800
+3c0a1003
+ad48b640
+3c081002
+35080680
+3c0a1003
+ad48b680
+3c081003
+35089f80
+3c0a1003
+ad48b6c0
+3c081000
+350803c0
+3c0a1003
+ad48b700
+3c081003
+35087780
+3c0a1003
+ad48b740
+3c081003
+35085d40
+3c0a1003
+ad48b780
+3c081001
+35080e40
+3c0a1003
+ad48b7c0
+3c081000
+3508f140
+3c0a1003
+ad48b800
+3c081003
+3508ad80
+3c0a1003
+ad48b840
+3c081000
+3508cf40
+3c0a1003
+ad48b880
+3c081000
+3508c480
+3c0a1003
+ad48b8c0
+3c081003
+35081600
+3c0a1003
+ad48b900
+3c081003
+3508bf40
+3c0a1003
+ad48b940
+3c081002
+35083880
+3c0a1003
+ad48b980
+3c081003
+3508a040
+3c0a1003
+ad48b9c0
+3c081003
+35084c40
+3c0a1003
+ad48ba00
+3c081002
+350801c0
+3c0a1003
+ad48ba40
+3c081000
+35084200
+3c0a1003
+ad48ba80
+3c081002
+35082e40
+3c0a1003
+ad48bac0
+3c081001
+35085a40
+3c0a1003
+ad48bb00
+3c081002
+3508bcc0
+3c0a1003
+ad48bb40
+3c081002
+35081980
+3c0a1003
+ad48bb80
+3c081003
+3508f3c0
+3c0a1003
+ad48bbc0
+3c081001
+35080100
+3c0a1003
+ad48bc00
+3c081002
+3508e900
+3c0a1003
+ad48bc40
+3c081003
+3508eb80
+3c0a1003
+ad48bc80
+3c081001
+3508ee80
+3c0a1003
+ad48bcc0
+3c081002
+3508d340
+3c0a1003
+ad48bd00
+3c081001
+35083a00
+3c0a1003
+ad48bd40
+3c081001
+3508a540
+3c0a1003
+ad48bd80
+3c081000
+35083280
+3c0a1003
+ad48bdc0
+3c081003
+35087180
+3c0a1003
+ad48be00
+3c081003
+3508bc00
+3c0a1003
+ad48be40
+3c081000
+35086480
+3c0a1003
+ad48be80
+3c081000
+3508bdc0
+3c0a1003
+ad48bec0
+3c081001
+35088680
+3c0a1003
+ad48bf00
+3c081003
+3508af80
+3c0a1003
+ad48bf40
+3c081001
+3508fb00
+3c0a1003
+ad48bf80
+3c081003
+35089ac0
+3c0a1003
+ad48bfc0
+3c081001
+350880c0
+3c0a1003
+ad48c000
+3c081000
+35083200
+3c0a1003
+ad48c040
+3c081002
+35086f00
+3c0a1003
+ad48c080
+3c081003
+35087fc0
+3c0a1003
+ad48c0c0
+3c081000
+3508d200
+3c0a1003
+ad48c100
+3c081003
+35087dc0
+3c0a1003
+ad48c140
+3c081002
+35088b40
+3c0a1003
+ad48c180
+3c081001
+35087540
+3c0a1003
+ad48c1c0
+3c081000
+35081780
+3c0a1003
+ad48c200
+3c081002
+3508fc40
+3c0a1003
+ad48c240
+3c081002
+35084bc0
+3c0a1003
+ad48c280
+3c081001
+350820c0
+3c0a1003
+ad48c2c0
+3c081000
+3508f280
+3c0a1003
+ad48c300
+3c081000
+3508a5c0
+3c0a1003
+ad48c340
+3c081002
+3508af00
+3c0a1003
+ad48c380
+3c081001
+35080200
+3c0a1003
+ad48c3c0
+3c081002
+3508d740
+3c0a1003
+ad48c400
+3c081000
+3508f980
+3c0a1003
+ad48c440
+3c081000
+35084000
+3c0a1003
+ad48c480
+3c081002
+35083840
+3c0a1003
+ad48c4c0
+3c081002
+35084ac0
+3c0a1003
+ad48c500
+3c081003
+3508d7c0
+3c0a1003
+ad48c540
+3c081002
+3508ec80
+3c0a1003
+ad48c580
+3c081003
+350815c0
+3c0a1003
+ad48c5c0
+3c081003
+3508f500
+3c0a1003
+ad48c600
+3c081001
+35084000
+3c0a1003
+ad48c640
+3c081003
+350846c0
+3c0a1003
+ad48c680
+3c081001
+350865c0
+3c0a1003
+ad48c6c0
+3c081003
+3508e040
+3c0a1003
+ad48c700
+3c081001
+3508cf80
+3c0a1003
+ad48c740
+3c081000
+3508a180
+3c0a1003
+ad48c780
+3c081003
+35083100
+3c0a1003
+ad48c7c0
+3c081003
+35082e00
+3c0a1003
+ad48c800
+3c081000
+35081300
+3c0a1003
+ad48c840
+3c081001
+3508b1c0
+3c0a1003
+ad48c880
+3c081000
+35080240
+3c0a1003
+ad48c8c0
+3c081001
+3508dec0
+3c0a1003
+ad48c900
+3c081002
+35082140
+3c0a1003
+ad48c940
+3c081001
+3508a400
+3c0a1003
+ad48c980
+3c081001
+35089400
+3c0a1003
+ad48c9c0
+3c081001
+350883c0
+3c0a1003
+ad48ca00
+3c081002
+35081240
+3c0a1003
+ad48ca40
+3c081001
+35084a80
+3c0a1003
+ad48ca80
+3c081001
+3508e6c0
+3c0a1003
+ad48cac0
+3c081003
+35080f40
+3c0a1003
+ad48cb00
+3c081001
+3508b400
+3c0a1003
+ad48cb40
+3c081000
+3508f000
+3c0a1003
+ad48cb80
+3c081000
+35083380
+3c0a1003
+ad48cbc0
+3c081000
+35084cc0
+3c0a1003
+ad48cc00
+3c081003
+35087e80
+3c0a1003
+ad48cc40
+3c081002
+3508ef80
+3c0a1003
+ad48cc80
+3c081001
+35083280
+3c0a1003
+ad48ccc0
+3c081003
+35081580
+3c0a1003
+ad48cd00
+3c081002
+3508bf40
+3c0a1003
+ad48cd40
+3c081000
+3508eb00
+3c0a1003
+ad48cd80
+3c081001
+3508d100
+3c0a1003
+ad48cdc0
+3c081003
+35086500
+3c0a1003
+ad48ce00
+3c081000
+3508a940
+3c0a1003
+ad48ce40
+3c081002
+35087980
+3c0a1003
+ad48ce80
+3c081000
+35085640
+3c0a1003
+ad48cec0
+3c081000
+35082800
+3c0a1003
+ad48cf00
+3c081001
+35080400
+3c0a1003
+ad48cf40
+3c081001
+3508d1c0
+3c0a1003
+ad48cf80
+3c081003
+35085e80
+3c0a1003
+ad48cfc0
+3c081003
+35088800
+3c0a1003
+ad48d000
+3c081003
+3508be80
+3c0a1003
+ad48d040
+3c081001
+35083c00
+3c0a1003
+ad48d080
+3c081003
+3508a240
+3c0a1003
+ad48d0c0
+3c081003
+35081ec0
+3c0a1003
+ad48d100
+3c081001
+35087180
+3c0a1003
+ad48d140
+3c081003
+35089d00
+3c0a1003
+ad48d180
+3c081001
+3508c880
+3c0a1003
+ad48d1c0
+3c081002
+35084600
+3c0a1003
+ad48d200
+3c081002
+3508c700
+3c0a1003
+ad48d240
+3c081000
+3508b280
+3c0a1003
+ad48d280
+3c081003
+350897c0
+3c0a1003
+ad48d2c0
+3c081002
+3508e180
+3c0a1003
+ad48d300
+3c081001
+350872c0
+3c0a1003
+ad48d340
+3c081002
+3508c000
+3c0a1003
+ad48d380
+3c081002
+350870c0
+3c0a1003
+ad48d3c0
+3c081000
+3508bb40
+3c0a1003
+ad48d400
+3c081001
+35082700
+3c0a1003
+ad48d440
+3c081003
+3508c880
+3c0a1003
+ad48d480
+3c081000
+350870c0
+3c0a1003
+ad48d4c0
+3c081000
+35081680
+3c0a1003
+ad48d500
+3c081001
+35080f00
+3c0a1003
+ad48d540
+3c081001
+35084f00
+3c0a1003
+ad48d580
+3c081001
+3508b340
+3c0a1003
+ad48d5c0
+3c081003
+3508d140
+3c0a1003
+ad48d600
+3c081000
+35080080
+3c0a1003
+ad48d640
+3c081000
+35086d80
+3c0a1003
+ad48d680
+3c081000
+3508c840
+3c0a1003
+ad48d6c0
+3c081000
+3508df80
+3c0a1003
+ad48d700
+3c081002
+3508e940
+3c0a1003
+ad48d740
+3c081002
+35080780
+3c0a1003
+ad48d780
+3c081000
+35085980
+3c0a1003
+ad48d7c0
+3c081000
+35081c40
+3c0a1003
+ad48d800
+3c081003
+3508f800
+3c0a1003
+ad48d840
+3c081003
+3508e4c0
+3c0a1003
+ad48d880
+3c081002
+35089800
+3c0a1003
+ad48d8c0
+3c081002
+3508c6c0
+3c0a1003
+ad48d900
+3c081002
+3508fac0
+3c0a1003
+ad48d940
+3c081001
+35085640
+3c0a1003
+ad48d980
+3c081002
+35083500
+3c0a1003
+ad48d9c0
+3c081000
+3508e680
+3c0a1003
+ad48da00
+3c081003
+35087f00
+3c0a1003
+ad48da40
+3c081001
+35083d00
+3c0a1003
+ad48da80
+3c081002
+3508f0c0
+3c0a1003
+ad48dac0
+3c081003
+35087640
+3c0a1003
+ad48db00
+3c081002
+3508dd80
+3c0a1003
+ad48db40
+3c081001
+350834c0
+3c0a1003
+ad48db80
+3c081002
+3508fb80
+3c0a1003
+ad48dbc0
+3c081000
+350831c0
+3c0a1003
+ad48dc00
+3c081001
+3508cec0
+3c0a1003
+ad48dc40
+3c081003
+35081e40
+3c0a1003
+ad48dc80
+3c081000
+35089d40
+3c0a1003
+ad48dcc0
+3c081000
+35088d80
+3c0a1003
+ad48dd00
+3c081001
+350851c0
+3c0a1003
+ad48dd40
+3c081002
+35088d80
+3c0a1003
+ad48dd80
+3c081002
+3508c2c0
+3c0a1003
+ad48ddc0
+3c081000
+35088c80
+3c0a1003
+ad48de00
+3c081001
+350840c0
+3c0a1003
+ad48de40
+3c081003
+3508da40
+3c0a1003
+ad48de80
+3c081000
+35088800
+3c0a1003
+ad48dec0
+3c081003
+3508cb80
+3c0a1003
+ad48df00
+3c081001
+3508c500
+3c0a1003
+ad48df40
+3c081000
+350876c0
+3c0a1003
+ad48df80
+3c081000
+3508d340
+3c0a1003
+ad48dfc0
+3c081003
+3508fe00
+3c0a1003
+ad48e000
+3c081000
+35082440
+3c0a1003
+ad48e040
+3c081003
+35085fc0
+3c0a1003
+ad48e080
+3c081002
+3508af40
+3c0a1003
+ad48e0c0
+3c081002
+35084740
+3c0a1003
+ad48e100
+3c081000
+35087fc0
+3c0a1003
+ad48e140
+3c081003
+35086d40
+3c0a1003
+ad48e180
+3c081000
+35080280
+3c0a1003
+ad48e1c0
+3c081003
+35087a80
+3c0a1003
+ad48e200
+3c081002
+35085bc0
+3c0a1003
+ad48e240
+3c081003
+3508cc40
+3c0a1003
+ad48e280
+3c081001
+3508a100
+3c0a1003
+ad48e2c0
+3c081001
+350810c0
+3c0a1003
+ad48e300
+3c081001
+3508f9c0
+3c0a1003
+ad48e340
+3c081001
+35089040
+3c0a1003
+ad48e380
+3c081002
+350864c0
+3c0a1003
+ad48e3c0
+3c081002
+35082ec0
+3c0a1003
+ad48e400
+3c081003
+3508fac0
+3c0a1003
+ad48e440
+3c081003
+35088840
+3c0a1003
+ad48e480
+3c081001
+35082ac0
+3c0a1003
+ad48e4c0
+3c081003
+3508bcc0
+3c0a1003
+ad48e500
+3c081002
+35088480
+3c0a1003
+ad48e540
+3c081003
+3508d2c0
+3c0a1003
+ad48e580
+3c081003
+35080b80
+3c0a1003
+ad48e5c0
+3c081002
+350816c0
+3c0a1003
+ad48e600
+3c081000
+35084680
+3c0a1003
+ad48e640
+3c081000
+3508c340
+3c0a1003
+ad48e680
+3c081002
+35085f00
+3c0a1003
+ad48e6c0
+3c081000
+35084300
+3c0a1003
+ad48e700
+3c081001
+350869c0
+3c0a1003
+ad48e740
+3c081001
+3508b040
+3c0a1003
+ad48e780
+3c081000
+3508a340
+3c0a1003
+ad48e7c0
+3c081003
+35088980
+3c0a1003
+ad48e800
+3c081003
+3508ef00
+3c0a1003
+ad48e840
+3c081001
+35089e80
+3c0a1003
+ad48e880
+3c081002
+35088a00
+3c0a1003
+ad48e8c0
+3c081001
+35081c40
+3c0a1003
+ad48e900
+3c081002
+35080f00
+3c0a1003
+ad48e940
+3c081003
+3508acc0
+3c0a1003
+ad48e980
+3c081002
+35087200
+3c0a1003
+ad48e9c0
+3c081002
+3508f480
+3c0a1003
+ad48ea00
+3c081002
+35081e00
+3c0a1003
+ad48ea40
+3c081001
+35083e40
+3c0a1003
+ad48ea80
+3c081000
+350848c0
+3c0a1003
+ad48eac0
+3c081002
+35086fc0
+3c0a1003
+ad48eb00
+3c081000
+35080680
+3c0a1003
+ad48eb40
+3c081003
+35086d80
+3c0a1003
+ad48eb80
+3c081003
+35089980
+3c0a1003
+ad48ebc0
+3c081002
+35088240
+3c0a1003
+ad48ec00
+3c081000
+3508d740
+3c0a1003
+ad48ec40
+3c081003
+3508fc40
+3c0a1003
+ad48ec80
+3c081001
+35085bc0
+3c0a1003
+ad48ecc0
+3c081002
+35088e80
+3c0a1003
+ad48ed00
+3c081000
+35080a00
+3c0a1003
+ad48ed40
+3c081001
+35088e40
+3c0a1003
+ad48ed80
+3c081000
+3508d6c0
+3c0a1003
+ad48edc0
+3c081002
+35088100
+3c0a1003
+ad48ee00
+3c081001
+35088a80
+3c0a1003
+ad48ee40
+3c081001
+3508f580
+3c0a1003
+ad48ee80
+3c081000
+35080300
+3c0a1003
+ad48eec0
+3c081000
+3508d440
+3c0a1003
+ad48ef00
+3c081003
+35084bc0
+3c0a1003
+ad48ef40
+3c081003
+3508c740
+3c0a1003
+ad48ef80
+3c081000
+3508f040
+3c0a1003
+ad48efc0
+3c081000
+35089e40
+3c0a1003
+ad48f000
+3c081003
+350885c0
+3c0a1003
+ad48f040
+3c081000
+3508cf80
+3c0a1003
+ad48f080
+3c081002
+35089cc0
+3c0a1003
+ad48f0c0
+3c081003
+3508ad00
+3c0a1003
+ad48f100
+3c081003
+3508c900
+3c0a1003
+ad48f140
+3c081001
+3508f500
+3c0a1003
+ad48f180
+3c081002
+3508e840
+3c0a1003
+ad48f1c0
+3c081002
+35081140
+3c0a1003
+ad48f200
+3c081003
+3508c540
+3c0a1003
+ad48f240
+3c081002
+35083b40
+3c0a1003
+ad48f280
+3c081001
+35081200
+3c0a1003
+ad48f2c0
+3c081002
+3508d4c0
+3c0a1003
+ad48f300
+3c081000
+35083c40
+3c0a1003
+ad48f340
+3c081002
+3508c100
+3c0a1003
+ad48f380
+3c081000
+35087f80
+3c0a1003
+ad48f3c0
+3c081002
+3508b2c0
+3c0a1003
+ad48f400
+3c081003
+3508afc0
+3c0a1003
+ad48f440
+3c081002
+3508e3c0
+3c0a1003
+ad48f480
+3c081000
+350832c0
+3c0a1003
+ad48f4c0
+3c081001
+3508fb40
+3c0a1003
+ad48f500
+3c081003
+35084200
+3c0a1003
+ad48f540
+3c081000
+35084400
+3c0a1003
+ad48f580
+3c081002
+35087080
+3c0a1003
+ad48f5c0
+3c081003
+3508d300
+3c0a1003
+ad48f600
+3c081003
+35089680
+3c0a1003
+ad48f640
+3c081003
+3508c100
+3c0a1003
+ad48f680
+3c081002
+35083c40
+3c0a1003
+ad48f6c0
+3c081002
+35089200
+3c0a1003
+ad48f700
+3c081003
+3508ef40
+3c0a1003
+ad48f740
+3c081001
+3508d840
+3c0a1003
+ad48f780
+3c081000
+35082c40
+3c0a1003
+ad48f7c0
+3c081000
+35080540
+3c0a1003
+ad48f800
+3c081001
+3508edc0
+3c0a1003
+ad48f840
+3c081000
+350806c0
+3c0a1003
+ad48f880
+3c081001
+35085d80
+3c0a1003
+ad48f8c0
+3c081000
+35087c00
+3c0a1003
+ad48f900
+3c081001
+3508f900
+3c0a1003
+ad48f940
+3c081000
+3508c640
+3c0a1003
+ad48f980
+3c081000
+3508f8c0
+3c0a1003
+ad48f9c0
+3c081000
+3508a300
+3c0a1003
+ad48fa00
+3c081003
+3508af00
+3c0a1003
+ad48fa40
+3c081003
+35084300
+3c0a1003
+ad48fa80
+3c081001
+3508a300
+3c0a1003
+ad48fac0
+3c081000
+35085440
+3c0a1003
+ad48fb00
+3c081003
+35082880
+3c0a1003
+ad48fb40
+3c081000
+3508b8c0
+3c0a1003
+ad48fb80
+3c081001
+3508f8c0
+3c0a1003
+ad48fbc0
+3c081000
+35089dc0
+3c0a1003
+ad48fc00
+3c081003
+35085d00
+3c0a1003
+ad48fc40
+3c081001
+35082d00
+3c0a1003
+ad48fc80
+3c081000
+350813c0
+3c0a1003
+ad48fcc0
+3c081002
+3508b6c0
+3c0a1003
+ad48fd00
+3c081003
+3508ff80
+3c0a1003
+ad48fd40
+3c081000
+3508e380
+3c0a1003
+ad48fd80
+3c081000
+3508e300
+3c0a1003
+ad48fdc0
+3c081003
+35080fc0
+3c0a1003
+ad48fe00
+3c081002
+350820c0
+3c0a1003
+ad48fe40
+3c081000
+35082b80
+3c0a1003
+ad48fe80
+3c081002
+3508cc80
+3c0a1003
+ad48fec0
+3c081000
+3508d800
+3c0a1003
+ad48ff00
+3c081002
+3508e000
+3c0a1003
+ad48ff40
+3c081003
+35087a40
+3c0a1003
+ad48ff80
+3c081001
+35088400
+3c0a1003
+ad48ffc0
+3c081000
+35085b00
+3c0a1003
+ad480000
+3c081002
+35083d40
+3c0a1003
+ad480040
+3c081003
+35085f40
+3c0a1003
+ad480080
+3c081001
+35082a00
+3c0a1003
+ad4800c0
+3c081002
+35081e80
+3c0a1003
+ad480100
+3c081002
+3508a180
+3c0a1003
+ad480140
+3c081003
+35082340
+3c0a1003
+ad480180
+3c081000
+3508b1c0
+3c0a1003
+ad4801c0
+3c081001
+35080140
+3c0a1003
+ad480200
+3c081000
+35082540
+3c0a1003
+ad480240
+3c081003
+3508f480
+3c0a1003
+ad480280
+3c081000
+3508d840
+3c0a1003
+ad4802c0
+3c081000
+3508cd00
+3c0a1003
+ad480300
+3c081001
+35081900
+3c0a1003
+ad480340
+3c081000
+35085bc0
+3c0a1003
+ad480380
+3c081000
+3508fe80
+3c0a1003
+ad4803c0
+3c081003
+35083980
+3c0a1003
+ad480400
+3c081000
+35080f00
+3c0a1003
+ad480440
+3c081000
+3508b900
+3c0a1003
+ad480480
+3c081001
+35088740
+3c0a1003
+ad4804c0
+3c081003
+35085c80
+3c0a1003
+ad480500
+3c081002
+3508c5c0
+3c0a1003
+ad480540
+3c081002
+35080900
+3c0a1003
+ad480580
+3c081003
+35080440
+3c0a1003
+ad4805c0
+3c081001
+35087700
+3c0a1003
+ad480600
+3c081001
+35087dc0
+3c0a1003
+ad480640
+3c081001
+3508f740
+3c0a1003
+ad480680
+3c081002
+3508e4c0
+3c0a1003
+ad4806c0
+3c081002
+3508c300
+3c0a1003
+ad480700
+3c081000
+3508ed00
+3c0a1003
+ad480740
+3c081000
+3508e8c0
+3c0a1003
+ad480780
+3c081002
+35085800
+3c0a1003
+ad4807c0
+3c081002
+3508e100
+3c0a1003
+ad480800
+3c081003
+35086f80
+3c0a1003
+ad480840
+3c081003
+35087000
+3c0a1003
+ad480880
+3c081001
+3508d3c0
+3c0a1003
+ad4808c0
+3c081003
+3508cbc0
+3c0a1003
+ad480900
+3c081003
+35086000
+3c0a1003
+ad480940
+3c081001
+35081280
+3c0a1003
+ad480980
+3c081003
+3508edc0
+3c0a1003
+ad4809c0
+3c081001
+3508a840
+3c0a1003
+ad480a00
+3c081000
+35080740
+3c0a1003
+ad480a40
+3c081001
+3508f240
+3c0a1003
+ad480a80
+3c081002
+35088b80
+3c0a1003
+ad480ac0
+3c081003
+35089200
+3c0a1003
+ad480b00
+3c081001
+3508fb80
+3c0a1003
+ad480b40
+3c081002
+3508b240
+3c0a1003
+ad480b80
+3c081003
+35080f80
+3c0a1003
+ad480bc0
+3c081000
+3508b000
+3c0a1003
+ad480c00
+3c081001
+3508c1c0
+3c0a1003
+ad480c40
+3c081000
+35089b40
+3c0a1003
+ad480c80
+3c081002
+35086e40
+3c0a1003
+ad480cc0
+3c081000
+35085a80
+3c0a1003
+ad480d00
+3c081003
+35083200
+3c0a1003
+ad480d40
+3c081000
+350846c0
+3c0a1003
+ad480d80
+3c081000
+35084980
+3c0a1003
+ad480dc0
+3c081000
+35087180
+3c0a1003
+ad480e00
+3c081003
+350835c0
+3c0a1003
+ad480e40
+3c081001
+3508cd40
+3c0a1003
+ad480e80
+3c081000
+3508c580
+3c0a1003
+ad480ec0
+3c081002
+3508be80
+3c0a1003
+ad480f00
+3c081001
+3508b700
+3c0a1003
+ad480f40
+3c081003
+350857c0
+3c0a1003
+ad480f80
+3c081000
+35083900
+3c0a1003
+ad480fc0
+3c081001
+3508a7c0
+3c0a1003
+ad481000
+3c081000
+3508b300
+3c0a1003
+ad481040
+3c081003
+35084800
+3c0a1003
+ad481080
+3c081002
+35085b00
+3c0a1003
+ad4810c0
+3c081000
+35086180
+3c0a1003
+ad481100
+3c081003
+3508b800
+3c0a1003
+ad481140
+3c081002
+3508ae00
+3c0a1003
+ad481180
+3c081003
+35080cc0
+3c0a1003
+ad4811c0
+3c081000
+3508be00
+3c0a1003
+ad481200
+3c081001
+350826c0
+3c0a1003
+ad481240
+3c081001
+3508f040
+3c0a1003
+ad481280
+3c081001
+350893c0
+3c0a1003
+ad4812c0
+3c081003
+35085140
+3c0a1003
+ad481300
+3c081001
+35086080
+3c0a1003
+ad481340
+3c081002
+3508adc0
+3c0a1003
+ad481380
+3c081000
+35087cc0
+3c0a1003
+ad4813c0
+3c081001
+3508a800
+3c0a1003
+ad481400
+3c081001
+35082480
+3c0a1003
+ad481440
+3c081002
+35088980
+3c0a1003
+ad481480
+3c081003
+3508c600
+3c0a1003
+ad4814c0
+3c081001
+350831c0
+3c0a1003
+ad481500
+3c081000
+35080cc0
+3c0a1003
+ad481540
+3c081001
+350815c0
+3c0a1003
+ad481580
+3c081000
+3508af00
+3c0a1003
+ad4815c0
+3c081003
+35088200
+3c0a1003
+ad481600
+3c081003
+35080300
+3c0a1003
+ad481640
+3c081000
+35087dc0
+3c0a1003
+ad481680
+3c081003
+3508e180
+3c0a1003
+ad4816c0
+3c081000
+35080900
+3c0a1003
+ad481700
+3c081002
+35085e40
+3c0a1003
+ad481740
+3c081001
+35086d40
+3c0a1003
+ad481780
+3c081002
+350833c0
+3c0a1003
+ad4817c0
+3c081001
+350855c0
+3c0a1003
+ad481800
+3c081001
+350889c0
+3c0a1003
+ad481840
+3c081000
+3508b980
+3c0a1003
+ad481880
+3c081003
+35085400
+3c0a1003
+ad4818c0
+3c081001
+3508e400
+3c0a1003
+ad481900
+3c081000
+350814c0
+3c0a1003
+ad481940
+3c081002
+35088f40
+3c0a1003
+ad481980
+3c081000
+35086500
+3c0a1003
+ad4819c0
+3c081000
+35085840
+3c0a1003
+ad481a00
+3c081003
+35089140
+3c0a1003
+ad481a40
+3c081002
+3508d000
+3c0a1003
+ad481a80
+3c081000
+35083ac0
+3c0a1003
+ad481ac0
+3c081000
+3508b800
+3c0a1003
+ad481b00
+3c081000
+35087c40
+3c0a1003
+ad481b40
+3c081001
+35080440
+3c0a1003
+ad481b80
+3c081001
+35085380
+3c0a1003
+ad481bc0
+3c081003
+35082040
+3c0a1003
+ad481c00
+3c081002
+35081340
+3c0a1003
+ad481c40
+3c081002
+35080180
+3c0a1003
+ad481c80
+3c081002
+350878c0
+3c0a1003
+ad481cc0
+3c081002
+35087ec0
+3c0a1003
+ad481d00
+3c081000
+35086ec0
+3c0a1003
+ad481d40
+3c081000
+35082fc0
+3c0a1003
+ad481d80
+3c081003
+35088540
+3c0a1003
+ad481dc0
+3c081002
+3508a600
+3c0a1003
+ad481e00
+3c081002
+35086a80
+3c0a1003
+ad481e40
+3c081000
+350820c0
+3c0a1003
+ad481e80
+3c081003
+3508ce40
+3c0a1003
+ad481ec0
+3c081002
+3508c900
+3c0a1003
+ad481f00
+3c081002
+35086d80
+3c0a1003
+ad481f40
+3c081003
+35085dc0
+3c0a1003
+ad481f80
+3c081000
+3508c400
+3c0a1003
+ad481fc0
+3c081003
+350839c0
+3c0a1003
+ad482000
+3c081001
+350859c0
+3c0a1003
+ad482040
+3c081002
+35086240
+3c0a1003
+ad482080
+3c081003
+3508e680
+3c0a1003
+ad4820c0
+3c081003
+35088140
+3c0a1003
+ad482100
+3c081003
+35080800
+3c0a1003
+ad482140
+3c081002
+35084100
+3c0a1003
+ad482180
+3c081002
+3508d7c0
+3c0a1003
+ad4821c0
+3c081003
+3508cfc0
+3c0a1003
+ad482200
+3c081001
+350856c0
+3c0a1003
+ad482240
+3c081001
+35088900
+3c0a1003
+ad482280
+3c081003
+350891c0
+3c0a1003
+ad4822c0
+3c081002
+3508f080
+3c0a1003
+ad482300
+3c081001
+3c0a1003
+ad482340
+3c081002
+3508d180
+3c0a1003
+ad482380
+3c081001
+350842c0
+3c0a1003
+ad4823c0
+3c081000
+3508dc80
+3c0a1003
+ad482400
+3c081000
+35081d80
+3c0a1003
+ad482440
+3c081000
+3508f580
+3c0a1003
+ad482480
+3c081003
+350873c0
+3c0a1003
+ad4824c0
+3c081001
+3508c780
+3c0a1003
+ad482500
+3c081003
+35082680
+3c0a1003
+ad482540
+3c081002
+35087e80
+3c0a1003
+ad482580
+3c081000
+35080b00
+3c0a1003
+ad4825c0
+3c081000
+35086e80
+3c0a1003
+ad482600
+3c081003
+35086c00
+3c0a1003
+ad482640
+3c081000
+3508b2c0
+3c0a1003
+ad482680
+3c081002
+35087540
+3c0a1003
+ad4826c0
+3c081003
+35089a40
+3c0a1003
+ad482700
+3c081003
+35087700
+3c0a1003
+ad482740
+3c081001
+3508e780
+3c0a1003
+ad482780
+3c081001
+350884c0
+3c0a1003
+ad4827c0
+3c081003
+35089100
+3c0a1003
+ad482800
+3c081001
+3508f100
+3c0a1003
+ad482840
+3c081001
+3508ad40
+3c0a1003
+ad482880
+3c081000
+350896c0
+3c0a1003
+ad4828c0
+3c081003
+35084e00
+3c0a1003
+ad482900
+3c081000
+35087f40
+3c0a1003
+ad482940
+3c081001
+350837c0
+3c0a1003
+ad482980
+3c081003
+3508ca80
+3c0a1003
+ad4829c0
+3c081000
+350817c0
+3c0a1003
+ad482a00
+3c081001
+3508c940
+3c0a1003
+ad482a40
+3c081000
+3508cb00
+3c0a1003
+ad482a80
+3c081000
+35089280
+3c0a1003
+ad482ac0
+3c081000
+35080dc0
+3c0a1003
+ad482b00
+3c081003
+350800c0
+3c0a1003
+ad482b40
+3c081003
+35081080
+3c0a1003
+ad482b80
+3c081002
+35080540
+3c0a1003
+ad482bc0
+3c081001
+35084480
+3c0a1003
+ad482c00
+3c081000
+35081900
+3c0a1003
+ad482c40
+3c081000
+350827c0
+3c0a1003
+ad482c80
+3c081003
+3508a300
+3c0a1003
+ad482cc0
+3c081002
+35084a80
+3c0a1003
+ad482d00
+3c081001
+35085f40
+3c0a1003
+ad482d40
+3c081002
+35085980
+3c0a1003
+ad482d80
+3c081001
+35088640
+3c0a1003
+ad482dc0
+3c081000
+35081e00
+3c0a1003
+ad482e00
+3c081003
+35081c80
+3c0a1003
+ad482e40
+3c081002
+3508db80
+3c0a1003
+ad482e80
+3c081002
+35088740
+3c0a1003
+ad482ec0
+3c081002
+3508de40
+3c0a1003
+ad482f00
+3c081003
+35080740
+3c0a1003
+ad482f40
+3c081001
+3508af40
+3c0a1003
+ad482f80
+3c081003
+3508b0c0
+3c0a1003
+ad482fc0
+3c081002
+35080700
+3c0a1003
+ad483000
+3c081002
+35083480
+3c0a1003
+ad483040
+3c081000
+35087040
+3c0a1003
+ad483080
+3c081002
+3508f9c0
+3c0a1003
+ad4830c0
+3c081002
+35088600
+3c0a1003
+ad483100
+3c081003
+350803c0
+3c0a1003
+ad483140
+3c081002
+3508fe00
+3c0a1003
+ad483180
+3c081000
+35085e00
+3c0a1003
+ad4831c0
+3c081000
+350821c0
+3c0a1003
+ad483200
+3c081001
+350835c0
+3c0a1003
+ad483240
+3c081000
+350893c0
+3c0a1003
+ad483280
+3c081000
+35080400
+3c0a1003
+ad4832c0
+3c081000
+35085a00
+3c0a1003
+ad483300
+3c081000
+35088680
+3c0a1003
+ad483340
+3c081000
+350818c0
+3c0a1003
+ad483380
+3c081002
+35081280
+3c0a1003
+ad4833c0
+3c081001
+35085900
+3c0a1003
+ad483400
+3c081003
+3508cac0
+3c0a1003
+ad483440
+3c081003
+3508f080
+3c0a1003
+ad483480
+3c081000
+35081ec0
+3c0a1003
+ad4834c0
+3c081001
+3508e8c0
+3c0a1003
+ad483500
+3c081002
+3508e300
+3c0a1003
+ad483540
+3c081003
+3508b100
+3c0a1003
+ad483580
+3c081003
+35086400
+3c0a1003
+ad4835c0
+3c081001
+350887c0
+3c0a1003
+ad483600
+3c081001
+350844c0
+3c0a1003
+ad483640
+3c081000
+350882c0
+3c0a1003
+ad483680
+3c081002
+35084dc0
+3c0a1003
+ad4836c0
+3c081003
+35081800
+3c0a1003
+ad483700
+3c081003
+3508ca40
+3c0a1003
+ad483740
+3c081001
+350882c0
+3c0a1003
+ad483780
+3c081002
+35089f80
+3c0a1003
+ad4837c0
+3c081000
+35081cc0
+3c0a1003
+ad483800
+3c081001
+35088000
+3c0a1003
+ad483840
+3c081001
+35088dc0
+3c0a1003
+ad483880
+3c081002
+3508ea40
+3c0a1003
+ad4838c0
+3c081003
+35088bc0
+3c0a1003
+ad483900
+3c081001
+3508bd40
+3c0a1003
+ad483940
+3c081002
+3508e6c0
+3c0a1003
+ad483980
+3c081002
+3508b480
+3c0a1003
+ad4839c0
+3c081001
+35088380
+3c0a1003
+ad483a00
+3c081003
+35084640
+3c0a1003
+ad483a40
+3c081002
+35088440
+3c0a1003
+ad483a80
+3c081001
+35088500
+3c0a1003
+ad483ac0
+3c081003
+35086ec0
+3c0a1003
+ad483b00
+3c081001
+350825c0
+3c0a1003
+ad483b40
+3c081003
+35087240
+3c0a1003
+ad483b80
+3c081000
+35081500
+3c0a1003
+ad483bc0
+3c081001
+350852c0
+3c0a1003
+ad483c00
+3c081000
+35087740
+3c0a1003
+ad483c40
+3c081003
+3508c080
+3c0a1003
+ad483c80
+3c081002
+35080d00
+3c0a1003
+ad483cc0
+3c081002
+35086640
+3c0a1003
+ad483d00
+3c081000
+3508da00
+3c0a1003
+ad483d40
+3c081000
+3508d980
+3c0a1003
+ad483d80
+3c081002
+35080b80
+3c0a1003
+ad483dc0
+3c081000
+35083640
+3c0a1003
+ad483e00
+3c081002
+35088bc0
+3c0a1003
+ad483e40
+3c081002
+350824c0
+3c0a1003
+ad483e80
+3c081001
+35084fc0
+3c0a1003
+ad483ec0
+3c081000
+3508ef00
+3c0a1003
+ad483f00
+3c081002
+35086e80
+3c0a1003
+ad483f40
+3c081001
+35084c80
+3c0a1003
+ad483f80
+3c081003
+3508bac0
+3c0a1003
+ad483fc0
+3c081000
+3508dac0
+3c0a1003
+ad484000
+3c081000
+35082ac0
+3c0a1003
+ad484040
+3c081002
+35088c40
+3c0a1003
+ad484080
+3c081003
+3508d500
+3c0a1003
+ad4840c0
+3c081001
+3508f0c0
+3c0a1003
+ad484100
+3c081000
+35088780
+3c0a1003
+ad484140
+3c081001
+3508e640
+3c0a1003
+ad484180
+3c081003
+3508a380
+3c0a1003
+ad4841c0
+3c081002
+35088780
+3c0a1003
+ad484200
+3c081001
+35080d40
+3c0a1003
+ad484240
+3c081000
+35087700
+3c0a1003
+ad484280
+3c081002
+3508df00
+3c0a1003
+ad4842c0
+3c081001
+35086b00
+3c0a1003
+ad484300
+3c081000
+3508f4c0
+3c0a1003
+ad484340
+3c081001
+35080cc0
+3c0a1003
+ad484380
+3c081000
+350884c0
+3c0a1003
+ad4843c0
+3c081000
+35081b40
+3c0a1003
+ad484400
+3c081003
+350867c0
+3c0a1003
+ad484440
+3c081001
+35089180
+3c0a1003
+ad484480
+3c081001
+3508ba40
+3c0a1003
+ad4844c0
+3c081001
+3508f640
+3c0a1003
+ad484500
+3c081002
+3508e440
+3c0a1003
+ad484540
+3c081000
+3508f340
+3c0a1003
+ad484580
+3c081000
+35089340
+3c0a1003
+ad4845c0
+3c081002
+35082c00
+3c0a1003
+ad484600
+3c081000
+35086600
+3c0a1003
+ad484640
+3c081001
+35082c40
+3c0a1003
+ad484680
+3c081002
+350823c0
+3c0a1003
+ad4846c0
+3c081001
+3508df40
+3c0a1003
+ad484700
+3c081002
+35085d00
+3c0a1003
+ad484740
+3c081003
+3508bb40
+3c0a1003
+ad484780
+3c081000
+35085380
+3c0a1003
+ad4847c0
+3c081003
+3508e900
+3c0a1003
+ad484800
+3c081003
+35086dc0
+3c0a1003
+ad484840
+3c081000
+3508eb80
+3c0a1003
+ad484880
+3c081001
+350843c0
+3c0a1003
+ad4848c0
+3c081001
+35083480
+3c0a1003
+ad484900
+3c081002
+35082640
+3c0a1003
+ad484940
+3c081000
+35089100
+3c0a1003
+ad484980
+3c081001
+3508e840
+3c0a1003
+ad4849c0
+3c081002
+35085380
+3c0a1003
+ad484a00
+3c081001
+35081f40
+3c0a1003
+ad484a40
+3c081001
+35087740
+3c0a1003
+ad484a80
+3c081000
+3508dc00
+3c0a1003
+ad484ac0
+3c081002
+35087580
+3c0a1003
+ad484b00
+3c081002
+35083080
+3c0a1003
+ad484b40
+3c081003
+3508d440
+3c0a1003
+ad484b80
+3c081000
+35086100
+3c0a1003
+ad484bc0
+3c081001
+35081e00
+3c0a1003
+ad484c00
+3c081000
+35083580
+3c0a1003
+ad484c40
+3c081001
+35085180
+3c0a1003
+ad484c80
+3c081000
+35083600
+3c0a1003
+ad484cc0
+3c081000
+350816c0
+3c0a1003
+ad484d00
+3c081001
+35084e00
+3c0a1003
+ad484d40
+3c081002
+350860c0
+3c0a1003
+ad484d80
+3c081000
+35083b00
+3c0a1003
+ad484dc0
+3c081000
+35087600
+3c0a1003
+ad484e00
+3c081002
+35088fc0
+3c0a1003
+ad484e40
+3c081000
+3508b7c0
+3c0a1003
+ad484e80
+3c081001
+3508cb00
+3c0a1003
+ad484ec0
+3c081000
+35086f00
+3c0a1003
+ad484f00
+3c081001
+350801c0
+3c0a1003
+ad484f40
+3c081000
+35089f00
+3c0a1003
+ad484f80
+3c081000
+35082f00
+3c0a1003
+ad484fc0
+3c081000
+3508afc0
+3c0a1003
+ad485000
+3c081000
+35080340
+3c0a1003
+ad485040
+3c081000
+35089700
+3c0a1003
+ad485080
+3c081001
+35089980
+3c0a1003
+ad4850c0
+3c081003
+350875c0
+3c0a1003
+ad485100
+3c081003
+3508d380
+3c0a1003
+ad485140
+3c081003
+3508b240
+3c0a1003
+ad485180
+3c081003
+35081200
+3c0a1003
+ad4851c0
+3c081002
+35080800
+3c0a1003
+ad485200
+3c081001
+35087bc0
+3c0a1003
+ad485240
+3c081000
+3508a680
+3c0a1003
+ad485280
+3c081003
+35089b80
+3c0a1003
+ad4852c0
+3c081001
+3508fc40
+3c0a1003
+ad485300
+3c081003
+35084f00
+3c0a1003
+ad485340
+3c081002
+35083040
+3c0a1003
+ad485380
+3c081003
+35085900
+3c0a1003
+ad4853c0
+3c081003
+350828c0
+3c0a1003
+ad485400
+3c081002
+35082e00
+3c0a1003
+ad485440
+3c081001
+3508f140
+3c0a1003
+ad485480
+3c081000
+3508ddc0
+3c0a1003
+ad4854c0
+3c081001
+35080800
+3c0a1003
+ad485500
+3c081001
+35081a00
+3c0a1003
+ad485540
+3c081000
+35087440
+3c0a1003
+ad485580
+3c081003
+35081400
+3c0a1003
+ad4855c0
+3c081001
+35085800
+3c0a1003
+ad485600
+3c081002
+3508dc40
+3c0a1003
+ad485640
+3c081001
+35087d40
+3c0a1003
+ad485680
+3c081002
+35080ec0
+3c0a1003
+ad4856c0
+3c081000
+35087a80
+3c0a1003
+ad485700
+3c081000
+3508d000
+3c0a1003
+ad485740
+3c081000
+350899c0
+3c0a1003
+ad485780
+3c081002
+35088280
+3c0a1003
+ad4857c0
+3c081003
+35089300
+3c0a1003
+ad485800
+3c081000
+350854c0
+3c0a1003
+ad485840
+3c081003
+35085940
+3c0a1003
+ad485880
+3c081002
+35089d00
+3c0a1003
+ad4858c0
+3c081002
+350845c0
+3c0a1003
+ad485900
+3c081001
+35081480
+3c0a1003
+ad485940
+3c081002
+35088400
+3c0a1003
+ad485980
+3c081001
+3508aa40
+3c0a1003
+ad4859c0
+3c081000
+350862c0
+3c0a1003
+ad485a00
+3c081002
+35089140
+3c0a1003
+ad485a40
+3c081003
+35081a00
+3c0a1003
+ad485a80
+3c081002
+35089480
+3c0a1003
+ad485ac0
+3c081000
+350836c0
+3c0a1003
+ad485b00
+3c081001
+3508bf40
+3c0a1003
+ad485b40
+3c081000
+35087a00
+3c0a1003
+ad485b80
+3c081001
+3508e340
+3c0a1003
+ad485bc0
+3c081000
+3508ac80
+3c0a1003
+ad485c00
+3c081002
+35081580
+3c0a1003
+ad485c40
+3c081002
+3508a1c0
+3c0a1003
+ad485c80
+3c081001
+350814c0
+3c0a1003
+ad485cc0
+3c081003
+3508f100
+3c0a1003
+ad485d00
+3c081003
+3508d3c0
+3c0a1003
+ad485d40
+3c081002
+35080640
+3c0a1003
+ad485d80
+3c081002
+35083ac0
+3c0a1003
+ad485dc0
+3c081000
+35082140
+3c0a1003
+ad485e00
+3c081003
+35088780
+3c0a1003
+ad485e40
+3c081003
+35083dc0
+3c0a1003
+ad485e80
+3c081003
+3508f900
+3c0a1003
+ad485ec0
+3c081002
+3508c600
+3c0a1003
+ad485f00
+3c081002
+3508afc0
+3c0a1003
+ad485f40
+3c081001
+35081000
+3c0a1003
+ad485f80
+3c081002
+3508f100
+3c0a1003
+ad485fc0
+3c081000
+35081180
+3c0a1003
+ad486000
+3c081002
+35085480
+3c0a1003
+ad486040
+3c081003
+35080e80
+3c0a1003
+ad486080
+3c081001
+35080ac0
+3c0a1003
+ad4860c0
+3c081001
+3508c0c0
+3c0a1003
+ad486100
+3c081002
+3508b4c0
+3c0a1003
+ad486140
+3c081002
+3508fa00
+3c0a1003
+ad486180
+3c081003
+35081f80
+3c0a1003
+ad4861c0
+3c081001
+35088600
+3c0a1003
+ad486200
+3c081002
+3508f800
+3c0a1003
+ad486240
+3c081001
+350807c0
+3c0a1003
+ad486280
+3c081001
+3508ff80
+3c0a1003
+ad4862c0
+3c081001
+35087100
+3c0a1003
+ad486300
+3c081000
+3508cb80
+3c0a1003
+ad486340
+3c081003
+35082c00
+3c0a1003
+ad486380
+3c081003
+350843c0
+3c0a1003
+ad4863c0
+3c081002
+35084700
+3c0a1003
+ad486400
+3c081003
+35081840
+3c0a1003
+ad486440
+3c081002
+3508a400
+3c0a1003
+ad486480
+3c081002
+3508d080
+3c0a1003
+ad4864c0
+3c081002
+35085400
+3c0a1003
+ad486500
+3c081002
+3508c440
+3c0a1003
+ad486540
+3c081003
+3508c8c0
+3c0a1003
+ad486580
+3c081001
+3508c040
+3c0a1003
+ad4865c0
+3c081001
+350802c0
+3c0a1003
+ad486600
+3c081001
+3508fd40
+3c0a1003
+ad486640
+3c081002
+350883c0
+3c0a1003
+ad486680
+3c081000
+35089f40
+3c0a1003
+ad4866c0
+3c081003
+35088400
+3c0a1003
+ad486700
+3c081000
+3508cf00
+3c0a1003
+ad486740
+3c081003
+35083700
+3c0a1003
+ad486780
+3c081003
+35083040
+3c0a1003
+ad4867c0
+3c081001
+35088300
+3c0a1003
+ad486800
+3c081003
+35084e40
+3c0a1003
+ad486840
+3c081003
+3508b380
+3c0a1003
+ad486880
+3c081001
+35081180
+3c0a1003
+ad4868c0
+3c081000
+35087c80
+3c0a1003
+ad486900
+3c081000
+35088c00
+3c0a1003
+ad486940
+3c081003
+35084540
+3c0a1003
+ad486980
+3c081003
+350882c0
+3c0a1003
+ad4869c0
+3c081002
+35085b40
+3c0a1003
+ad486a00
+3c081003
+3508af40
+3c0a1003
+ad486a40
+3c081002
+35087180
+3c0a1003
+ad486a80
+3c081003
+35086080
+3c0a1003
+ad486ac0
+3c081000
+35080c00
+3c0a1003
+ad486b00
+3c081001
+3508c980
+3c0a1003
+ad486b40
+3c081002
+350822c0
+3c0a1003
+ad486b80
+3c081003
+3c0a1003
+ad486bc0
+3c081003
+350817c0
+3c0a1003
+ad486c00
+3c081003
+35084240
+3c0a1003
+ad486c40
+3c081003
+350879c0
+3c0a1003
+ad486c80
+3c081000
+35085e40
+3c0a1003
+ad486cc0
+3c081003
+3508df80
+3c0a1003
+ad486d00
+3c081003
+3508cd80
+3c0a1003
+ad486d40
+3c081000
+3508a900
+3c0a1003
+ad486d80
+3c081003
+35082280
+3c0a1003
+ad486dc0
+3c081003
+35085e40
+3c0a1003
+ad486e00
+3c081000
+3508cdc0
+3c0a1003
+ad486e40
+3c081000
+35087100
+3c0a1003
+ad486e80
+3c081002
+35087240
+3c0a1003
+ad486ec0
+3c081002
+35089dc0
+3c0a1003
+ad486f00
+3c081000
+35084880
+3c0a1003
+ad486f40
+3c081002
+35087880
+3c0a1003
+ad486f80
+3c081003
+3508b600
+3c0a1003
+ad486fc0
+3c081003
+350837c0
+3c0a1003
+ad487000
+3c081002
+35084c00
+3c0a1003
+ad487040
+3c081003
+350895c0
+3c0a1003
+ad487080
+3c081002
+3508e540
+3c0a1003
+ad4870c0
+3c081003
+3508ae40
+3c0a1003
+ad487100
+3c081000
+3508b740
+3c0a1003
+ad487140
+3c081001
+35087280
+3c0a1003
+ad487180
+3c081000
+3508b940
+3c0a1003
+ad4871c0
+3c081000
+3508c680
+3c0a1003
+ad487200
+3c081002
+35081900
+3c0a1003
+ad487240
+3c081003
+3508a580
+3c0a1003
+ad487280
+3c081001
+3508e500
+3c0a1003
+ad4872c0
+3c081002
+35086b40
+3c0a1003
+ad487300
+3c081003
+3508e240
+3c0a1003
+ad487340
+3c081003
+350855c0
+3c0a1003
+ad487380
+3c081001
+35080600
+3c0a1003
+ad4873c0
+3c081003
+35088000
+3c0a1003
+ad487400
+3c081001
+35081500
+3c0a1003
+ad487440
+3c081002
+35086b80
+3c0a1003
+ad487480
+3c081001
+3508ed80
+3c0a1003
+ad4874c0
+3c081000
+3508fc00
+3c0a1003
+ad487500
+3c081001
+35089fc0
+3c0a1003
+ad487540
+3c081002
+35081cc0
+3c0a1003
+ad487580
+3c081000
+35088e00
+3c0a1003
+ad4875c0
+3c081001
+35081440
+3c0a1003
+ad487600
+3c081002
+350850c0
+3c0a1003
+ad487640
+3c081001
+3508f940
+3c0a1003
+ad487680
+3c081003
+35088e00
+3c0a1003
+ad4876c0
+3c081001
+35088580
+3c0a1003
+ad487700
+3c081003
+350834c0
+3c0a1003
+ad487740
+3c081003
+35086cc0
+3c0a1003
+ad487780
+3c081003
+3508d940
+3c0a1003
+ad4877c0
+3c081000
+3508dd00
+3c0a1003
+ad487800
+3c081000
+3508f100
+3c0a1003
+ad487840
+3c081003
+350829c0
+3c0a1003
+ad487880
+3c081003
+35085000
+3c0a1003
+ad4878c0
+3c081000
+35085540
+3c0a1003
+ad487900
+3c081002
+35081d80
+3c0a1003
+ad487940
+3c081002
+3508ca80
+3c0a1003
+ad487980
+3c081003
+3508dbc0
+3c0a1003
+ad4879c0
+3c081001
+3508af80
+3c0a1003
+ad487a00
+3c081003
+35082e80
+3c0a1003
+ad487a40
+3c081001
+3508d7c0
+3c0a1003
+ad487a80
+3c081003
+35083f00
+3c0a1003
+ad487ac0
+3c081001
+3508ecc0
+3c0a1003
+ad487b00
+3c081002
+3508d240
+3c0a1003
+ad487b40
+3c081001
+3508b5c0
+3c0a1003
+ad487b80
+3c081002
+3508a480
+3c0a1003
+ad487bc0
+3c081001
+3508a700
+3c0a1003
+ad487c00
+3c081002
+35084340
+3c0a1003
+ad487c40
+3c081000
+3508e000
+3c0a1003
+ad487c80
+3c081002
+35087300
+3c0a1003
+ad487cc0
+3c081002
+35082200
+3c0a1003
+ad487d00
+3c081000
+35085cc0
+3c0a1003
+ad487d40
+3c081002
+35081d00
+3c0a1003
+ad487d80
+3c081001
+35080e80
+3c0a1003
+ad487dc0
+3c081000
+3508c380
+3c0a1003
+ad487e00
+3c081002
+3508ab00
+3c0a1003
+ad487e40
+3c081003
+3508b280
+3c0a1003
+ad487e80
+3c081000
+350869c0
+3c0a1003
+ad487ec0
+3c081003
+35086480
+3c0a1003
+ad487f00
+3c081003
+3508d540
+3c0a1003
+ad487f40
+3c081003
+3508f980
+3c0a1003
+ad487f80
+3c081003
+35081cc0
+3c0a1003
+ad487fc0
+3c081002
+35085700
+3c0a1004
+ad488000
+3c081002
+35083b80
+3c0a1004
+ad488040
+3c081000
+35087340
+3c0a1004
+ad488080
+3c081000
+3508d940
+3c0a1004
+ad4880c0
+3c081002
+3508c780
+3c0a1004
+ad488100
+3c081000
+35082640
+3c0a1004
+ad488140
+3c081003
+3508dd40
+3c0a1004
+ad488180
+3c081000
+35084c00
+3c0a1004
+ad4881c0
+3c081003
+35087540
+3c0a1004
+ad488200
+3c081000
+3508e480
+3c0a1004
+ad488240
+3c081001
+3508f380
+3c0a1004
+ad488280
+3c081001
+35082440
+3c0a1004
+ad4882c0
+3c081000
+35085f40
+3c0a1004
+ad488300
+3c081001
+35080640
+3c0a1004
+ad488340
+3c081003
+350838c0
+3c0a1004
+ad488380
+3c081001
+35089940
+3c0a1004
+ad4883c0
+3c081002
+35083e40
+3c0a1004
+ad488400
+3c081000
+35084a00
+3c0a1004
+ad488440
+3c081003
+35089fc0
+3c0a1004
+ad488480
+3c081001
+35084740
+3c0a1004
+ad4884c0
+3c081001
+35080500
+3c0a1004
+ad488500
+3c081000
+350804c0
+3c0a1004
+ad488540
+3c081001
+3508ee40
+3c0a1004
+ad488580
+3c081001
+35082200
+3c0a1004
+ad4885c0
+3c081003
+3508e700
+3c0a1004
+ad488600
+3c081002
+35083d80
+3c0a1004
+ad488640
+3c081003
+3508c1c0
+3c0a1004
+ad488680
+3c081003
+3508a980
+3c0a1004
+ad4886c0
+3c081002
+35087780
+3c0a1004
+ad488700
+3c081003
+35084ac0
+3c0a1004
+ad488740
+3c081000
+3508c6c0
+3c0a1004
+ad488780
+3c081003
+3508e500
+3c0a1004
+ad4887c0
+3c081002
+35083200
+3c0a1004
+ad488800
+3c081001
+35082e40
+3c0a1004
+ad488840
+3c081001
+3508c140
+3c0a1004
+ad488880
+3c081000
+35086940
+3c0a1004
+ad4888c0
+3c081003
+35084400
+3c0a1004
+ad488900
+3c081001
+3508e700
+3c0a1004
+ad488940
+3c081003
+350825c0
+3c0a1004
+ad488980
+3c081002
+35080c40
+3c0a1004
+ad4889c0
+3c081003
+3508c340
+3c0a1004
+ad488a00
+3c081001
+3508d740
+3c0a1004
+ad488a40
+3c081002
+350874c0
+3c0a1004
+ad488a80
+3c081001
+35083680
+3c0a1004
+ad488ac0
+3c081001
+35082d40
+3c0a1004
+ad488b00
+3c081001
+3508aac0
+3c0a1004
+ad488b40
+3c081003
+3508d1c0
+3c0a1004
+ad488b80
+3c081000
+3508ce80
+3c0a1004
+ad488bc0
+3c081001
+35084a00
+3c0a1004
+ad488c00
+3c081002
+350848c0
+3c0a1004
+ad488c40
+3c081001
+3508f200
+3c0a1004
+ad488c80
+3c081002
+3508dc80
+3c0a1004
+ad488cc0
+3c081001
+3508f340
+3c0a1004
+ad488d00
+3c081002
+35086000
+3c0a1004
+ad488d40
+3c081001
+3508ed40
+3c0a1004
+ad488d80
+3c081000
+35080640
+3c0a1004
+ad488dc0
+3c081002
+35080d80
+3c0a1004
+ad488e00
+3c081003
+350840c0
+3c0a1004
+ad488e40
+3c081003
+35082f00
+3c0a1004
+ad488e80
+3c081002
+3508ab40
+3c0a1004
+ad488ec0
+3c081000
+35088280
+3c0a1004
+ad488f00
+3c081000
+35084f80
+3c0a1004
+ad488f40
+3c081002
+3508c640
+3c0a1004
+ad488f80
+3c081000
+35081980
+3c0a1004
+ad488fc0
+3c081003
+35088c80
+3c0a1004
+ad489000
+3c081003
+35089580
+3c0a1004
+ad489040
+3c081001
+35086b80
+3c0a1004
+ad489080
+3c081001
+35088b80
+3c0a1004
+ad4890c0
+3c081003
+350824c0
+3c0a1004
+ad489100
+3c081001
+35086cc0
+3c0a1004
+ad489140
+3c081001
+3508f000
+3c0a1004
+ad489180
+3c081002
+35088f80
+3c0a1004
+ad4891c0
+3c081001
+35080080
+3c0a1004
+ad489200
+3c081002
+35083280
+3c0a1004
+ad489240
+3c081001
+3508f980
+3c0a1004
+ad489280
+3c081001
+35086a80
+3c0a1004
+ad4892c0
+3c081000
+35081d40
+3c0a1004
+ad489300
+3c081003
+35084340
+3c0a1004
+ad489340
+3c081001
+35089540
+3c0a1004
+ad489380
+3c081002
+3508d500
+3c0a1004
+ad4893c0
+3c081003
+35083b80
+3c0a1004
+ad489400
+3c081003
+3508fa80
+3c0a1004
+ad489440
+3c081003
+35082c80
+3c0a1004
+ad489480
+3c081001
+3508c8c0
+3c0a1004
+ad4894c0
+3c081001
+35082800
+3c0a1004
+ad489500
+3c081001
+350854c0
+3c0a1004
+ad489540
+3c081000
+35084a40
+3c0a1004
+ad489580
+3c081001
+350829c0
+3c0a1004
+ad4895c0
+3c081001
+3508a6c0
+3c0a1004
+ad489600
+3c081002
+3508b280
+3c0a1004
+ad489640
+3c081003
+35085bc0
+3c0a1004
+ad489680
+3c081003
+35084d00
+3c0a1004
+ad4896c0
+3c081000
+3508e1c0
+3c0a1004
+ad489700
+3c081003
+35087b80
+3c0a1004
+ad489740
+3c081000
+3508a140
+3c0a1004
+ad489780
+3c081003
+35085f80
+3c0a1004
+ad4897c0
+3c081003
+350810c0
+3c0a1004
+ad489800
+3c081000
+3508c740
+3c0a1004
+ad489840
+3c081002
+35086b00
+3c0a1004
+ad489880
+3c081001
+350809c0
+3c0a1004
+ad4898c0
+3c081002
+35084200
+3c0a1004
+ad489900
+3c081001
+35086e00
+3c0a1004
+ad489940
+3c081001
+350803c0
+3c0a1004
+ad489980
+3c081001
+35081580
+3c0a1004
+ad4899c0
+3c081003
+35082640
+3c0a1004
+ad489a00
+3c081000
+3508d580
+3c0a1004
+ad489a40
+3c081000
+3508df00
+3c0a1004
+ad489a80
+3c081003
+3508e600
+3c0a1004
+ad489ac0
+3c081002
+35087a00
+3c0a1004
+ad489b00
+3c081000
+350868c0
+3c0a1004
+ad489b40
+3c081001
+3508f400
+3c0a1004
+ad489b80
+3c081002
+35082740
+3c0a1004
+ad489bc0
+3c081000
+3508cb40
+3c0a1004
+ad489c00
+3c081002
+35089300
+3c0a1004
+ad489c40
+3c081003
+35084d40
+3c0a1004
+ad489c80
+3c081002
+35087400
+3c0a1004
+ad489cc0
+3c081000
+3508e7c0
+3c0a1004
+ad489d00
+3c081002
+3508dfc0
+3c0a1004
+ad489d40
+3c081001
+3508b080
+3c0a1004
+ad489d80
+3c081002
+35082cc0
+3c0a1004
+ad489dc0
+3c081001
+35088e80
+3c0a1004
+ad489e00
+3c081000
+35081e40
+3c0a1004
+ad489e40
+3c081003
+3508e780
+3c0a1004
+ad489e80
+3c081003
+35080a00
+3c0a1004
+ad489ec0
+3c081000
+35085dc0
+3c0a1004
+ad489f00
+3c081001
+3508af00
+3c0a1004
+ad489f40
+3c081002
+35083780
+3c0a1004
+ad489f80
+3c081000
+35084540
+3c0a1004
+ad489fc0
+3c081003
+35085880
+3c0a1004
+ad48a000
+3c081001
+35081a40
+3c0a1004
+ad48a040
+3c081000
+3508ba00
+3c0a1004
+ad48a080
+3c081002
+3508c680
+3c0a1004
+ad48a0c0
+3c081003
+35085700
+3c0a1004
+ad48a100
+3c081003
+35088180
+3c0a1004
+ad48a140
+3c081003
+35081e00
+3c0a1004
+ad48a180
+3c081003
+350814c0
+3c0a1004
+ad48a1c0
+3c081002
+35084940
+3c0a1004
+ad48a200
+3c081002
+35088580
+3c0a1004
+ad48a240
+3c081000
+35085d00
+3c0a1004
+ad48a280
+3c081003
+35083600
+3c0a1004
+ad48a2c0
+3c081001
+3508a9c0
+3c0a1004
+ad48a300
+3c081002
+3508cf40
+3c0a1004
+ad48a340
+3c081002
+3508c980
+3c0a1004
+ad48a380
+3c081001
+3508d640
+3c0a1004
+ad48a3c0
+3c081001
+3508eb80
+3c0a1004
+ad48a400
+3c081003
+35085200
+3c0a1004
+ad48a440
+3c081000
+3508e140
+3c0a1004
+ad48a480
+3c081003
+350820c0
+3c0a1004
+ad48a4c0
+3c081001
+3508e240
+3c0a1004
+ad48a500
+3c081000
+35080380
+3c0a1004
+ad48a540
+3c081001
+3508ab00
+3c0a1004
+ad48a580
+3c081001
+3508fa80
+3c0a1004
+ad48a5c0
+3c081001
+35084940
+3c0a1004
+ad48a600
+3c081002
+35081dc0
+3c0a1004
+ad48a640
+3c081001
+35086680
+3c0a1004
+ad48a680
+3c081003
+3508de00
+3c0a1004
+ad48a6c0
+3c081003
+35089380
+3c0a1004
+ad48a700
+3c081000
+35084500
+3c0a1004
+ad48a740
+3c081003
+3508f440
+3c0a1004
+ad48a780
+3c081002
+35081300
+3c0a1004
+ad48a7c0
+3c081003
+3508b400
+3c0a1004
+ad48a800
+3c081000
+3508e440
+3c0a1004
+ad48a840
+3c081003
+350819c0
+3c0a1004
+ad48a880
+3c081002
+35080040
+3c0a1004
+ad48a8c0
+3c081002
+35084480
+3c0a1004
+ad48a900
+3c081003
+35086ac0
+3c0a1004
+ad48a940
+3c081001
+35080d00
+3c0a1004
+ad48a980
+3c081003
+35080940
+3c0a1004
+ad48a9c0
+3c081001
+35088d80
+3c0a1004
+ad48aa00
+3c081003
+3508fe40
+3c0a1004
+ad48aa40
+3c081003
+350859c0
+3c0a1004
+ad48aa80
+3c081002
+350871c0
+3c0a1004
+ad48aac0
+3c081002
+35088380
+3c0a1004
+ad48ab00
+3c081001
+35083e00
+3c0a1004
+ad48ab40
+3c081002
+35086840
+3c0a1004
+ad48ab80
+3c081001
+35083a80
+3c0a1004
+ad48abc0
+3c081002
+3508fe40
+3c0a1004
+ad48ac00
+3c081003
+3508a4c0
+3c0a1004
+ad48ac40
+3c081002
+3508ecc0
+3c0a1004
+ad48ac80
+3c081003
+3508c580
+3c0a1004
+ad48acc0
+3c081003
+3508e8c0
+3c0a1004
+ad48ad00
+3c081003
+35083ac0
+3c0a1004
+ad48ad40
+3c081003
+35088740
+3c0a1004
+ad48ad80
+3c081003
+3508fb80
+3c0a1004
+ad48adc0
+3c081001
+35080b40
+3c0a1004
+ad48ae00
+3c081002
+350828c0
+3c0a1004
+ad48ae40
+3c081003
+3508ea80
+3c0a1004
+ad48ae80
+3c081000
+35089ac0
+3c0a1004
+ad48aec0
+3c081002
+3508b440
+3c0a1004
+ad48af00
+3c081003
+35089440
+3c0a1004
+ad48af40
+3c081002
+350877c0
+3c0a1004
+ad48af80
+3c081000
+35088d40
+3c0a1004
+ad48afc0
+3c081002
+35088900
+3c0a1004
+ad48b000
+3c081003
+350881c0
+3c0a1004
+ad48b040
+3c081002
+35083a00
+3c0a1004
+ad48b080
+3c081003
+3508d4c0
+3c0a1004
+ad48b0c0
+3c081002
+3508a4c0
+3c0a1004
+ad48b100
+3c081000
+350824c0
+3c0a1004
+ad48b140
+3c081001
+3508cb80
+3c0a1004
+ad48b180
+3c081001
+35087e00
+3c0a1004
+ad48b1c0
+3c081000
+35087680
+3c0a1004
+ad48b200
+3c081003
+3508e000
+3c0a1004
+ad48b240
+3c081001
+35081740
+3c0a1004
+ad48b280
+3c081003
+35080900
+3c0a1004
+ad48b2c0
+3c081003
+3508cc00
+3c0a1004
+ad48b300
+3c081002
+3508bb80
+3c0a1004
+ad48b340
+3c081001
+3508e7c0
+3c0a1004
+ad48b380
+3c081001
+3508f880
+3c0a1004
+ad48b3c0
+3c081001
+350800c0
+3c0a1004
+ad48b400
+3c081003
+35080880
+3c0a1004
+ad48b440
+3c081000
+35088640
+3c0a1004
+ad48b480
+3c081001
+350828c0
+3c0a1004
+ad48b4c0
+3c081002
+3508d800
+3c0a1004
+ad48b500
+3c081000
+3508ae40
+3c0a1004
+ad48b540
+3c081001
+3508fdc0
+3c0a1004
+ad48b580
+3c081000
+35082880
+3c0a1004
+ad48b5c0
+3c081000
+350857c0
+3c0a1004
+ad48b600
+3c081003
+3508a2c0
+3c0a1004
+ad48b640
+3c081002
+3508f380
+3c0a1004
+ad48b680
+3c081001
+35089580
+3c0a1004
+ad48b6c0
+3c081002
+35088500
+3c0a1004
+ad48b700
+3c081000
+35080f40
+3c0a1004
+ad48b740
+3c081001
+35084440
+3c0a1004
+ad48b780
+3c081002
+350882c0
+3c0a1004
+ad48b7c0
+3c081002
+35087000
+3c0a1004
+ad48b800
+3c081002
+350876c0
+3c0a1004
+ad48b840
+3c081000
+3508c4c0
+3c0a1004
+ad48b880
+3c081001
+35089c00
+3c0a1004
+ad48b8c0
+3c081001
+350862c0
+3c0a1004
+ad48b900
+3c081000
+35080940
+3c0a1004
+ad48b940
+3c081003
+35084440
+3c0a1004
+ad48b980
+3c081003
+350877c0
+3c0a1004
+ad48b9c0
+3c081003
+35082a00
+3c0a1004
+ad48ba00
+3c081002
+35085900
+3c0a1004
+ad48ba40
+3c081000
+35084dc0
+3c0a1004
+ad48ba80
+3c081000
+3508a480
+3c0a1004
+ad48bac0
+3c081000
+3508d0c0
+3c0a1004
+ad48bb00
+3c081000
+3508f600
+3c0a1004
+ad48bb40
+3c081000
+35085340
+3c0a1004
+ad48bb80
+3c081003
+35081f00
+3c0a1004
+ad48bbc0
+3c081002
+35086180
+3c0a1004
+ad48bc00
+3c081002
+35080fc0
+3c0a1004
+ad48bc40
+3c081002
+35085840
+3c0a1004
+ad48bc80
+3c081003
+350818c0
+3c0a1004
+ad48bcc0
+3c081003
+3508ab80
+3c0a1004
+ad48bd00
+3c081001
+35080380
+3c0a1004
+ad48bd40
+3c081003
+35088f00
+3c0a1004
+ad48bd80
+3c081000
+35086e40
+3c0a1004
+ad48bdc0
+3c081001
+3508a180
+3c0a1004
+ad48be00
+3c081003
+35082a40
+3c0a1004
+ad48be40
+3c081000
+35085fc0
+3c0a1004
+ad48be80
+3c081003
+35085d80
+3c0a1004
+ad48bec0
+3c081002
+35080100
+3c0a1004
+ad48bf00
+3c081003
+3508b200
+3c0a1004
+ad48bf40
+3c081001
+35082f80
+3c0a1004
+ad48bf80
+3c081002
+3508a780
+3c0a1004
+ad48bfc0
+3c081003
+35083280
+3c0a1004
+ad48c000
+3c081000
+35087380
+3c0a1004
+ad48c040
+3c081000
+3508ea40
+3c0a1004
+ad48c080
+3c081000
+35085040
+3c0a1004
+ad48c0c0
+3c081003
+35088b80
+3c0a1004
+ad48c100
+3c081002
+3508ac80
+3c0a1004
+ad48c140
+3c081000
+35089200
+3c0a1004
+ad48c180
+3c081000
+35080980
+3c0a1004
+ad48c1c0
+3c081000
+3508ad80
+3c0a1004
+ad48c200
+3c081000
+350837c0
+3c0a1004
+ad48c240
+3c081002
+3508aec0
+3c0a1004
+ad48c280
+3c081001
+3508da40
+3c0a1004
+ad48c2c0
+3c081003
+35088ac0
+3c0a1004
+ad48c300
+3c081002
+3508a640
+3c0a1004
+ad48c340
+3c081003
+350862c0
+3c0a1004
+ad48c380
+3c081000
+3508ccc0
+3c0a1004
+ad48c3c0
+3c081003
+35080100
+3c0a1004
+ad48c400
+3c081002
+35088840
+3c0a1004
+ad48c440
+3c081002
+35084a00
+3c0a1004
+ad48c480
+3c081000
+3508a380
+3c0a1004
+ad48c4c0
+3c081000
+35089240
+3c0a1004
+ad48c500
+3c081002
+3508ce40
+3c0a1004
+ad48c540
+3c081000
+3508c540
+3c0a1004
+ad48c580
+3c081002
+35087700
+3c0a1004
+ad48c5c0
+3c081002
+35085200
+3c0a1004
+ad48c600
+3c081003
+3508d580
+3c0a1004
+ad48c640
+3c081003
+3508c280
+3c0a1004
+ad48c680
+3c081003
+3508bf80
+3c0a1004
+ad48c6c0
+3c081001
+35085b80
+3c0a1004
+ad48c700
+3c081002
+35087cc0
+3c0a1004
+ad48c740
+3c081003
+3508a780
+3c0a1004
+ad48c780
+3c081003
+35088880
+3c0a1004
+ad48c7c0
+3c081002
+35085d80
+3c0a1004
+ad48c800
+3c081002
+35083600
+3c0a1004
+ad48c840
+3c081003
+35081b80
+3c0a1004
+ad48c880
+3c081000
+35086700
+3c0a1004
+ad48c8c0
+3c081002
+35087d40
+3c0a1004
+ad48c900
+3c081002
+3508a6c0
+3c0a1004
+ad48c940
+3c081002
+35087500
+3c0a1004
+ad48c980
+3c081000
+3508b080
+3c0a1004
+ad48c9c0
+3c081003
+35080780
+3c0a1004
+ad48ca00
+3c081003
+350848c0
+3c0a1004
+ad48ca40
+3c081003
+3508a540
+3c0a1004
+ad48ca80
+3c081001
+3508c6c0
+3c0a1004
+ad48cac0
+3c081002
+35087440
+3c0a1004
+ad48cb00
+3c081000
+35083fc0
+3c0a1004
+ad48cb40
+3c081003
+35084a80
+3c0a1004
+ad48cb80
+3c081002
+3508b5c0
+3c0a1004
+ad48cbc0
+3c081002
+3508ddc0
+3c0a1004
+ad48cc00
+3c081000
+350890c0
+3c0a1004
+ad48cc40
+3c081003
+3508c680
+3c0a1004
+ad48cc80
+3c081001
+3508b480
+3c0a1004
+ad48ccc0
+3c081000
+3508c940
+3c0a1004
+ad48cd00
+3c081002
+350852c0
+3c0a1004
+ad48cd40
+3c081002
+35084680
+3c0a1004
+ad48cd80
+3c081000
+35084180
+3c0a1004
+ad48cdc0
+3c081002
+3508f200
+3c0a1004
+ad48ce00
+3c081003
+350878c0
+3c0a1004
+ad48ce40
+3c081002
+35085640
+3c0a1004
+ad48ce80
+3c081003
+3508c0c0
+3c0a1004
+ad48cec0
+3c081002
+3508ce80
+3c0a1004
+ad48cf00
+3c081001
+3508d6c0
+3c0a1004
+ad48cf40
+3c081001
+35086040
+3c0a1004
+ad48cf80
+3c081000
+35089780
+3c0a1004
+ad48cfc0
+3c081001
+3508dbc0
+3c0a1004
+ad48d000
+3c081000
+3508e100
+3c0a1004
+ad48d040
+3c081000
+35088d00
+3c0a1004
+ad48d080
+3c081002
+3508bd80
+3c0a1004
+ad48d0c0
+3c081001
+35083600
+3c0a1004
+ad48d100
+3c081002
+350898c0
+3c0a1004
+ad48d140
+3c081003
+3508a100
+3c0a1004
+ad48d180
+3c081003
+35084840
+3c0a1004
+ad48d1c0
+3c081003
+35081d80
+3c0a1004
+ad48d200
+3c081003
+3508a900
+3c0a1004
+ad48d240
+3c081000
+35089e00
+3c0a1004
+ad48d280
+3c081003
+3508a5c0
+3c0a1004
+ad48d2c0
+3c081000
+35082080
+3c0a1004
+ad48d300
+3c081002
+35087b40
+3c0a1004
+ad48d340
+3c081003
+3508d740
+3c0a1004
+ad48d380
+3c081002
+350821c0
+3c0a1004
+ad48d3c0
+3c081002
+35089780
+3c0a1004
+ad48d400
+3c081000
+35088f80
+3c0a1004
+ad48d440
+3c081001
+35085600
+3c0a1004
+ad48d480
+3c081002
+350817c0
+3c0a1004
+ad48d4c0
+3c081000
+3508b440
+3c0a1004
+ad48d500
+3c081003
+35086b80
+3c0a1004
+ad48d540
+3c081003
+35086340
+3c0a1004
+ad48d580
+3c081000
+3508fec0
+3c0a1004
+ad48d5c0
+3c081002
+3508c240
+3c0a1004
+ad48d600
+3c081002
+35083100
+3c0a1004
+ad48d640
+3c081003
+35087c00
+3c0a1004
+ad48d680
+3c081003
+3508e540
+3c0a1004
+ad48d6c0
+3c081002
+3508f5c0
+3c0a1004
+ad48d700
+3c081003
+35080f00
+3c0a1004
+ad48d740
+3c081000
+35088000
+3c0a1004
+ad48d780
+3c081003
+3508bb00
+3c0a1004
+ad48d7c0
+3c081001
+350895c0
+3c0a1004
+ad48d800
+3c081002
+35087840
+3c0a1004
+ad48d840
+3c081003
+35087400
+3c0a1004
+ad48d880
+3c081001
+35082f00
+3c0a1004
+ad48d8c0
+3c081003
+35082840
+3c0a1004
+ad48d900
+3c081003
+35082ec0
+3c0a1004
+ad48d940
+3c081000
+35083300
+3c0a1004
+ad48d980
+3c081003
+3508e100
+3c0a1004
+ad48d9c0
+3c081002
+3508bd00
+3c0a1004
+ad48da00
+3c081002
+3508ba00
+3c0a1004
+ad48da40
+3c081003
+3508b840
+3c0a1004
+ad48da80
+3c081003
+350874c0
+3c0a1004
+ad48dac0
+3c081000
+35084140
+3c0a1004
+ad48db00
+3c081002
+35088300
+3c0a1004
+ad48db40
+3c081000
+3508ab00
+3c0a1004
+ad48db80
+3c081003
+35086240
+3c0a1004
+ad48dbc0
+3c081000
+35084280
+3c0a1004
+ad48dc00
+3c081002
+350810c0
+3c0a1004
+ad48dc40
+3c081002
+3508c500
+3c0a1004
+ad48dc80
+3c081001
+35088a00
+3c0a1004
+ad48dcc0
+3c081001
+3508e000
+3c0a1004
+ad48dd00
+3c081002
+3508f040
+3c0a1004
+ad48dd40
+3c081001
+3508fe00
+3c0a1004
+ad48dd80
+3c081001
+35089140
+3c0a1004
+ad48ddc0
+3c081002
+35088140
+3c0a1004
+ad48de00
+3c081000
+35085c80
+3c0a1004
+ad48de40
+3c081003
+3508bf00
+3c0a1004
+ad48de80
+3c081003
+3508e6c0
+3c0a1004
+ad48dec0
+3c081000
+35083740
+3c0a1004
+ad48df00
+3c081002
+3508f740
+3c0a1004
+ad48df40
+3c081002
+35081d40
+3c0a1004
+ad48df80
+3c081001
+3508a280
+3c0a1004
+ad48dfc0
+3c081001
+35084980
+3c0a1004
+ad48e000
+3c081000
+35085140
+3c0a1004
+ad48e040
+3c081000
+3508de00
+3c0a1004
+ad48e080
+3c081000
+35088e80
+3c0a1004
+ad48e0c0
+3c081001
+350838c0
+3c0a1004
+ad48e100
+3c081000
+35082180
+3c0a1004
+ad48e140
+3c081000
+35088940
+3c0a1004
+ad48e180
+3c081001
+3508cf40
+3c0a1004
+ad48e1c0
+3c081003
+350860c0
+3c0a1004
+ad48e200
+3c081003
+3508ec40
+3c0a1004
+ad48e240
+3c081001
+35086d80
+3c0a1004
+ad48e280
+3c081002
+350879c0
+3c0a1004
+ad48e2c0
+3c081002
+350846c0
+3c0a1004
+ad48e300
+3c081001
+35083140
+3c0a1004
+ad48e340
+3c081002
+350804c0
+3c0a1004
+ad48e380
+3c081000
+35080580
+3c0a1004
+ad48e3c0
+3c081001
+35086e40
+3c0a1004
+ad48e400
+3c081001
+35086d00
+3c0a1004
+ad48e440
+3c081002
+35084a40
+3c0a1004
+ad48e480
+3c081003
+3508f840
+3c0a1004
+ad48e4c0
+3c081002
+350859c0
+3c0a1004
+ad48e500
+3c081003
+3508b580
+3c0a1004
+ad48e540
+3c081003
+35089d40
+3c0a1004
+ad48e580
+3c081003
+35088500
+3c0a1004
+ad48e5c0
+3c081003
+3508d640
+3c0a1004
+ad48e600
+3c081000
+35083680
+3c0a1004
+ad48e640
+3c081002
+35087600
+3c0a1004
+ad48e680
+3c081000
+3508d1c0
+3c0a1004
+ad48e6c0
+3c081002
+35089c00
+3c0a1004
+ad48e700
+3c081000
+35080440
+3c0a1004
+ad48e740
+3c081001
+3508a940
+3c0a1004
+ad48e780
+3c081003
+3508ba00
+3c0a1004
+ad48e7c0
+3c081001
+3508fc00
+3c0a1004
+ad48e800
+3c081002
+35080480
+3c0a1004
+ad48e840
+3c081002
+35082380
+3c0a1004
+ad48e880
+3c081000
+3508db40
+3c0a1004
+ad48e8c0
+3c081001
+350879c0
+3c0a1004
+ad48e900
+3c081003
+35087940
+3c0a1004
+ad48e940
+3c081002
+3508cfc0
+3c0a1004
+ad48e980
+3c081002
+3508f000
+3c0a1004
+ad48e9c0
+3c081000
+35082c80
+3c0a1004
+ad48ea00
+3c081002
+35086dc0
+3c0a1004
+ad48ea40
+3c081000
+35084d80
+3c0a1004
+ad48ea80
+3c081000
+35086640
+3c0a1004
+ad48eac0
+3c081003
+350816c0
+3c0a1004
+ad48eb00
+3c081003
+35082b00
+3c0a1004
+ad48eb40
+3c081003
+35087980
+3c0a1004
+ad48eb80
+3c081001
+3508e2c0
+3c0a1004
+ad48ebc0
+3c081002
+3508e2c0
+3c0a1004
+ad48ec00
+3c081003
+35085980
+3c0a1004
+ad48ec40
+3c081003
+3508a600
+3c0a1004
+ad48ec80
+3c081000
+35086d40
+3c0a1004
+ad48ecc0
+3c081001
+35082940
+3c0a1004
+ad48ed00
+3c081003
+35080a80
+3c0a1004
+ad48ed40
+3c081000
+35083a80
+3c0a1004
+ad48ed80
+3c081003
+35083c40
+3c0a1004
+ad48edc0
+3c081000
+3508a240
+3c0a1004
+ad48ee00
+3c081000
+35084d00
+3c0a1004
+ad48ee40
+3c081002
+35080c80
+3c0a1004
+ad48ee80
+3c081001
+35086180
+3c0a1004
+ad48eec0
+3c081001
+35087440
+3c0a1004
+ad48ef00
+3c081000
+350867c0
+3c0a1004
+ad48ef40
+3c081000
+350822c0
+3c0a1004
+ad48ef80
+3c081003
+35084180
+3c0a1004
+ad48efc0
+3c081003
+3508ee80
+3c0a1004
+ad48f000
+3c081001
+35080dc0
+3c0a1004
+ad48f040
+3c081001
+35085e40
+3c0a1004
+ad48f080
+3c081002
+3508c380
+3c0a1004
+ad48f0c0
+3c081002
+3508b080
+3c0a1004
+ad48f100
+3c081002
+3508fb00
+3c0a1004
+ad48f140
+3c081001
+35081b00
+3c0a1004
+ad48f180
+3c081003
+3508c940
+3c0a1004
+ad48f1c0
+3c081002
+35087740
+3c0a1004
+ad48f200
+3c081002
+3508c4c0
+3c0a1004
+ad48f240
+3c081002
+35084e80
+3c0a1004
+ad48f280
+3c081001
+35085d00
+3c0a1004
+ad48f2c0
+3c081000
+35080ec0
+3c0a1004
+ad48f300
+3c081003
+3508de80
+3c0a1004
+ad48f340
+3c081001
+35081100
+3c0a1004
+ad48f380
+3c081000
+35081800
+3c0a1004
+ad48f3c0
+3c081001
+3508c100
+3c0a1004
+ad48f400
+3c081001
+35082740
+3c0a1004
+ad48f440
+3c081001
+35088bc0
+3c0a1004
+ad48f480
+3c081001
+3508c080
+3c0a1004
+ad48f4c0
+3c081002
+3508a200
+3c0a1004
+ad48f500
+3c081003
+35089240
+3c0a1004
+ad48f540
+3c081000
+35086000
+3c0a1004
+ad48f580
+3c081003
+350812c0
+3c0a1004
+ad48f5c0
+3c081003
+350889c0
+3c0a1004
+ad48f600
+3c081002
+35089840
+3c0a1004
+ad48f640
+3c081002
+35089bc0
+3c0a1004
+ad48f680
+3c081003
+3508a940
+3c0a1004
+ad48f6c0
+3c081003
+35080700
+3c0a1004
+ad48f700
+3c081003
+3508ee40
+3c0a1004
+ad48f740
+3c081002
+35085000
+3c0a1004
+ad48f780
+3c081002
+3508c200
+3c0a1004
+ad48f7c0
+3c081002
+35089000
+3c0a1004
+ad48f800
+3c081003
+35089540
+3c0a1004
+ad48f840
+3c081001
+3508dd80
+3c0a1004
+ad48f880
+3c081001
+35083bc0
+3c0a1004
+ad48f8c0
+3c081003
+350866c0
+3c0a1004
+ad48f900
+3c081002
+35082c80
+3c0a1004
+ad48f940
+3c081000
+35080c80
+3c0a1004
+ad48f980
+3c081001
+3508a000
+3c0a1004
+ad48f9c0
+3c081000
+3508c300
+3c0a1004
+ad48fa00
+3c081001
+35083240
+3c0a1004
+ad48fa40
+3c081001
+3508ca80
+3c0a1004
+ad48fa80
+3c081001
+3508a340
+3c0a1004
+ad48fac0
+3c081001
+3508c800
+3c0a1004
+ad48fb00
+3c081003
+35089800
+3c0a1004
+ad48fb40
+3c081002
+35087d80
+3c0a1004
+ad48fb80
+3c081000
+3508f800
+3c0a1004
+ad48fbc0
+3c081003
+35083fc0
+3c0a1004
+ad48fc00
+3c081001
+35081940
+3c0a1004
+ad48fc40
+3c081003
+3508ed80
+3c0a1004
+ad48fc80
+3c081001
+3508f2c0
+3c0a1004
+ad48fcc0
+3c081003
+35086300
+3c0a1004
+ad48fd00
+3c081002
+3508df40
+3c0a1004
+ad48fd40
+3c081000
+3508e040
+3c0a1004
+ad48fd80
+3c081003
+35089e00
+3c0a1004
+ad48fdc0
+3c081001
+35089f80
+3c0a1004
+ad48fe00
+3c081003
+3508c500
+3c0a1004
+ad48fe40
+3c081002
+35087100
+3c0a1004
+ad48fe80
+3c081000
+3508e340
+3c0a1004
+ad48fec0
+3c081001
+350861c0
+3c0a1004
+ad48ff00
+3c081003
+3508cf80
+3c0a1004
+ad48ff40
+3c081003
+35083380
+3c0a1004
+ad48ff80
+3c081002
+3508fd00
+3c0a1004
+ad48ffc0
+02004021
+8d080000
+2529ffff
+1520fffd
+2402000a
+0000000c
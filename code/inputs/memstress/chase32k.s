@@ -0,0 +1,4107 @@
+# chase32k: pointer chasing within the cache: misses only while building the list
+# generated by memgen.py chase --count=32768 --footprint=32768 --node=32 --seed=1
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x18c0
+    lui $t2, 0x1000
+    sw $t0, 0($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x59a0
+    lui $t2, 0x1000
+    sw $t0, 32($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c60
+    lui $t2, 0x1000
+    sw $t0, 64($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6240
+    lui $t2, 0x1000
+    sw $t0, 96($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b60
+    lui $t2, 0x1000
+    sw $t0, 128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c40
+    lui $t2, 0x1000
+    sw $t0, 160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d60
+    lui $t2, 0x1000
+    sw $t0, 192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x71e0
+    lui $t2, 0x1000
+    sw $t0, 224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6aa0
+    lui $t2, 0x1000
+    sw $t0, 256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x10c0
+    lui $t2, 0x1000
+    sw $t0, 288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4560
+    lui $t2, 0x1000
+    sw $t0, 320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x380
+    lui $t2, 0x1000
+    sw $t0, 352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3980
+    lui $t2, 0x1000
+    sw $t0, 384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d20
+    lui $t2, 0x1000
+    sw $t0, 416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6200
+    lui $t2, 0x1000
+    sw $t0, 448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a00
+    lui $t2, 0x1000
+    sw $t0, 480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x74a0
+    lui $t2, 0x1000
+    sw $t0, 512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5460
+    lui $t2, 0x1000
+    sw $t0, 544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xac0
+    lui $t2, 0x1000
+    sw $t0, 576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ce0
+    lui $t2, 0x1000
+    sw $t0, 608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7600
+    lui $t2, 0x1000
+    sw $t0, 640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f60
+    lui $t2, 0x1000
+    sw $t0, 672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3760
+    lui $t2, 0x1000
+    sw $t0, 704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x400
+    lui $t2, 0x1000
+    sw $t0, 736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1620
+    lui $t2, 0x1000
+    sw $t0, 768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xea0
+    lui $t2, 0x1000
+    sw $t0, 800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a60
+    lui $t2, 0x1000
+    sw $t0, 832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e0
+    lui $t2, 0x1000
+    sw $t0, 864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c40
+    lui $t2, 0x1000
+    sw $t0, 896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ce0
+    lui $t2, 0x1000
+    sw $t0, 928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e80
+    lui $t2, 0x1000
+    sw $t0, 960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5de0
+    lui $t2, 0x1000
+    sw $t0, 992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x28c0
+    lui $t2, 0x1000
+    sw $t0, 1024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x31e0
+    lui $t2, 0x1000
+    sw $t0, 1056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f20
+    lui $t2, 0x1000
+    sw $t0, 1088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6740
+    lui $t2, 0x1000
+    sw $t0, 1120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d40
+    lui $t2, 0x1000
+    sw $t0, 1152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x12c0
+    lui $t2, 0x1000
+    sw $t0, 1184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1760
+    lui $t2, 0x1000
+    sw $t0, 1216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a00
+    lui $t2, 0x1000
+    sw $t0, 1248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d00
+    lui $t2, 0x1000
+    sw $t0, 1280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7540
+    lui $t2, 0x1000
+    sw $t0, 1312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x860
+    lui $t2, 0x1000
+    sw $t0, 1344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ac0
+    lui $t2, 0x1000
+    sw $t0, 1376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2620
+    lui $t2, 0x1000
+    sw $t0, 1408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c20
+    lui $t2, 0x1000
+    sw $t0, 1440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b40
+    lui $t2, 0x1000
+    sw $t0, 1472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7060
+    lui $t2, 0x1000
+    sw $t0, 1504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5800
+    lui $t2, 0x1000
+    sw $t0, 1536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b40
+    lui $t2, 0x1000
+    sw $t0, 1568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a00
+    lui $t2, 0x1000
+    sw $t0, 1600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7980
+    lui $t2, 0x1000
+    sw $t0, 1632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2840
+    lui $t2, 0x1000
+    sw $t0, 1664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x37a0
+    lui $t2, 0x1000
+    sw $t0, 1696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ca0
+    lui $t2, 0x1000
+    sw $t0, 1728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5440
+    lui $t2, 0x1000
+    sw $t0, 1760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e00
+    lui $t2, 0x1000
+    sw $t0, 1792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7dc0
+    lui $t2, 0x1000
+    sw $t0, 1824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x36a0
+    lui $t2, 0x1000
+    sw $t0, 1856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a60
+    lui $t2, 0x1000
+    sw $t0, 1888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x72e0
+    lui $t2, 0x1000
+    sw $t0, 1920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e20
+    lui $t2, 0x1000
+    sw $t0, 1952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xda0
+    lui $t2, 0x1000
+    sw $t0, 1984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b00
+    lui $t2, 0x1000
+    sw $t0, 2016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x580
+    lui $t2, 0x1000
+    sw $t0, 2048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x61e0
+    lui $t2, 0x1000
+    sw $t0, 2080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f40
+    lui $t2, 0x1000
+    sw $t0, 2112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e20
+    lui $t2, 0x1000
+    sw $t0, 2144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb40
+    lui $t2, 0x1000
+    sw $t0, 2176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6540
+    lui $t2, 0x1000
+    sw $t0, 2208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2980
+    lui $t2, 0x1000
+    sw $t0, 2240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x77a0
+    lui $t2, 0x1000
+    sw $t0, 2272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2540
+    lui $t2, 0x1000
+    sw $t0, 2304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5640
+    lui $t2, 0x1000
+    sw $t0, 2336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6780
+    lui $t2, 0x1000
+    sw $t0, 2368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3420
+    lui $t2, 0x1000
+    sw $t0, 2400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1240
+    lui $t2, 0x1000
+    sw $t0, 2432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6260
+    lui $t2, 0x1000
+    sw $t0, 2464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f80
+    lui $t2, 0x1000
+    sw $t0, 2496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6560
+    lui $t2, 0x1000
+    sw $t0, 2528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3660
+    lui $t2, 0x1000
+    sw $t0, 2560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6440
+    lui $t2, 0x1000
+    sw $t0, 2592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x17a0
+    lui $t2, 0x1000
+    sw $t0, 2624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x21c0
+    lui $t2, 0x1000
+    sw $t0, 2656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4880
+    lui $t2, 0x1000
+    sw $t0, 2688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7660
+    lui $t2, 0x1000
+    sw $t0, 2720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x920
+    lui $t2, 0x1000
+    sw $t0, 2752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x540
+    lui $t2, 0x1000
+    sw $t0, 2784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x79a0
+    lui $t2, 0x1000
+    sw $t0, 2816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3000
+    lui $t2, 0x1000
+    sw $t0, 2848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a80
+    lui $t2, 0x1000
+    sw $t0, 2880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 128
+    lui $t2, 0x1000
+    sw $t0, 2912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6480
+    lui $t2, 0x1000
+    sw $t0, 2944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3960
+    lui $t2, 0x1000
+    sw $t0, 2976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1740
+    lui $t2, 0x1000
+    sw $t0, 3008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd00
+    lui $t2, 0x1000
+    sw $t0, 3040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d80
+    lui $t2, 0x1000
+    sw $t0, 3072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ae0
+    lui $t2, 0x1000
+    sw $t0, 3104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ca0
+    lui $t2, 0x1000
+    sw $t0, 3136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c40
+    lui $t2, 0x1000
+    sw $t0, 3168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2440
+    lui $t2, 0x1000
+    sw $t0, 3200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x780
+    lui $t2, 0x1000
+    sw $t0, 3232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c80
+    lui $t2, 0x1000
+    sw $t0, 3264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5240
+    lui $t2, 0x1000
+    sw $t0, 3296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ae0
+    lui $t2, 0x1000
+    sw $t0, 3328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7900
+    lui $t2, 0x1000
+    sw $t0, 3360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5aa0
+    lui $t2, 0x1000
+    sw $t0, 3392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f20
+    lui $t2, 0x1000
+    sw $t0, 3424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 160
+    lui $t2, 0x1000
+    sw $t0, 3456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4360
+    lui $t2, 0x1000
+    sw $t0, 3488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2720
+    lui $t2, 0x1000
+    sw $t0, 3520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4120
+    lui $t2, 0x1000
+    sw $t0, 3552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2120
+    lui $t2, 0x1000
+    sw $t0, 3584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6be0
+    lui $t2, 0x1000
+    sw $t0, 3616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1520
+    lui $t2, 0x1000
+    sw $t0, 3648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a60
+    lui $t2, 0x1000
+    sw $t0, 3680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ee0
+    lui $t2, 0x1000
+    sw $t0, 3712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3cc0
+    lui $t2, 0x1000
+    sw $t0, 3744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2bc0
+    lui $t2, 0x1000
+    sw $t0, 3776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x14c0
+    lui $t2, 0x1000
+    sw $t0, 3808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c0
+    lui $t2, 0x1000
+    sw $t0, 3840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x20c0
+    lui $t2, 0x1000
+    sw $t0, 3872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3940
+    lui $t2, 0x1000
+    sw $t0, 3904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe80
+    lui $t2, 0x1000
+    sw $t0, 3936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2600
+    lui $t2, 0x1000
+    sw $t0, 3968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3020
+    lui $t2, 0x1000
+    sw $t0, 4000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4cc0
+    lui $t2, 0x1000
+    sw $t0, 4032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ac0
+    lui $t2, 0x1000
+    sw $t0, 4064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x11e0
+    lui $t2, 0x1000
+    sw $t0, 4096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2640
+    lui $t2, 0x1000
+    sw $t0, 4128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x25a0
+    lui $t2, 0x1000
+    sw $t0, 4160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d20
+    lui $t2, 0x1000
+    sw $t0, 4192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x63e0
+    lui $t2, 0x1000
+    sw $t0, 4224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x67a0
+    lui $t2, 0x1000
+    sw $t0, 4256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2060
+    lui $t2, 0x1000
+    sw $t0, 4288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4760
+    lui $t2, 0x1000
+    sw $t0, 4320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c0
+    lui $t2, 0x1000
+    sw $t0, 4352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xae0
+    lui $t2, 0x1000
+    sw $t0, 4384($t2)
+    lui $t0, 0x1000
+    lui $t2, 0x1000
+    sw $t0, 4416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4820
+    lui $t2, 0x1000
+    sw $t0, 4448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c80
+    lui $t2, 0x1000
+    sw $t0, 4480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x29e0
+    lui $t2, 0x1000
+    sw $t0, 4512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6840
+    lui $t2, 0x1000
+    sw $t0, 4544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1300
+    lui $t2, 0x1000
+    sw $t0, 4576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xca0
+    lui $t2, 0x1000
+    sw $t0, 4608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1340
+    lui $t2, 0x1000
+    sw $t0, 4640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3720
+    lui $t2, 0x1000
+    sw $t0, 4672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x13e0
+    lui $t2, 0x1000
+    sw $t0, 4704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x720
+    lui $t2, 0x1000
+    sw $t0, 4736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc80
+    lui $t2, 0x1000
+    sw $t0, 4768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x32e0
+    lui $t2, 0x1000
+    sw $t0, 4800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x30c0
+    lui $t2, 0x1000
+    sw $t0, 4832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5be0
+    lui $t2, 0x1000
+    sw $t0, 4864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1400
+    lui $t2, 0x1000
+    sw $t0, 4896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1700
+    lui $t2, 0x1000
+    sw $t0, 4928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5780
+    lui $t2, 0x1000
+    sw $t0, 4960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5560
+    lui $t2, 0x1000
+    sw $t0, 4992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1680
+    lui $t2, 0x1000
+    sw $t0, 5024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x76e0
+    lui $t2, 0x1000
+    sw $t0, 5056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e60
+    lui $t2, 0x1000
+    sw $t0, 5088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b80
+    lui $t2, 0x1000
+    sw $t0, 5120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f60
+    lui $t2, 0x1000
+    sw $t0, 5152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d00
+    lui $t2, 0x1000
+    sw $t0, 5184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5bc0
+    lui $t2, 0x1000
+    sw $t0, 5216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1580
+    lui $t2, 0x1000
+    sw $t0, 5248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c20
+    lui $t2, 0x1000
+    sw $t0, 5280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x60e0
+    lui $t2, 0x1000
+    sw $t0, 5312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3460
+    lui $t2, 0x1000
+    sw $t0, 5344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x63c0
+    lui $t2, 0x1000
+    sw $t0, 5376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2180
+    lui $t2, 0x1000
+    sw $t0, 5408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4600
+    lui $t2, 0x1000
+    sw $t0, 5440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x15c0
+    lui $t2, 0x1000
+    sw $t0, 5472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x900
+    lui $t2, 0x1000
+    sw $t0, 5504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x15e0
+    lui $t2, 0x1000
+    sw $t0, 5536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1120
+    lui $t2, 0x1000
+    sw $t0, 5568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x52e0
+    lui $t2, 0x1000
+    sw $t0, 5600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b00
+    lui $t2, 0x1000
+    sw $t0, 5632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2be0
+    lui $t2, 0x1000
+    sw $t0, 5664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5520
+    lui $t2, 0x1000
+    sw $t0, 5696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x28e0
+    lui $t2, 0x1000
+    sw $t0, 5728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f80
+    lui $t2, 0x1000
+    sw $t0, 5760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6300
+    lui $t2, 0x1000
+    sw $t0, 5792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5160
+    lui $t2, 0x1000
+    sw $t0, 5824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3fc0
+    lui $t2, 0x1000
+    sw $t0, 5856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7200
+    lui $t2, 0x1000
+    sw $t0, 5888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ae0
+    lui $t2, 0x1000
+    sw $t0, 5920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ae0
+    lui $t2, 0x1000
+    sw $t0, 5952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2660
+    lui $t2, 0x1000
+    sw $t0, 5984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2140
+    lui $t2, 0x1000
+    sw $t0, 6016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3360
+    lui $t2, 0x1000
+    sw $t0, 6048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5000
+    lui $t2, 0x1000
+    sw $t0, 6080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xce0
+    lui $t2, 0x1000
+    sw $t0, 6112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5580
+    lui $t2, 0x1000
+    sw $t0, 6144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3600
+    lui $t2, 0x1000
+    sw $t0, 6176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ea0
+    lui $t2, 0x1000
+    sw $t0, 6208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x55e0
+    lui $t2, 0x1000
+    sw $t0, 6240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x75c0
+    lui $t2, 0x1000
+    sw $t0, 6272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1660
+    lui $t2, 0x1000
+    sw $t0, 6304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5960
+    lui $t2, 0x1000
+    sw $t0, 6336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7bc0
+    lui $t2, 0x1000
+    sw $t0, 6368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x74e0
+    lui $t2, 0x1000
+    sw $t0, 6400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d60
+    lui $t2, 0x1000
+    sw $t0, 6432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x51c0
+    lui $t2, 0x1000
+    sw $t0, 6464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7720
+    lui $t2, 0x1000
+    sw $t0, 6496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2760
+    lui $t2, 0x1000
+    sw $t0, 6528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x62c0
+    lui $t2, 0x1000
+    sw $t0, 6560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3080
+    lui $t2, 0x1000
+    sw $t0, 6592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f00
+    lui $t2, 0x1000
+    sw $t0, 6624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6120
+    lui $t2, 0x1000
+    sw $t0, 6656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7480
+    lui $t2, 0x1000
+    sw $t0, 6688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e40
+    lui $t2, 0x1000
+    sw $t0, 6720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x47e0
+    lui $t2, 0x1000
+    sw $t0, 6752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1040
+    lui $t2, 0x1000
+    sw $t0, 6784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7680
+    lui $t2, 0x1000
+    sw $t0, 6816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2960
+    lui $t2, 0x1000
+    sw $t0, 6848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6500
+    lui $t2, 0x1000
+    sw $t0, 6880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x53e0
+    lui $t2, 0x1000
+    sw $t0, 6912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x45e0
+    lui $t2, 0x1000
+    sw $t0, 6944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1020
+    lui $t2, 0x1000
+    sw $t0, 6976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3700
+    lui $t2, 0x1000
+    sw $t0, 7008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d40
+    lui $t2, 0x1000
+    sw $t0, 7040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2020
+    lui $t2, 0x1000
+    sw $t0, 7072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x57e0
+    lui $t2, 0x1000
+    sw $t0, 7104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ba0
+    lui $t2, 0x1000
+    sw $t0, 7136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x26c0
+    lui $t2, 0x1000
+    sw $t0, 7168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x56c0
+    lui $t2, 0x1000
+    sw $t0, 7200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x45c0
+    lui $t2, 0x1000
+    sw $t0, 7232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3040
+    lui $t2, 0x1000
+    sw $t0, 7264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x43a0
+    lui $t2, 0x1000
+    sw $t0, 7296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x39c0
+    lui $t2, 0x1000
+    sw $t0, 7328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6660
+    lui $t2, 0x1000
+    sw $t0, 7360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c0
+    lui $t2, 0x1000
+    sw $t0, 7392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1720
+    lui $t2, 0x1000
+    sw $t0, 7424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4060
+    lui $t2, 0x1000
+    sw $t0, 7456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c20
+    lui $t2, 0x1000
+    sw $t0, 7488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f80
+    lui $t2, 0x1000
+    sw $t0, 7520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a0
+    lui $t2, 0x1000
+    sw $t0, 7552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c40
+    lui $t2, 0x1000
+    sw $t0, 7584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x71c0
+    lui $t2, 0x1000
+    sw $t0, 7616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x46e0
+    lui $t2, 0x1000
+    sw $t0, 7648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ee0
+    lui $t2, 0x1000
+    sw $t0, 7680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4440
+    lui $t2, 0x1000
+    sw $t0, 7712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ea0
+    lui $t2, 0x1000
+    sw $t0, 7744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1540
+    lui $t2, 0x1000
+    sw $t0, 7776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d80
+    lui $t2, 0x1000
+    sw $t0, 7808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5100
+    lui $t2, 0x1000
+    sw $t0, 7840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x64a0
+    lui $t2, 0x1000
+    sw $t0, 7872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b60
+    lui $t2, 0x1000
+    sw $t0, 7904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7160
+    lui $t2, 0x1000
+    sw $t0, 7936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d80
+    lui $t2, 0x1000
+    sw $t0, 7968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a0
+    lui $t2, 0x1000
+    sw $t0, 8000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbe0
+    lui $t2, 0x1000
+    sw $t0, 8032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7440
+    lui $t2, 0x1000
+    sw $t0, 8064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1980
+    lui $t2, 0x1000
+    sw $t0, 8096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x55c0
+    lui $t2, 0x1000
+    sw $t0, 8128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1080
+    lui $t2, 0x1000
+    sw $t0, 8160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2400
+    lui $t2, 0x1000
+    sw $t0, 8192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe60
+    lui $t2, 0x1000
+    sw $t0, 8224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c00
+    lui $t2, 0x1000
+    sw $t0, 8256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4860
+    lui $t2, 0x1000
+    sw $t0, 8288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe00
+    lui $t2, 0x1000
+    sw $t0, 8320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x340
+    lui $t2, 0x1000
+    sw $t0, 8352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x820
+    lui $t2, 0x1000
+    sw $t0, 8384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4300
+    lui $t2, 0x1000
+    sw $t0, 8416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4460
+    lui $t2, 0x1000
+    sw $t0, 8448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1820
+    lui $t2, 0x1000
+    sw $t0, 8480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2da0
+    lui $t2, 0x1000
+    sw $t0, 8512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2880
+    lui $t2, 0x1000
+    sw $t0, 8544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2fa0
+    lui $t2, 0x1000
+    sw $t0, 8576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4380
+    lui $t2, 0x1000
+    sw $t0, 8608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3160
+    lui $t2, 0x1000
+    sw $t0, 8640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb60
+    lui $t2, 0x1000
+    sw $t0, 8672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x880
+    lui $t2, 0x1000
+    sw $t0, 8704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3920
+    lui $t2, 0x1000
+    sw $t0, 8736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa80
+    lui $t2, 0x1000
+    sw $t0, 8768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x54e0
+    lui $t2, 0x1000
+    sw $t0, 8800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x77c0
+    lui $t2, 0x1000
+    sw $t0, 8832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3140
+    lui $t2, 0x1000
+    sw $t0, 8864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5da0
+    lui $t2, 0x1000
+    sw $t0, 8896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x48a0
+    lui $t2, 0x1000
+    sw $t0, 8928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5420
+    lui $t2, 0x1000
+    sw $t0, 8960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c60
+    lui $t2, 0x1000
+    sw $t0, 8992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4780
+    lui $t2, 0x1000
+    sw $t0, 9024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d60
+    lui $t2, 0x1000
+    sw $t0, 9056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3aa0
+    lui $t2, 0x1000
+    sw $t0, 9088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ea0
+    lui $t2, 0x1000
+    sw $t0, 9120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe40
+    lui $t2, 0x1000
+    sw $t0, 9152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x62e0
+    lui $t2, 0x1000
+    sw $t0, 9184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x60c0
+    lui $t2, 0x1000
+    sw $t0, 9216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3380
+    lui $t2, 0x1000
+    sw $t0, 9248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ea0
+    lui $t2, 0x1000
+    sw $t0, 9280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x26e0
+    lui $t2, 0x1000
+    sw $t0, 9312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6080
+    lui $t2, 0x1000
+    sw $t0, 9344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ac0
+    lui $t2, 0x1000
+    sw $t0, 9376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ce0
+    lui $t2, 0x1000
+    sw $t0, 9408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x940
+    lui $t2, 0x1000
+    sw $t0, 9440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6de0
+    lui $t2, 0x1000
+    sw $t0, 9472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ae0
+    lui $t2, 0x1000
+    sw $t0, 9504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x73a0
+    lui $t2, 0x1000
+    sw $t0, 9536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x77e0
+    lui $t2, 0x1000
+    sw $t0, 9568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4200
+    lui $t2, 0x1000
+    sw $t0, 9600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xdc0
+    lui $t2, 0x1000
+    sw $t0, 9632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7520
+    lui $t2, 0x1000
+    sw $t0, 9664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6960
+    lui $t2, 0x1000
+    sw $t0, 9696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e20
+    lui $t2, 0x1000
+    sw $t0, 9728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6cc0
+    lui $t2, 0x1000
+    sw $t0, 9760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a0
+    lui $t2, 0x1000
+    sw $t0, 9792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b80
+    lui $t2, 0x1000
+    sw $t0, 9824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b80
+    lui $t2, 0x1000
+    sw $t0, 9856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x42a0
+    lui $t2, 0x1000
+    sw $t0, 9888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x44a0
+    lui $t2, 0x1000
+    sw $t0, 9920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1860
+    lui $t2, 0x1000
+    sw $t0, 9952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x300
+    lui $t2, 0x1000
+    sw $t0, 9984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7fc0
+    lui $t2, 0x1000
+    sw $t0, 10016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x620
+    lui $t2, 0x1000
+    sw $t0, 10048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x49a0
+    lui $t2, 0x1000
+    sw $t0, 10080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a0
+    lui $t2, 0x1000
+    sw $t0, 10112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x38a0
+    lui $t2, 0x1000
+    sw $t0, 10144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9e0
+    lui $t2, 0x1000
+    sw $t0, 10176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ba0
+    lui $t2, 0x1000
+    sw $t0, 10208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x320
+    lui $t2, 0x1000
+    sw $t0, 10240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3220
+    lui $t2, 0x1000
+    sw $t0, 10272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1060
+    lui $t2, 0x1000
+    sw $t0, 10304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d20
+    lui $t2, 0x1000
+    sw $t0, 10336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x43e0
+    lui $t2, 0x1000
+    sw $t0, 10368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x840
+    lui $t2, 0x1000
+    sw $t0, 10400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7380
+    lui $t2, 0x1000
+    sw $t0, 10432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4240
+    lui $t2, 0x1000
+    sw $t0, 10464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d00
+    lui $t2, 0x1000
+    sw $t0, 10496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x49c0
+    lui $t2, 0x1000
+    sw $t0, 10528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7180
+    lui $t2, 0x1000
+    sw $t0, 10560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x72a0
+    lui $t2, 0x1000
+    sw $t0, 10592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4aa0
+    lui $t2, 0x1000
+    sw $t0, 10624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x47a0
+    lui $t2, 0x1000
+    sw $t0, 10656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6520
+    lui $t2, 0x1000
+    sw $t0, 10688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ea0
+    lui $t2, 0x1000
+    sw $t0, 10720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5880
+    lui $t2, 0x1000
+    sw $t0, 10752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ac0
+    lui $t2, 0x1000
+    sw $t0, 10784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ee0
+    lui $t2, 0x1000
+    sw $t0, 10816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5fc0
+    lui $t2, 0x1000
+    sw $t0, 10848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e80
+    lui $t2, 0x1000
+    sw $t0, 10880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f20
+    lui $t2, 0x1000
+    sw $t0, 10912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3740
+    lui $t2, 0x1000
+    sw $t0, 10944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f80
+    lui $t2, 0x1000
+    sw $t0, 10976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6340
+    lui $t2, 0x1000
+    sw $t0, 11008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4340
+    lui $t2, 0x1000
+    sw $t0, 11040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d00
+    lui $t2, 0x1000
+    sw $t0, 11072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f20
+    lui $t2, 0x1000
+    sw $t0, 11104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1160
+    lui $t2, 0x1000
+    sw $t0, 11136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b60
+    lui $t2, 0x1000
+    sw $t0, 11168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ba0
+    lui $t2, 0x1000
+    sw $t0, 11200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e40
+    lui $t2, 0x1000
+    sw $t0, 11232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3180
+    lui $t2, 0x1000
+    sw $t0, 11264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x41e0
+    lui $t2, 0x1000
+    sw $t0, 11296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1de0
+    lui $t2, 0x1000
+    sw $t0, 11328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7240
+    lui $t2, 0x1000
+    sw $t0, 11360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x19c0
+    lui $t2, 0x1000
+    sw $t0, 11392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c20
+    lui $t2, 0x1000
+    sw $t0, 11424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7de0
+    lui $t2, 0x1000
+    sw $t0, 11456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3fe0
+    lui $t2, 0x1000
+    sw $t0, 11488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xaa0
+    lui $t2, 0x1000
+    sw $t0, 11520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2500
+    lui $t2, 0x1000
+    sw $t0, 11552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a00
+    lui $t2, 0x1000
+    sw $t0, 11584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x70a0
+    lui $t2, 0x1000
+    sw $t0, 11616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a80
+    lui $t2, 0x1000
+    sw $t0, 11648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f20
+    lui $t2, 0x1000
+    sw $t0, 11680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6820
+    lui $t2, 0x1000
+    sw $t0, 11712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3de0
+    lui $t2, 0x1000
+    sw $t0, 11744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a20
+    lui $t2, 0x1000
+    sw $t0, 11776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2480
+    lui $t2, 0x1000
+    sw $t0, 11808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1fa0
+    lui $t2, 0x1000
+    sw $t0, 11840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6020
+    lui $t2, 0x1000
+    sw $t0, 11872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f00
+    lui $t2, 0x1000
+    sw $t0, 11904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4080
+    lui $t2, 0x1000
+    sw $t0, 11936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3da0
+    lui $t2, 0x1000
+    sw $t0, 11968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7820
+    lui $t2, 0x1000
+    sw $t0, 12000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1640
+    lui $t2, 0x1000
+    sw $t0, 12032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6320
+    lui $t2, 0x1000
+    sw $t0, 12064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3100
+    lui $t2, 0x1000
+    sw $t0, 12096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2580
+    lui $t2, 0x1000
+    sw $t0, 12128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7360
+    lui $t2, 0x1000
+    sw $t0, 12160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7880
+    lui $t2, 0x1000
+    sw $t0, 12192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1000
+    lui $t2, 0x1000
+    sw $t0, 12224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e80
+    lui $t2, 0x1000
+    sw $t0, 12256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e80
+    lui $t2, 0x1000
+    sw $t0, 12288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x200
+    lui $t2, 0x1000
+    sw $t0, 12320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 32
+    lui $t2, 0x1000
+    sw $t0, 12352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5280
+    lui $t2, 0x1000
+    sw $t0, 12384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x59c0
+    lui $t2, 0x1000
+    sw $t0, 12416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5380
+    lui $t2, 0x1000
+    sw $t0, 12448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x960
+    lui $t2, 0x1000
+    sw $t0, 12480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x70e0
+    lui $t2, 0x1000
+    sw $t0, 12512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d00
+    lui $t2, 0x1000
+    sw $t0, 12544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 192
+    lui $t2, 0x1000
+    sw $t0, 12576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c60
+    lui $t2, 0x1000
+    sw $t0, 12608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ce0
+    lui $t2, 0x1000
+    sw $t0, 12640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2800
+    lui $t2, 0x1000
+    sw $t0, 12672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3480
+    lui $t2, 0x1000
+    sw $t0, 12704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x19e0
+    lui $t2, 0x1000
+    sw $t0, 12736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7500
+    lui $t2, 0x1000
+    sw $t0, 12768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b00
+    lui $t2, 0x1000
+    sw $t0, 12800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ea0
+    lui $t2, 0x1000
+    sw $t0, 12832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x76c0
+    lui $t2, 0x1000
+    sw $t0, 12864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x40c0
+    lui $t2, 0x1000
+    sw $t0, 12896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a20
+    lui $t2, 0x1000
+    sw $t0, 12928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b20
+    lui $t2, 0x1000
+    sw $t0, 12960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa40
+    lui $t2, 0x1000
+    sw $t0, 12992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x260
+    lui $t2, 0x1000
+    sw $t0, 13024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7080
+    lui $t2, 0x1000
+    sw $t0, 13056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2820
+    lui $t2, 0x1000
+    sw $t0, 13088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f60
+    lui $t2, 0x1000
+    sw $t0, 13120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5220
+    lui $t2, 0x1000
+    sw $t0, 13152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e60
+    lui $t2, 0x1000
+    sw $t0, 13184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x78a0
+    lui $t2, 0x1000
+    sw $t0, 13216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6620
+    lui $t2, 0x1000
+    sw $t0, 13248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1dc0
+    lui $t2, 0x1000
+    sw $t0, 13280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2fc0
+    lui $t2, 0x1000
+    sw $t0, 13312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x520
+    lui $t2, 0x1000
+    sw $t0, 13344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c0
+    lui $t2, 0x1000
+    sw $t0, 13376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x57c0
+    lui $t2, 0x1000
+    sw $t0, 13408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5820
+    lui $t2, 0x1000
+    sw $t0, 13440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1440
+    lui $t2, 0x1000
+    sw $t0, 13472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a40
+    lui $t2, 0x1000
+    sw $t0, 13504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ae0
+    lui $t2, 0x1000
+    sw $t0, 13536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x40a0
+    lui $t2, 0x1000
+    sw $t0, 13568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x33c0
+    lui $t2, 0x1000
+    sw $t0, 13600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e60
+    lui $t2, 0x1000
+    sw $t0, 13632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b00
+    lui $t2, 0x1000
+    sw $t0, 13664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9c0
+    lui $t2, 0x1000
+    sw $t0, 13696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1960
+    lui $t2, 0x1000
+    sw $t0, 13728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x14e0
+    lui $t2, 0x1000
+    sw $t0, 13760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5140
+    lui $t2, 0x1000
+    sw $t0, 13792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c00
+    lui $t2, 0x1000
+    sw $t0, 13824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1bc0
+    lui $t2, 0x1000
+    sw $t0, 13856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc40
+    lui $t2, 0x1000
+    sw $t0, 13888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1840
+    lui $t2, 0x1000
+    sw $t0, 13920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7800
+    lui $t2, 0x1000
+    sw $t0, 13952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a60
+    lui $t2, 0x1000
+    sw $t0, 13984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3060
+    lui $t2, 0x1000
+    sw $t0, 14016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b20
+    lui $t2, 0x1000
+    sw $t0, 14048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b80
+    lui $t2, 0x1000
+    sw $t0, 14080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6980
+    lui $t2, 0x1000
+    sw $t0, 14112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6860
+    lui $t2, 0x1000
+    sw $t0, 14144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4da0
+    lui $t2, 0x1000
+    sw $t0, 14176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3200
+    lui $t2, 0x1000
+    sw $t0, 14208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x31a0
+    lui $t2, 0x1000
+    sw $t0, 14240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd40
+    lui $t2, 0x1000
+    sw $t0, 14272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x760
+    lui $t2, 0x1000
+    sw $t0, 14304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x16a0
+    lui $t2, 0x1000
+    sw $t0, 14336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7f60
+    lui $t2, 0x1000
+    sw $t0, 14368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb20
+    lui $t2, 0x1000
+    sw $t0, 14400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d00
+    lui $t2, 0x1000
+    sw $t0, 14432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4420
+    lui $t2, 0x1000
+    sw $t0, 14464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2200
+    lui $t2, 0x1000
+    sw $t0, 14496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1320
+    lui $t2, 0x1000
+    sw $t0, 14528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5200
+    lui $t2, 0x1000
+    sw $t0, 14560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e00
+    lui $t2, 0x1000
+    sw $t0, 14592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5920
+    lui $t2, 0x1000
+    sw $t0, 14624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7fa0
+    lui $t2, 0x1000
+    sw $t0, 14656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb80
+    lui $t2, 0x1000
+    sw $t0, 14688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x36c0
+    lui $t2, 0x1000
+    sw $t0, 14720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6180
+    lui $t2, 0x1000
+    sw $t0, 14752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4220
+    lui $t2, 0x1000
+    sw $t0, 14784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x34a0
+    lui $t2, 0x1000
+    sw $t0, 14816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x240
+    lui $t2, 0x1000
+    sw $t0, 14848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b20
+    lui $t2, 0x1000
+    sw $t0, 14880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x25c0
+    lui $t2, 0x1000
+    sw $t0, 14912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x28a0
+    lui $t2, 0x1000
+    sw $t0, 14944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5760
+    lui $t2, 0x1000
+    sw $t0, 14976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f80
+    lui $t2, 0x1000
+    sw $t0, 15008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a80
+    lui $t2, 0x1000
+    sw $t0, 15040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ec0
+    lui $t2, 0x1000
+    sw $t0, 15072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6940
+    lui $t2, 0x1000
+    sw $t0, 15104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x980
+    lui $t2, 0x1000
+    sw $t0, 15136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa00
+    lui $t2, 0x1000
+    sw $t0, 15168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3be0
+    lui $t2, 0x1000
+    sw $t0, 15200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c0
+    lui $t2, 0x1000
+    sw $t0, 15232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x65a0
+    lui $t2, 0x1000
+    sw $t0, 15264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f60
+    lui $t2, 0x1000
+    sw $t0, 15296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e20
+    lui $t2, 0x1000
+    sw $t0, 15328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7420
+    lui $t2, 0x1000
+    sw $t0, 15360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e0
+    lui $t2, 0x1000
+    sw $t0, 15392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5860
+    lui $t2, 0x1000
+    sw $t0, 15424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ca0
+    lui $t2, 0x1000
+    sw $t0, 15456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x39a0
+    lui $t2, 0x1000
+    sw $t0, 15488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6000
+    lui $t2, 0x1000
+    sw $t0, 15520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3fa0
+    lui $t2, 0x1000
+    sw $t0, 15552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6420
+    lui $t2, 0x1000
+    sw $t0, 15584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ba0
+    lui $t2, 0x1000
+    sw $t0, 15616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6060
+    lui $t2, 0x1000
+    sw $t0, 15648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1880
+    lui $t2, 0x1000
+    sw $t0, 15680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x38c0
+    lui $t2, 0x1000
+    sw $t0, 15712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x480
+    lui $t2, 0x1000
+    sw $t0, 15744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x740
+    lui $t2, 0x1000
+    sw $t0, 15776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a0
+    lui $t2, 0x1000
+    sw $t0, 15808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7640
+    lui $t2, 0x1000
+    sw $t0, 15840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x54a0
+    lui $t2, 0x1000
+    sw $t0, 15872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3500
+    lui $t2, 0x1000
+    sw $t0, 15904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a20
+    lui $t2, 0x1000
+    sw $t0, 15936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6900
+    lui $t2, 0x1000
+    sw $t0, 15968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc20
+    lui $t2, 0x1000
+    sw $t0, 16000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d60
+    lui $t2, 0x1000
+    sw $t0, 16032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f80
+    lui $t2, 0x1000
+    sw $t0, 16064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3860
+    lui $t2, 0x1000
+    sw $t0, 16096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7be0
+    lui $t2, 0x1000
+    sw $t0, 16128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x18e0
+    lui $t2, 0x1000
+    sw $t0, 16160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e00
+    lui $t2, 0x1000
+    sw $t0, 16192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc00
+    lui $t2, 0x1000
+    sw $t0, 16224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf20
+    lui $t2, 0x1000
+    sw $t0, 16256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2940
+    lui $t2, 0x1000
+    sw $t0, 16288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5360
+    lui $t2, 0x1000
+    sw $t0, 16320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b40
+    lui $t2, 0x1000
+    sw $t0, 16352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7100
+    lui $t2, 0x1000
+    sw $t0, 16384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b20
+    lui $t2, 0x1000
+    sw $t0, 16416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4400
+    lui $t2, 0x1000
+    sw $t0, 16448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x15a0
+    lui $t2, 0x1000
+    sw $t0, 16480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x23e0
+    lui $t2, 0x1000
+    sw $t0, 16512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d20
+    lui $t2, 0x1000
+    sw $t0, 16544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c60
+    lui $t2, 0x1000
+    sw $t0, 16576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a40
+    lui $t2, 0x1000
+    sw $t0, 16608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x79c0
+    lui $t2, 0x1000
+    sw $t0, 16640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5500
+    lui $t2, 0x1000
+    sw $t0, 16672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4fc0
+    lui $t2, 0x1000
+    sw $t0, 16704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d80
+    lui $t2, 0x1000
+    sw $t0, 16736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7300
+    lui $t2, 0x1000
+    sw $t0, 16768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ee0
+    lui $t2, 0x1000
+    sw $t0, 16800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6da0
+    lui $t2, 0x1000
+    sw $t0, 16832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x33e0
+    lui $t2, 0x1000
+    sw $t0, 16864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1180
+    lui $t2, 0x1000
+    sw $t0, 16896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5900
+    lui $t2, 0x1000
+    sw $t0, 16928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1940
+    lui $t2, 0x1000
+    sw $t0, 16960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x36e0
+    lui $t2, 0x1000
+    sw $t0, 16992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x10a0
+    lui $t2, 0x1000
+    sw $t0, 17024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ca0
+    lui $t2, 0x1000
+    sw $t0, 17056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1500
+    lui $t2, 0x1000
+    sw $t0, 17088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a80
+    lui $t2, 0x1000
+    sw $t0, 17120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e20
+    lui $t2, 0x1000
+    sw $t0, 17152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ca0
+    lui $t2, 0x1000
+    sw $t0, 17184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6140
+    lui $t2, 0x1000
+    sw $t0, 17216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x27e0
+    lui $t2, 0x1000
+    sw $t0, 17248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x22e0
+    lui $t2, 0x1000
+    sw $t0, 17280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7da0
+    lui $t2, 0x1000
+    sw $t0, 17312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x640
+    lui $t2, 0x1000
+    sw $t0, 17344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ae0
+    lui $t2, 0x1000
+    sw $t0, 17376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x13c0
+    lui $t2, 0x1000
+    sw $t0, 17408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3640
+    lui $t2, 0x1000
+    sw $t0, 17440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x68a0
+    lui $t2, 0x1000
+    sw $t0, 17472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x800
+    lui $t2, 0x1000
+    sw $t0, 17504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7040
+    lui $t2, 0x1000
+    sw $t0, 17536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x57a0
+    lui $t2, 0x1000
+    sw $t0, 17568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4040
+    lui $t2, 0x1000
+    sw $t0, 17600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ac0
+    lui $t2, 0x1000
+    sw $t0, 17632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 64
+    lui $t2, 0x1000
+    sw $t0, 17664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x19a0
+    lui $t2, 0x1000
+    sw $t0, 17696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4500
+    lui $t2, 0x1000
+    sw $t0, 17728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5340
+    lui $t2, 0x1000
+    sw $t0, 17760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f20
+    lui $t2, 0x1000
+    sw $t0, 17792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x11a0
+    lui $t2, 0x1000
+    sw $t0, 17824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x69c0
+    lui $t2, 0x1000
+    sw $t0, 17856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1920
+    lui $t2, 0x1000
+    sw $t0, 17888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7fe0
+    lui $t2, 0x1000
+    sw $t0, 17920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e40
+    lui $t2, 0x1000
+    sw $t0, 17952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f00
+    lui $t2, 0x1000
+    sw $t0, 17984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x11c0
+    lui $t2, 0x1000
+    sw $t0, 18016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x16c0
+    lui $t2, 0x1000
+    sw $t0, 18048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xbc0
+    lui $t2, 0x1000
+    sw $t0, 18080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5080
+    lui $t2, 0x1000
+    sw $t0, 18112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7ee0
+    lui $t2, 0x1000
+    sw $t0, 18144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4900
+    lui $t2, 0x1000
+    sw $t0, 18176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3540
+    lui $t2, 0x1000
+    sw $t0, 18208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7560
+    lui $t2, 0x1000
+    sw $t0, 18240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x20e0
+    lui $t2, 0x1000
+    sw $t0, 18272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d80
+    lui $t2, 0x1000
+    sw $t0, 18304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b00
+    lui $t2, 0x1000
+    sw $t0, 18336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4180
+    lui $t2, 0x1000
+    sw $t0, 18368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x63a0
+    lui $t2, 0x1000
+    sw $t0, 18400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1800
+    lui $t2, 0x1000
+    sw $t0, 18432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a00
+    lui $t2, 0x1000
+    sw $t0, 18464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x25e0
+    lui $t2, 0x1000
+    sw $t0, 18496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7740
+    lui $t2, 0x1000
+    sw $t0, 18528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1cc0
+    lui $t2, 0x1000
+    sw $t0, 18560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x71a0
+    lui $t2, 0x1000
+    sw $t0, 18592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x700
+    lui $t2, 0x1000
+    sw $t0, 18624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1140
+    lui $t2, 0x1000
+    sw $t0, 18656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ec0
+    lui $t2, 0x1000
+    sw $t0, 18688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b00
+    lui $t2, 0x1000
+    sw $t0, 18720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf40
+    lui $t2, 0x1000
+    sw $t0, 18752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ec0
+    lui $t2, 0x1000
+    sw $t0, 18784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x69e0
+    lui $t2, 0x1000
+    sw $t0, 18816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7aa0
+    lui $t2, 0x1000
+    sw $t0, 18848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5680
+    lui $t2, 0x1000
+    sw $t0, 18880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x46c0
+    lui $t2, 0x1000
+    sw $t0, 18912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2c20
+    lui $t2, 0x1000
+    sw $t0, 18944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c00
+    lui $t2, 0x1000
+    sw $t0, 18976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5720
+    lui $t2, 0x1000
+    sw $t0, 19008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x51e0
+    lui $t2, 0x1000
+    sw $t0, 19040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ba0
+    lui $t2, 0x1000
+    sw $t0, 19072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 224
+    lui $t2, 0x1000
+    sw $t0, 19104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b60
+    lui $t2, 0x1000
+    sw $t0, 19136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4680
+    lui $t2, 0x1000
+    sw $t0, 19168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x21e0
+    lui $t2, 0x1000
+    sw $t0, 19200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1ec0
+    lui $t2, 0x1000
+    sw $t0, 19232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2460
+    lui $t2, 0x1000
+    sw $t0, 19264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf00
+    lui $t2, 0x1000
+    sw $t0, 19296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3260
+    lui $t2, 0x1000
+    sw $t0, 19328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e0
+    lui $t2, 0x1000
+    sw $t0, 19360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d60
+    lui $t2, 0x1000
+    sw $t0, 19392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x100
+    lui $t2, 0x1000
+    sw $t0, 19424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ec0
+    lui $t2, 0x1000
+    sw $t0, 19456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e80
+    lui $t2, 0x1000
+    sw $t0, 19488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7b40
+    lui $t2, 0x1000
+    sw $t0, 19520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3440
+    lui $t2, 0x1000
+    sw $t0, 19552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7000
+    lui $t2, 0x1000
+    sw $t0, 19584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6760
+    lui $t2, 0x1000
+    sw $t0, 19616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6f40
+    lui $t2, 0x1000
+    sw $t0, 19648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ac0
+    lui $t2, 0x1000
+    sw $t0, 19680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x160
+    lui $t2, 0x1000
+    sw $t0, 19712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x21a0
+    lui $t2, 0x1000
+    sw $t0, 19744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6fc0
+    lui $t2, 0x1000
+    sw $t0, 19776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x53c0
+    lui $t2, 0x1000
+    sw $t0, 19808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c00
+    lui $t2, 0x1000
+    sw $t0, 19840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e00
+    lui $t2, 0x1000
+    sw $t0, 19872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x70c0
+    lui $t2, 0x1000
+    sw $t0, 19904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3780
+    lui $t2, 0x1000
+    sw $t0, 19936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ce0
+    lui $t2, 0x1000
+    sw $t0, 19968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfc0
+    lui $t2, 0x1000
+    sw $t0, 20000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2680
+    lui $t2, 0x1000
+    sw $t0, 20032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x29c0
+    lui $t2, 0x1000
+    sw $t0, 20064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x64c0
+    lui $t2, 0x1000
+    sw $t0, 20096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x33a0
+    lui $t2, 0x1000
+    sw $t0, 20128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ca0
+    lui $t2, 0x1000
+    sw $t0, 20160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7760
+    lui $t2, 0x1000
+    sw $t0, 20192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x44c0
+    lui $t2, 0x1000
+    sw $t0, 20224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x37c0
+    lui $t2, 0x1000
+    sw $t0, 20256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x37e0
+    lui $t2, 0x1000
+    sw $t0, 20288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7cc0
+    lui $t2, 0x1000
+    sw $t0, 20320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7320
+    lui $t2, 0x1000
+    sw $t0, 20352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x420
+    lui $t2, 0x1000
+    sw $t0, 20384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1600
+    lui $t2, 0x1000
+    sw $t0, 20416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4540
+    lui $t2, 0x1000
+    sw $t0, 20448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xe20
+    lui $t2, 0x1000
+    sw $t0, 20480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5620
+    lui $t2, 0x1000
+    sw $t0, 20512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1100
+    lui $t2, 0x1000
+    sw $t0, 20544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5fe0
+    lui $t2, 0x1000
+    sw $t0, 20576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x69a0
+    lui $t2, 0x1000
+    sw $t0, 20608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x17e0
+    lui $t2, 0x1000
+    sw $t0, 20640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c40
+    lui $t2, 0x1000
+    sw $t0, 20672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6bc0
+    lui $t2, 0x1000
+    sw $t0, 20704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x74c0
+    lui $t2, 0x1000
+    sw $t0, 20736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5fa0
+    lui $t2, 0x1000
+    sw $t0, 20768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a20
+    lui $t2, 0x1000
+    sw $t0, 20800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1d80
+    lui $t2, 0x1000
+    sw $t0, 20832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5040
+    lui $t2, 0x1000
+    sw $t0, 20864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6280
+    lui $t2, 0x1000
+    sw $t0, 20896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x34e0
+    lui $t2, 0x1000
+    sw $t0, 20928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x180
+    lui $t2, 0x1000
+    sw $t0, 20960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4960
+    lui $t2, 0x1000
+    sw $t0, 20992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a20
+    lui $t2, 0x1000
+    sw $t0, 21024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7620
+    lui $t2, 0x1000
+    sw $t0, 21056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7700
+    lui $t2, 0x1000
+    sw $t0, 21088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x53a0
+    lui $t2, 0x1000
+    sw $t0, 21120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5020
+    lui $t2, 0x1000
+    sw $t0, 21152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b40
+    lui $t2, 0x1000
+    sw $t0, 21184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3280
+    lui $t2, 0x1000
+    sw $t0, 21216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2300
+    lui $t2, 0x1000
+    sw $t0, 21248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4320
+    lui $t2, 0x1000
+    sw $t0, 21280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x360
+    lui $t2, 0x1000
+    sw $t0, 21312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3bc0
+    lui $t2, 0x1000
+    sw $t0, 21344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c80
+    lui $t2, 0x1000
+    sw $t0, 21376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7340
+    lui $t2, 0x1000
+    sw $t0, 21408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2560
+    lui $t2, 0x1000
+    sw $t0, 21440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x16e0
+    lui $t2, 0x1000
+    sw $t0, 21472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x48c0
+    lui $t2, 0x1000
+    sw $t0, 21504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6dc0
+    lui $t2, 0x1000
+    sw $t0, 21536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa60
+    lui $t2, 0x1000
+    sw $t0, 21568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x59e0
+    lui $t2, 0x1000
+    sw $t0, 21600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2280
+    lui $t2, 0x1000
+    sw $t0, 21632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c00
+    lui $t2, 0x1000
+    sw $t0, 21664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a00
+    lui $t2, 0x1000
+    sw $t0, 21696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x67e0
+    lui $t2, 0x1000
+    sw $t0, 21728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3840
+    lui $t2, 0x1000
+    sw $t0, 21760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3520
+    lui $t2, 0x1000
+    sw $t0, 21792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd60
+    lui $t2, 0x1000
+    sw $t0, 21824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3dc0
+    lui $t2, 0x1000
+    sw $t0, 21856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x560
+    lui $t2, 0x1000
+    sw $t0, 21888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5600
+    lui $t2, 0x1000
+    sw $t0, 21920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf60
+    lui $t2, 0x1000
+    sw $t0, 21952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a40
+    lui $t2, 0x1000
+    sw $t0, 21984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4660
+    lui $t2, 0x1000
+    sw $t0, 22016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f40
+    lui $t2, 0x1000
+    sw $t0, 22048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x440
+    lui $t2, 0x1000
+    sw $t0, 22080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6360
+    lui $t2, 0x1000
+    sw $t0, 22112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x32a0
+    lui $t2, 0x1000
+    sw $t0, 22144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4720
+    lui $t2, 0x1000
+    sw $t0, 22176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1da0
+    lui $t2, 0x1000
+    sw $t0, 22208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x40e0
+    lui $t2, 0x1000
+    sw $t0, 22240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d80
+    lui $t2, 0x1000
+    sw $t0, 22272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ea0
+    lui $t2, 0x1000
+    sw $t0, 22304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x65e0
+    lui $t2, 0x1000
+    sw $t0, 22336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d20
+    lui $t2, 0x1000
+    sw $t0, 22368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a20
+    lui $t2, 0x1000
+    sw $t0, 22400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x58c0
+    lui $t2, 0x1000
+    sw $t0, 22432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3d40
+    lui $t2, 0x1000
+    sw $t0, 22464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x30e0
+    lui $t2, 0x1000
+    sw $t0, 22496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x51a0
+    lui $t2, 0x1000
+    sw $t0, 22528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e00
+    lui $t2, 0x1000
+    sw $t0, 22560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3240
+    lui $t2, 0x1000
+    sw $t0, 22592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x23c0
+    lui $t2, 0x1000
+    sw $t0, 22624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1420
+    lui $t2, 0x1000
+    sw $t0, 22656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7400
+    lui $t2, 0x1000
+    sw $t0, 22688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8c0
+    lui $t2, 0x1000
+    sw $t0, 22720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f00
+    lui $t2, 0x1000
+    sw $t0, 22752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x50c0
+    lui $t2, 0x1000
+    sw $t0, 22784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 96
+    lui $t2, 0x1000
+    sw $t0, 22816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x29a0
+    lui $t2, 0x1000
+    sw $t0, 22848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e60
+    lui $t2, 0x1000
+    sw $t0, 22880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x24c0
+    lui $t2, 0x1000
+    sw $t0, 22912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4dc0
+    lui $t2, 0x1000
+    sw $t0, 22944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4140
+    lui $t2, 0x1000
+    sw $t0, 22976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x62a0
+    lui $t2, 0x1000
+    sw $t0, 23008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x73e0
+    lui $t2, 0x1000
+    sw $t0, 23040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2780
+    lui $t2, 0x1000
+    sw $t0, 23072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c60
+    lui $t2, 0x1000
+    sw $t0, 23104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d60
+    lui $t2, 0x1000
+    sw $t0, 23136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1360
+    lui $t2, 0x1000
+    sw $t0, 23168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f00
+    lui $t2, 0x1000
+    sw $t0, 23200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x41c0
+    lui $t2, 0x1000
+    sw $t0, 23232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x280
+    lui $t2, 0x1000
+    sw $t0, 23264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x58a0
+    lui $t2, 0x1000
+    sw $t0, 23296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c20
+    lui $t2, 0x1000
+    sw $t0, 23328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a40
+    lui $t2, 0x1000
+    sw $t0, 23360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7020
+    lui $t2, 0x1000
+    sw $t0, 23392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5b60
+    lui $t2, 0x1000
+    sw $t0, 23424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x12e0
+    lui $t2, 0x1000
+    sw $t0, 23456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x27c0
+    lui $t2, 0x1000
+    sw $t0, 23488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a40
+    lui $t2, 0x1000
+    sw $t0, 23520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f00
+    lui $t2, 0x1000
+    sw $t0, 23552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a0
+    lui $t2, 0x1000
+    sw $t0, 23584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4940
+    lui $t2, 0x1000
+    sw $t0, 23616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2220
+    lui $t2, 0x1000
+    sw $t0, 23648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3b20
+    lui $t2, 0x1000
+    sw $t0, 23680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x23a0
+    lui $t2, 0x1000
+    sw $t0, 23712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x50a0
+    lui $t2, 0x1000
+    sw $t0, 23744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a80
+    lui $t2, 0x1000
+    sw $t0, 23776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3620
+    lui $t2, 0x1000
+    sw $t0, 23808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2b00
+    lui $t2, 0x1000
+    sw $t0, 23840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4fa0
+    lui $t2, 0x1000
+    sw $t0, 23872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4e00
+    lui $t2, 0x1000
+    sw $t0, 23904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2080
+    lui $t2, 0x1000
+    sw $t0, 23936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2340
+    lui $t2, 0x1000
+    sw $t0, 23968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f40
+    lui $t2, 0x1000
+    sw $t0, 24000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ec0
+    lui $t2, 0x1000
+    sw $t0, 24032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6640
+    lui $t2, 0x1000
+    sw $t0, 24064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x50e0
+    lui $t2, 0x1000
+    sw $t0, 24096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8e0
+    lui $t2, 0x1000
+    sw $t0, 24128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6700
+    lui $t2, 0x1000
+    sw $t0, 24160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5660
+    lui $t2, 0x1000
+    sw $t0, 24192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2100
+    lui $t2, 0x1000
+    sw $t0, 24224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x600
+    lui $t2, 0x1000
+    sw $t0, 24256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6920
+    lui $t2, 0x1000
+    sw $t0, 24288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ce0
+    lui $t2, 0x1000
+    sw $t0, 24320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xf80
+    lui $t2, 0x1000
+    sw $t0, 24352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f20
+    lui $t2, 0x1000
+    sw $t0, 24384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2420
+    lui $t2, 0x1000
+    sw $t0, 24416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c60
+    lui $t2, 0x1000
+    sw $t0, 24448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ca0
+    lui $t2, 0x1000
+    sw $t0, 24480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x20a0
+    lui $t2, 0x1000
+    sw $t0, 24512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x68c0
+    lui $t2, 0x1000
+    sw $t0, 24544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3800
+    lui $t2, 0x1000
+    sw $t0, 24576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1fe0
+    lui $t2, 0x1000
+    sw $t0, 24608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2de0
+    lui $t2, 0x1000
+    sw $t0, 24640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4f60
+    lui $t2, 0x1000
+    sw $t0, 24672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x52c0
+    lui $t2, 0x1000
+    sw $t0, 24704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e0
+    lui $t2, 0x1000
+    sw $t0, 24736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x60a0
+    lui $t2, 0x1000
+    sw $t0, 24768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b20
+    lui $t2, 0x1000
+    sw $t0, 24800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5940
+    lui $t2, 0x1000
+    sw $t0, 24832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3300
+    lui $t2, 0x1000
+    sw $t0, 24864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x39e0
+    lui $t2, 0x1000
+    sw $t0, 24896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xa20
+    lui $t2, 0x1000
+    sw $t0, 24928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f80
+    lui $t2, 0x1000
+    sw $t0, 24960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4de0
+    lui $t2, 0x1000
+    sw $t0, 24992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e80
+    lui $t2, 0x1000
+    sw $t0, 25024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x66c0
+    lui $t2, 0x1000
+    sw $t0, 25056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ac0
+    lui $t2, 0x1000
+    sw $t0, 25088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1fc0
+    lui $t2, 0x1000
+    sw $t0, 25120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x61a0
+    lui $t2, 0x1000
+    sw $t0, 25152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x52a0
+    lui $t2, 0x1000
+    sw $t0, 25184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b80
+    lui $t2, 0x1000
+    sw $t0, 25216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x42e0
+    lui $t2, 0x1000
+    sw $t0, 25248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1a0
+    lui $t2, 0x1000
+    sw $t0, 25280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x56a0
+    lui $t2, 0x1000
+    sw $t0, 25312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2700
+    lui $t2, 0x1000
+    sw $t0, 25344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e60
+    lui $t2, 0x1000
+    sw $t0, 25376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x22a0
+    lui $t2, 0x1000
+    sw $t0, 25408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a00
+    lui $t2, 0x1000
+    sw $t0, 25440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x44e0
+    lui $t2, 0x1000
+    sw $t0, 25472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4280
+    lui $t2, 0x1000
+    sw $t0, 25504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xde0
+    lui $t2, 0x1000
+    sw $t0, 25536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd80
+    lui $t2, 0x1000
+    sw $t0, 25568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4c80
+    lui $t2, 0x1000
+    sw $t0, 25600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x45a0
+    lui $t2, 0x1000
+    sw $t0, 25632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x79e0
+    lui $t2, 0x1000
+    sw $t0, 25664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3120
+    lui $t2, 0x1000
+    sw $t0, 25696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6580
+    lui $t2, 0x1000
+    sw $t0, 25728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5060
+    lui $t2, 0x1000
+    sw $t0, 25760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4fe0
+    lui $t2, 0x1000
+    sw $t0, 25792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6d60
+    lui $t2, 0x1000
+    sw $t0, 25824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x30a0
+    lui $t2, 0x1000
+    sw $t0, 25856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x73c0
+    lui $t2, 0x1000
+    sw $t0, 25888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5180
+    lui $t2, 0x1000
+    sw $t0, 25920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2740
+    lui $t2, 0x1000
+    sw $t0, 25952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e40
+    lui $t2, 0x1000
+    sw $t0, 25984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6fa0
+    lui $t2, 0x1000
+    sw $t0, 26016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1480
+    lui $t2, 0x1000
+    sw $t0, 26048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a40
+    lui $t2, 0x1000
+    sw $t0, 26080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x64e0
+    lui $t2, 0x1000
+    sw $t0, 26112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f40
+    lui $t2, 0x1000
+    sw $t0, 26144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7860
+    lui $t2, 0x1000
+    sw $t0, 26176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4920
+    lui $t2, 0x1000
+    sw $t0, 26208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6880
+    lui $t2, 0x1000
+    sw $t0, 26240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3340
+    lui $t2, 0x1000
+    sw $t0, 26272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c80
+    lui $t2, 0x1000
+    sw $t0, 26304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x26a0
+    lui $t2, 0x1000
+    sw $t0, 26336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7580
+    lui $t2, 0x1000
+    sw $t0, 26368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d20
+    lui $t2, 0x1000
+    sw $t0, 26400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x24e0
+    lui $t2, 0x1000
+    sw $t0, 26432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7920
+    lui $t2, 0x1000
+    sw $t0, 26464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3900
+    lui $t2, 0x1000
+    sw $t0, 26496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x41a0
+    lui $t2, 0x1000
+    sw $t0, 26528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6c40
+    lui $t2, 0x1000
+    sw $t0, 26560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1560
+    lui $t2, 0x1000
+    sw $t0, 26592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x49e0
+    lui $t2, 0x1000
+    sw $t0, 26624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e20
+    lui $t2, 0x1000
+    sw $t0, 26656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3ee0
+    lui $t2, 0x1000
+    sw $t0, 26688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6160
+    lui $t2, 0x1000
+    sw $t0, 26720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5ce0
+    lui $t2, 0x1000
+    sw $t0, 26752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4480
+    lui $t2, 0x1000
+    sw $t0, 26784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6600
+    lui $t2, 0x1000
+    sw $t0, 26816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x75e0
+    lui $t2, 0x1000
+    sw $t0, 26848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x13a0
+    lui $t2, 0x1000
+    sw $t0, 26880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6460
+    lui $t2, 0x1000
+    sw $t0, 26912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1be0
+    lui $t2, 0x1000
+    sw $t0, 26944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2240
+    lui $t2, 0x1000
+    sw $t0, 26976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ec0
+    lui $t2, 0x1000
+    sw $t0, 27008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6fe0
+    lui $t2, 0x1000
+    sw $t0, 27040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x56e0
+    lui $t2, 0x1000
+    sw $t0, 27072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xcc0
+    lui $t2, 0x1000
+    sw $t0, 27104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x120
+    lui $t2, 0x1000
+    sw $t0, 27136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4ee0
+    lui $t2, 0x1000
+    sw $t0, 27168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4100
+    lui $t2, 0x1000
+    sw $t0, 27200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xb00
+    lui $t2, 0x1000
+    sw $t0, 27232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x66a0
+    lui $t2, 0x1000
+    sw $t0, 27264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1280
+    lui $t2, 0x1000
+    sw $t0, 27296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5700
+    lui $t2, 0x1000
+    sw $t0, 27328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a80
+    lui $t2, 0x1000
+    sw $t0, 27360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7260
+    lui $t2, 0x1000
+    sw $t0, 27392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x32c0
+    lui $t2, 0x1000
+    sw $t0, 27424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3560
+    lui $t2, 0x1000
+    sw $t0, 27456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xee0
+    lui $t2, 0x1000
+    sw $t0, 27488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e0
+    lui $t2, 0x1000
+    sw $t0, 27520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x42c0
+    lui $t2, 0x1000
+    sw $t0, 27552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2920
+    lui $t2, 0x1000
+    sw $t0, 27584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2000
+    lui $t2, 0x1000
+    sw $t0, 27616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x460
+    lui $t2, 0x1000
+    sw $t0, 27648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x31c0
+    lui $t2, 0x1000
+    sw $t0, 27680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3680
+    lui $t2, 0x1000
+    sw $t0, 27712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4000
+    lui $t2, 0x1000
+    sw $t0, 27744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x48e0
+    lui $t2, 0x1000
+    sw $t0, 27776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5a20
+    lui $t2, 0x1000
+    sw $t0, 27808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2f40
+    lui $t2, 0x1000
+    sw $t0, 27840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5480
+    lui $t2, 0x1000
+    sw $t0, 27872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x220
+    lui $t2, 0x1000
+    sw $t0, 27904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4700
+    lui $t2, 0x1000
+    sw $t0, 27936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b80
+    lui $t2, 0x1000
+    sw $t0, 27968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b80
+    lui $t2, 0x1000
+    sw $t0, 28000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7220
+    lui $t2, 0x1000
+    sw $t0, 28032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x12a0
+    lui $t2, 0x1000
+    sw $t0, 28064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7960
+    lui $t2, 0x1000
+    sw $t0, 28096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x47c0
+    lui $t2, 0x1000
+    sw $t0, 28128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6040
+    lui $t2, 0x1000
+    sw $t0, 28160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5cc0
+    lui $t2, 0x1000
+    sw $t0, 28192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c40
+    lui $t2, 0x1000
+    sw $t0, 28224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6220
+    lui $t2, 0x1000
+    sw $t0, 28256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xec0
+    lui $t2, 0x1000
+    sw $t0, 28288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x10e0
+    lui $t2, 0x1000
+    sw $t0, 28320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfa0
+    lui $t2, 0x1000
+    sw $t0, 28352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6380
+    lui $t2, 0x1000
+    sw $t0, 28384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x78c0
+    lui $t2, 0x1000
+    sw $t0, 28416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4a80
+    lui $t2, 0x1000
+    sw $t0, 28448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2cc0
+    lui $t2, 0x1000
+    sw $t0, 28480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1f60
+    lui $t2, 0x1000
+    sw $t0, 28512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c80
+    lui $t2, 0x1000
+    sw $t0, 28544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x43c0
+    lui $t2, 0x1000
+    sw $t0, 28576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4be0
+    lui $t2, 0x1000
+    sw $t0, 28608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e60
+    lui $t2, 0x1000
+    sw $t0, 28640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5980
+    lui $t2, 0x1000
+    sw $t0, 28672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7c00
+    lui $t2, 0x1000
+    sw $t0, 28704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4620
+    lui $t2, 0x1000
+    sw $t0, 28736($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2380
+    lui $t2, 0x1000
+    sw $t0, 28768($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5120
+    lui $t2, 0x1000
+    sw $t0, 28800($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e0
+    lui $t2, 0x1000
+    sw $t0, 28832($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2040
+    lui $t2, 0x1000
+    sw $t0, 28864($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7840
+    lui $t2, 0x1000
+    sw $t0, 28896($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4b40
+    lui $t2, 0x1000
+    sw $t0, 28928($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7280
+    lui $t2, 0x1000
+    sw $t0, 28960($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4980
+    lui $t2, 0x1000
+    sw $t0, 28992($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b60
+    lui $t2, 0x1000
+    sw $t0, 29024($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3a40
+    lui $t2, 0x1000
+    sw $t0, 29056($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x18a0
+    lui $t2, 0x1000
+    sw $t0, 29088($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4520
+    lui $t2, 0x1000
+    sw $t0, 29120($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5400
+    lui $t2, 0x1000
+    sw $t0, 29152($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x58e0
+    lui $t2, 0x1000
+    sw $t0, 29184($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xba0
+    lui $t2, 0x1000
+    sw $t0, 29216($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2dc0
+    lui $t2, 0x1000
+    sw $t0, 29248($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3c0
+    lui $t2, 0x1000
+    sw $t0, 29280($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1e40
+    lui $t2, 0x1000
+    sw $t0, 29312($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5260
+    lui $t2, 0x1000
+    sw $t0, 29344($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2aa0
+    lui $t2, 0x1000
+    sw $t0, 29376($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6400
+    lui $t2, 0x1000
+    sw $t0, 29408($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2320
+    lui $t2, 0x1000
+    sw $t0, 29440($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4840
+    lui $t2, 0x1000
+    sw $t0, 29472($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3580
+    lui $t2, 0x1000
+    sw $t0, 29504($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6ba0
+    lui $t2, 0x1000
+    sw $t0, 29536($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xd20
+    lui $t2, 0x1000
+    sw $t0, 29568($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x17c0
+    lui $t2, 0x1000
+    sw $t0, 29600($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x68e0
+    lui $t2, 0x1000
+    sw $t0, 29632($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4640
+    lui $t2, 0x1000
+    sw $t0, 29664($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6e80
+    lui $t2, 0x1000
+    sw $t0, 29696($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x38e0
+    lui $t2, 0x1000
+    sw $t0, 29728($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4800
+    lui $t2, 0x1000
+    sw $t0, 29760($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5dc0
+    lui $t2, 0x1000
+    sw $t0, 29792($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4260
+    lui $t2, 0x1000
+    sw $t0, 29824($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3880
+    lui $t2, 0x1000
+    sw $t0, 29856($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x660
+    lui $t2, 0x1000
+    sw $t0, 29888($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x500
+    lui $t2, 0x1000
+    sw $t0, 29920($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xfe0
+    lui $t2, 0x1000
+    sw $t0, 29952($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5300
+    lui $t2, 0x1000
+    sw $t0, 29984($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5740
+    lui $t2, 0x1000
+    sw $t0, 30016($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b40
+    lui $t2, 0x1000
+    sw $t0, 30048($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2260
+    lui $t2, 0x1000
+    sw $t0, 30080($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3e40
+    lui $t2, 0x1000
+    sw $t0, 30112($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7940
+    lui $t2, 0x1000
+    sw $t0, 30144($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d40
+    lui $t2, 0x1000
+    sw $t0, 30176($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x8a0
+    lui $t2, 0x1000
+    sw $t0, 30208($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4740
+    lui $t2, 0x1000
+    sw $t0, 30240($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e0
+    lui $t2, 0x1000
+    sw $t0, 30272($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2360
+    lui $t2, 0x1000
+    sw $t0, 30304($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2860
+    lui $t2, 0x1000
+    sw $t0, 30336($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2520
+    lui $t2, 0x1000
+    sw $t0, 30368($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6800
+    lui $t2, 0x1000
+    sw $t0, 30400($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3f40
+    lui $t2, 0x1000
+    sw $t0, 30432($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6a60
+    lui $t2, 0x1000
+    sw $t0, 30464($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x67c0
+    lui $t2, 0x1000
+    sw $t0, 30496($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1460
+    lui $t2, 0x1000
+    sw $t0, 30528($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x9a0
+    lui $t2, 0x1000
+    sw $t0, 30560($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e00
+    lui $t2, 0x1000
+    sw $t0, 30592($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6680
+    lui $t2, 0x1000
+    sw $t0, 30624($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2d40
+    lui $t2, 0x1000
+    sw $t0, 30656($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2ba0
+    lui $t2, 0x1000
+    sw $t0, 30688($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x22c0
+    lui $t2, 0x1000
+    sw $t0, 30720($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6100
+    lui $t2, 0x1000
+    sw $t0, 30752($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x140
+    lui $t2, 0x1000
+    sw $t0, 30784($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2fe0
+    lui $t2, 0x1000
+    sw $t0, 30816($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2a60
+    lui $t2, 0x1000
+    sw $t0, 30848($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x75a0
+    lui $t2, 0x1000
+    sw $t0, 30880($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1200
+    lui $t2, 0x1000
+    sw $t0, 30912($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5840
+    lui $t2, 0x1000
+    sw $t0, 30944($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4bc0
+    lui $t2, 0x1000
+    sw $t0, 30976($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1260
+    lui $t2, 0x1000
+    sw $t0, 31008($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7e60
+    lui $t2, 0x1000
+    sw $t0, 31040($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x65c0
+    lui $t2, 0x1000
+    sw $t0, 31072($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c0
+    lui $t2, 0x1000
+    sw $t0, 31104($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x35a0
+    lui $t2, 0x1000
+    sw $t0, 31136($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4020
+    lui $t2, 0x1000
+    sw $t0, 31168($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7780
+    lui $t2, 0x1000
+    sw $t0, 31200($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x78e0
+    lui $t2, 0x1000
+    sw $t0, 31232($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5f00
+    lui $t2, 0x1000
+    sw $t0, 31264($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x55a0
+    lui $t2, 0x1000
+    sw $t0, 31296($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3820
+    lui $t2, 0x1000
+    sw $t0, 31328($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x24a0
+    lui $t2, 0x1000
+    sw $t0, 31360($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1780
+    lui $t2, 0x1000
+    sw $t0, 31392($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x680
+    lui $t2, 0x1000
+    sw $t0, 31424($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2e20
+    lui $t2, 0x1000
+    sw $t0, 31456($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x76a0
+    lui $t2, 0x1000
+    sw $t0, 31488($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5320
+    lui $t2, 0x1000
+    sw $t0, 31520($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1aa0
+    lui $t2, 0x1000
+    sw $t0, 31552($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7460
+    lui $t2, 0x1000
+    sw $t0, 31584($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6b20
+    lui $t2, 0x1000
+    sw $t0, 31616($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x35c0
+    lui $t2, 0x1000
+    sw $t0, 31648($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7d20
+    lui $t2, 0x1000
+    sw $t0, 31680($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1380
+    lui $t2, 0x1000
+    sw $t0, 31712($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4d40
+    lui $t2, 0x1000
+    sw $t0, 31744($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x72c0
+    lui $t2, 0x1000
+    sw $t0, 31776($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1b60
+    lui $t2, 0x1000
+    sw $t0, 31808($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x14a0
+    lui $t2, 0x1000
+    sw $t0, 31840($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x27a0
+    lui $t2, 0x1000
+    sw $t0, 31872($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3400
+    lui $t2, 0x1000
+    sw $t0, 31904($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4580
+    lui $t2, 0x1000
+    sw $t0, 31936($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2160
+    lui $t2, 0x1000
+    sw $t0, 31968($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5e40
+    lui $t2, 0x1000
+    sw $t0, 32000($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7140
+    lui $t2, 0x1000
+    sw $t0, 32032($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5540
+    lui $t2, 0x1000
+    sw $t0, 32064($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1900
+    lui $t2, 0x1000
+    sw $t0, 32096($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d40
+    lui $t2, 0x1000
+    sw $t0, 32128($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5d00
+    lui $t2, 0x1000
+    sw $t0, 32160($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x61c0
+    lui $t2, 0x1000
+    sw $t0, 32192($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x6720
+    lui $t2, 0x1000
+    sw $t0, 32224($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x4160
+    lui $t2, 0x1000
+    sw $t0, 32256($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x54c0
+    lui $t2, 0x1000
+    sw $t0, 32288($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0xc60
+    lui $t2, 0x1000
+    sw $t0, 32320($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x34c0
+    lui $t2, 0x1000
+    sw $t0, 32352($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x35e0
+    lui $t2, 0x1000
+    sw $t0, 32384($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x2900
+    lui $t2, 0x1000
+    sw $t0, 32416($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c20
+    lui $t2, 0x1000
+    sw $t0, 32448($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7a60
+    lui $t2, 0x1000
+    sw $t0, 32480($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x66e0
+    lui $t2, 0x1000
+    sw $t0, 32512($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x46a0
+    lui $t2, 0x1000
+    sw $t0, 32544($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x3320
+    lui $t2, 0x1000
+    sw $t0, 32576($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1c80
+    lui $t2, 0x1000
+    sw $t0, 32608($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c60
+    lui $t2, 0x1000
+    sw $t0, 32640($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x7120
+    lui $t2, 0x1000
+    sw $t0, 32672($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x1220
+    lui $t2, 0x1000
+    sw $t0, 32704($t2)
+    lui $t0, 0x1000
+    ori $t0, $t0, 0x5c00
+    lui $t2, 0x1000
+    sw $t0, 32736($t2)
+    addu $t0, $s0, $zero
+loop:
+    lw $t0, 0($t0)
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
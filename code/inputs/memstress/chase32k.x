@@ -0,0 +1,4103 @@
+3c101000
+34098000
+3c081000
+350818c0
+3c0a1000
+ad480000
+3c081000
+350859a0
+3c0a1000
+ad480020
+3c081000
+35082c60
+3c0a1000
+ad480040
+3c081000
+35086240
+3c0a1000
+ad480060
+3c081000
+35084b60
+3c0a1000
+ad480080
+3c081000
+35085c40
+3c0a1000
+ad4800a0
+3c081000
+35085d60
+3c0a1000
+ad4800c0
+3c081000
+350871e0
+3c0a1000
+ad4800e0
+3c081000
+35086aa0
+3c0a1000
+ad480100
+3c081000
+350810c0
+3c0a1000
+ad480120
+3c081000
+35084560
+3c0a1000
+ad480140
+3c081000
+35080380
+3c0a1000
+ad480160
+3c081000
+35083980
+3c0a1000
+ad480180
+3c081000
+35081d20
+3c0a1000
+ad4801a0
+3c081000
+35086200
+3c0a1000
+ad4801c0
+3c081000
+35083a00
+3c0a1000
+ad4801e0
+3c081000
+350874a0
+3c0a1000
+ad480200
+3c081000
+35085460
+3c0a1000
+ad480220
+3c081000
+35080ac0
+3c0a1000
+ad480240
+3c081000
+35081ce0
+3c0a1000
+ad480260
+3c081000
+35087600
+3c0a1000
+ad480280
+3c081000
+35086f60
+3c0a1000
+ad4802a0
+3c081000
+35083760
+3c0a1000
+ad4802c0
+3c081000
+35080400
+3c0a1000
+ad4802e0
+3c081000
+35081620
+3c0a1000
+ad480300
+3c081000
+35080ea0
+3c0a1000
+ad480320
+3c081000
+35084a60
+3c0a1000
+ad480340
+3c081000
+350802e0
+3c0a1000
+ad480360
+3c081000
+35084c40
+3c0a1000
+ad480380
+3c081000
+35084ce0
+3c0a1000
+ad4803a0
+3c081000
+35083e80
+3c0a1000
+ad4803c0
+3c081000
+35085de0
+3c0a1000
+ad4803e0
+3c081000
+350828c0
+3c0a1000
+ad480400
+3c081000
+350831e0
+3c0a1000
+ad480420
+3c081000
+35087f20
+3c0a1000
+ad480440
+3c081000
+35086740
+3c0a1000
+ad480460
+3c081000
+35086d40
+3c0a1000
+ad480480
+3c081000
+350812c0
+3c0a1000
+ad4804a0
+3c081000
+35081760
+3c0a1000
+ad4804c0
+3c081000
+35086a00
+3c0a1000
+ad4804e0
+3c081000
+35081d00
+3c0a1000
+ad480500
+3c081000
+35087540
+3c0a1000
+ad480520
+3c081000
+35080860
+3c0a1000
+ad480540
+3c081000
+35086ac0
+3c0a1000
+ad480560
+3c081000
+35082620
+3c0a1000
+ad480580
+3c081000
+35083c20
+3c0a1000
+ad4805a0
+3c081000
+35085b40
+3c0a1000
+ad4805c0
+3c081000
+35087060
+3c0a1000
+ad4805e0
+3c081000
+35085800
+3c0a1000
+ad480600
+3c081000
+35081b40
+3c0a1000
+ad480620
+3c081000
+35081a00
+3c0a1000
+ad480640
+3c081000
+35087980
+3c0a1000
+ad480660
+3c081000
+35082840
+3c0a1000
+ad480680
+3c081000
+350837a0
+3c0a1000
+ad4806a0
+3c081000
+35083ca0
+3c0a1000
+ad4806c0
+3c081000
+35085440
+3c0a1000
+ad4806e0
+3c081000
+35086e00
+3c0a1000
+ad480700
+3c081000
+35087dc0
+3c0a1000
+ad480720
+3c081000
+350836a0
+3c0a1000
+ad480740
+3c081000
+35085a60
+3c0a1000
+ad480760
+3c081000
+350872e0
+3c0a1000
+ad480780
+3c081000
+35085e20
+3c0a1000
+ad4807a0
+3c081000
+35080da0
+3c0a1000
+ad4807c0
+3c081000
+35081b00
+3c0a1000
+ad4807e0
+3c081000
+35080580
+3c0a1000
+ad480800
+3c081000
+350861e0
+3c0a1000
+ad480820
+3c081000
+35087f40
+3c0a1000
+ad480840
+3c081000
+35081e20
+3c0a1000
+ad480860
+3c081000
+35080b40
+3c0a1000
+ad480880
+3c081000
+35086540
+3c0a1000
+ad4808a0
+3c081000
+35082980
+3c0a1000
+ad4808c0
+3c081000
+350877a0
+3c0a1000
+ad4808e0
+3c081000
+35082540
+3c0a1000
+ad480900
+3c081000
+35085640
+3c0a1000
+ad480920
+3c081000
+35086780
+3c0a1000
+ad480940
+3c081000
+35083420
+3c0a1000
+ad480960
+3c081000
+35081240
+3c0a1000
+ad480980
+3c081000
+35086260
+3c0a1000
+ad4809a0
+3c081000
+35086f80
+3c0a1000
+ad4809c0
+3c081000
+35086560
+3c0a1000
+ad4809e0
+3c081000
+35083660
+3c0a1000
+ad480a00
+3c081000
+35086440
+3c0a1000
+ad480a20
+3c081000
+350817a0
+3c0a1000
+ad480a40
+3c081000
+350821c0
+3c0a1000
+ad480a60
+3c081000
+35084880
+3c0a1000
+ad480a80
+3c081000
+35087660
+3c0a1000
+ad480aa0
+3c081000
+35080920
+3c0a1000
+ad480ac0
+3c081000
+35080540
+3c0a1000
+ad480ae0
+3c081000
+350879a0
+3c0a1000
+ad480b00
+3c081000
+35083000
+3c0a1000
+ad480b20
+3c081000
+35085a80
+3c0a1000
+ad480b40
+3c081000
+35080080
+3c0a1000
+ad480b60
+3c081000
+35086480
+3c0a1000
+ad480b80
+3c081000
+35083960
+3c0a1000
+ad480ba0
+3c081000
+35081740
+3c0a1000
+ad480bc0
+3c081000
+35080d00
+3c0a1000
+ad480be0
+3c081000
+35084d80
+3c0a1000
+ad480c00
+3c081000
+35081ae0
+3c0a1000
+ad480c20
+3c081000
+35087ca0
+3c0a1000
+ad480c40
+3c081000
+35087c40
+3c0a1000
+ad480c60
+3c081000
+35082440
+3c0a1000
+ad480c80
+3c081000
+35080780
+3c0a1000
+ad480ca0
+3c081000
+35082c80
+3c0a1000
+ad480cc0
+3c081000
+35085240
+3c0a1000
+ad480ce0
+3c081000
+35082ae0
+3c0a1000
+ad480d00
+3c081000
+35087900
+3c0a1000
+ad480d20
+3c081000
+35085aa0
+3c0a1000
+ad480d40
+3c081000
+35083f20
+3c0a1000
+ad480d60
+3c081000
+350800a0
+3c0a1000
+ad480d80
+3c081000
+35084360
+3c0a1000
+ad480da0
+3c081000
+35082720
+3c0a1000
+ad480dc0
+3c081000
+35084120
+3c0a1000
+ad480de0
+3c081000
+35082120
+3c0a1000
+ad480e00
+3c081000
+35086be0
+3c0a1000
+ad480e20
+3c081000
+35081520
+3c0a1000
+ad480e40
+3c081000
+35083a60
+3c0a1000
+ad480e60
+3c081000
+35082ee0
+3c0a1000
+ad480e80
+3c081000
+35083cc0
+3c0a1000
+ad480ea0
+3c081000
+35082bc0
+3c0a1000
+ad480ec0
+3c081000
+350814c0
+3c0a1000
+ad480ee0
+3c081000
+350805c0
+3c0a1000
+ad480f00
+3c081000
+350820c0
+3c0a1000
+ad480f20
+3c081000
+35083940
+3c0a1000
+ad480f40
+3c081000
+35080e80
+3c0a1000
+ad480f60
+3c081000
+35082600
+3c0a1000
+ad480f80
+3c081000
+35083020
+3c0a1000
+ad480fa0
+3c081000
+35084cc0
+3c0a1000
+ad480fc0
+3c081000
+35082ac0
+3c0a1000
+ad480fe0
+3c081000
+350811e0
+3c0a1000
+ad481000
+3c081000
+35082640
+3c0a1000
+ad481020
+3c081000
+350825a0
+3c0a1000
+ad481040
+3c081000
+35084d20
+3c0a1000
+ad481060
+3c081000
+350863e0
+3c0a1000
+ad481080
+3c081000
+350867a0
+3c0a1000
+ad4810a0
+3c081000
+35082060
+3c0a1000
+ad4810c0
+3c081000
+35084760
+3c0a1000
+ad4810e0
+3c081000
+350806c0
+3c0a1000
+ad481100
+3c081000
+35080ae0
+3c0a1000
+ad481120
+3c081000
+3c0a1000
+ad481140
+3c081000
+35084820
+3c0a1000
+ad481160
+3c081000
+35085c80
+3c0a1000
+ad481180
+3c081000
+350829e0
+3c0a1000
+ad4811a0
+3c081000
+35086840
+3c0a1000
+ad4811c0
+3c081000
+35081300
+3c0a1000
+ad4811e0
+3c081000
+35080ca0
+3c0a1000
+ad481200
+3c081000
+35081340
+3c0a1000
+ad481220
+3c081000
+35083720
+3c0a1000
+ad481240
+3c081000
+350813e0
+3c0a1000
+ad481260
+3c081000
+35080720
+3c0a1000
+ad481280
+3c081000
+35080c80
+3c0a1000
+ad4812a0
+3c081000
+350832e0
+3c0a1000
+ad4812c0
+3c081000
+350830c0
+3c0a1000
+ad4812e0
+3c081000
+35085be0
+3c0a1000
+ad481300
+3c081000
+35081400
+3c0a1000
+ad481320
+3c081000
+35081700
+3c0a1000
+ad481340
+3c081000
+35085780
+3c0a1000
+ad481360
+3c081000
+35085560
+3c0a1000
+ad481380
+3c081000
+35081680
+3c0a1000
+ad4813a0
+3c081000
+350876e0
+3c0a1000
+ad4813c0
+3c081000
+35082e60
+3c0a1000
+ad4813e0
+3c081000
+35087b80
+3c0a1000
+ad481400
+3c081000
+35085f60
+3c0a1000
+ad481420
+3c081000
+35086d00
+3c0a1000
+ad481440
+3c081000
+35085bc0
+3c0a1000
+ad481460
+3c081000
+35081580
+3c0a1000
+ad481480
+3c081000
+35085c20
+3c0a1000
+ad4814a0
+3c081000
+350860e0
+3c0a1000
+ad4814c0
+3c081000
+35083460
+3c0a1000
+ad4814e0
+3c081000
+350863c0
+3c0a1000
+ad481500
+3c081000
+35082180
+3c0a1000
+ad481520
+3c081000
+35084600
+3c0a1000
+ad481540
+3c081000
+350815c0
+3c0a1000
+ad481560
+3c081000
+35080900
+3c0a1000
+ad481580
+3c081000
+350815e0
+3c0a1000
+ad4815a0
+3c081000
+35081120
+3c0a1000
+ad4815c0
+3c081000
+350852e0
+3c0a1000
+ad4815e0
+3c081000
+35083b00
+3c0a1000
+ad481600
+3c081000
+35082be0
+3c0a1000
+ad481620
+3c081000
+35085520
+3c0a1000
+ad481640
+3c081000
+350828e0
+3c0a1000
+ad481660
+3c081000
+35085f80
+3c0a1000
+ad481680
+3c081000
+35086300
+3c0a1000
+ad4816a0
+3c081000
+35085160
+3c0a1000
+ad4816c0
+3c081000
+35083fc0
+3c0a1000
+ad4816e0
+3c081000
+35087200
+3c0a1000
+ad481700
+3c081000
+35086ae0
+3c0a1000
+ad481720
+3c081000
+35084ae0
+3c0a1000
+ad481740
+3c081000
+35082660
+3c0a1000
+ad481760
+3c081000
+35082140
+3c0a1000
+ad481780
+3c081000
+35083360
+3c0a1000
+ad4817a0
+3c081000
+35085000
+3c0a1000
+ad4817c0
+3c081000
+35080ce0
+3c0a1000
+ad4817e0
+3c081000
+35085580
+3c0a1000
+ad481800
+3c081000
+35083600
+3c0a1000
+ad481820
+3c081000
+35085ea0
+3c0a1000
+ad481840
+3c081000
+350855e0
+3c0a1000
+ad481860
+3c081000
+350875c0
+3c0a1000
+ad481880
+3c081000
+35081660
+3c0a1000
+ad4818a0
+3c081000
+35085960
+3c0a1000
+ad4818c0
+3c081000
+35087bc0
+3c0a1000
+ad4818e0
+3c081000
+350874e0
+3c0a1000
+ad481900
+3c081000
+35087d60
+3c0a1000
+ad481920
+3c081000
+350851c0
+3c0a1000
+ad481940
+3c081000
+35087720
+3c0a1000
+ad481960
+3c081000
+35082760
+3c0a1000
+ad481980
+3c081000
+350862c0
+3c0a1000
+ad4819a0
+3c081000
+35083080
+3c0a1000
+ad4819c0
+3c081000
+35087f00
+3c0a1000
+ad4819e0
+3c081000
+35086120
+3c0a1000
+ad481a00
+3c081000
+35087480
+3c0a1000
+ad481a20
+3c081000
+35084e40
+3c0a1000
+ad481a40
+3c081000
+350847e0
+3c0a1000
+ad481a60
+3c081000
+35081040
+3c0a1000
+ad481a80
+3c081000
+35087680
+3c0a1000
+ad481aa0
+3c081000
+35082960
+3c0a1000
+ad481ac0
+3c081000
+35086500
+3c0a1000
+ad481ae0
+3c081000
+350853e0
+3c0a1000
+ad481b00
+3c081000
+350845e0
+3c0a1000
+ad481b20
+3c081000
+35081020
+3c0a1000
+ad481b40
+3c081000
+35083700
+3c0a1000
+ad481b60
+3c081000
+35081d40
+3c0a1000
+ad481b80
+3c081000
+35082020
+3c0a1000
+ad481ba0
+3c081000
+350857e0
+3c0a1000
+ad481bc0
+3c081000
+35084ba0
+3c0a1000
+ad481be0
+3c081000
+350826c0
+3c0a1000
+ad481c00
+3c081000
+350856c0
+3c0a1000
+ad481c20
+3c081000
+350845c0
+3c0a1000
+ad481c40
+3c081000
+35083040
+3c0a1000
+ad481c60
+3c081000
+350843a0
+3c0a1000
+ad481c80
+3c081000
+350839c0
+3c0a1000
+ad481ca0
+3c081000
+35086660
+3c0a1000
+ad481cc0
+3c081000
+350802c0
+3c0a1000
+ad481ce0
+3c081000
+35081720
+3c0a1000
+ad481d00
+3c081000
+35084060
+3c0a1000
+ad481d20
+3c081000
+35084c20
+3c0a1000
+ad481d40
+3c081000
+35087f80
+3c0a1000
+ad481d60
+3c081000
+350803a0
+3c0a1000
+ad481d80
+3c081000
+35082c40
+3c0a1000
+ad481da0
+3c081000
+350871c0
+3c0a1000
+ad481dc0
+3c081000
+350846e0
+3c0a1000
+ad481de0
+3c081000
+35081ee0
+3c0a1000
+ad481e00
+3c081000
+35084440
+3c0a1000
+ad481e20
+3c081000
+35081ea0
+3c0a1000
+ad481e40
+3c081000
+35081540
+3c0a1000
+ad481e60
+3c081000
+35082d80
+3c0a1000
+ad481e80
+3c081000
+35085100
+3c0a1000
+ad481ea0
+3c081000
+350864a0
+3c0a1000
+ad481ec0
+3c081000
+35087b60
+3c0a1000
+ad481ee0
+3c081000
+35087160
+3c0a1000
+ad481f00
+3c081000
+35083d80
+3c0a1000
+ad481f20
+3c081000
+350802a0
+3c0a1000
+ad481f40
+3c081000
+35080be0
+3c0a1000
+ad481f60
+3c081000
+35087440
+3c0a1000
+ad481f80
+3c081000
+35081980
+3c0a1000
+ad481fa0
+3c081000
+350855c0
+3c0a1000
+ad481fc0
+3c081000
+35081080
+3c0a1000
+ad481fe0
+3c081000
+35082400
+3c0a1000
+ad482000
+3c081000
+35080e60
+3c0a1000
+ad482020
+3c081000
+35081c00
+3c0a1000
+ad482040
+3c081000
+35084860
+3c0a1000
+ad482060
+3c081000
+35080e00
+3c0a1000
+ad482080
+3c081000
+35080340
+3c0a1000
+ad4820a0
+3c081000
+35080820
+3c0a1000
+ad4820c0
+3c081000
+35084300
+3c0a1000
+ad4820e0
+3c081000
+35084460
+3c0a1000
+ad482100
+3c081000
+35081820
+3c0a1000
+ad482120
+3c081000
+35082da0
+3c0a1000
+ad482140
+3c081000
+35082880
+3c0a1000
+ad482160
+3c081000
+35082fa0
+3c0a1000
+ad482180
+3c081000
+35084380
+3c0a1000
+ad4821a0
+3c081000
+35083160
+3c0a1000
+ad4821c0
+3c081000
+35080b60
+3c0a1000
+ad4821e0
+3c081000
+35080880
+3c0a1000
+ad482200
+3c081000
+35083920
+3c0a1000
+ad482220
+3c081000
+35080a80
+3c0a1000
+ad482240
+3c081000
+350854e0
+3c0a1000
+ad482260
+3c081000
+350877c0
+3c0a1000
+ad482280
+3c081000
+35083140
+3c0a1000
+ad4822a0
+3c081000
+35085da0
+3c0a1000
+ad4822c0
+3c081000
+350848a0
+3c0a1000
+ad4822e0
+3c081000
+35085420
+3c0a1000
+ad482300
+3c081000
+35084c60
+3c0a1000
+ad482320
+3c081000
+35084780
+3c0a1000
+ad482340
+3c081000
+35083d60
+3c0a1000
+ad482360
+3c081000
+35083aa0
+3c0a1000
+ad482380
+3c081000
+35084ea0
+3c0a1000
+ad4823a0
+3c081000
+35080e40
+3c0a1000
+ad4823c0
+3c081000
+350862e0
+3c0a1000
+ad4823e0
+3c081000
+350860c0
+3c0a1000
+ad482400
+3c081000
+35083380
+3c0a1000
+ad482420
+3c081000
+35086ea0
+3c0a1000
+ad482440
+3c081000
+350826e0
+3c0a1000
+ad482460
+3c081000
+35086080
+3c0a1000
+ad482480
+3c081000
+35081ac0
+3c0a1000
+ad4824a0
+3c081000
+35087ce0
+3c0a1000
+ad4824c0
+3c081000
+35080940
+3c0a1000
+ad4824e0
+3c081000
+35086de0
+3c0a1000
+ad482500
+3c081000
+35083ae0
+3c0a1000
+ad482520
+3c081000
+350873a0
+3c0a1000
+ad482540
+3c081000
+350877e0
+3c0a1000
+ad482560
+3c081000
+35084200
+3c0a1000
+ad482580
+3c081000
+35080dc0
+3c0a1000
+ad4825a0
+3c081000
+35087520
+3c0a1000
+ad4825c0
+3c081000
+35086960
+3c0a1000
+ad4825e0
+3c081000
+35086e20
+3c0a1000
+ad482600
+3c081000
+35086cc0
+3c0a1000
+ad482620
+3c081000
+350807a0
+3c0a1000
+ad482640
+3c081000
+35085b80
+3c0a1000
+ad482660
+3c081000
+35083b80
+3c0a1000
+ad482680
+3c081000
+350842a0
+3c0a1000
+ad4826a0
+3c081000
+350844a0
+3c0a1000
+ad4826c0
+3c081000
+35081860
+3c0a1000
+ad4826e0
+3c081000
+35080300
+3c0a1000
+ad482700
+3c081000
+35087fc0
+3c0a1000
+ad482720
+3c081000
+35080620
+3c0a1000
+ad482740
+3c081000
+350849a0
+3c0a1000
+ad482760
+3c081000
+350805a0
+3c0a1000
+ad482780
+3c081000
+350838a0
+3c0a1000
+ad4827a0
+3c081000
+350809e0
+3c0a1000
+ad4827c0
+3c081000
+35087ba0
+3c0a1000
+ad4827e0
+3c081000
+35080320
+3c0a1000
+ad482800
+3c081000
+35083220
+3c0a1000
+ad482820
+3c081000
+35081060
+3c0a1000
+ad482840
+3c081000
+35083d20
+3c0a1000
+ad482860
+3c081000
+350843e0
+3c0a1000
+ad482880
+3c081000
+35080840
+3c0a1000
+ad4828a0
+3c081000
+35087380
+3c0a1000
+ad4828c0
+3c081000
+35084240
+3c0a1000
+ad4828e0
+3c081000
+35084d00
+3c0a1000
+ad482900
+3c081000
+350849c0
+3c0a1000
+ad482920
+3c081000
+35087180
+3c0a1000
+ad482940
+3c081000
+350872a0
+3c0a1000
+ad482960
+3c081000
+35084aa0
+3c0a1000
+ad482980
+3c081000
+350847a0
+3c0a1000
+ad4829a0
+3c081000
+35086520
+3c0a1000
+ad4829c0
+3c081000
+35082ea0
+3c0a1000
+ad4829e0
+3c081000
+35085880
+3c0a1000
+ad482a00
+3c081000
+35085ac0
+3c0a1000
+ad482a20
+3c081000
+35086ee0
+3c0a1000
+ad482a40
+3c081000
+35085fc0
+3c0a1000
+ad482a60
+3c081000
+35084e80
+3c0a1000
+ad482a80
+3c081000
+35085f20
+3c0a1000
+ad482aa0
+3c081000
+35083740
+3c0a1000
+ad482ac0
+3c081000
+35081f80
+3c0a1000
+ad482ae0
+3c081000
+35086340
+3c0a1000
+ad482b00
+3c081000
+35084340
+3c0a1000
+ad482b20
+3c081000
+35083d00
+3c0a1000
+ad482b40
+3c081000
+35082f20
+3c0a1000
+ad482b60
+3c081000
+35081160
+3c0a1000
+ad482b80
+3c081000
+35082b60
+3c0a1000
+ad482ba0
+3c081000
+35085ba0
+3c0a1000
+ad482bc0
+3c081000
+35086e40
+3c0a1000
+ad482be0
+3c081000
+35083180
+3c0a1000
+ad482c00
+3c081000
+350841e0
+3c0a1000
+ad482c20
+3c081000
+35081de0
+3c0a1000
+ad482c40
+3c081000
+35087240
+3c0a1000
+ad482c60
+3c081000
+350819c0
+3c0a1000
+ad482c80
+3c081000
+35086c20
+3c0a1000
+ad482ca0
+3c081000
+35087de0
+3c0a1000
+ad482cc0
+3c081000
+35083fe0
+3c0a1000
+ad482ce0
+3c081000
+35080aa0
+3c0a1000
+ad482d00
+3c081000
+35082500
+3c0a1000
+ad482d20
+3c081000
+35084a00
+3c0a1000
+ad482d40
+3c081000
+350870a0
+3c0a1000
+ad482d60
+3c081000
+35086a80
+3c0a1000
+ad482d80
+3c081000
+35086f20
+3c0a1000
+ad482da0
+3c081000
+35086820
+3c0a1000
+ad482dc0
+3c081000
+35083de0
+3c0a1000
+ad482de0
+3c081000
+35086a20
+3c0a1000
+ad482e00
+3c081000
+35082480
+3c0a1000
+ad482e20
+3c081000
+35081fa0
+3c0a1000
+ad482e40
+3c081000
+35086020
+3c0a1000
+ad482e60
+3c081000
+35086f00
+3c0a1000
+ad482e80
+3c081000
+35084080
+3c0a1000
+ad482ea0
+3c081000
+35083da0
+3c0a1000
+ad482ec0
+3c081000
+35087820
+3c0a1000
+ad482ee0
+3c081000
+35081640
+3c0a1000
+ad482f00
+3c081000
+35086320
+3c0a1000
+ad482f20
+3c081000
+35083100
+3c0a1000
+ad482f40
+3c081000
+35082580
+3c0a1000
+ad482f60
+3c081000
+35087360
+3c0a1000
+ad482f80
+3c081000
+35087880
+3c0a1000
+ad482fa0
+3c081000
+35081000
+3c0a1000
+ad482fc0
+3c081000
+35087e80
+3c0a1000
+ad482fe0
+3c081000
+35085e80
+3c0a1000
+ad483000
+3c081000
+35080200
+3c0a1000
+ad483020
+3c081000
+35080020
+3c0a1000
+ad483040
+3c081000
+35085280
+3c0a1000
+ad483060
+3c081000
+350859c0
+3c0a1000
+ad483080
+3c081000
+35085380
+3c0a1000
+ad4830a0
+3c081000
+35080960
+3c0a1000
+ad4830c0
+3c081000
+350870e0
+3c0a1000
+ad4830e0
+3c081000
+35082d00
+3c0a1000
+ad483100
+3c081000
+350800c0
+3c0a1000
+ad483120
+3c081000
+35083c60
+3c0a1000
+ad483140
+3c081000
+35082ce0
+3c0a1000
+ad483160
+3c081000
+35082800
+3c0a1000
+ad483180
+3c081000
+35083480
+3c0a1000
+ad4831a0
+3c081000
+350819e0
+3c0a1000
+ad4831c0
+3c081000
+35087500
+3c0a1000
+ad4831e0
+3c081000
+35086b00
+3c0a1000
+ad483200
+3c081000
+35087ea0
+3c0a1000
+ad483220
+3c081000
+350876c0
+3c0a1000
+ad483240
+3c081000
+350840c0
+3c0a1000
+ad483260
+3c081000
+35084a20
+3c0a1000
+ad483280
+3c081000
+35087b20
+3c0a1000
+ad4832a0
+3c081000
+35080a40
+3c0a1000
+ad4832c0
+3c081000
+35080260
+3c0a1000
+ad4832e0
+3c081000
+35087080
+3c0a1000
+ad483300
+3c081000
+35082820
+3c0a1000
+ad483320
+3c081000
+35083f60
+3c0a1000
+ad483340
+3c081000
+35085220
+3c0a1000
+ad483360
+3c081000
+35084e60
+3c0a1000
+ad483380
+3c081000
+350878a0
+3c0a1000
+ad4833a0
+3c081000
+35086620
+3c0a1000
+ad4833c0
+3c081000
+35081dc0
+3c0a1000
+ad4833e0
+3c081000
+35082fc0
+3c0a1000
+ad483400
+3c081000
+35080520
+3c0a1000
+ad483420
+3c081000
+350804c0
+3c0a1000
+ad483440
+3c081000
+350857c0
+3c0a1000
+ad483460
+3c081000
+35085820
+3c0a1000
+ad483480
+3c081000
+35081440
+3c0a1000
+ad4834a0
+3c081000
+35082a40
+3c0a1000
+ad4834c0
+3c081000
+35087ae0
+3c0a1000
+ad4834e0
+3c081000
+350840a0
+3c0a1000
+ad483500
+3c081000
+350833c0
+3c0a1000
+ad483520
+3c081000
+35086e60
+3c0a1000
+ad483540
+3c081000
+35087b00
+3c0a1000
+ad483560
+3c081000
+350809c0
+3c0a1000
+ad483580
+3c081000
+35081960
+3c0a1000
+ad4835a0
+3c081000
+350814e0
+3c0a1000
+ad4835c0
+3c081000
+35085140
+3c0a1000
+ad4835e0
+3c081000
+35082c00
+3c0a1000
+ad483600
+3c081000
+35081bc0
+3c0a1000
+ad483620
+3c081000
+35080c40
+3c0a1000
+ad483640
+3c081000
+35081840
+3c0a1000
+ad483660
+3c081000
+35087800
+3c0a1000
+ad483680
+3c081000
+35081a60
+3c0a1000
+ad4836a0
+3c081000
+35083060
+3c0a1000
+ad4836c0
+3c081000
+35081b20
+3c0a1000
+ad4836e0
+3c081000
+35082b80
+3c0a1000
+ad483700
+3c081000
+35086980
+3c0a1000
+ad483720
+3c081000
+35086860
+3c0a1000
+ad483740
+3c081000
+35084da0
+3c0a1000
+ad483760
+3c081000
+35083200
+3c0a1000
+ad483780
+3c081000
+350831a0
+3c0a1000
+ad4837a0
+3c081000
+35080d40
+3c0a1000
+ad4837c0
+3c081000
+35080760
+3c0a1000
+ad4837e0
+3c081000
+350816a0
+3c0a1000
+ad483800
+3c081000
+35087f60
+3c0a1000
+ad483820
+3c081000
+35080b20
+3c0a1000
+ad483840
+3c081000
+35087d00
+3c0a1000
+ad483860
+3c081000
+35084420
+3c0a1000
+ad483880
+3c081000
+35082200
+3c0a1000
+ad4838a0
+3c081000
+35081320
+3c0a1000
+ad4838c0
+3c081000
+35085200
+3c0a1000
+ad4838e0
+3c081000
+35081e00
+3c0a1000
+ad483900
+3c081000
+35085920
+3c0a1000
+ad483920
+3c081000
+35087fa0
+3c0a1000
+ad483940
+3c081000
+35080b80
+3c0a1000
+ad483960
+3c081000
+350836c0
+3c0a1000
+ad483980
+3c081000
+35086180
+3c0a1000
+ad4839a0
+3c081000
+35084220
+3c0a1000
+ad4839c0
+3c081000
+350834a0
+3c0a1000
+ad4839e0
+3c081000
+35080240
+3c0a1000
+ad483a00
+3c081000
+35082b20
+3c0a1000
+ad483a20
+3c081000
+350825c0
+3c0a1000
+ad483a40
+3c081000
+350828a0
+3c0a1000
+ad483a60
+3c081000
+35085760
+3c0a1000
+ad483a80
+3c081000
+35084f80
+3c0a1000
+ad483aa0
+3c081000
+35082a80
+3c0a1000
+ad483ac0
+3c081000
+35087ec0
+3c0a1000
+ad483ae0
+3c081000
+35086940
+3c0a1000
+ad483b00
+3c081000
+35080980
+3c0a1000
+ad483b20
+3c081000
+35080a00
+3c0a1000
+ad483b40
+3c081000
+35083be0
+3c0a1000
+ad483b60
+3c081000
+350807c0
+3c0a1000
+ad483b80
+3c081000
+350865a0
+3c0a1000
+ad483ba0
+3c081000
+35082f60
+3c0a1000
+ad483bc0
+3c081000
+35084e20
+3c0a1000
+ad483be0
+3c081000
+35087420
+3c0a1000
+ad483c00
+3c081000
+350803e0
+3c0a1000
+ad483c20
+3c081000
+35085860
+3c0a1000
+ad483c40
+3c081000
+35085ca0
+3c0a1000
+ad483c60
+3c081000
+350839a0
+3c0a1000
+ad483c80
+3c081000
+35086000
+3c0a1000
+ad483ca0
+3c081000
+35083fa0
+3c0a1000
+ad483cc0
+3c081000
+35086420
+3c0a1000
+ad483ce0
+3c081000
+35083ba0
+3c0a1000
+ad483d00
+3c081000
+35086060
+3c0a1000
+ad483d20
+3c081000
+35081880
+3c0a1000
+ad483d40
+3c081000
+350838c0
+3c0a1000
+ad483d60
+3c081000
+35080480
+3c0a1000
+ad483d80
+3c081000
+35080740
+3c0a1000
+ad483da0
+3c081000
+350806a0
+3c0a1000
+ad483dc0
+3c081000
+35087640
+3c0a1000
+ad483de0
+3c081000
+350854a0
+3c0a1000
+ad483e00
+3c081000
+35083500
+3c0a1000
+ad483e20
+3c081000
+35082a20
+3c0a1000
+ad483e40
+3c081000
+35086900
+3c0a1000
+ad483e60
+3c081000
+35080c20
+3c0a1000
+ad483e80
+3c081000
+35084d60
+3c0a1000
+ad483ea0
+3c081000
+35082f80
+3c0a1000
+ad483ec0
+3c081000
+35083860
+3c0a1000
+ad483ee0
+3c081000
+35087be0
+3c0a1000
+ad483f00
+3c081000
+350818e0
+3c0a1000
+ad483f20
+3c081000
+35082e00
+3c0a1000
+ad483f40
+3c081000
+35080c00
+3c0a1000
+ad483f60
+3c081000
+35080f20
+3c0a1000
+ad483f80
+3c081000
+35082940
+3c0a1000
+ad483fa0
+3c081000
+35085360
+3c0a1000
+ad483fc0
+3c081000
+35082b40
+3c0a1000
+ad483fe0
+3c081000
+35087100
+3c0a1000
+ad484000
+3c081000
+35085b20
+3c0a1000
+ad484020
+3c081000
+35084400
+3c0a1000
+ad484040
+3c081000
+350815a0
+3c0a1000
+ad484060
+3c081000
+350823e0
+3c0a1000
+ad484080
+3c081000
+35086d20
+3c0a1000
+ad4840a0
+3c081000
+35086c60
+3c0a1000
+ad4840c0
+3c081000
+35085a40
+3c0a1000
+ad4840e0
+3c081000
+350879c0
+3c0a1000
+ad484100
+3c081000
+35085500
+3c0a1000
+ad484120
+3c081000
+35084fc0
+3c0a1000
+ad484140
+3c081000
+35085d80
+3c0a1000
+ad484160
+3c081000
+35087300
+3c0a1000
+ad484180
+3c081000
+35085ee0
+3c0a1000
+ad4841a0
+3c081000
+35086da0
+3c0a1000
+ad4841c0
+3c081000
+350833e0
+3c0a1000
+ad4841e0
+3c081000
+35081180
+3c0a1000
+ad484200
+3c081000
+35085900
+3c0a1000
+ad484220
+3c081000
+35081940
+3c0a1000
+ad484240
+3c081000
+350836e0
+3c0a1000
+ad484260
+3c081000
+350810a0
+3c0a1000
+ad484280
+3c081000
+35084ca0
+3c0a1000
+ad4842a0
+3c081000
+35081500
+3c0a1000
+ad4842c0
+3c081000
+35081a80
+3c0a1000
+ad4842e0
+3c081000
+35087e20
+3c0a1000
+ad484300
+3c081000
+35081ca0
+3c0a1000
+ad484320
+3c081000
+35086140
+3c0a1000
+ad484340
+3c081000
+350827e0
+3c0a1000
+ad484360
+3c081000
+350822e0
+3c0a1000
+ad484380
+3c081000
+35087da0
+3c0a1000
+ad4843a0
+3c081000
+35080640
+3c0a1000
+ad4843c0
+3c081000
+35085ae0
+3c0a1000
+ad4843e0
+3c081000
+350813c0
+3c0a1000
+ad484400
+3c081000
+35083640
+3c0a1000
+ad484420
+3c081000
+350868a0
+3c0a1000
+ad484440
+3c081000
+35080800
+3c0a1000
+ad484460
+3c081000
+35087040
+3c0a1000
+ad484480
+3c081000
+350857a0
+3c0a1000
+ad4844a0
+3c081000
+35084040
+3c0a1000
+ad4844c0
+3c081000
+35087ac0
+3c0a1000
+ad4844e0
+3c081000
+35080040
+3c0a1000
+ad484500
+3c081000
+350819a0
+3c0a1000
+ad484520
+3c081000
+35084500
+3c0a1000
+ad484540
+3c081000
+35085340
+3c0a1000
+ad484560
+3c081000
+35084f20
+3c0a1000
+ad484580
+3c081000
+350811a0
+3c0a1000
+ad4845a0
+3c081000
+350869c0
+3c0a1000
+ad4845c0
+3c081000
+35081920
+3c0a1000
+ad4845e0
+3c081000
+35087fe0
+3c0a1000
+ad484600
+3c081000
+35087e40
+3c0a1000
+ad484620
+3c081000
+35082f00
+3c0a1000
+ad484640
+3c081000
+350811c0
+3c0a1000
+ad484660
+3c081000
+350816c0
+3c0a1000
+ad484680
+3c081000
+35080bc0
+3c0a1000
+ad4846a0
+3c081000
+35085080
+3c0a1000
+ad4846c0
+3c081000
+35087ee0
+3c0a1000
+ad4846e0
+3c081000
+35084900
+3c0a1000
+ad484700
+3c081000
+35083540
+3c0a1000
+ad484720
+3c081000
+35087560
+3c0a1000
+ad484740
+3c081000
+350820e0
+3c0a1000
+ad484760
+3c081000
+35087d80
+3c0a1000
+ad484780
+3c081000
+35084b00
+3c0a1000
+ad4847a0
+3c081000
+35084180
+3c0a1000
+ad4847c0
+3c081000
+350863a0
+3c0a1000
+ad4847e0
+3c081000
+35081800
+3c0a1000
+ad484800
+3c081000
+35082a00
+3c0a1000
+ad484820
+3c081000
+350825e0
+3c0a1000
+ad484840
+3c081000
+35087740
+3c0a1000
+ad484860
+3c081000
+35081cc0
+3c0a1000
+ad484880
+3c081000
+350871a0
+3c0a1000
+ad4848a0
+3c081000
+35080700
+3c0a1000
+ad4848c0
+3c081000
+35081140
+3c0a1000
+ad4848e0
+3c081000
+35082ec0
+3c0a1000
+ad484900
+3c081000
+35085b00
+3c0a1000
+ad484920
+3c081000
+35080f40
+3c0a1000
+ad484940
+3c081000
+35085ec0
+3c0a1000
+ad484960
+3c081000
+350869e0
+3c0a1000
+ad484980
+3c081000
+35087aa0
+3c0a1000
+ad4849a0
+3c081000
+35085680
+3c0a1000
+ad4849c0
+3c081000
+350846c0
+3c0a1000
+ad4849e0
+3c081000
+35082c20
+3c0a1000
+ad484a00
+3c081000
+35084c00
+3c0a1000
+ad484a20
+3c081000
+35085720
+3c0a1000
+ad484a40
+3c081000
+350851e0
+3c0a1000
+ad484a60
+3c081000
+35081ba0
+3c0a1000
+ad484a80
+3c081000
+350800e0
+3c0a1000
+ad484aa0
+3c081000
+35083b60
+3c0a1000
+ad484ac0
+3c081000
+35084680
+3c0a1000
+ad484ae0
+3c081000
+350821e0
+3c0a1000
+ad484b00
+3c081000
+35081ec0
+3c0a1000
+ad484b20
+3c081000
+35082460
+3c0a1000
+ad484b40
+3c081000
+35080f00
+3c0a1000
+ad484b60
+3c081000
+35083260
+3c0a1000
+ad484b80
+3c081000
+350804e0
+3c0a1000
+ad484ba0
+3c081000
+35081d60
+3c0a1000
+ad484bc0
+3c081000
+35080100
+3c0a1000
+ad484be0
+3c081000
+35084ec0
+3c0a1000
+ad484c00
+3c081000
+35081e80
+3c0a1000
+ad484c20
+3c081000
+35087b40
+3c0a1000
+ad484c40
+3c081000
+35083440
+3c0a1000
+ad484c60
+3c081000
+35087000
+3c0a1000
+ad484c80
+3c081000
+35086760
+3c0a1000
+ad484ca0
+3c081000
+35086f40
+3c0a1000
+ad484cc0
+3c081000
+35083ac0
+3c0a1000
+ad484ce0
+3c081000
+35080160
+3c0a1000
+ad484d00
+3c081000
+350821a0
+3c0a1000
+ad484d20
+3c081000
+35086fc0
+3c0a1000
+ad484d40
+3c081000
+350853c0
+3c0a1000
+ad484d60
+3c081000
+35086c00
+3c0a1000
+ad484d80
+3c081000
+35087e00
+3c0a1000
+ad484da0
+3c081000
+350870c0
+3c0a1000
+ad484dc0
+3c081000
+35083780
+3c0a1000
+ad484de0
+3c081000
+35086ce0
+3c0a1000
+ad484e00
+3c081000
+35080fc0
+3c0a1000
+ad484e20
+3c081000
+35082680
+3c0a1000
+ad484e40
+3c081000
+350829c0
+3c0a1000
+ad484e60
+3c081000
+350864c0
+3c0a1000
+ad484e80
+3c081000
+350833a0
+3c0a1000
+ad484ea0
+3c081000
+35086ca0
+3c0a1000
+ad484ec0
+3c081000
+35087760
+3c0a1000
+ad484ee0
+3c081000
+350844c0
+3c0a1000
+ad484f00
+3c081000
+350837c0
+3c0a1000
+ad484f20
+3c081000
+350837e0
+3c0a1000
+ad484f40
+3c081000
+35087cc0
+3c0a1000
+ad484f60
+3c081000
+35087320
+3c0a1000
+ad484f80
+3c081000
+35080420
+3c0a1000
+ad484fa0
+3c081000
+35081600
+3c0a1000
+ad484fc0
+3c081000
+35084540
+3c0a1000
+ad484fe0
+3c081000
+35080e20
+3c0a1000
+ad485000
+3c081000
+35085620
+3c0a1000
+ad485020
+3c081000
+35081100
+3c0a1000
+ad485040
+3c081000
+35085fe0
+3c0a1000
+ad485060
+3c081000
+350869a0
+3c0a1000
+ad485080
+3c081000
+350817e0
+3c0a1000
+ad4850a0
+3c081000
+35081c40
+3c0a1000
+ad4850c0
+3c081000
+35086bc0
+3c0a1000
+ad4850e0
+3c081000
+350874c0
+3c0a1000
+ad485100
+3c081000
+35085fa0
+3c0a1000
+ad485120
+3c081000
+35083a20
+3c0a1000
+ad485140
+3c081000
+35081d80
+3c0a1000
+ad485160
+3c081000
+35085040
+3c0a1000
+ad485180
+3c081000
+35086280
+3c0a1000
+ad4851a0
+3c081000
+350834e0
+3c0a1000
+ad4851c0
+3c081000
+35080180
+3c0a1000
+ad4851e0
+3c081000
+35084960
+3c0a1000
+ad485200
+3c081000
+35087a20
+3c0a1000
+ad485220
+3c081000
+35087620
+3c0a1000
+ad485240
+3c081000
+35087700
+3c0a1000
+ad485260
+3c081000
+350853a0
+3c0a1000
+ad485280
+3c081000
+35085020
+3c0a1000
+ad4852a0
+3c081000
+35083b40
+3c0a1000
+ad4852c0
+3c081000
+35083280
+3c0a1000
+ad4852e0
+3c081000
+35082300
+3c0a1000
+ad485300
+3c081000
+35084320
+3c0a1000
+ad485320
+3c081000
+35080360
+3c0a1000
+ad485340
+3c081000
+35083bc0
+3c0a1000
+ad485360
+3c081000
+35083c80
+3c0a1000
+ad485380
+3c081000
+35087340
+3c0a1000
+ad4853a0
+3c081000
+35082560
+3c0a1000
+ad4853c0
+3c081000
+350816e0
+3c0a1000
+ad4853e0
+3c081000
+350848c0
+3c0a1000
+ad485400
+3c081000
+35086dc0
+3c0a1000
+ad485420
+3c081000
+35080a60
+3c0a1000
+ad485440
+3c081000
+350859e0
+3c0a1000
+ad485460
+3c081000
+35082280
+3c0a1000
+ad485480
+3c081000
+35083c00
+3c0a1000
+ad4854a0
+3c081000
+35087a00
+3c0a1000
+ad4854c0
+3c081000
+350867e0
+3c0a1000
+ad4854e0
+3c081000
+35083840
+3c0a1000
+ad485500
+3c081000
+35083520
+3c0a1000
+ad485520
+3c081000
+35080d60
+3c0a1000
+ad485540
+3c081000
+35083dc0
+3c0a1000
+ad485560
+3c081000
+35080560
+3c0a1000
+ad485580
+3c081000
+35085600
+3c0a1000
+ad4855a0
+3c081000
+35080f60
+3c0a1000
+ad4855c0
+3c081000
+35086a40
+3c0a1000
+ad4855e0
+3c081000
+35084660
+3c0a1000
+ad485600
+3c081000
+35081f40
+3c0a1000
+ad485620
+3c081000
+35080440
+3c0a1000
+ad485640
+3c081000
+35086360
+3c0a1000
+ad485660
+3c081000
+350832a0
+3c0a1000
+ad485680
+3c081000
+35084720
+3c0a1000
+ad4856a0
+3c081000
+35081da0
+3c0a1000
+ad4856c0
+3c081000
+350840e0
+3c0a1000
+ad4856e0
+3c081000
+35086d80
+3c0a1000
+ad485700
+3c081000
+35083ea0
+3c0a1000
+ad485720
+3c081000
+350865e0
+3c0a1000
+ad485740
+3c081000
+35085d20
+3c0a1000
+ad485760
+3c081000
+35081a20
+3c0a1000
+ad485780
+3c081000
+350858c0
+3c0a1000
+ad4857a0
+3c081000
+35083d40
+3c0a1000
+ad4857c0
+3c081000
+350830e0
+3c0a1000
+ad4857e0
+3c081000
+350851a0
+3c0a1000
+ad485800
+3c081000
+35083e00
+3c0a1000
+ad485820
+3c081000
+35083240
+3c0a1000
+ad485840
+3c081000
+350823c0
+3c0a1000
+ad485860
+3c081000
+35081420
+3c0a1000
+ad485880
+3c081000
+35087400
+3c0a1000
+ad4858a0
+3c081000
+350808c0
+3c0a1000
+ad4858c0
+3c081000
+35084f00
+3c0a1000
+ad4858e0
+3c081000
+350850c0
+3c0a1000
+ad485900
+3c081000
+35080060
+3c0a1000
+ad485920
+3c081000
+350829a0
+3c0a1000
+ad485940
+3c081000
+35081e60
+3c0a1000
+ad485960
+3c081000
+350824c0
+3c0a1000
+ad485980
+3c081000
+35084dc0
+3c0a1000
+ad4859a0
+3c081000
+35084140
+3c0a1000
+ad4859c0
+3c081000
+350862a0
+3c0a1000
+ad4859e0
+3c081000
+350873e0
+3c0a1000
+ad485a00
+3c081000
+35082780
+3c0a1000
+ad485a20
+3c081000
+35087c60
+3c0a1000
+ad485a40
+3c081000
+35082d60
+3c0a1000
+ad485a60
+3c081000
+35081360
+3c0a1000
+ad485a80
+3c081000
+35081f00
+3c0a1000
+ad485aa0
+3c081000
+350841c0
+3c0a1000
+ad485ac0
+3c081000
+35080280
+3c0a1000
+ad485ae0
+3c081000
+350858a0
+3c0a1000
+ad485b00
+3c081000
+35087c20
+3c0a1000
+ad485b20
+3c081000
+35087a40
+3c0a1000
+ad485b40
+3c081000
+35087020
+3c0a1000
+ad485b60
+3c081000
+35085b60
+3c0a1000
+ad485b80
+3c081000
+350812e0
+3c0a1000
+ad485ba0
+3c081000
+350827c0
+3c0a1000
+ad485bc0
+3c081000
+35081a40
+3c0a1000
+ad485be0
+3c081000
+35083f00
+3c0a1000
+ad485c00
+3c081000
+350804a0
+3c0a1000
+ad485c20
+3c081000
+35084940
+3c0a1000
+ad485c40
+3c081000
+35082220
+3c0a1000
+ad485c60
+3c081000
+35083b20
+3c0a1000
+ad485c80
+3c081000
+350823a0
+3c0a1000
+ad485ca0
+3c081000
+350850a0
+3c0a1000
+ad485cc0
+3c081000
+35087a80
+3c0a1000
+ad485ce0
+3c081000
+35083620
+3c0a1000
+ad485d00
+3c081000
+35082b00
+3c0a1000
+ad485d20
+3c081000
+35084fa0
+3c0a1000
+ad485d40
+3c081000
+35084e00
+3c0a1000
+ad485d60
+3c081000
+35082080
+3c0a1000
+ad485d80
+3c081000
+35082340
+3c0a1000
+ad485da0
+3c081000
+35084f40
+3c0a1000
+ad485dc0
+3c081000
+35083ec0
+3c0a1000
+ad485de0
+3c081000
+35086640
+3c0a1000
+ad485e00
+3c081000
+350850e0
+3c0a1000
+ad485e20
+3c081000
+350808e0
+3c0a1000
+ad485e40
+3c081000
+35086700
+3c0a1000
+ad485e60
+3c081000
+35085660
+3c0a1000
+ad485e80
+3c081000
+35082100
+3c0a1000
+ad485ea0
+3c081000
+35080600
+3c0a1000
+ad485ec0
+3c081000
+35086920
+3c0a1000
+ad485ee0
+3c081000
+35083ce0
+3c0a1000
+ad485f00
+3c081000
+35080f80
+3c0a1000
+ad485f20
+3c081000
+35081f20
+3c0a1000
+ad485f40
+3c081000
+35082420
+3c0a1000
+ad485f60
+3c081000
+35081c60
+3c0a1000
+ad485f80
+3c081000
+35082ca0
+3c0a1000
+ad485fa0
+3c081000
+350820a0
+3c0a1000
+ad485fc0
+3c081000
+350868c0
+3c0a1000
+ad485fe0
+3c081000
+35083800
+3c0a1000
+ad486000
+3c081000
+35081fe0
+3c0a1000
+ad486020
+3c081000
+35082de0
+3c0a1000
+ad486040
+3c081000
+35084f60
+3c0a1000
+ad486060
+3c081000
+350852c0
+3c0a1000
+ad486080
+3c081000
+350801e0
+3c0a1000
+ad4860a0
+3c081000
+350860a0
+3c0a1000
+ad4860c0
+3c081000
+35084b20
+3c0a1000
+ad4860e0
+3c081000
+35085940
+3c0a1000
+ad486100
+3c081000
+35083300
+3c0a1000
+ad486120
+3c081000
+350839e0
+3c0a1000
+ad486140
+3c081000
+35080a20
+3c0a1000
+ad486160
+3c081000
+35083f80
+3c0a1000
+ad486180
+3c081000
+35084de0
+3c0a1000
+ad4861a0
+3c081000
+35082e80
+3c0a1000
+ad4861c0
+3c081000
+350866c0
+3c0a1000
+ad4861e0
+3c081000
+35084ac0
+3c0a1000
+ad486200
+3c081000
+35081fc0
+3c0a1000
+ad486220
+3c081000
+350861a0
+3c0a1000
+ad486240
+3c081000
+350852a0
+3c0a1000
+ad486260
+3c081000
+35081b80
+3c0a1000
+ad486280
+3c081000
+350842e0
+3c0a1000
+ad4862a0
+3c081000
+350801a0
+3c0a1000
+ad4862c0
+3c081000
+350856a0
+3c0a1000
+ad4862e0
+3c081000
+35082700
+3c0a1000
+ad486300
+3c081000
+35085e60
+3c0a1000
+ad486320
+3c081000
+350822a0
+3c0a1000
+ad486340
+3c081000
+35085a00
+3c0a1000
+ad486360
+3c081000
+350844e0
+3c0a1000
+ad486380
+3c081000
+35084280
+3c0a1000
+ad4863a0
+3c081000
+35080de0
+3c0a1000
+ad4863c0
+3c081000
+35080d80
+3c0a1000
+ad4863e0
+3c081000
+35084c80
+3c0a1000
+ad486400
+3c081000
+350845a0
+3c0a1000
+ad486420
+3c081000
+350879e0
+3c0a1000
+ad486440
+3c081000
+35083120
+3c0a1000
+ad486460
+3c081000
+35086580
+3c0a1000
+ad486480
+3c081000
+35085060
+3c0a1000
+ad4864a0
+3c081000
+35084fe0
+3c0a1000
+ad4864c0
+3c081000
+35086d60
+3c0a1000
+ad4864e0
+3c081000
+350830a0
+3c0a1000
+ad486500
+3c081000
+350873c0
+3c0a1000
+ad486520
+3c081000
+35085180
+3c0a1000
+ad486540
+3c081000
+35082740
+3c0a1000
+ad486560
+3c081000
+35082e40
+3c0a1000
+ad486580
+3c081000
+35086fa0
+3c0a1000
+ad4865a0
+3c081000
+35081480
+3c0a1000
+ad4865c0
+3c081000
+35084a40
+3c0a1000
+ad4865e0
+3c081000
+350864e0
+3c0a1000
+ad486600
+3c081000
+35085f40
+3c0a1000
+ad486620
+3c081000
+35087860
+3c0a1000
+ad486640
+3c081000
+35084920
+3c0a1000
+ad486660
+3c081000
+35086880
+3c0a1000
+ad486680
+3c081000
+35083340
+3c0a1000
+ad4866a0
+3c081000
+35086c80
+3c0a1000
+ad4866c0
+3c081000
+350826a0
+3c0a1000
+ad4866e0
+3c081000
+35087580
+3c0a1000
+ad486700
+3c081000
+35082d20
+3c0a1000
+ad486720
+3c081000
+350824e0
+3c0a1000
+ad486740
+3c081000
+35087920
+3c0a1000
+ad486760
+3c081000
+35083900
+3c0a1000
+ad486780
+3c081000
+350841a0
+3c0a1000
+ad4867a0
+3c081000
+35086c40
+3c0a1000
+ad4867c0
+3c081000
+35081560
+3c0a1000
+ad4867e0
+3c081000
+350849e0
+3c0a1000
+ad486800
+3c081000
+35083e20
+3c0a1000
+ad486820
+3c081000
+35083ee0
+3c0a1000
+ad486840
+3c081000
+35086160
+3c0a1000
+ad486860
+3c081000
+35085ce0
+3c0a1000
+ad486880
+3c081000
+35084480
+3c0a1000
+ad4868a0
+3c081000
+35086600
+3c0a1000
+ad4868c0
+3c081000
+350875e0
+3c0a1000
+ad4868e0
+3c081000
+350813a0
+3c0a1000
+ad486900
+3c081000
+35086460
+3c0a1000
+ad486920
+3c081000
+35081be0
+3c0a1000
+ad486940
+3c081000
+35082240
+3c0a1000
+ad486960
+3c081000
+35086ec0
+3c0a1000
+ad486980
+3c081000
+35086fe0
+3c0a1000
+ad4869a0
+3c081000
+350856e0
+3c0a1000
+ad4869c0
+3c081000
+35080cc0
+3c0a1000
+ad4869e0
+3c081000
+35080120
+3c0a1000
+ad486a00
+3c081000
+35084ee0
+3c0a1000
+ad486a20
+3c081000
+35084100
+3c0a1000
+ad486a40
+3c081000
+35080b00
+3c0a1000
+ad486a60
+3c081000
+350866a0
+3c0a1000
+ad486a80
+3c081000
+35081280
+3c0a1000
+ad486aa0
+3c081000
+35085700
+3c0a1000
+ad486ac0
+3c081000
+35083a80
+3c0a1000
+ad486ae0
+3c081000
+35087260
+3c0a1000
+ad486b00
+3c081000
+350832c0
+3c0a1000
+ad486b20
+3c081000
+35083560
+3c0a1000
+ad486b40
+3c081000
+35080ee0
+3c0a1000
+ad486b60
+3c081000
+350805e0
+3c0a1000
+ad486b80
+3c081000
+350842c0
+3c0a1000
+ad486ba0
+3c081000
+35082920
+3c0a1000
+ad486bc0
+3c081000
+35082000
+3c0a1000
+ad486be0
+3c081000
+35080460
+3c0a1000
+ad486c00
+3c081000
+350831c0
+3c0a1000
+ad486c20
+3c081000
+35083680
+3c0a1000
+ad486c40
+3c081000
+35084000
+3c0a1000
+ad486c60
+3c081000
+350848e0
+3c0a1000
+ad486c80
+3c081000
+35085a20
+3c0a1000
+ad486ca0
+3c081000
+35082f40
+3c0a1000
+ad486cc0
+3c081000
+35085480
+3c0a1000
+ad486ce0
+3c081000
+35080220
+3c0a1000
+ad486d00
+3c081000
+35084700
+3c0a1000
+ad486d20
+3c081000
+35084b80
+3c0a1000
+ad486d40
+3c081000
+35086b80
+3c0a1000
+ad486d60
+3c081000
+35087220
+3c0a1000
+ad486d80
+3c081000
+350812a0
+3c0a1000
+ad486da0
+3c081000
+35087960
+3c0a1000
+ad486dc0
+3c081000
+350847c0
+3c0a1000
+ad486de0
+3c081000
+35086040
+3c0a1000
+ad486e00
+3c081000
+35085cc0
+3c0a1000
+ad486e20
+3c081000
+35083c40
+3c0a1000
+ad486e40
+3c081000
+35086220
+3c0a1000
+ad486e60
+3c081000
+35080ec0
+3c0a1000
+ad486e80
+3c081000
+350810e0
+3c0a1000
+ad486ea0
+3c081000
+35080fa0
+3c0a1000
+ad486ec0
+3c081000
+35086380
+3c0a1000
+ad486ee0
+3c081000
+350878c0
+3c0a1000
+ad486f00
+3c081000
+35084a80
+3c0a1000
+ad486f20
+3c081000
+35082cc0
+3c0a1000
+ad486f40
+3c081000
+35081f60
+3c0a1000
+ad486f60
+3c081000
+35087c80
+3c0a1000
+ad486f80
+3c081000
+350843c0
+3c0a1000
+ad486fa0
+3c081000
+35084be0
+3c0a1000
+ad486fc0
+3c081000
+35083e60
+3c0a1000
+ad486fe0
+3c081000
+35085980
+3c0a1000
+ad487000
+3c081000
+35087c00
+3c0a1000
+ad487020
+3c081000
+35084620
+3c0a1000
+ad487040
+3c081000
+35082380
+3c0a1000
+ad487060
+3c081000
+35085120
+3c0a1000
+ad487080
+3c081000
+350806e0
+3c0a1000
+ad4870a0
+3c081000
+35082040
+3c0a1000
+ad4870c0
+3c081000
+35087840
+3c0a1000
+ad4870e0
+3c081000
+35084b40
+3c0a1000
+ad487100
+3c081000
+35087280
+3c0a1000
+ad487120
+3c081000
+35084980
+3c0a1000
+ad487140
+3c081000
+35086b60
+3c0a1000
+ad487160
+3c081000
+35083a40
+3c0a1000
+ad487180
+3c081000
+350818a0
+3c0a1000
+ad4871a0
+3c081000
+35084520
+3c0a1000
+ad4871c0
+3c081000
+35085400
+3c0a1000
+ad4871e0
+3c081000
+350858e0
+3c0a1000
+ad487200
+3c081000
+35080ba0
+3c0a1000
+ad487220
+3c081000
+35082dc0
+3c0a1000
+ad487240
+3c081000
+350803c0
+3c0a1000
+ad487260
+3c081000
+35081e40
+3c0a1000
+ad487280
+3c081000
+35085260
+3c0a1000
+ad4872a0
+3c081000
+35082aa0
+3c0a1000
+ad4872c0
+3c081000
+35086400
+3c0a1000
+ad4872e0
+3c081000
+35082320
+3c0a1000
+ad487300
+3c081000
+35084840
+3c0a1000
+ad487320
+3c081000
+35083580
+3c0a1000
+ad487340
+3c081000
+35086ba0
+3c0a1000
+ad487360
+3c081000
+35080d20
+3c0a1000
+ad487380
+3c081000
+350817c0
+3c0a1000
+ad4873a0
+3c081000
+350868e0
+3c0a1000
+ad4873c0
+3c081000
+35084640
+3c0a1000
+ad4873e0
+3c081000
+35086e80
+3c0a1000
+ad487400
+3c081000
+350838e0
+3c0a1000
+ad487420
+3c081000
+35084800
+3c0a1000
+ad487440
+3c081000
+35085dc0
+3c0a1000
+ad487460
+3c081000
+35084260
+3c0a1000
+ad487480
+3c081000
+35083880
+3c0a1000
+ad4874a0
+3c081000
+35080660
+3c0a1000
+ad4874c0
+3c081000
+35080500
+3c0a1000
+ad4874e0
+3c081000
+35080fe0
+3c0a1000
+ad487500
+3c081000
+35085300
+3c0a1000
+ad487520
+3c081000
+35085740
+3c0a1000
+ad487540
+3c081000
+35086b40
+3c0a1000
+ad487560
+3c081000
+35082260
+3c0a1000
+ad487580
+3c081000
+35083e40
+3c0a1000
+ad4875a0
+3c081000
+35087940
+3c0a1000
+ad4875c0
+3c081000
+35087d40
+3c0a1000
+ad4875e0
+3c081000
+350808a0
+3c0a1000
+ad487600
+3c081000
+35084740
+3c0a1000
+ad487620
+3c081000
+350807e0
+3c0a1000
+ad487640
+3c081000
+35082360
+3c0a1000
+ad487660
+3c081000
+35082860
+3c0a1000
+ad487680
+3c081000
+35082520
+3c0a1000
+ad4876a0
+3c081000
+35086800
+3c0a1000
+ad4876c0
+3c081000
+35083f40
+3c0a1000
+ad4876e0
+3c081000
+35086a60
+3c0a1000
+ad487700
+3c081000
+350867c0
+3c0a1000
+ad487720
+3c081000
+35081460
+3c0a1000
+ad487740
+3c081000
+350809a0
+3c0a1000
+ad487760
+3c081000
+35085e00
+3c0a1000
+ad487780
+3c081000
+35086680
+3c0a1000
+ad4877a0
+3c081000
+35082d40
+3c0a1000
+ad4877c0
+3c081000
+35082ba0
+3c0a1000
+ad4877e0
+3c081000
+350822c0
+3c0a1000
+ad487800
+3c081000
+35086100
+3c0a1000
+ad487820
+3c081000
+35080140
+3c0a1000
+ad487840
+3c081000
+35082fe0
+3c0a1000
+ad487860
+3c081000
+35082a60
+3c0a1000
+ad487880
+3c081000
+350875a0
+3c0a1000
+ad4878a0
+3c081000
+35081200
+3c0a1000
+ad4878c0
+3c081000
+35085840
+3c0a1000
+ad4878e0
+3c081000
+35084bc0
+3c0a1000
+ad487900
+3c081000
+35081260
+3c0a1000
+ad487920
+3c081000
+35087e60
+3c0a1000
+ad487940
+3c081000
+350865c0
+3c0a1000
+ad487960
+3c081000
+350801c0
+3c0a1000
+ad487980
+3c081000
+350835a0
+3c0a1000
+ad4879a0
+3c081000
+35084020
+3c0a1000
+ad4879c0
+3c081000
+35087780
+3c0a1000
+ad4879e0
+3c081000
+350878e0
+3c0a1000
+ad487a00
+3c081000
+35085f00
+3c0a1000
+ad487a20
+3c081000
+350855a0
+3c0a1000
+ad487a40
+3c081000
+35083820
+3c0a1000
+ad487a60
+3c081000
+350824a0
+3c0a1000
+ad487a80
+3c081000
+35081780
+3c0a1000
+ad487aa0
+3c081000
+35080680
+3c0a1000
+ad487ac0
+3c081000
+35082e20
+3c0a1000
+ad487ae0
+3c081000
+350876a0
+3c0a1000
+ad487b00
+3c081000
+35085320
+3c0a1000
+ad487b20
+3c081000
+35081aa0
+3c0a1000
+ad487b40
+3c081000
+35087460
+3c0a1000
+ad487b60
+3c081000
+35086b20
+3c0a1000
+ad487b80
+3c081000
+350835c0
+3c0a1000
+ad487ba0
+3c081000
+35087d20
+3c0a1000
+ad487bc0
+3c081000
+35081380
+3c0a1000
+ad487be0
+3c081000
+35084d40
+3c0a1000
+ad487c00
+3c081000
+350872c0
+3c0a1000
+ad487c20
+3c081000
+35081b60
+3c0a1000
+ad487c40
+3c081000
+350814a0
+3c0a1000
+ad487c60
+3c081000
+350827a0
+3c0a1000
+ad487c80
+3c081000
+35083400
+3c0a1000
+ad487ca0
+3c081000
+35084580
+3c0a1000
+ad487cc0
+3c081000
+35082160
+3c0a1000
+ad487ce0
+3c081000
+35085e40
+3c0a1000
+ad487d00
+3c081000
+35087140
+3c0a1000
+ad487d20
+3c081000
+35085540
+3c0a1000
+ad487d40
+3c081000
+35081900
+3c0a1000
+ad487d60
+3c081000
+35085d40
+3c0a1000
+ad487d80
+3c081000
+35085d00
+3c0a1000
+ad487da0
+3c081000
+350861c0
+3c0a1000
+ad487dc0
+3c081000
+35086720
+3c0a1000
+ad487de0
+3c081000
+35084160
+3c0a1000
+ad487e00
+3c081000
+350854c0
+3c0a1000
+ad487e20
+3c081000
+35080c60
+3c0a1000
+ad487e40
+3c081000
+350834c0
+3c0a1000
+ad487e60
+3c081000
+350835e0
+3c0a1000
+ad487e80
+3c081000
+35082900
+3c0a1000
+ad487ea0
+3c081000
+35081c20
+3c0a1000
+ad487ec0
+3c081000
+35087a60
+3c0a1000
+ad487ee0
+3c081000
+350866e0
+3c0a1000
+ad487f00
+3c081000
+350846a0
+3c0a1000
+ad487f20
+3c081000
+35083320
+3c0a1000
+ad487f40
+3c081000
+35081c80
+3c0a1000
+ad487f60
+3c081000
+35085c60
+3c0a1000
+ad487f80
+3c081000
+35087120
+3c0a1000
+ad487fa0
+3c081000
+35081220
+3c0a1000
+ad487fc0
+3c081000
+35085c00
+3c0a1000
+ad487fe0
+02004021
+8d080000
+2529ffff
+1520fffd
+2402000a
+0000000c
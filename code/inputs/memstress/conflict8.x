@@ -0,0 +1,14 @@
+3c101000
+34098000
+3c110001
+34122000
+00004021
+02085021
+8d4b0000
+01124021
+15110001
+00004021
+2529ffff
+1520fff9
+2402000a
+0000000c
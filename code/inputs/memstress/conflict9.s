@@ -0,0 +1,20 @@
+# conflict9: round robin over 9 blocks of one 8-way set: LRU misses every time
+# generated by memgen.py conflict --count=32768 --set_stride=8192 --ways=9
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    lui $s1, 1
+    ori $s1, $s1, 0x2000
+    ori $s2, $zero, 0x2000
+    addu $t0, $zero, $zero
+loop:
+    addu $t2, $s0, $t0
+    lw $t3, 0($t2)
+    addu $t0, $t0, $s2
+    bne $t0, $s1, next
+    addu $t0, $zero, $zero
+next:
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
@@ -0,0 +1,431 @@
+#!/usr/bin/python3
+
+# Memory-system stress workload generator.
+#
+# Writes MIPS programs with a controlled data access pattern as <name>.s
+# (assembly), <name>.x (hex, ready for ./sim) and <name>.json (the pattern,
+# its parameters, and the L1 data cache behavior a model of the default
+# cache predicts for it):
+#
+#   ./memgen.py stride --stride=64 --footprint=262144 -o stride64
+#   ./memgen.py chase --footprint=131072
+#   ./memgen.py --suite                 # regenerate this directory's corpus
+#   ./memgen.py --suite --check ../../sim
+#
+# Patterns:
+#   stride    loads at a fixed stride, wrapping around a footprint
+#   chase     pointer chasing through a random cyclic list of nodes
+#   random    uniformly random loads over a footprint
+#   zipf      Zipf-like reuse: block popularity falls off as 1/rank
+#   prodcons  a producer stream of stores with a consumer stream of loads
+#             trailing it by a fixed lag
+#   conflict  round-robin loads to more blocks than one set can hold
+#
+# The programs need no assembler: this script encodes the (small) subset of
+# MIPS it emits itself. Data lives at 0x10000000. With --check, every program
+# is also run under the given simulator and its L1D statistics compared with
+# the prediction.
+
+import argparse, json, os, random, re, subprocess, sys
+
+DATA_BASE = 0x10000000
+
+REGS = {'$zero': 0, '$v0': 2, '$v1': 3, '$a0': 4,
+        '$t0': 8, '$t1': 9, '$t2': 10, '$t3': 11, '$t4': 12, '$t5': 13, '$t6': 14, '$t7': 15,
+        '$s0': 16, '$s1': 17, '$s2': 18, '$s3': 19}
+
+# opcode (I-type) or function code (R-type) of each instruction emitted
+RTYPE = {'addu': 0x21, 'subu': 0x23, 'and': 0x24, 'or': 0x25, 'xor': 0x26, 'sltu': 0x2b}
+SHIFT = {'sll': 0x00, 'srl': 0x02}
+SHIFTV = {'sllv': 0x04, 'srlv': 0x06}
+ITYPE = {'addiu': 0x09, 'andi': 0x0c, 'ori': 0x0d}
+MEMOP = {'lw': 0x23, 'sw': 0x2b}
+BRANCH = {'beq': 0x04, 'bne': 0x05}
+
+
+class Asm:
+    """A list of instructions and labels, printed as .s and encoded as .x."""
+
+    def __init__(self):
+        self.items = []
+
+    def label(self, name):
+        self.items.append((None, name))
+
+    def op(self, mnemonic, *args):
+        self.items.append((mnemonic,) + args)
+
+    def li(self, reg, value):
+        value &= 0xffffffff
+        if value < 0x10000:
+            self.op('ori', reg, '$zero', value)
+            return
+        self.op('lui', reg, value >> 16)
+        if value & 0xffff:
+            self.op('ori', reg, reg, value & 0xffff)
+
+    def source(self):
+        lines = ['.text']
+        for item in self.items:
+            if item[0] is None:
+                lines.append(item[1] + ':')
+            elif item[0] in MEMOP:
+                lines.append('    %s %s, %d(%s)' % (item[0], item[1], item[2], item[3]))
+            elif item[0] == 'syscall':
+                lines.append('    syscall')
+            else:
+                args = [a if isinstance(a, str) else ('0x%x' % a if a > 255 else str(a)) for a in item[1:]]
+                lines.append('    %s %s' % (item[0], ', '.join(args)))
+        return '\n'.join(lines) + '\n'
+
+    def words(self):
+        labels, pc = {}, 0
+        for item in self.items:
+            if item[0] is None:
+                labels[item[1]] = pc
+            else:
+                pc += 4
+
+        words, pc = [], 0
+        for item in self.items:
+            if item[0] is None:
+                continue
+            m, a = item[0], item[1:]
+            r = lambda x: REGS[x]
+            if m in RTYPE:
+                w = (r(a[1]) << 21) | (r(a[2]) << 16) | (r(a[0]) << 11) | RTYPE[m]
+            elif m in SHIFT:
+                w = (r(a[1]) << 16) | (r(a[0]) << 11) | (a[2] << 6) | SHIFT[m]
+            elif m in SHIFTV:
+                w = (r(a[2]) << 21) | (r(a[1]) << 16) | (r(a[0]) << 11) | SHIFTV[m]
+            elif m in ITYPE:
+                w = (ITYPE[m] << 26) | (r(a[1]) << 21) | (r(a[0]) << 16) | (a[2] & 0xffff)
+            elif m == 'lui':
+                w = (0x0f << 26) | (r(a[0]) << 16) | (a[1] & 0xffff)
+            elif m in MEMOP:
+                w = (MEMOP[m] << 26) | (r(a[2]) << 21) | (r(a[0]) << 16) | (a[1] & 0xffff)
+            elif m in BRANCH:
+                offset = (labels[a[2]] - (pc + 4)) >> 2
+                w = (BRANCH[m] << 26) | (r(a[0]) << 21) | (r(a[1]) << 16) | (offset & 0xffff)
+            elif m == 'syscall':
+                w = 0x0c
+            else:
+                raise ValueError('cannot encode ' + m)
+            words.append(w)
+            pc += 4
+        return words
+
+
+class Cache:
+    """The simulator's L1 (src/cache.cpp) on one core: set-associative,
+    LRU, write-allocate, write-back."""
+
+    def __init__(self, size, assoc, block):
+        self.assoc, self.block = assoc, block
+        self.sets = size // (assoc * block)
+        self.lines = [dict() for _ in range(self.sets)]  # block -> [lru, dirty]
+        self.clock = 0
+        self.accesses = self.misses = self.writebacks = 0
+
+    def access(self, addr, write):
+        block = addr // self.block
+        s = self.lines[block % self.sets]
+        self.accesses += 1
+        self.clock += 1
+        if block not in s:
+            self.misses += 1
+            if len(s) == self.assoc:
+                victim = min(s, key=lambda b: s[b][0])
+                if s[victim][1]:
+                    self.writebacks += 1
+                del s[victim]
+            s[block] = [0, 0]
+        s[block][0] = self.clock
+        s[block][1] |= write
+
+
+def xorshift(x):
+    x ^= (x << 13) & 0xffffffff
+    x ^= x >> 17
+    x ^= (x << 5) & 0xffffffff
+    return x
+
+
+def log2(x):
+    return x.bit_length() - 1
+
+
+# Each pattern emits its program into 'asm' and returns its data access
+# trace as (address, write) pairs. $s0 holds DATA_BASE and $t1 the loop count.
+
+def gen_stride(asm, p):
+    asm.li('$s1', p['footprint'] - 1)
+    asm.li('$s2', p['stride'])
+    asm.op('addu', '$t0', '$zero', '$zero')
+    asm.label('loop')
+    asm.op('addu', '$t2', '$s0', '$t0')
+    asm.op('lw', '$t3', 0, '$t2')
+    asm.op('addu', '$t0', '$t0', '$s2')
+    asm.op('and', '$t0', '$t0', '$s1')
+    asm.op('addiu', '$t1', '$t1', -1)
+    asm.op('bne', '$t1', '$zero', 'loop')
+    return [(DATA_BASE + (i * p['stride']) % p['footprint'], 0) for i in range(p['count'])]
+
+
+def gen_chase(asm, p):
+    nodes = p['footprint'] // p['node']
+    order = list(range(1, nodes))
+    random.Random(p['seed']).shuffle(order)
+    order = [0] + order
+    succ = [0] * nodes
+    for k in range(nodes):
+        succ[order[k]] = order[(k + 1) % nodes]
+
+    # build the list: one store of each node's successor pointer
+    trace = []
+    for n in range(nodes):
+        addr = DATA_BASE + n * p['node']
+        lo = addr & 0xffff
+        lo = lo - 0x10000 if lo >= 0x8000 else lo
+        asm.li('$t0', DATA_BASE + succ[n] * p['node'])
+        asm.op('lui', '$t2', ((addr - lo) >> 16) & 0xffff)
+        asm.op('sw', '$t0', lo, '$t2')
+        trace.append((addr, 1))
+
+    asm.op('addu', '$t0', '$s0', '$zero')
+    asm.label('loop')
+    asm.op('lw', '$t0', 0, '$t0')
+    asm.op('addiu', '$t1', '$t1', -1)
+    asm.op('bne', '$t1', '$zero', 'loop')
+    n = 0
+    for i in range(p['count']):
+        trace.append((DATA_BASE + n * p['node'], 0))
+        n = succ[n]
+    return trace
+
+
+def emit_xorshift(asm):
+    asm.op('sll', '$t6', '$t5', 13)
+    asm.op('xor', '$t5', '$t5', '$t6')
+    asm.op('srl', '$t6', '$t5', 17)
+    asm.op('xor', '$t5', '$t5', '$t6')
+    asm.op('sll', '$t6', '$t5', 5)
+    asm.op('xor', '$t5', '$t5', '$t6')
+
+
+def gen_random(asm, p):
+    mask = (p['footprint'] - 1) & ~3
+    asm.li('$t5', p['seed'])
+    asm.li('$s1', mask)
+    asm.label('loop')
+    emit_xorshift(asm)
+    asm.op('and', '$t2', '$t5', '$s1')
+    asm.op('addu', '$t2', '$t2', '$s0')
+    asm.op('lw', '$t3', 0, '$t2')
+    asm.op('addiu', '$t1', '$t1', -1)
+    asm.op('bne', '$t1', '$zero', 'loop')
+    trace, x = [], p['seed']
+    for i in range(p['count']):
+        x = xorshift(x)
+        trace.append((DATA_BASE + (x & mask), 0))
+    return trace
+
+
+def gen_zipf(asm, p):
+    # a uniform block index shifted right by a uniform 0..15 bits: an index
+    # is then chosen with probability roughly proportional to 1/index
+    blocks = p['footprint'] // p['block']
+    assert blocks <= 1 << 15, 'zipf: at most 32768 blocks'
+    offset_mask = (p['block'] - 1) & ~3
+    asm.li('$t5', p['seed'])
+    asm.li('$s1', blocks - 1)
+    asm.li('$s2', offset_mask)
+    asm.label('loop')
+    emit_xorshift(asm)
+    asm.op('srl', '$t6', '$t5', 28)
+    asm.op('and', '$t2', '$t5', '$s1')
+    asm.op('srlv', '$t2', '$t2', '$t6')
+    asm.op('sll', '$t2', '$t2', log2(p['block']))
+    asm.op('srl', '$t7', '$t5', 16)
+    asm.op('and', '$t7', '$t7', '$s2')
+    asm.op('addu', '$t2', '$t2', '$t7')
+    asm.op('addu', '$t2', '$t2', '$s0')
+    asm.op('lw', '$t3', 0, '$t2')
+    asm.op('addiu', '$t1', '$t1', -1)
+    asm.op('bne', '$t1', '$zero', 'loop')
+    trace, x = [], p['seed']
+    for i in range(p['count']):
+        x = xorshift(x)
+        index = (x & (blocks - 1)) >> (x >> 28)
+        trace.append((DATA_BASE + index * p['block'] + ((x >> 16) & offset_mask), 0))
+    return trace
+
+
+def gen_prodcons(asm, p):
+    mask = p['footprint'] - 1
+    asm.li('$s1', mask)
+    asm.li('$s2', p['lag'] * 4)
+    asm.op('addu', '$t0', '$zero', '$zero')
+    asm.label('loop')
+    asm.op('addu', '$t2', '$s0', '$t0')
+    asm.op('sw', '$t1', 0, '$t2')
+    asm.op('subu', '$t4', '$t0', '$s2')
+    asm.op('and', '$t4', '$t4', '$s1')
+    asm.op('addu', '$t4', '$t4', '$s0')
+    asm.op('lw', '$t3', 0, '$t4')
+    asm.op('addiu', '$t0', '$t0', 4)
+    asm.op('and', '$t0', '$t0', '$s1')
+    asm.op('addiu', '$t1', '$t1', -1)
+    asm.op('bne', '$t1', '$zero', 'loop')
+    trace = []
+    for i in range(p['count']):
+        trace.append((DATA_BASE + (4 * i) % p['footprint'], 1))
+        trace.append((DATA_BASE + (4 * (i - p['lag'])) % p['footprint'], 0))
+    return trace
+
+
+def gen_conflict(asm, p):
+    asm.li('$s1', p['ways'] * p['set_stride'])
+    asm.li('$s2', p['set_stride'])
+    asm.op('addu', '$t0', '$zero', '$zero')
+    asm.label('loop')
+    asm.op('addu', '$t2', '$s0', '$t0')
+    asm.op('lw', '$t3', 0, '$t2')
+    asm.op('addu', '$t0', '$t0', '$s2')
+    asm.op('bne', '$t0', '$s1', 'next')
+    asm.op('addu', '$t0', '$zero', '$zero')
+    asm.label('next')
+    asm.op('addiu', '$t1', '$t1', -1)
+    asm.op('bne', '$t1', '$zero', 'loop')
+    return [(DATA_BASE + (i % p['ways']) * p['set_stride'], 0) for i in range(p['count'])]
+
+
+PATTERNS = {
+    'stride': (gen_stride, {'stride': 4, 'footprint': 32768, 'count': 32768}),
+    'chase': (gen_chase, {'footprint': 131072, 'node': 32, 'count': 32768, 'seed': 1}),
+    'random': (gen_random, {'footprint': 1048576, 'count': 32768, 'seed': 1}),
+    'zipf': (gen_zipf, {'footprint': 1048576, 'block': 32, 'count': 32768, 'seed': 1}),
+    'prodcons': (gen_prodcons, {'footprint': 262144, 'lag': 256, 'count': 32768}),
+    'conflict': (gen_conflict, {'ways': 9, 'set_stride': 8192, 'count': 32768}),
+}
+
+# the corpus in this directory: (name, pattern, parameters, what it shows)
+SUITE = [
+    ('stride4', 'stride', {'stride': 4, 'footprint': 32768},
+     'sequential words: one compulsory miss per block, then all hits'),
+    ('stride32', 'stride', {'stride': 32, 'footprint': 262144},
+     'one access per block over 4x the cache: every access misses'),
+    ('stride4096', 'stride', {'stride': 4096, 'footprint': 1048576},
+     'a power-of-two stride maps 256 blocks onto 2 sets: every access misses'),
+    ('chase32k', 'chase', {'footprint': 32768},
+     'pointer chasing within the cache: misses only while building the list'),
+    ('chase256k', 'chase', {'footprint': 262144, 'node': 64, 'count': 16384},
+     'pointer chasing over 4x the cache: dependent, mostly missing loads'),
+    ('random16k', 'random', {'footprint': 16384},
+     'random loads in a resident footprint: compulsory misses only'),
+    ('random1m', 'random', {'footprint': 1048576},
+     'random loads over 16x the cache: mostly capacity misses'),
+    ('zipf1m', 'zipf', {'footprint': 1048576},
+     'skewed reuse over 16x the cache: the hot blocks stay resident'),
+    ('prodcons_near', 'prodcons', {'lag': 256},
+     'the consumer trails the producer by 1 KB: its loads hit'),
+    ('prodcons_far', 'prodcons', {'lag': 32768},
+     'the consumer trails by 128 KB, twice the cache: its loads miss'),
+    ('conflict8', 'conflict', {'ways': 8},
+     'round robin over 8 blocks of one set: fits the 8 ways, all hits'),
+    ('conflict9', 'conflict', {'ways': 9},
+     'round robin over 9 blocks of one 8-way set: LRU misses every time'),
+]
+
+# the default configuration of ./sim (src/config.h)
+L1D = {'size': 65536, 'assoc': 8, 'block': 32}
+
+
+def generate(name, pattern, params, note, outdir):
+    gen, defaults = PATTERNS[pattern]
+    p = dict(defaults)
+    p.update(params)
+
+    asm = Asm()
+    asm.op('lui', '$s0', DATA_BASE >> 16)
+    asm.li('$t1', p['count'])
+    trace = gen(asm, p)
+    asm.op('addiu', '$v0', '$zero', 10)
+    asm.op('syscall')
+
+    cache = Cache(L1D['size'], L1D['assoc'], L1D['block'])
+    for addr, write in trace:
+        cache.access(addr, write)
+
+    base = os.path.join(outdir, name)
+    with open(base + '.s', 'w') as f:
+        f.write('# %s: %s\n' % (name, note) if note else '# %s\n' % name)
+        f.write('# generated by memgen.py %s %s\n' % (pattern,
+                ' '.join('--%s=%s' % kv for kv in sorted(p.items()))))
+        f.write(asm.source())
+    with open(base + '.x', 'w') as f:
+        f.write(''.join('%08x\n' % w for w in asm.words()))
+
+    meta = {
+        'name': name,
+        'pattern': pattern,
+        'params': p,
+        'description': note,
+        'l1d': L1D,
+        'expected': {
+            'l1d_accesses': cache.accesses,
+            'l1d_misses': cache.misses,
+            'l1d_writebacks': cache.writebacks,
+            'l1d_miss_rate': round(cache.misses / cache.accesses, 4),
+        },
+    }
+    with open(base + '.json', 'w') as f:
+        json.dump(meta, f, indent=2, sort_keys=True)
+        f.write('\n')
+    return base + '.x', meta
+
+
+def check(sim, program, meta):
+    out = subprocess.run([sim, program], input='go\nstats\nquit\n', capture_output=True,
+                         text=True, timeout=60).stdout
+    stats = dict(re.findall(r'^Core0\.L1D\.(\w+): (\d+)$', out, re.M))
+    expected = meta['expected']
+    got = (int(stats.get('Accesses', -1)), int(stats.get('Misses', -1)), int(stats.get('Writebacks', -1)))
+    want = (expected['l1d_accesses'], expected['l1d_misses'], expected['l1d_writebacks'])
+    status = 'ok' if got == want else 'MISMATCH (sim %s, expected %s)' % (got, want)
+    print('%-16s accesses %6d  misses %6d  miss rate %.3f  %s' %
+          (meta['name'], want[0], want[1], expected['l1d_miss_rate'], status))
+    return got == want
+
+
+def main():
+    parser = argparse.ArgumentParser(description='memory-system stress workload generator')
+    parser.add_argument('pattern', nargs='?', choices=sorted(PATTERNS))
+    parser.add_argument('-o', '--output', help='output name (default: the pattern)')
+    parser.add_argument('--suite', action='store_true', help='regenerate the whole corpus')
+    parser.add_argument('--check', metavar='SIM', help='run each program under SIM and compare')
+    parser.add_argument('--dir', default=os.path.dirname(os.path.abspath(__file__)),
+                        help='output directory (default: this script\'s)')
+    for key in sorted(set(k for _, d in PATTERNS.values() for k in d)):
+        parser.add_argument('--' + key, type=int)
+    args = parser.parse_args()
+
+    if args.suite:
+        jobs = SUITE
+    elif args.pattern:
+        params = {k: v for k, v in vars(args).items()
+                  if k in PATTERNS[args.pattern][1] and v is not None}
+        jobs = [(args.output or args.pattern, args.pattern, params, '')]
+    else:
+        parser.error('give a pattern or --suite')
+
+    ok = True
+    for name, pattern, params, note in jobs:
+        program, meta = generate(name, pattern, params, note, args.dir)
+        if args.check:
+            ok &= check(args.check, program, meta)
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == '__main__':
+    main()
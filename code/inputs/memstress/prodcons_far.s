@@ -0,0 +1,22 @@
+# prodcons_far: the consumer trails by 128 KB, twice the cache: its loads miss
+# generated by memgen.py prodcons --count=32768 --footprint=262144 --lag=32768
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    lui $s1, 3
+    ori $s1, $s1, 0xffff
+    lui $s2, 2
+    addu $t0, $zero, $zero
+loop:
+    addu $t2, $s0, $t0
+    sw $t1, 0($t2)
+    subu $t4, $t0, $s2
+    and $t4, $t4, $s1
+    addu $t4, $t4, $s0
+    lw $t3, 0($t4)
+    addiu $t0, $t0, 4
+    and $t0, $t0, $s1
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
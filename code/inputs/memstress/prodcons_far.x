@@ -0,0 +1,18 @@
+3c101000
+34098000
+3c110003
+3631ffff
+3c120002
+00004021
+02085021
+ad490000
+01126023
+01916024
+01906021
+8d8b0000
+25080004
+01114024
+2529ffff
+1520fff6
+2402000a
+0000000c
@@ -0,0 +1,21 @@
+# random16k: random loads in a resident footprint: compulsory misses only
+# generated by memgen.py random --count=32768 --footprint=16384 --seed=1
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    ori $t5, $zero, 1
+    ori $s1, $zero, 0x3ffc
+loop:
+    sll $t6, $t5, 13
+    xor $t5, $t5, $t6
+    srl $t6, $t5, 17
+    xor $t5, $t5, $t6
+    sll $t6, $t5, 5
+    xor $t5, $t5, $t6
+    and $t2, $t5, $s1
+    addu $t2, $t2, $s0
+    lw $t3, 0($t2)
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
@@ -0,0 +1,18 @@
+3c101000
+34098000
+340d0001
+3c11000f
+3631fffc
+000d7340
+01ae6826
+000d7442
+01ae6826
+000d7140
+01ae6826
+01b15024
+01505021
+8d4b0000
+2529ffff
+1520fff5
+2402000a
+0000000c
@@ -0,0 +1,18 @@
+# stride32: one access per block over 4x the cache: every access misses
+# generated by memgen.py stride --count=32768 --footprint=262144 --stride=32
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    lui $s1, 3
+    ori $s1, $s1, 0xffff
+    ori $s2, $zero, 32
+    addu $t0, $zero, $zero
+loop:
+    addu $t2, $s0, $t0
+    lw $t3, 0($t2)
+    addu $t0, $t0, $s2
+    and $t0, $t0, $s1
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
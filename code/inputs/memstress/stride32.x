@@ -0,0 +1,14 @@
+3c101000
+34098000
+3c110003
+3631ffff
+34120020
+00004021
+02085021
+8d4b0000
+01124021
+01114024
+2529ffff
+1520fffa
+2402000a
+0000000c
@@ -0,0 +1,17 @@
+# stride4: sequential words: one compulsory miss per block, then all hits
+# generated by memgen.py stride --count=32768 --footprint=32768 --stride=4
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    ori $s1, $zero, 0x7fff
+    ori $s2, $zero, 4
+    addu $t0, $zero, $zero
+loop:
+    addu $t2, $s0, $t0
+    lw $t3, 0($t2)
+    addu $t0, $t0, $s2
+    and $t0, $t0, $s1
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
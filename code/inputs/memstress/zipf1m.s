@@ -0,0 +1,28 @@
+# zipf1m: skewed reuse over 16x the cache: the hot blocks stay resident
+# generated by memgen.py zipf --block=32 --count=32768 --footprint=1048576 --seed=1
+.text
+    lui $s0, 0x1000
+    ori $t1, $zero, 0x8000
+    ori $t5, $zero, 1
+    ori $s1, $zero, 0x7fff
+    ori $s2, $zero, 28
+loop:
+    sll $t6, $t5, 13
+    xor $t5, $t5, $t6
+    srl $t6, $t5, 17
+    xor $t5, $t5, $t6
+    sll $t6, $t5, 5
+    xor $t5, $t5, $t6
+    srl $t6, $t5, 28
+    and $t2, $t5, $s1
+    srlv $t2, $t2, $t6
+    sll $t2, $t2, 5
+    srl $t7, $t5, 16
+    and $t7, $t7, $s2
+    addu $t2, $t2, $t7
+    addu $t2, $t2, $s0
+    lw $t3, 0($t2)
+    addiu $t1, $t1, -1
+    bne $t1, $zero, loop
+    addiu $v0, $zero, 10
+    syscall
@@ -0,0 +1,24 @@
+3c101000
+34098000
+340d0001
+34117fff
+3412001c
+000d7340
+01ae6826
+000d7442
+01ae6826
+000d7140
+01ae6826
+000d7702
+01b15024
+01ca5006
+000a5140
+000d7c02
+01f27824
+014f5021
+01505021
+8d4b0000
+2529ffff
+1520ffef
+2402000a
+0000000c
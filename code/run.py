@@ -5,7 +5,7 @@
 # Juan Gomez Luna, 2017
 # Minesh Patel, 2020
 
-import sys, os, subprocess, re, glob, argparse
+import sys, os, subprocess, re, glob, argparse, json
 
 ref = "./basesim"
 sim = "./sim"
@@ -21,6 +21,9 @@ def main():
 
     parser = argparse.ArgumentParser()
     parser.add_argument("inputs", nargs="*", default=all_inputs)
+    parser.add_argument("--cosim", action="store_true",
+                        help="check every retired instruction against the functional model, "
+                             "also across a fast-forward in the middle of the run")
     parser = parser.parse_args()
 
     for i in parser.inputs:
@@ -29,7 +32,10 @@ def main():
             continue
 
         print(bold + "Testing: " + normal + i)
-        ref_out, sim_out = run(i)
+        ref_out, sim_out, cosim_out = run(i, parser.cosim)
+
+        for l in cosim_out:
+            print("  " + red + l + normal)
 
         print("  " + "Stats".ljust(14) + "BaselineSim".center(14) + "YourSim".center(14))
 
@@ -56,25 +62,73 @@ def main():
 
         if error == 0:
             print("  " + green + "REGISTER CONTENTS OK" + normal)
+
+        # inputs that document the statistics they must produce (e.g. the
+        # coherence counts of inputs/coherence) are rerun with their options
+        expected = run_expected(i)
+        if expected is not None:
+            for l in expected:
+                print("  " + red + l + normal)
+            if not expected:
+                print("  " + green + "EXPECTED STATS OK" + normal)
         print()
 
 
-def run(i):
+def run(i, cosim):
     global ref, sim
 
+    sim_args = [sim, "--cosim=1", i] if cosim else [sim, i]
     refproc = subprocess.Popen([ref, i], executable=ref, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
-    simproc = subprocess.Popen([sim, i], executable=sim, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    simproc = subprocess.Popen(sim_args, executable=sim, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
 
     cmds = b""
     cmdfile = os.path.splitext(i)[0] + ".cmd"
     if os.path.exists(cmdfile):
       cmds += open(cmdfile).read().encode('utf-8')
 
-    cmds += b"\ngo\nrdump\nquit\n"
-    (r, r_err) = refproc.communicate(input=cmds)
-    (s, s_err) = simproc.communicate(input=cmds)
+    (r, r_err) = refproc.communicate(input=cmds + b"\ngo\nrdump\nquit\n")
+    (s, s_err) = simproc.communicate(input=cmds + b"\ngo\nrdump\nquit\n")
+
+    s = s.decode('utf-8')
+    cosim_out = [l for l in s.split("\n") if l.startswith("Cosim:")]
+
+    # the same run with a fast-forward after some timing simulation must
+    # end in the same architectural state
+    if cosim:
+        ffproc = subprocess.Popen(sim_args, executable=sim, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        (f, f_err) = ffproc.communicate(input=cmds + b"\nrun 100\nfastforward 1000\ngo\nrdump\nquit\n")
+        f = f.decode('utf-8')
+        cosim_out += ["fast-forward: " + l for l in f.split("\n") if l.startswith("Cosim:")]
+        if arch_state(f) != arch_state(s):
+            cosim_out.append("fast-forward: architectural state differs from the timing run")
+
+    return filter_stats(r.decode('utf-8')), filter_stats(s), cosim_out
+
+
+def run_expected(i):
+    global sim
+
+    metafile = os.path.splitext(i)[0] + ".json"
+    if not os.path.exists(metafile):
+        return None
+    meta = json.load(open(metafile))
+    if "options" not in meta or "expected" not in meta:
+        return None
+
+    simproc = subprocess.Popen([sim] + meta["options"] + [i], executable=sim, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    (s, s_err) = simproc.communicate(input=b"go\nstats\nquit\n")
+    stats = dict(re.findall(r"^(\S+): (\S+)$", s.decode('utf-8'), re.M))
+
+    errors = []
+    for name, value in sorted(meta["expected"].items()):
+        if stats.get(name) != str(value):
+            errors.append("ERROR " + name + ": expected " + str(value) + ", got " + str(stats.get(name)))
+    return errors
+
 
-    return filter_stats(r.decode('utf-8')), filter_stats(s.decode('utf-8'))
+def arch_state(out):
+    regex = re.compile("^(HI|LO|R\d+|PC):")
+    return [l for l in out.split("\n") if regex.match(l)]
 
 
 def filter_stats(out):
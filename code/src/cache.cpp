@@ -0,0 +1,417 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: private L1 caches with MESI coherence
+ */
+
+#include "cache.h"
+#include "sim.h"
+#include <algorithm>
+#include <cassert>
+
+static int log2i(uint32_t x)
+{
+    int n = 0;
+    while ((1u << n) < x)
+        n++;
+    return n;
+}
+
+Cache::Cache(uint32_t size, uint32_t assoc, uint32_t block_size, uint32_t miss_latency)
+    : num_sets(size / (assoc * block_size)), assoc(assoc), block_size(block_size),
+      block_bits(log2i(block_size)), miss_latency(miss_latency),
+      sector_size(block_size), sector_bits(log2i(block_size)), beat_bytes(0), cwf(0), ways(assoc),
+      blocks(size / block_size), lru_clock(0), valid_blocks(0), bus(nullptr),
+      mem(nullptr), decompress_latency(0), next(nullptr), stream(STREAM_DATA),
+      clock(nullptr)
+{
+    /* remote_words holds one bit per 32-bit word */
+    assert(block_size >= 4 && block_size <= 256);
+    assert(num_sets > 0 && (num_sets & (num_sets - 1)) == 0);
+}
+
+void Cache::enable_compression(const Sim_Memory *mem, uint32_t tags_per_way, uint32_t latency)
+{
+    assert(valid_blocks == 0 && block_size >= CACHE_SEGMENT);
+    this->mem = mem;
+    decompress_latency = latency;
+    ways = assoc * tags_per_way;
+    blocks.assign(num_sets * ways, Cache_Block());
+}
+
+void Cache::enable_partitioning(uint32_t interval)
+{
+    umon.reset(new Umon(num_sets, assoc, interval));
+}
+
+void Cache::enable_sectors(uint32_t size)
+{
+    /* the sector bitmaps hold at most 64 sectors */
+    assert(valid_blocks == 0 && size >= 4 && size <= block_size && block_size / size <= 64);
+    sector_size = size;
+    sector_bits = log2i(size);
+}
+
+uint32_t Cache::fill(Cache_Block *b, uint32_t addr, int write, int stream)
+{
+    stats.transfer_bytes += sector_size;
+    stats.energy += timing.fill_energy * sector_size / block_size;
+    b->fill_beats = 0;
+
+    if (next)
+        return next->access(addr, write, stream);
+    if (!beat_bytes || beat_bytes >= sector_size)
+        return miss_latency;
+
+    uint32_t beats = sector_size / beat_bytes;
+    uint32_t whole = miss_latency + beats - 1;
+    if (!cwf)
+        return whole;
+
+    /* early restart: the requester goes on with the first beat */
+    stats.restart_cycles += whole - miss_latency;
+    if (clock) {
+        b->fill_cycle = *clock;
+        b->fill_start = addr & (block_size - 1) & ~(sector_size - 1);
+        b->fill_first = (addr & (sector_size - 1)) / beat_bytes;
+        b->fill_beats = beats;
+    }
+    return miss_latency;
+}
+
+uint32_t Cache::fill_wait(Cache_Block *b, uint32_t addr)
+{
+    uint32_t offset = addr & (block_size - 1);
+
+    if (b->fill_beats <= 1 || (offset & ~(sector_size - 1)) != b->fill_start)
+        return 0;
+
+    /* beats arrive from the critical one on, wrapping around the sector */
+    uint32_t beat = (offset & (sector_size - 1)) / beat_bytes;
+    uint32_t order = (beat + b->fill_beats - b->fill_first) % b->fill_beats;
+    uint32_t arrival = b->fill_cycle + miss_latency + order;
+    if (arrival <= *clock) {
+        if (order == b->fill_beats - 1)
+            b->fill_beats = 0;
+        return 0;
+    }
+
+    stats.fill_wait_cycles += arrival - *clock;
+    return arrival - *clock;
+}
+
+void Cache::writeback(Cache_Block *b)
+{
+    uint32_t sectors = __builtin_popcountll(b->dirty_sectors);
+
+    stats.writebacks++;
+    stats.writeback_bytes += sectors * sector_size;
+    stats.energy += timing.fill_energy * sectors * sector_size / block_size;
+    b->dirty_sectors = 0;
+}
+
+/* the k-byte little-endian element at 'p', sign-extended */
+static int64_t bdi_element(const uint8_t *p, int k)
+{
+    uint64_t x = 0;
+    for (int i = k - 1; i >= 0; i--)
+        x = (x << 8) | p[i];
+    int shift = 64 - 8 * k;
+    return (int64_t)(x << shift) >> shift;
+}
+
+/* x - base, wrapped to a k-byte element like the hardware's subtractor */
+static int64_t bdi_delta(int64_t x, int64_t base, int k)
+{
+    int shift = 64 - 8 * k;
+    return (int64_t)(((uint64_t)x - (uint64_t)base) << shift) >> shift;
+}
+
+/* does 'x' fit in a d-byte signed delta? */
+static int bdi_fits(int64_t x, int d)
+{
+    int64_t limit = 1LL << (8 * d - 1);
+    return x >= -limit && x < limit;
+}
+
+/* Compressed size in bytes of a block under Base-Delta-Immediate: all
+ * zeros, one repeated 8-byte value, or n k-byte elements (k = 8, 4, 2)
+ * stored as d-byte deltas (d < k) from either one explicit base or an
+ * implicit zero base, plus a bit per element choosing the base. A block
+ * that fits none of these is stored as is. */
+static uint32_t bdi_size(const uint8_t *data, uint32_t len)
+{
+    int zero = 1;
+    for (uint32_t i = 0; i < len && zero; i++)
+        zero = data[i] == 0;
+    if (zero)
+        return 1;
+
+    int repeated = len >= 8;
+    for (uint32_t i = 8; i < len && repeated; i++)
+        repeated = data[i] == data[i % 8];
+    if (repeated)
+        return 8;
+
+    static const int bases[] = {8, 4, 2}, deltas[] = {1, 2, 4};
+    uint32_t best = len;
+    for (int k : bases) {
+        uint32_t n = len / k;
+        if (n == 0)
+            continue;
+        for (int d : deltas) {
+            if (d >= k || k + n * d + (n + 7) / 8 >= best)
+                continue;
+
+            /* the base is the first element that is not an immediate */
+            int have_base = 0, fits = 1;
+            int64_t base = 0;
+            for (uint32_t i = 0; i < n && fits; i++) {
+                int64_t x = bdi_element(data + i * k, k);
+                if (bdi_fits(x, d))
+                    continue;
+                if (!have_base) {
+                    base = x;
+                    have_base = 1;
+                }
+                fits = bdi_fits(bdi_delta(x, base, k), d);
+            }
+            if (fits)
+                best = k + n * d + (n + 7) / 8;
+        }
+    }
+    return best;
+}
+
+Cache_Block *Cache::lookup(uint32_t addr)
+{
+    uint32_t block = addr >> block_bits;
+    Cache_Block *set = &blocks[(block & (num_sets - 1)) * ways];
+
+    for (uint32_t w = 0; w < ways; w++) {
+        if (set[w].state != COH_I && set[w].tag == block)
+            return &set[w];
+    }
+    return nullptr;
+}
+
+/* another cache is reading the block: give up exclusivity. Returns 1 if we
+ * held a copy (so the requester must take it in S). */
+int Cache::snoop_read(uint32_t addr)
+{
+    Cache_Block *b = lookup(addr);
+    stats.energy += timing.tag_energy;
+    if (!b)
+        return 0;
+
+    /* a modified block is flushed back to memory on its way to S */
+    if (b->state == COH_M)
+        writeback(b);
+    b->state = COH_S;
+    return 1;
+}
+
+/* another cache is about to write the block: drop our copy, but keep the
+ * tag so that our next miss on it can be classified */
+void Cache::snoop_invalidate(uint32_t addr)
+{
+    Cache_Block *b = lookup(addr);
+    stats.energy += timing.tag_energy;
+    if (!b)
+        return;
+
+    /* a modified block is flushed to the writer before it is dropped */
+    if (b->state == COH_M)
+        writeback(b);
+    b->state = COH_I;
+    b->coh_inval = 1;
+    b->remote_words = 0;
+    stats.invalidations++;
+    valid_blocks--;
+}
+
+/* another cache wrote a word of the block: remember which one, if we lost
+ * our copy of it to an invalidation */
+void Cache::snoop_write(uint32_t addr)
+{
+    uint32_t block = addr >> block_bits;
+    Cache_Block *set = &blocks[(block & (num_sets - 1)) * ways];
+
+    for (uint32_t w = 0; w < ways; w++) {
+        if (set[w].state == COH_I && set[w].coh_inval && set[w].tag == block)
+            set[w].remote_words |= 1ULL << ((addr & (block_size - 1)) >> 2);
+    }
+}
+
+uint32_t Cache::compressed_segments(uint32_t block) const
+{
+    uint8_t data[256];
+    uint32_t addr = block << block_bits;
+
+    for (uint32_t i = 0; i < block_size; i += 4) {
+        uint32_t word = mem->read_32(addr + i);
+        for (int j = 0; j < 4; j++)
+            data[i + j] = (word >> (8 * j)) & 0xFF;
+    }
+    return (bdi_size(data, block_size) + CACHE_SEGMENT - 1) / CACHE_SEGMENT;
+}
+
+void Cache::make_room(Cache_Block *set, Cache_Block *keep)
+{
+    uint32_t capacity = assoc * block_size / CACHE_SEGMENT;
+
+    for (;;) {
+        uint32_t used = 0;
+        Cache_Block *lru = nullptr;
+        for (uint32_t w = 0; w < ways; w++) {
+            Cache_Block *b = &set[w];
+            if (b->state == COH_I)
+                continue;
+            used += b->segments;
+            if (b != keep && (!lru || b->lru < lru->lru))
+                lru = b;
+        }
+        if (used <= capacity || !lru)
+            return;
+
+        if (lru->state == COH_M)
+            writeback(lru);
+        lru->state = COH_I;
+        lru->coh_inval = 0;
+        stats.space_evictions++;
+        valid_blocks--;
+    }
+}
+
+uint32_t Cache::access(uint32_t addr, int write, int stream)
+{
+    uint32_t block = addr >> block_bits;
+    Cache_Block *set = &blocks[(block & (num_sets - 1)) * ways];
+    uint64_t word_bit = 1ULL << ((addr & (block_size - 1)) >> 2);
+    uint64_t sector_bit = 1ULL << ((addr & (block_size - 1)) >> sector_bits);
+
+    if (umon)
+        umon_access(*umon, block & (num_sets - 1), block, stream);
+
+    stats.accesses++;
+    stats.resident_blocks += valid_blocks;
+    lru_clock++;
+
+    Cache_Block *b = lookup(addr);
+    if (b) {
+        int sector_hit = (b->valid_sectors & sector_bit) != 0;
+        if (sector_hit)
+            stats.hits++;
+        else {
+            stats.misses++;
+            stats.sector_misses++;
+        }
+        stats.energy += write ? timing.write_energy : timing.read_energy;
+        b->lru = lru_clock;
+
+        if (write) {
+            /* S -> M needs the other copies gone; E -> M is silent */
+            if (b->state == COH_S && bus) {
+                stats.bus_upgr++;
+                for (Cache *c : bus->caches)
+                    if (c != this) c->snoop_invalidate(addr);
+            }
+            b->state = COH_M;
+            b->dirty_sectors |= sector_bit;
+
+            if (bus) {
+                for (Cache *c : bus->caches)
+                    if (c != this) c->snoop_write(addr);
+            }
+        }
+
+        if (!sector_hit) {
+            b->valid_sectors |= sector_bit;
+            return timing.tag_latency + fill(b, addr, write, stream);
+        }
+
+        if (mem) {
+            b->segments = compressed_segments(block);
+            make_room(set, b);
+            if (b->segments < block_size / CACHE_SEGMENT)
+                return timing.hit_latency + decompress_latency;
+        }
+        return timing.hit_latency + fill_wait(b, addr);
+    }
+
+    stats.misses++;
+
+    /* the lookup that missed */
+    stats.energy += write ? timing.tag_energy : timing.read_energy;
+
+    /* a block we lost to an invalidation is the natural victim, and makes
+     * this a coherence miss */
+    Cache_Block *victim = nullptr;
+    for (uint32_t w = 0; w < ways; w++) {
+        if (set[w].coh_inval && set[w].state == COH_I && set[w].tag == block) {
+            victim = &set[w];
+            stats.coherence_misses++;
+            if (!(victim->remote_words & word_bit))
+                stats.false_sharing_misses++;
+            break;
+        }
+    }
+
+    /* otherwise an invalid block, otherwise the least recently used one */
+    for (uint32_t w = 0; w < ways && !victim; w++) {
+        if (set[w].state == COH_I)
+            victim = &set[w];
+    }
+    if (!victim && umon)
+        victim = umon_victim(*umon, set, ways, stream);
+    if (!victim) {
+        victim = &set[0];
+        for (uint32_t w = 1; w < ways; w++) {
+            if (set[w].lru < victim->lru)
+                victim = &set[w];
+        }
+    }
+
+    if (victim->state == COH_M)
+        writeback(victim);
+    if (victim->state == COH_I)
+        valid_blocks++;
+
+    if (write) {
+        /* BusRdX: fetch the block and invalidate all other copies */
+        if (bus) {
+            stats.bus_rdx++;
+            for (Cache *c : bus->caches)
+                if (c != this) c->snoop_invalidate(addr);
+            for (Cache *c : bus->caches)
+                if (c != this) c->snoop_write(addr);
+        }
+        victim->state = COH_M;
+    }
+    else {
+        /* BusRd: take the block exclusive unless someone else has it */
+        int shared = 0;
+        if (bus) {
+            stats.bus_rd++;
+            for (Cache *c : bus->caches)
+                if (c != this) shared |= c->snoop_read(addr);
+        }
+        victim->state = shared ? COH_S : COH_E;
+    }
+
+    victim->tag = block;
+    victim->stream = stream;
+    victim->valid_sectors = sector_size < block_size ? sector_bit : 1;
+    victim->dirty_sectors = write ? sector_bit : 0;
+    victim->lru = lru_clock;
+    victim->coh_inval = 0;
+    victim->remote_words = 0;
+
+    if (mem) {
+        victim->segments = compressed_segments(block);
+        stats.fill_bytes += victim->segments * CACHE_SEGMENT;
+        make_room(set, victim);
+    }
+
+    return timing.tag_latency + fill(victim, addr, write, stream);
+}
@@ -0,0 +1,227 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: private L1 caches with MESI coherence
+ */
+
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+#include "cachemodel.h"
+#include "umon.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* The caches only track tags and coherence state; data always lives in the
+ * shared main memory (mem_read_32/mem_write_32). A cache access therefore
+ * decides only how many cycles the requesting stage must stall and which
+ * coherence actions the access causes in the other cores' caches.
+ *
+ * A compressed cache (enable_compression(), --l1d_compress) decouples tags
+ * from data: each set has tags_per_way times as many tags as data ways, and
+ * a data store of assoc * block_size bytes in CACHE_SEGMENT-byte segments.
+ * Blocks are stored in Base-Delta-Immediate (BDI) form, sized from their
+ * current contents in memory, so a set holds as many blocks as fit both
+ * its tags and its segments. A block's size is refreshed whenever it is
+ * accessed (a store's own data counts from the next access on); if the set
+ * then overflows, LRU blocks are evicted to make room. Hits on compressed
+ * blocks pay the decompression latency.
+ *
+ * Hits cost timing.hit_latency cycles and misses timing.tag_latency on top
+ * of the miss penalty, both 0 unless --cache_model derives them from the
+ * geometry (cachemodel.h), which also sets the energies charged to
+ * stats.energy.
+ *
+ * A cache with a next level (the unified L2, --l2_size) sends its misses
+ * there instead of paying miss_latency, as accesses of its own stream. The
+ * L2 is private to its core and not kept coherent: like the L1s it only
+ * decides timing, so a block another core wrote may still hit in it.
+ *
+ * A sectored cache (enable_sectors(), --sector_size) keeps one tag per
+ * block but fills and writes back sector by sector, with a valid and a
+ * dirty bit per sector: a miss allocates the block and fetches only the
+ * sector it needs, and an access to an invalid sector of a present block
+ * is a sector miss that fetches just that sector.
+ *
+ * With beat_bytes set (--mem_bus_bytes), a fill from main memory arrives
+ * in beats of that many bytes, the first after miss_latency cycles and
+ * one more every cycle; the requester waits for the whole sector. With
+ * critical-word-first (--cwf) the beat holding the requested word comes
+ * first and the requester restarts as soon as it is there; the rest
+ * arrives wrapping around the sector, and an access to a word that has
+ * not arrived yet waits for it (only the block's latest fill is
+ * tracked). */
+#define CACHE_SEGMENT 8
+
+struct Sim_Memory;
+
+/* MESI coherence states */
+enum Coh_State {
+    COH_I = 0, /* invalid */
+    COH_S,     /* shared, clean */
+    COH_E,     /* exclusive, clean */
+    COH_M      /* modified (dirty), exclusive */
+};
+
+struct Cache_Block {
+    uint32_t tag;     /* block address (address / block size) */
+    int state;        /* Coh_State */
+    uint64_t lru;     /* time of last access, for LRU replacement */
+
+    /* false-sharing detection: a block invalidated by a remote write keeps
+     * its tag, and remembers which words other cores wrote since then */
+    int coh_inval;
+    uint64_t remote_words;
+
+    /* data segments in use (compressed caches) */
+    uint32_t segments;
+
+    /* Cache_Stream that filled the block (unified caches) */
+    int stream;
+
+    /* one bit per sector (a single one if unsectored) */
+    uint64_t valid_sectors, dirty_sectors;
+
+    /* the fill in progress, if fill_beats > 1: requested in cycle
+     * fill_cycle for the sector at block offset fill_start, critical beat
+     * first */
+    uint32_t fill_cycle, fill_start, fill_first, fill_beats;
+
+    Cache_Block() : tag(0), state(COH_I), lru(0), coh_inval(0), remote_words(0), segments(0),
+                    stream(STREAM_INSTR), valid_sectors(0), dirty_sectors(0),
+                    fill_cycle(0), fill_start(0), fill_first(0), fill_beats(0) {}
+};
+
+struct Cache_Stats {
+    uint64_t accesses, hits, misses, writebacks;
+
+    /* coherence traffic issued by this cache */
+    uint64_t bus_rd, bus_rdx, bus_upgr;
+    /* blocks this cache lost to other cores' writes */
+    uint64_t invalidations;
+    /* misses to blocks lost to an invalidation; false sharing if the
+     * word we want was not one the other cores wrote */
+    uint64_t coherence_misses, false_sharing_misses;
+
+    /* compression: compressed bytes of all blocks filled, valid blocks
+     * resident summed over all accesses, and blocks evicted only to free
+     * data segments */
+    uint64_t fill_bytes, resident_blocks, space_evictions;
+
+    /* dynamic energy of the accesses, fills and snoops (fJ) */
+    uint64_t energy;
+
+    /* sectors and fill timing: misses to an invalid sector of a present
+     * block, bytes filled and written back, requester stall cycles
+     * critical-word-first saved, and cycles spent waiting for words of a
+     * fill still in progress */
+    uint64_t sector_misses, transfer_bytes, writeback_bytes;
+    uint64_t restart_cycles, fill_wait_cycles;
+
+    Cache_Stats() : accesses(0), hits(0), misses(0), writebacks(0),
+                    bus_rd(0), bus_rdx(0), bus_upgr(0), invalidations(0),
+                    coherence_misses(0), false_sharing_misses(0),
+                    fill_bytes(0), resident_blocks(0), space_evictions(0), energy(0),
+                    sector_misses(0), transfer_bytes(0), writeback_bytes(0),
+                    restart_cycles(0), fill_wait_cycles(0) {}
+};
+
+struct Cache;
+
+/* snooping bus connecting the coherent caches. Every miss and upgrade is
+ * broadcast to all other caches on the bus; transactions are atomic. */
+struct Coherence_Bus {
+    std::vector<Cache *> caches;
+};
+
+struct Cache {
+    uint32_t num_sets, assoc, block_size;
+    int block_bits;
+    uint32_t miss_latency;
+
+    /* sector size (block_size if unsectored), memory fill beat size (0:
+     * a fill arrives at once) and critical-word-first */
+    uint32_t sector_size;
+    int sector_bits;
+    uint32_t beat_bytes;
+    int cwf;
+
+    /* tags per set: assoc, or more in a compressed cache */
+    uint32_t ways;
+
+    std::vector<Cache_Block> blocks; /* num_sets * ways, set-major */
+    uint64_t lru_clock;
+    uint32_t valid_blocks;
+
+    /* NULL for a cache that does not participate in coherence */
+    Coherence_Bus *bus;
+
+    /* the memory whose contents a compressed cache sizes its blocks by;
+     * NULL for an uncompressed cache */
+    const Sim_Memory *mem;
+    uint32_t decompress_latency;
+
+    /* hit and tag latency, and energy per access */
+    Cache_Timing timing;
+
+    /* where misses go (NULL: main memory), as accesses of 'stream'; and
+     * the way partitioning of a unified cache (NULL if off) */
+    Cache *next;
+    int stream;
+    std::unique_ptr<Umon> umon;
+
+    /* the owning core's cycle count, for fills in progress (set once the
+     * core no longer moves) */
+    const uint32_t *clock;
+
+    Cache_Stats stats;
+
+    Cache() : num_sets(0), assoc(0), block_size(0), block_bits(0),
+              miss_latency(0), sector_size(0), sector_bits(0), beat_bytes(0), cwf(0),
+              ways(0), lru_clock(0), valid_blocks(0), bus(nullptr),
+              mem(nullptr), decompress_latency(0), next(nullptr), stream(STREAM_DATA),
+              clock(nullptr) {}
+    Cache(uint32_t size, uint32_t assoc, uint32_t block_size, uint32_t miss_latency);
+
+    /* switch an empty cache to BDI-compressed storage */
+    void enable_compression(const Sim_Memory *mem, uint32_t tags_per_way, uint32_t latency);
+
+    /* perform a read or write access; returns the number of cycles the
+     * requesting stage must stall (0 on a hit). A unified cache charges
+     * it to 'stream', any other to its own. */
+    uint32_t access(uint32_t addr, int write) { return access(addr, write, stream); }
+    uint32_t access(uint32_t addr, int write, int stream);
+
+    /* partition the ways between the streams, repartitioning every
+     * 'interval' accesses (umon.h) */
+    void enable_partitioning(uint32_t interval);
+
+    /* fill and write back an empty cache in sectors of 'size' bytes */
+    void enable_sectors(uint32_t size);
+
+    /* find the valid block holding 'addr', or NULL */
+    Cache_Block *lookup(uint32_t addr);
+
+    /* bus side: react to another cache's transaction for 'addr' */
+    int snoop_read(uint32_t addr);
+    void snoop_invalidate(uint32_t addr);
+    void snoop_write(uint32_t addr);
+
+    /* compression: the data segments block number 'block' needs now, and
+     * evicting blocks of 'set' other than 'keep' until the set fits */
+    uint32_t compressed_segments(uint32_t block) const;
+    void make_room(Cache_Block *set, Cache_Block *keep);
+
+    /* fetch the sector of 'b' holding 'addr'; returns the cycles until
+     * the word at 'addr' is there */
+    uint32_t fill(Cache_Block *b, uint32_t addr, int write, int stream);
+
+    /* cycles until the word at 'addr' of a fill in progress arrives */
+    uint32_t fill_wait(Cache_Block *b, uint32_t addr);
+
+    /* write a modified block's dirty sectors back */
+    void writeback(Cache_Block *b);
+};
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: cache access latency and energy model
+ */
+
+#include "cachemodel.h"
+#include <cmath>
+
+/* model coefficients (45 nm) */
+static const double T_DATA_BASE = 0.20;     /* decode, sense, drive out (ns) */
+static const double T_TAG_BASE = 0.15;
+static const double T_PER_SQRT_KB = 0.09;   /* wire delay (ns per sqrt(KB)) */
+static const double T_PER_WAY_BIT = 0.04;   /* compare and way mux (ns per log2(assoc)) */
+static const double T_PER_OUT_BIT = 0.01;   /* output width (ns per log2(words)) */
+static const double T_MUX = 0.05;           /* tag match to way select (ns) */
+static const double PORT_AREA = 0.5;        /* cell area each extra port adds */
+static const double E_BIT = 2.5;            /* fJ per bit per sqrt(KB of subarray) */
+static const double E_WIRE = 300.0;         /* fJ per access per sqrt(KB) */
+static const double E_MEM_BIT = 20000.0;    /* fJ per bit to or from DRAM */
+static const double LEAK_PER_KB = 0.5;      /* mW per KB of cells */
+static const uint32_t STATE_BITS = 2;       /* MESI state per tag */
+
+static int log2i(uint32_t x)
+{
+    int n = 0;
+    while ((1u << n) < x)
+        n++;
+    return n;
+}
+
+/* cycles an access of 't' ns needs beyond its first */
+static uint32_t extra_cycles(double t, uint32_t clock_mhz)
+{
+    double cycles = std::ceil(t * clock_mhz / 1000.0 - 1e-9);
+    return cycles > 1 ? (uint32_t)cycles - 1 : 0;
+}
+
+Cache_Timing cache_timing(uint32_t size, uint32_t assoc, uint32_t block_size,
+                          uint32_t ports, uint32_t clock_mhz)
+{
+    Cache_Timing t;
+    uint32_t sets = size / (assoc * block_size);
+    uint32_t tag_bits = 32 - log2i(sets) - log2i(block_size) + STATE_BITS;
+    uint32_t block_bits = 8 * block_size;
+    double area = 1.0 + PORT_AREA * (ports > 1 ? ports - 1 : 0);
+    double kb = size / 1024.0 * area;
+    double tag_kb = (double)sets * assoc * tag_bits / 8 / 1024 * area;
+
+    t.access_ns = T_DATA_BASE + T_PER_SQRT_KB * std::sqrt(kb) +
+                  T_PER_WAY_BIT * log2i(assoc) + T_PER_OUT_BIT * log2i(block_size / 4);
+    t.tag_ns = T_TAG_BASE + T_PER_SQRT_KB * std::sqrt(tag_kb) + T_PER_WAY_BIT * log2i(assoc);
+    t.hit_latency = extra_cycles(std::fmax(t.access_ns, t.tag_ns + T_MUX), clock_mhz);
+    t.tag_latency = extra_cycles(t.tag_ns, clock_mhz);
+
+    double wire = E_WIRE * std::sqrt(kb);
+    double way = block_bits * E_BIT * std::sqrt(kb / assoc);
+    double tags = assoc * tag_bits * E_BIT * std::sqrt(tag_kb);
+
+    t.read_energy = (uint64_t)(wire + tags + assoc * way);
+    t.write_energy = (uint64_t)(wire + tags + way);
+    t.fill_energy = (uint64_t)(wire + way);
+    t.tag_energy = (uint64_t)(wire + tags);
+    t.mem_energy = (uint64_t)(block_bits * E_MEM_BIT);
+    t.leakage_mw = LEAK_PER_KB * (kb + tag_kb);
+    return t;
+}
@@ -0,0 +1,64 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: cache access latency and energy model
+ */
+
+#ifndef _CACHEMODEL_H_
+#define _CACHEMODEL_H_
+
+#include <cstdint>
+
+/* With --cache_model=1, each L1 cache's hit latency, tag latency and energy
+ * per access are derived from its geometry instead of being free. The model
+ * is analytical, in the spirit of CACTI, with coefficients fitted by hand to
+ * published 45 nm SRAM figures:
+ *
+ *   - Wires dominate: the data array's access time grows with the square
+ *     root of its area (capacity, times the extra area each additional
+ *     port's wordlines and bitlines take), and associativity adds the tag
+ *     comparison and way multiplexing. The tag array is sized from the tag
+ *     and state bits each block needs, and a hit completes when both the
+ *     data and the (parallel) tag lookup have.
+ *
+ *   - A read reads the tags and the data of every way of the set in
+ *     parallel; a write reads the tags and writes one way; a fill or a
+ *     writeback moves one block; a snoop reads only the tags. Bit energies
+ *     grow with the square root of the subarray's area (bitline length),
+ *     and every access drives the address and data wires across the array.
+ *
+ *   - Leakage is proportional to the number of cells.
+ *
+ * Times are converted to cycles of a --clock_mhz core: the fetch and memory
+ * stages already spend one cycle on the access, so a cache that fits in one
+ * cycle adds nothing, and a slower one stalls the stage for the rest. A
+ * miss is known only once the tags have been checked, so it costs the tag
+ * latency on top of the miss penalty.
+ *
+ * Energies are in femtojoules, so that they add up exactly in the 64-bit
+ * statistics counters. */
+struct Cache_Timing {
+    /* array access times (ns) and what they cost beyond the stage's own
+     * cycle */
+    double access_ns, tag_ns;
+    uint32_t hit_latency, tag_latency;
+
+    /* dynamic energy per access (fJ), and per block moved to or from
+     * main memory */
+    uint64_t read_energy, write_energy, fill_energy, tag_energy;
+    uint64_t mem_energy;
+
+    /* static power (mW) */
+    double leakage_mw;
+
+    Cache_Timing() : access_ns(0), tag_ns(0), hit_latency(0), tag_latency(0),
+                     read_energy(0), write_energy(0), fill_energy(0), tag_energy(0),
+                     mem_energy(0), leakage_mw(0) {}
+};
+
+/* the model's figures for a cache of 'size' bytes with 'ports' read/write
+ * ports, in a core clocked at 'clock_mhz' */
+Cache_Timing cache_timing(uint32_t size, uint32_t assoc, uint32_t block_size,
+                          uint32_t ports, uint32_t clock_mhz);
+
+#endif
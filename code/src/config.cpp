@@ -0,0 +1,267 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: run-time configuration
+ */
+
+#include "config.h"
+#include "umon.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* one command-line option: "--name=value" stores value into *field. Options
+ * with a list of names take one of those names and store its index; text
+ * options (field == nullptr) store the string itself into *text. */
+struct Config_Option {
+    const char *name;
+    uint32_t Sim_Config::*field;
+    const char *help;
+    const char *const *names;
+    std::string Sim_Config::*text;
+};
+
+static const char *const core_names[] = { "inorder", "ooo", nullptr };
+static const char *const muldiv_names[] = { "simple", "pipelined", nullptr };
+static const char *const sample_unit_names[] = { "cycles", "instructions", nullptr };
+
+static const Config_Option options[] = {
+    { "cores",       &Sim_Config::ncores,      "number of cores" },
+    { "core",        &Sim_Config::core_model,  "core model", core_names },
+    { "width",       &Sim_Config::width,       "ops fetched/decoded/executed/retired per cycle" },
+    { "alu_ports",   &Sim_Config::alu_ports,   "ops executed per cycle (0 = width)" },
+    { "mem_ports",   &Sim_Config::mem_ports,   "loads/stores per cycle in the memory stage" },
+    { "rob_size",    &Sim_Config::rob_size,    "ooo: reorder buffer entries" },
+    { "iq_size",     &Sim_Config::iq_size,     "ooo: issue queue entries" },
+    { "lsq_size",    &Sim_Config::lsq_size,    "ooo: load/store queue entries" },
+    { "muldiv",      &Sim_Config::muldiv,      "HI/LO unit model", muldiv_names },
+    { "mul_latency", &Sim_Config::mul_latency, "multiply latency (cycles)" },
+    { "div_latency", &Sim_Config::div_latency, "divide latency (cycles; pipelined: the longest)" },
+    { "block_size",  &Sim_Config::block_size,  "L1 block size (bytes)" },
+    { "l1i_size",    &Sim_Config::l1i_size,    "L1 instruction cache size (bytes)" },
+    { "l1i_assoc",   &Sim_Config::l1i_assoc,   "L1 instruction cache associativity" },
+    { "l1d_size",    &Sim_Config::l1d_size,    "L1 data cache size (bytes)" },
+    { "l1d_assoc",   &Sim_Config::l1d_assoc,   "L1 data cache associativity" },
+    { "l1d_compress", &Sim_Config::l1d_compress, "BDI-compress the L1 data cache (0/1)" },
+    { "compress_tags", &Sim_Config::compress_tags, "l1d_compress: tags per data way" },
+    { "decompress_latency", &Sim_Config::decompress_latency, "l1d_compress: compressed hit latency (cycles)" },
+    { "sector_size", &Sim_Config::sector_size, "L1 data cache sector size (bytes, 0 = whole blocks)" },
+    { "mem_bus_bytes", &Sim_Config::mem_bus_bytes, "bytes per memory bus beat of a fill (0 = all at once)" },
+    { "cwf",         &Sim_Config::cwf,         "critical-word-first fills with early restart (0/1)" },
+    { "ftq",         &Sim_Config::ftq_size,    "fetch target queue entries (0 = no decoupled front end)" },
+    { "btb_entries", &Sim_Config::btb_entries, "ftq: branch target buffer entries" },
+    { "l2_size",     &Sim_Config::l2_size,     "unified L2 cache size (bytes, 0 = none)" },
+    { "l2_assoc",    &Sim_Config::l2_assoc,    "L2 associativity" },
+    { "l2_latency",  &Sim_Config::l2_latency,  "L2 lookup latency, paid by hits and misses (cycles)" },
+    { "l2_partition", &Sim_Config::l2_partition, "UMON way partitioning of the L2 between instructions and data (0/1)" },
+    { "umon_interval", &Sim_Config::umon_interval, "l2_partition: L2 accesses between decisions" },
+    { "mem_latency", &Sim_Config::mem_latency, "last-level cache miss penalty, on top of its lookup (cycles)" },
+    { "cache_model", &Sim_Config::cache_model, "derive cache latency and energy from geometry (0/1)" },
+    { "clock_mhz",   &Sim_Config::clock_mhz,   "cache_model: core clock (MHz)" },
+    { "tlb",         &Sim_Config::tlb,         "model TLBs and page walks (0/1)" },
+    { "page_size",   &Sim_Config::page_size,   "tlb: page size (bytes)" },
+    { "itlb_entries", &Sim_Config::itlb_entries, "tlb: instruction TLB entries" },
+    { "dtlb_entries", &Sim_Config::dtlb_entries, "tlb: data TLB entries" },
+    { "l2tlb_entries", &Sim_Config::l2tlb_entries, "tlb: L2 TLB entries" },
+    { "l2tlb_assoc", &Sim_Config::l2tlb_assoc, "tlb: L2 TLB associativity" },
+    { "l2tlb_latency", &Sim_Config::l2tlb_latency, "tlb: L2 TLB hit latency (cycles)" },
+    { "sample",      &Sim_Config::sample_interval, "interval statistics period (0 = off)" },
+    { "sample_unit", &Sim_Config::sample_unit, "interval statistics period unit", sample_unit_names },
+    { "sample_file", nullptr, "interval statistics output (.csv or binary)", nullptr, &Sim_Config::sample_file },
+    { "cosim",       &Sim_Config::cosim,       "check each retire against a functional model (0/1)" },
+    { "host_stats",  &Sim_Config::host_stats,  "report host time and simulation speed (0/1)" },
+};
+
+static bool is_pow2(uint32_t x)
+{
+    return x != 0 && (x & (x - 1)) == 0;
+}
+
+/* can 'path' be created, or overwritten? */
+static bool writable(const std::string &path)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0)
+        return !S_ISDIR(st.st_mode) && access(path.c_str(), W_OK) == 0;
+
+    size_t slash = path.rfind('/');
+    std::string dir = slash == std::string::npos ? "." : path.substr(0, slash ? slash : 1);
+    return access(dir.c_str(), W_OK | X_OK) == 0;
+}
+
+bool config_check(Sim_Config &config)
+{
+    if (config.ncores < 1) {
+        printf("Error: --cores must be at least 1\n");
+        return false;
+    }
+    if (config.width < 1 || config.width > 8) {
+        printf("Error: --width must be between 1 and 8\n");
+        return false;
+    }
+    if (config.alu_ports == 0 || config.alu_ports > config.width)
+        config.alu_ports = config.width;
+    if (config.rob_size < 1 || config.iq_size < 1 || config.lsq_size < 1) {
+        printf("Error: ooo queue sizes must be at least 1\n");
+        return false;
+    }
+    if (config.mem_ports < 1) {
+        printf("Error: --mem_ports must be at least 1\n");
+        return false;
+    }
+    if (config.mul_latency < 1 || config.mul_latency > 1024 ||
+            config.div_latency < 1 || config.div_latency > 1024) {
+        printf("Error: --mul_latency and --div_latency must be between 1 and 1024\n");
+        return false;
+    }
+    if (!is_pow2(config.block_size) || config.block_size < 4 || config.block_size > 256) {
+        printf("Error: --block_size must be a power of two between 4 and 256\n");
+        return false;
+    }
+    if (!is_pow2(config.l1i_assoc) || !is_pow2(config.l1i_size) ||
+            config.l1i_size < config.block_size * config.l1i_assoc) {
+        printf("Error: bad L1 instruction cache geometry\n");
+        return false;
+    }
+    if (!is_pow2(config.l1d_assoc) || !is_pow2(config.l1d_size) ||
+            config.l1d_size < config.block_size * config.l1d_assoc) {
+        printf("Error: bad L1 data cache geometry\n");
+        return false;
+    }
+    if (config.l2_size > 0 && (!is_pow2(config.l2_assoc) || !is_pow2(config.l2_size) ||
+            config.l2_size < config.block_size * config.l2_assoc)) {
+        printf("Error: bad L2 cache geometry\n");
+        return false;
+    }
+    if (config.l2_partition && (config.l2_size == 0 || config.l2_assoc < NUM_STREAMS ||
+            config.umon_interval < 1)) {
+        printf("Error: --l2_partition needs an L2 with at least 2 ways and a --umon_interval\n");
+        return false;
+    }
+    if (config.l1d_compress && (config.block_size < 8 || config.compress_tags < 1 || config.compress_tags > 8)) {
+        printf("Error: --l1d_compress needs --block_size of at least 8 and 1 to 8 --compress_tags\n");
+        return false;
+    }
+    if (config.sector_size > 0 && (!is_pow2(config.sector_size) || config.sector_size < 4 ||
+            config.sector_size > config.block_size || config.block_size / config.sector_size > 64 ||
+            config.l1d_compress)) {
+        printf("Error: --sector_size must be a power of two from 4 bytes to the block size, "
+               "at least 1/64 of it, and not used with --l1d_compress\n");
+        return false;
+    }
+    if (config.mem_bus_bytes > 0 && (!is_pow2(config.mem_bus_bytes) || config.mem_bus_bytes < 4)) {
+        printf("Error: --mem_bus_bytes must be a power of two of at least 4\n");
+        return false;
+    }
+    if (config.ftq_size > 0 && !is_pow2(config.btb_entries)) {
+        printf("Error: --btb_entries must be a power of two\n");
+        return false;
+    }
+    if (config.cache_model && (config.clock_mhz < 1 || config.clock_mhz > 100000)) {
+        printf("Error: --clock_mhz must be between 1 and 100000\n");
+        return false;
+    }
+    if (config.sample_interval > 0 && !writable(config.sample_file)) {
+        printf("Error: Can't create sample file %s\n", config.sample_file.c_str());
+        return false;
+    }
+    if (config.cosim && config.ncores > 1) {
+        printf("Error: --cosim needs a single core\n");
+        return false;
+    }
+    if (!is_pow2(config.page_size) || config.page_size < 1024 || config.page_size > (1u << 28)) {
+        printf("Error: --page_size must be a power of two between 1 KB and 256 MB\n");
+        return false;
+    }
+    if (config.itlb_entries < 1 || config.dtlb_entries < 1 || !is_pow2(config.l2tlb_assoc) ||
+            !is_pow2(config.l2tlb_entries) || config.l2tlb_entries < config.l2tlb_assoc) {
+        printf("Error: bad TLB geometry\n");
+        return false;
+    }
+    return true;
+}
+
+bool config_set(Sim_Config &config, const char *name, size_t name_len, const char *value)
+{
+    const Config_Option *opt = nullptr;
+    for (const auto &o : options) {
+        if (strlen(o.name) == name_len && strncmp(o.name, name, name_len) == 0)
+            opt = &o;
+    }
+    if (!opt) {
+        printf("Error: unknown option --%.*s\n", (int)name_len, name);
+        return false;
+    }
+
+    if (opt->text) {
+        config.*(opt->text) = value;
+        return true;
+    }
+
+    if (opt->names) {
+        int index = -1;
+        for (int n = 0; opt->names[n]; n++) {
+            if (strcmp(opt->names[n], value) == 0)
+                index = n;
+        }
+        if (index < 0) {
+            printf("Error: unknown value %s for option --%s\n", value, opt->name);
+            return false;
+        }
+        config.*(opt->field) = (uint32_t)index;
+        return true;
+    }
+
+    char *end;
+    unsigned long v = strtoul(value, &end, 0);
+    if (*value == '\0' || *end != '\0') {
+        printf("Error: option --%s needs a numeric value\n", opt->name);
+        return false;
+    }
+    config.*(opt->field) = (uint32_t)v;
+    return true;
+}
+
+int config_parse(Sim_Config &config, int argc, char *argv[])
+{
+    int i;
+
+    for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        const char *arg = argv[i] + 2;
+        const char *eq = strchr(arg, '=');
+        if (!eq) {
+            printf("Error: option %s needs a value (--name=value)\n", argv[i]);
+            return -1;
+        }
+        if (!config_set(config, arg, eq - arg, eq + 1))
+            return -1;
+    }
+
+    if (!config_check(config))
+        return -1;
+
+    return i;
+}
+
+void config_usage()
+{
+    const Sim_Config defaults;
+
+    printf("Options:\n");
+    for (const auto &o : options) {
+        if (o.text) {
+            printf("  --%-14s %s (default %s)\n", o.name, o.help, (defaults.*(o.text)).c_str());
+            continue;
+        }
+        if (!o.names) {
+            printf("  --%-14s %s (default %u)\n", o.name, o.help, defaults.*(o.field));
+            continue;
+        }
+        printf("  --%-14s %s:", o.name, o.help);
+        for (int n = 0; o.names[n]; n++)
+            printf(" %s", o.names[n]);
+        printf(" (default %s)\n", o.names[defaults.*(o.field)]);
+    }
+}
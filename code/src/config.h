@@ -0,0 +1,154 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: run-time configuration
+ */
+
+#ifndef _CONFIG_H_
+#define _CONFIG_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/* core models (--core) */
+enum Core_Model {
+    CORE_INORDER = 0, /* the 5-stage in-order pipe (pipe.cpp) */
+    CORE_OOO          /* out-of-order core (ooo.cpp) */
+};
+
+/* HI/LO functional-unit models (--muldiv) */
+enum Muldiv_Model {
+    MULDIV_SIMPLE = 0,  /* one countdown that every HI/LO op waits on */
+    MULDIV_PIPELINED    /* pipelined multiplier, early-out divider (muldiv.h) */
+};
+
+/* what the interval of --sample counts (stats.h) */
+enum Sample_Unit {
+    SAMPLE_CYCLES = 0,
+    SAMPLE_INSTRUCTIONS /* instructions retired by all cores */
+};
+
+/* Simulator parameters, set from "--name=value" command-line options that
+ * precede the program file(s). The defaults model the original single-core
+ * machine: caches are present (and collect statistics) but a miss costs no
+ * extra cycles unless --mem_latency is given. */
+struct Sim_Config {
+    /* number of cores, each with its own pipeline and private L1 caches */
+    uint32_t ncores;
+
+    /* Core_Model of every core */
+    uint32_t core_model;
+
+    /* superscalar width: ops per stage per cycle, and the execute (ALU)
+     * and memory-stage ports shared by each bundle */
+    uint32_t width;
+    uint32_t alu_ports, mem_ports;
+
+    /* out-of-order window: reorder buffer, issue queue and load/store
+     * queue entries (--core=ooo only) */
+    uint32_t rob_size, iq_size, lsq_size;
+
+    /* Muldiv_Model of the HI/LO unit, the multiplier's latency and the
+     * divider's (its longest, with --muldiv=pipelined) in cycles */
+    uint32_t muldiv, mul_latency, div_latency;
+
+    /* L1 cache geometry (sizes and block size in bytes) */
+    uint32_t block_size;
+    uint32_t l1i_size, l1i_assoc;
+    uint32_t l1d_size, l1d_assoc;
+
+    /* BDI compression of the L1 data cache (cache.h): off unless
+     * l1d_compress is set. compress_tags tags per data way, and
+     * decompress_latency cycles on a hit to a compressed block */
+    uint32_t l1d_compress, compress_tags, decompress_latency;
+
+    /* sectored L1 data cache blocks (cache.h): sector size in bytes, 0 =
+     * whole blocks */
+    uint32_t sector_size;
+
+    /* main memory fills (cache.h): bytes per bus beat (0 = a fill arrives
+     * at once), and critical-word-first with early restart */
+    uint32_t mem_bus_bytes, cwf;
+
+    /* decoupled front end (frontend.h): fetch target queue entries (0 =
+     * fetch runs sequentially, as without one) and BTB entries */
+    uint32_t ftq_size, btb_entries;
+
+    /* a unified L2 per core behind both L1s (l2_size 0 = none); hits take
+     * l2_latency cycles and misses the same l2_latency lookup plus
+     * mem_latency; l2_partition splits its ways
+     * between instructions and data (umon.h), deciding anew every
+     * umon_interval L2 accesses */
+    uint32_t l2_size, l2_assoc, l2_latency;
+    uint32_t l2_partition, umon_interval;
+
+    /* cycles a fetch or memory stage stalls on a miss in the last cache
+     * level, after that level's lookup */
+    uint32_t mem_latency;
+
+    /* derive the caches' hit and tag latencies (the L2's replacing
+     * l2_latency) and energy per access from their geometry
+     * (cachemodel.h) for a core clocked at clock_mhz;
+     * otherwise hits are free and no energy is counted */
+    uint32_t cache_model, clock_mhz;
+
+    /* address translation (tlb.h): off unless tlb is set. L1 TLBs are
+     * fully associative; the L2 TLB adds l2tlb_latency cycles to an L1 TLB
+     * miss, and a page walk on top of that if it misses too */
+    uint32_t tlb, page_size;
+    uint32_t itlb_entries, dtlb_entries;
+    uint32_t l2tlb_entries, l2tlb_assoc, l2tlb_latency;
+
+    /* interval statistics: every sample_interval Sample_Units (0 = off),
+     * write the change in every counter to sample_file, as CSV if its name
+     * ends in ".csv" and in the binary format of stats.h otherwise */
+    uint32_t sample_interval, sample_unit;
+    std::string sample_file;
+
+    /* check every retired instruction against a functional model
+     * (cosim.h; single core only) */
+    uint32_t cosim;
+
+    /* also report host time and simulation speed in the stats command */
+    uint32_t host_stats;
+
+    Sim_Config() : ncores(1), core_model(CORE_INORDER),
+                   width(1), alu_ports(0), mem_ports(1),
+                   rob_size(64), iq_size(32), lsq_size(32),
+                   muldiv(MULDIV_SIMPLE), mul_latency(4), div_latency(32),
+                   block_size(32),
+                   l1i_size(8192), l1i_assoc(4),
+                   l1d_size(65536), l1d_assoc(8),
+                   l1d_compress(0), compress_tags(2), decompress_latency(1),
+                   sector_size(0), mem_bus_bytes(0), cwf(0),
+                   ftq_size(0), btb_entries(256),
+                   l2_size(0), l2_assoc(8), l2_latency(10),
+                   l2_partition(0), umon_interval(4096),
+                   mem_latency(0),
+                   cache_model(0), clock_mhz(2000),
+                   tlb(0), page_size(4096),
+                   itlb_entries(16), dtlb_entries(32),
+                   l2tlb_entries(512), l2tlb_assoc(4), l2tlb_latency(7),
+                   sample_interval(0), sample_unit(SAMPLE_CYCLES),
+                   sample_file("samples.csv"),
+                   cosim(0), host_stats(0) {}
+};
+
+/* parse leading "--name=value" options into 'config' and check it.
+ * Returns the index of the first non-option argument, or -1 on a
+ * malformed/unknown option or a bad configuration. */
+int config_parse(Sim_Config &config, int argc, char *argv[]);
+
+/* set one option (the 'name_len' characters at 'name', without "--") from
+ * its string value; returns false, after printing why, if either is bad */
+bool config_set(Sim_Config &config, const char *name, size_t name_len, const char *value);
+
+/* reject geometries the simulator cannot represent, and resolve defaults
+ * that depend on other options (alu_ports = 0) */
+bool config_check(Sim_Config &config);
+
+/* print the list of options and their default values */
+void config_usage();
+
+#endif
@@ -0,0 +1,285 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: lock-step co-simulation checker
+ */
+
+#include "cosim.h"
+#include "pipe.h"
+#include "ooo.h"
+#include "mips.h"
+#include <cstdio>
+
+Cosim::Cosim(const Pipe_State &pipe)
+    : REGS(pipe.REGS), HI(pipe.HI), LO(pipe.LO), PC(pipe.PC), mem(pipe.sim->mem),
+      checked(0), failed(0)
+{
+}
+
+/* what one instruction did, for comparison with the core */
+struct Cosim_Step {
+    int dst;                 /* register written, or -1 */
+    int is_mem, mem_write;
+    uint32_t mem_addr;
+    uint32_t mem_data;       /* bits a store writes (in the low bytes) */
+};
+
+/* execute the instruction at m.PC */
+static Cosim_Step cosim_step(Cosim &m, int core_id)
+{
+    Cosim_Step s = {-1, 0, 0, 0, 0};
+    uint32_t inst = m.mem.read_32(m.PC);
+    uint32_t opcode = inst >> 26;
+    uint32_t rs = (inst >> 21) & 0x1F, rt = (inst >> 16) & 0x1F, rd = (inst >> 11) & 0x1F;
+    uint32_t shamt = (inst >> 6) & 0x1F, funct = inst & 0x3F;
+    uint32_t imm = inst & 0xFFFF, simm = (uint32_t)(int32_t)(int16_t)imm;
+    uint32_t a = m.REGS[rs], b = m.REGS[rt];
+    uint32_t next = m.PC + 4;
+    uint32_t val = 0;
+    int dst = -1;
+
+    switch (opcode) {
+        case OP_SPECIAL:
+            switch (funct) {
+                case SUBOP_SLL:  dst = rd; val = b << shamt; break;
+                case SUBOP_SRL:  dst = rd; val = b >> shamt; break;
+                case SUBOP_SRA:  dst = rd; val = (int32_t)b >> shamt; break;
+                case SUBOP_SLLV: dst = rd; val = b << (a & 31); break;
+                case SUBOP_SRLV: dst = rd; val = b >> (a & 31); break;
+                case SUBOP_SRAV: dst = rd; val = (int32_t)b >> (a & 31); break;
+                case SUBOP_JR:   next = a; break;
+                case SUBOP_JALR: dst = rd; val = m.PC + 4; next = a; break;
+                case SUBOP_SYSCALL:
+                    if (m.REGS[2] == SYSCALL_CORE_ID) {
+                        dst = 2;
+                        val = core_id;
+                    }
+                    break;
+                case SUBOP_MULT: {
+                    uint64_t p = (uint64_t)((int64_t)(int32_t)a * (int32_t)b);
+                    m.HI = p >> 32;
+                    m.LO = (uint32_t)p;
+                    break;
+                }
+                case SUBOP_MULTU: {
+                    uint64_t p = (uint64_t)a * b;
+                    m.HI = p >> 32;
+                    m.LO = (uint32_t)p;
+                    break;
+                }
+                case SUBOP_DIV:
+                    /* division by zero leaves zeros, as in the pipeline */
+                    if (b == 0)
+                        m.HI = m.LO = 0;
+                    else if (a == 0x80000000 && b == 0xFFFFFFFF) {
+                        m.LO = a;
+                        m.HI = 0;
+                    }
+                    else {
+                        m.LO = (int32_t)a / (int32_t)b;
+                        m.HI = (int32_t)a % (int32_t)b;
+                    }
+                    break;
+                case SUBOP_DIVU:
+                    if (b == 0)
+                        m.HI = m.LO = 0;
+                    else {
+                        m.LO = a / b;
+                        m.HI = a % b;
+                    }
+                    break;
+                case SUBOP_MFHI: dst = rd; val = m.HI; break;
+                case SUBOP_MTHI: m.HI = a; break;
+                case SUBOP_MFLO: dst = rd; val = m.LO; break;
+                case SUBOP_MTLO: m.LO = a; break;
+                case SUBOP_ADD:
+                case SUBOP_ADDU: dst = rd; val = a + b; break;
+                case SUBOP_SUB:
+                case SUBOP_SUBU: dst = rd; val = a - b; break;
+                case SUBOP_AND:  dst = rd; val = a & b; break;
+                case SUBOP_OR:   dst = rd; val = a | b; break;
+                case SUBOP_XOR:  dst = rd; val = a ^ b; break;
+                case SUBOP_NOR:  dst = rd; val = ~(a | b); break;
+                case SUBOP_SLT:  dst = rd; val = (int32_t)a < (int32_t)b; break;
+                case SUBOP_SLTU: dst = rd; val = a < b; break;
+            }
+            break;
+
+        case OP_BRSPEC: {
+            int taken = 0;
+            if (rt == BROP_BLTZ || rt == BROP_BLTZAL)
+                taken = (int32_t)a < 0;
+            else if (rt == BROP_BGEZ || rt == BROP_BGEZAL)
+                taken = (int32_t)a >= 0;
+            if (rt == BROP_BLTZAL || rt == BROP_BGEZAL) {
+                dst = 31;
+                val = m.PC + 4;
+            }
+            if (taken)
+                next = m.PC + 4 + (simm << 2);
+            break;
+        }
+
+        case OP_JAL:
+            dst = 31;
+            val = m.PC + 4;
+            /* fallthrough */
+        case OP_J:
+            next = (m.PC & 0xF0000000) | ((inst & 0x03FFFFFF) << 2);
+            break;
+
+        case OP_BEQ:  if (a == b) next = m.PC + 4 + (simm << 2); break;
+        case OP_BNE:  if (a != b) next = m.PC + 4 + (simm << 2); break;
+        case OP_BLEZ: if ((int32_t)a <= 0) next = m.PC + 4 + (simm << 2); break;
+        case OP_BGTZ: if ((int32_t)a > 0) next = m.PC + 4 + (simm << 2); break;
+
+        case OP_ADDI:
+        case OP_ADDIU: dst = rt; val = a + simm; break;
+        case OP_SLTI:  dst = rt; val = (int32_t)a < (int32_t)simm; break;
+        case OP_SLTIU: dst = rt; val = a < simm; break;
+        case OP_ANDI:  dst = rt; val = a & imm; break;
+        case OP_ORI:   dst = rt; val = a | imm; break;
+        case OP_XORI:  dst = rt; val = a ^ imm; break;
+        case OP_LUI:   dst = rt; val = imm << 16; break;
+
+        /* memory is word-addressed: a word access ignores the low address
+         * bits, a halfword access bit 0 */
+        case OP_LW:
+        case OP_LH:
+        case OP_LHU:
+        case OP_LB:
+        case OP_LBU: {
+            uint32_t addr = a + simm;
+            uint32_t word = m.mem.read_32(addr & ~3);
+            s.is_mem = 1;
+            s.mem_addr = addr;
+            dst = rt;
+            if (opcode == OP_LW)
+                val = word;
+            else if (opcode == OP_LH || opcode == OP_LHU) {
+                val = (word >> (8 * (addr & 2))) & 0xFFFF;
+                if (opcode == OP_LH)
+                    val = (uint32_t)(int32_t)(int16_t)val;
+            }
+            else {
+                val = (word >> (8 * (addr & 3))) & 0xFF;
+                if (opcode == OP_LB)
+                    val = (uint32_t)(int32_t)(int8_t)val;
+            }
+            break;
+        }
+
+        case OP_SW:
+        case OP_SH:
+        case OP_SB: {
+            uint32_t addr = a + simm;
+            uint32_t word = m.mem.read_32(addr & ~3);
+            s.is_mem = 1;
+            s.mem_write = 1;
+            s.mem_addr = addr;
+            if (opcode == OP_SW) {
+                s.mem_data = b;
+                word = b;
+            }
+            else if (opcode == OP_SH) {
+                int shift = 8 * (addr & 2);
+                s.mem_data = b & 0xFFFF;
+                word = (word & ~(0xFFFFu << shift)) | (s.mem_data << shift);
+            }
+            else {
+                int shift = 8 * (addr & 3);
+                s.mem_data = b & 0xFF;
+                word = (word & ~(0xFFu << shift)) | (s.mem_data << shift);
+            }
+            m.mem.write_32(addr & ~3, word);
+            break;
+        }
+    }
+
+    if (dst > 0) {
+        m.REGS[dst] = val;
+        s.dst = dst;
+    }
+    m.PC = next;
+    return s;
+}
+
+/* the bits of a store's register value that reach memory */
+static uint32_t store_data(const Pipe_Op *op)
+{
+    if (op->opcode == OP_SB)
+        return op->mem_value & 0xFF;
+    if (op->opcode == OP_SH)
+        return op->mem_value & 0xFFFF;
+    return op->mem_value;
+}
+
+static void cosim_report(Pipe_State &pipe, const Pipe_Op *op, const char *what)
+{
+    Cosim &m = *pipe.cosim;
+
+    printf("Cosim: core %d diverged from the functional model at instruction %llu (cycle %u)\n",
+           pipe.core_id, (unsigned long long)m.checked, pipe.stat_cycles);
+    printf("Cosim: %s\n", what);
+    printf("Cosim: retiring ");
+    print_op(op);
+
+    if (pipe.ooo) {
+        printf("ROB:\n");
+        for (const auto &e : pipe.ooo->rob)
+            print_op(e.op.get());
+    }
+    else {
+        print_bundle("DCODE", pipe.decode_ops);
+        print_bundle("EXEC ", pipe.execute_ops);
+        print_bundle("MEM  ", pipe.mem_ops);
+        print_bundle("WB   ", pipe.wb_ops);
+    }
+
+    m.failed = 1;
+    pipe.sim->run_bit = false;
+}
+
+void cosim_retire(Pipe_State &pipe, const Pipe_Op *op)
+{
+    Cosim &m = *pipe.cosim;
+    char what[160];
+
+    if (m.failed)
+        return;
+
+    if (op->pc != m.PC) {
+        snprintf(what, sizeof(what), "PC: core %08x, model %08x", op->pc, m.PC);
+        cosim_report(pipe, op, what);
+        return;
+    }
+
+    Cosim_Step s = cosim_step(m, pipe.core_id);
+    m.checked++;
+
+    /* every register either side wrote */
+    int regs[2] = {op->reg_dst, s.dst};
+    for (int r : regs) {
+        if (r > 0 && pipe.REGS[r] != m.REGS[r]) {
+            snprintf(what, sizeof(what), "R%d: core %08x, model %08x", r, pipe.REGS[r], m.REGS[r]);
+            cosim_report(pipe, op, what);
+            return;
+        }
+    }
+
+    if (op->is_mem != s.is_mem || (s.is_mem && op->mem_write != s.mem_write)) {
+        snprintf(what, sizeof(what), "memory access: core %s, model %s",
+                 !op->is_mem ? "none" : op->mem_write ? "store" : "load",
+                 !s.is_mem ? "none" : s.mem_write ? "store" : "load");
+        cosim_report(pipe, op, what);
+    }
+    else if (s.is_mem && op->mem_addr != s.mem_addr) {
+        snprintf(what, sizeof(what), "address: core %08x, model %08x", op->mem_addr, s.mem_addr);
+        cosim_report(pipe, op, what);
+    }
+    else if (s.mem_write && store_data(op) != s.mem_data) {
+        snprintf(what, sizeof(what), "store data at %08x: core %08x, model %08x",
+                 s.mem_addr, store_data(op), s.mem_data);
+        cosim_report(pipe, op, what);
+    }
+}
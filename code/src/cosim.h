@@ -0,0 +1,50 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: lock-step co-simulation checker
+ */
+
+#ifndef _COSIM_H_
+#define _COSIM_H_
+
+#include "sim.h"
+#include <array>
+#include <cstdint>
+
+struct Pipe_Op;
+struct Pipe_State;
+
+/* The checker (--cosim=1) runs a functional model of the ISA in lock step
+ * with a core: a plain one-instruction-at-a-time interpreter that shares no
+ * code with the pipeline's decode and execute. Each time the core retires
+ * an instruction, the model executes one too and the two must agree on
+ *
+ *   - the instruction's PC,
+ *   - every register either of them wrote, as the core's register file
+ *     holds it after the retire,
+ *   - a load's or store's address, and the data a store writes.
+ *
+ * At the first disagreement the checker prints what differs, the retiring
+ * op and the contents of the pipeline, and stops the simulation.
+ *
+ * The model starts from the core's architectural state when the first cycle
+ * is simulated, and keeps a private copy of memory (sharing its pages with
+ * the simulator's until either writes them), so it needs a single core: on
+ * a multi-core run other cores' stores would reach only one of the two. */
+struct Cosim {
+    std::array<uint32_t, 32> REGS;
+    uint32_t HI, LO, PC;
+    Sim_Memory mem;
+
+    /* instructions checked, and whether a divergence stopped the run */
+    uint64_t checked;
+    int failed;
+
+    explicit Cosim(const Pipe_State &pipe);
+};
+
+/* the core retired 'op' (its register write already done): step the model
+ * and compare */
+void cosim_retire(Pipe_State &pipe, const Pipe_Op *op);
+
+#endif
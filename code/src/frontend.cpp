@@ -0,0 +1,112 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: decoupled front end
+ */
+
+#include "frontend.h"
+#include "pipe.h"
+#include "sim.h"
+#include "mips.h"
+
+Front_End::Front_End(const Sim_Config &config)
+    : ftq_size(config.ftq_size), bpu_pc(0), btb(config.btb_entries)
+{
+}
+
+static Btb_Entry &btb_entry(Front_End &fe, uint32_t pc)
+{
+    return fe.btb[(pc >> 2) & (fe.btb.size() - 1)];
+}
+
+void frontend_cycle(Pipe_State &pipe)
+{
+    Front_End &fe = *pipe.frontend;
+    Cache &icache = pipe.icache;
+
+    /* prefetches whose data has arrived are plain cache blocks now */
+    for (size_t i = fe.inflight.size(); i-- > 0; ) {
+        if (fe.inflight[i].ready <= pipe.stat_cycles)
+            fe.inflight.erase(fe.inflight.begin() + i);
+    }
+
+    /* an empty FTQ (at startup, or flushed by a recovery) restarts the
+     * BPU where fetch is */
+    if (fe.ftq.empty())
+        fe.bpu_pc = pipe.PC;
+    else if (fe.ftq.size() >= fe.ftq_size)
+        return;
+
+    /* the block runs to the end of its cache block, or up to a jump the
+     * BTB knows */
+    Ftq_Entry e;
+    e.start = fe.bpu_pc;
+    e.end = (e.start | (icache.block_size - 1)) + 1;
+    e.next = e.end;
+    for (uint32_t pc = e.start; pc != e.end; pc += 4) {
+        Btb_Entry &b = btb_entry(fe, pc);
+        if (b.valid && b.pc == pc) {
+            e.end = pc + 4;
+            e.next = b.target;
+            fe.stats.btb_hits++;
+            break;
+        }
+    }
+    fe.ftq.push_back(e);
+    fe.bpu_pc = e.next;
+    fe.stats.blocks++;
+
+    if (!icache.lookup(e.start)) {
+        uint32_t latency = icache.access(e.start, 0);
+        fe.inflight.push_back({e.start >> icache.block_bits, pipe.stat_cycles + latency});
+        fe.stats.prefetches++;
+    }
+}
+
+uint32_t frontend_fetch(Pipe_State &pipe, uint32_t pc)
+{
+    Front_End &fe = *pipe.frontend;
+    uint32_t stall = pipe.icache.access(pc, 0);
+
+    for (const Fetch_Prefetch &p : fe.inflight) {
+        if (p.block == pc >> pipe.icache.block_bits && p.ready > pipe.stat_cycles) {
+            fe.stats.late_prefetches++;
+            stall += p.ready - pipe.stat_cycles;
+            break;
+        }
+    }
+    return stall;
+}
+
+uint32_t frontend_next_pc(Pipe_State &pipe, uint32_t pc)
+{
+    Front_End &fe = *pipe.frontend;
+    const Ftq_Entry &e = fe.ftq.front();
+
+    if (pc + 4 != e.end)
+        return pc + 4;
+
+    uint32_t next = e.next;
+    fe.ftq.pop_front();
+    return next;
+}
+
+int frontend_decode_redirect(Pipe_State &pipe, Pipe_Op *op)
+{
+    Front_End &fe = *pipe.frontend;
+
+    if ((op->opcode != OP_J && op->opcode != OP_JAL) || op->next_pc == op->branch_dest)
+        return 0;
+
+    Btb_Entry &b = btb_entry(fe, op->pc);
+    b.pc = op->pc;
+    b.target = op->branch_dest;
+    b.valid = 1;
+
+    /* fetch now goes the right way after the jump, so execute has nothing
+     * to recover */
+    op->next_pc = op->branch_dest;
+    pipe_recover(pipe, 2, op->branch_dest);
+    fe.stats.decode_redirects++;
+    return 1;
+}
@@ -0,0 +1,91 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: decoupled front end
+ */
+
+#ifndef _FRONTEND_H_
+#define _FRONTEND_H_
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+struct Pipe_State;
+struct Pipe_Op;
+struct Sim_Config;
+
+/* The decoupled front end (--ftq=N) splits fetch in two. A branch
+ * prediction unit runs ahead of fetch, one fetch block per cycle, and
+ * queues each block in the fetch target queue (FTQ): a run of sequential
+ * instructions up to the end of a cache block or a predicted-taken jump,
+ * and where fetch goes after it. The fetch stage then only fetches what the
+ * FTQ tells it to, and waits when the FTQ is empty.
+ *
+ * Every block the BPU queues that misses in the instruction cache is
+ * prefetched right away (fetch-directed prefetching), so by the time fetch
+ * reaches it the miss is partly or wholly over. A prefetch installs the
+ * block and is tracked until its data would arrive; a demand fetch of a
+ * block still in flight waits only for the rest.
+ *
+ * The BPU predicts with a direct-mapped BTB of unconditional direct jumps
+ * (J/JAL). Decode redirects fetch to the target of a J/JAL the BTB did not
+ * know about (flushing only fetch and decode) and installs it in the BTB;
+ * everything else (conditional branches, JR/JALR) is predicted not taken
+ * and resolved in execute as without the FTQ. */
+
+struct Ftq_Entry {
+    uint32_t start, end;  /* instructions [start, end) */
+    uint32_t next;        /* where fetch goes after end - 4 */
+};
+
+struct Btb_Entry {
+    uint32_t pc, target;
+    int valid;
+
+    Btb_Entry() : pc(0), target(0), valid(0) {}
+};
+
+/* an instruction cache block on its way in, and the cycle it arrives */
+struct Fetch_Prefetch {
+    uint32_t block;
+    uint64_t ready;
+};
+
+struct Frontend_Stats {
+    uint64_t blocks, btb_hits, prefetches, late_prefetches;
+    uint64_t decode_redirects, ftq_empty;
+
+    Frontend_Stats() : blocks(0), btb_hits(0), prefetches(0), late_prefetches(0),
+                       decode_redirects(0), ftq_empty(0) {}
+};
+
+struct Front_End {
+    uint32_t ftq_size;
+    std::deque<Ftq_Entry> ftq;
+    uint32_t bpu_pc;  /* start of the next block the BPU predicts (fetch's
+                       * PC while the FTQ is empty) */
+
+    std::vector<Btb_Entry> btb;
+    std::vector<Fetch_Prefetch> inflight;
+
+    Frontend_Stats stats;
+
+    explicit Front_End(const Sim_Config &config);
+};
+
+/* run the BPU for one cycle: queue (and prefetch) the next fetch block */
+void frontend_cycle(Pipe_State &pipe);
+
+/* the instruction cache access of a demand fetch; returns the cycles fetch
+ * stalls */
+uint32_t frontend_fetch(Pipe_State &pipe, uint32_t pc);
+
+/* fetch took the instruction at 'pc': returns the next fetch PC */
+uint32_t frontend_next_pc(Pipe_State &pipe, uint32_t pc);
+
+/* decode: redirect fetch to the target of an unpredicted J/JAL. Returns 1
+ * if it did (everything younger in decode is on the wrong path). */
+int frontend_decode_redirect(Pipe_State &pipe, Pipe_Op *op);
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: parallel checkpointed interval simulation
+ */
+
+#include "interval.h"
+#include "pool.h"
+#include <chrono>
+#include <cstdio>
+
+void checkpoint_take(const Simulator &sim, uint64_t insts, Sim_Checkpoint &cp)
+{
+    const Pipe_State &p = sim.pipes[0];
+
+    cp.insts = insts;
+    cp.REGS = p.REGS;
+    cp.HI = p.HI;
+    cp.LO = p.LO;
+    cp.PC = p.PC;
+    cp.mem = sim.mem;
+}
+
+void checkpoint_restore(Simulator &sim, const Sim_Checkpoint &cp)
+{
+    Pipe_State &p = sim.pipes[0];
+
+    sim.mem = cp.mem;
+    p.REGS = cp.REGS;
+    p.HI = cp.HI;
+    p.LO = cp.LO;
+    p.PC = cp.PC;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* simulate in detail until 'insts' instructions have retired, or the
+ * program ends */
+static void run_until_retired(Simulator &sim, uint64_t insts)
+{
+    while (sim.run_bit && sim.stat_inst_retire < insts) {
+        sim.skip_idle_cycles(UINT32_MAX);
+        sim.cycle();
+    }
+}
+
+/* interval 'i' of 'interval' instructions (fewer if the program ends in
+ * it): the change of every counter into 'delta' */
+static void run_interval(const Sim_Config &config, const std::vector<Sim_Checkpoint> &cps,
+                         uint64_t interval, uint64_t warmup, size_t i, std::vector<uint64_t> &delta)
+{
+    uint64_t begin = cps[i].insts;
+    uint64_t start = begin > warmup ? begin - warmup : 0;
+    const Sim_Checkpoint &cp = cps[start / interval];
+
+    Simulator sim(config);
+    checkpoint_restore(sim, cp);
+    if (start > cp.insts)
+        sim.fast_forward(start - cp.insts);
+
+    run_until_retired(sim, begin - start);
+    for (size_t c = 0; c < delta.size(); c++)
+        delta[c] = sim.stats.counters[c].value();
+
+    uint64_t end = i + 1 < cps.size() ? cps[i + 1].insts : UINT64_MAX;
+    run_until_retired(sim, end - start);
+    for (size_t c = 0; c < delta.size(); c++)
+        delta[c] = sim.stats.counters[c].value() - delta[c];
+}
+
+bool interval_run(const Sim_Config &config, const Simulator &image, uint64_t interval,
+                  uint64_t warmup, unsigned threads, Interval_Result &result)
+{
+    if (config.ncores > 1) {
+        printf("Error: interval simulation needs a single core\n");
+        return false;
+    }
+    if (config.sample_interval > 0) {
+        printf("Error: interval simulation cannot sample (--sample)\n");
+        return false;
+    }
+    if (interval < 1) {
+        printf("Error: the interval must be at least one instruction\n");
+        return false;
+    }
+
+    /* 1: the functional run, leaving checkpoints */
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Sim_Checkpoint> cps;
+    Simulator run(config);
+    run.share_program(image);
+    uint64_t insts = 0;
+    while (run.run_bit) {
+        cps.emplace_back();
+        checkpoint_take(run, insts, cps.back());
+        int64_t n = run.fast_forward(interval);
+        insts += n;
+        if (n == 0)
+            cps.pop_back();
+    }
+    result.insts = insts;
+    result.intervals = cps.size();
+    result.functional_seconds = seconds_since(start);
+
+    /* 2: every interval in detail */
+    start = std::chrono::steady_clock::now();
+    size_t ncounters = run.stats.counters.size();
+    std::vector<std::vector<uint64_t>> deltas(cps.size(), std::vector<uint64_t>(ncounters));
+    pool_run(threads, cps.size(), [&](size_t i) {
+        run_interval(config, cps, interval, warmup, i, deltas[i]);
+    });
+    result.detailed_seconds = seconds_since(start);
+
+    /* 3: the totals */
+    result.names.clear();
+    for (const Stat_Counter &c : run.stats.counters)
+        result.names.push_back(c.name);
+    result.totals.assign(ncounters, 0);
+    for (const auto &d : deltas) {
+        for (size_t c = 0; c < ncounters; c++)
+            result.totals[c] += d[c];
+    }
+    return true;
+}
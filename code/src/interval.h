@@ -0,0 +1,68 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: parallel checkpointed interval simulation
+ */
+
+#ifndef _INTERVAL_H_
+#define _INTERVAL_H_
+
+#include "sim.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* One long run, simulated in parallel (tools/intervals.cpp):
+ *
+ *   1. The program runs functionally (Simulator::fast_forward()), leaving
+ *      a checkpoint every 'interval' instructions: the architectural
+ *      registers and a copy of memory, which shares every page with the
+ *      run until the run writes it, so a checkpoint costs only the pages
+ *      dirtied after it.
+ *
+ *   2. Every interval is then simulated in detail on a thread pool, in a
+ *      simulator of its own started from the checkpoint at or before the
+ *      interval's start minus 'warmup' instructions: it fast-forwards to
+ *      the start of the warm-up, simulates the warm-up in detail (warming
+ *      caches, TLBs and predictors, and filling the pipeline), and then
+ *      counts the interval's own instructions.
+ *
+ *   3. The change in every registered counter over each interval is
+ *      summed into the totals of the whole run.
+ *
+ * Intervals stop at the first cycle that retires their last instruction,
+ * so the totals are those of a continuous run up to the warm-up's
+ * approximations. Multi-core programs are not supported: their cores'
+ * interleaving is timing-dependent. */
+struct Sim_Checkpoint {
+    uint64_t insts;         /* instructions executed before it */
+    std::array<uint32_t, 32> REGS;
+    uint32_t HI, LO, PC;
+    Sim_Memory mem;
+};
+
+/* the state of a (single-core, drained) simulator */
+void checkpoint_take(const Simulator &sim, uint64_t insts, Sim_Checkpoint &cp);
+
+/* start a freshly constructed simulator from a checkpoint */
+void checkpoint_restore(Simulator &sim, const Sim_Checkpoint &cp);
+
+struct Interval_Result {
+    /* every registered counter, and its total over all intervals */
+    std::vector<std::string> names;
+    std::vector<uint64_t> totals;
+
+    size_t intervals;
+    uint64_t insts;                 /* executed functionally in step 1 */
+    double functional_seconds, detailed_seconds;
+
+    Interval_Result() : intervals(0), insts(0), functional_seconds(0), detailed_seconds(0) {}
+};
+
+/* run the program 'image' has loaded under 'config' as above; returns
+ * false, after printing why, if the configuration cannot be split */
+bool interval_run(const Sim_Config &config, const Simulator &image, uint64_t interval,
+                  uint64_t warmup, unsigned threads, Interval_Result &result);
+
+#endif
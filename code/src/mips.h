@@ -63,4 +63,8 @@
 #define OP_SH    0x29
 #define OP_SW    0x2b
 
+/* syscall numbers (passed in $v0) */
+#define SYSCALL_EXIT    0xA /* halt this core */
+#define SYSCALL_CORE_ID 0xB /* $v0 <- ID of the calling core */
+
 #endif
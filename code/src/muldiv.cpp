@@ -0,0 +1,98 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: pipelined multiply/divide unit
+ */
+
+#include "muldiv.h"
+#include "pipe.h"
+#include "config.h"
+#include "mips.h"
+#include <algorithm>
+
+Muldiv_Unit::Muldiv_Unit(const Sim_Config &config)
+    : mul_latency(config.mul_latency), div_latency(config.div_latency),
+      mul_free(0), div_free(0), hi_ready(0), lo_ready(0)
+{
+}
+
+static uint32_t significant_bits(uint32_t v)
+{
+    return v ? 32 - __builtin_clz(v) : 0;
+}
+
+static uint32_t magnitude(uint32_t v, int is_signed)
+{
+    return is_signed && (int32_t)v < 0 ? 0u - v : v;
+}
+
+uint32_t muldiv_div_cycles(const Muldiv_Unit &u, uint32_t a, uint32_t b, int is_signed)
+{
+    a = magnitude(a, is_signed);
+    b = magnitude(b, is_signed);
+
+    /* the quotient has at most this many bits; none if b > a */
+    uint32_t bits = 0;
+    if (b != 0 && a >= b)
+        bits = significant_bits(a) - significant_bits(b) + 1;
+
+    return std::min(u.div_latency, MULDIV_DIV_SETUP + bits);
+}
+
+static uint64_t cycles_until(uint64_t ready, uint64_t now)
+{
+    return ready > now ? ready - now : 0;
+}
+
+uint64_t muldiv_wait(const Muldiv_Unit &u, const Pipe_Op *op, uint64_t now)
+{
+    if (op->opcode != OP_SPECIAL)
+        return 0;
+
+    switch (op->subop) {
+        case SUBOP_MULT: case SUBOP_MULTU:
+            return cycles_until(u.mul_free, now);
+        case SUBOP_DIV: case SUBOP_DIVU:
+            return cycles_until(u.div_free, now);
+        case SUBOP_MFHI:
+            return cycles_until(u.hi_ready, now);
+        case SUBOP_MFLO:
+            return cycles_until(u.lo_ready, now);
+    }
+    return 0;
+}
+
+int muldiv_issue(Muldiv_Unit &u, const Pipe_Op *op, uint64_t now)
+{
+    if (muldiv_wait(u, op, now) > 0)
+        return 0;
+    if (op->opcode != OP_SPECIAL)
+        return 1;
+
+    switch (op->subop) {
+        case SUBOP_MULT: case SUBOP_MULTU:
+            u.mul_free = now + 1;
+            u.hi_ready = u.lo_ready = now + u.mul_latency;
+            u.stats.mul_ops++;
+            break;
+
+        case SUBOP_DIV: case SUBOP_DIVU: {
+            uint32_t cycles = muldiv_div_cycles(u, op->reg_src1_value, op->reg_src2_value,
+                                                op->subop == SUBOP_DIV);
+            u.div_free = u.hi_ready = u.lo_ready = now + cycles;
+            u.stats.div_ops++;
+            u.stats.div_busy += cycles;
+            u.stats.div_saved += u.div_latency - cycles;
+            break;
+        }
+
+        /* a fresh copy, ready at once */
+        case SUBOP_MTHI:
+            u.hi_ready = now;
+            break;
+        case SUBOP_MTLO:
+            u.lo_ready = now;
+            break;
+    }
+    return 1;
+}
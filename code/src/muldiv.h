@@ -0,0 +1,68 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: pipelined multiply/divide unit
+ */
+
+#ifndef _MULDIV_H_
+#define _MULDIV_H_
+
+#include <cstdint>
+
+struct Pipe_Op;
+struct Sim_Config;
+
+/* The HI/LO functional units of --muldiv=pipelined. Without it, every
+ * MULT/DIV sets one countdown (mul_latency or div_latency cycles) and every
+ * HI/LO access, MTHI/MTLO included, waits for it to reach zero.
+ *
+ *   multiplier - fully pipelined: accepts a MULT/MULTU every cycle, each
+ *                producing HI and LO mul_latency cycles later
+ *   divider    - iterative, one quotient bit per cycle: a DIV/DIVU takes
+ *                MULDIV_DIV_SETUP cycles (operand normalisation and sign
+ *                fixup) plus one per significant quotient bit, at most
+ *                div_latency, and the divider accepts nothing else
+ *                meanwhile. A small quotient thus finishes early; division
+ *                by zero takes only the setup.
+ *
+ * HI and LO are renamed: each op writes a fresh copy, so only MFHI/MFLO
+ * wait, for the youngest producer of their register; MTHI/MTLO and a new
+ * MULT/DIV never wait for an older one to finish (no WAW stall), and
+ * independent multiplies overlap. Values are still computed when an op
+ * executes; the unit only decides when. */
+#define MULDIV_DIV_SETUP 2
+
+struct Muldiv_Stats {
+    /* ops started on each unit, cycles the divider was busy, and the
+     * cycles early-out saved against a full div_latency */
+    uint64_t mul_ops, div_ops;
+    uint64_t div_busy, div_saved;
+
+    Muldiv_Stats() : mul_ops(0), div_ops(0), div_busy(0), div_saved(0) {}
+};
+
+struct Muldiv_Unit {
+    uint32_t mul_latency, div_latency;
+
+    /* first cycle each unit accepts a new op, and the cycle the youngest
+     * value of HI and of LO is ready */
+    uint64_t mul_free, div_free;
+    uint64_t hi_ready, lo_ready;
+
+    Muldiv_Stats stats;
+
+    explicit Muldiv_Unit(const Sim_Config &config);
+};
+
+/* divider cycles for a DIV (is_signed) or DIVU of 'a' by 'b' */
+uint32_t muldiv_div_cycles(const Muldiv_Unit &u, uint32_t a, uint32_t b, int is_signed);
+
+/* cycles from 'now' until the HI/LO op 'op' (with its source values read)
+ * can execute; 0 if it can now, or if it is no HI/LO op */
+uint64_t muldiv_wait(const Muldiv_Unit &u, const Pipe_Op *op, uint64_t now);
+
+/* execute 'op' in cycle 'now' if it need not wait: occupy its unit and
+ * set when its results are ready. Returns 0 if it must wait. */
+int muldiv_issue(Muldiv_Unit &u, const Pipe_Op *op, uint64_t now);
+
+#endif
@@ -0,0 +1,348 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: out-of-order core model
+ */
+
+#include "ooo.h"
+#include "sim.h"
+#include "tlb.h"
+#include "frontend.h"
+#include "cosim.h"
+#include "muldiv.h"
+#include "mips.h"
+#include <cassert>
+#include <cstdint>
+
+Ooo_Core::Ooo_Core(const Sim_Config &config)
+    : iq_count(0), lsq_count(0),
+      prf(32 + config.rob_size, 0), prf_ready(32 + config.rob_size, 0),
+      store_stall(0)
+{
+    ooo_reset_rename(*this);
+}
+
+void ooo_reset_rename(Ooo_Core &o)
+{
+    assert(o.rob.empty());
+
+    o.rat.fill(-1);
+    o.free_regs.clear();
+    for (int p = (int)o.prf.size() - 1; p >= 0; p--)
+        o.free_regs.push_back(p);
+}
+
+/* HI/LO ops and syscalls issue only at the ROB head */
+static int is_serializing(const Pipe_Op *op)
+{
+    if (op->opcode != OP_SPECIAL)
+        return 0;
+
+    switch (op->subop) {
+        case SUBOP_MULT:
+        case SUBOP_MULTU:
+        case SUBOP_DIV:
+        case SUBOP_DIVU:
+        case SUBOP_MFHI:
+        case SUBOP_MTHI:
+        case SUBOP_MFLO:
+        case SUBOP_MTLO:
+        case SUBOP_SYSCALL:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static int src_ready(const Ooo_Core &o, int psrc, uint64_t now)
+{
+    return psrc < 0 || o.prf_ready[psrc] <= now;
+}
+
+static void read_src(const Pipe_State &pipe, int reg, int psrc, uint32_t *value)
+{
+    if (reg == -1)
+        return;
+
+    *value = psrc >= 0 ? pipe.ooo->prf[psrc] : pipe.REGS[reg];
+}
+
+/* remove the youngest ROB entry, undoing its rename */
+static void squash_youngest(Ooo_Core &o)
+{
+    Rob_Entry &e = o.rob.back();
+
+    if (e.pdst >= 0) {
+        o.rat[e.op->reg_dst] = e.pold;
+        o.free_regs.push_back(e.pdst);
+    }
+    if (!e.issued)
+        o.iq_count--;
+    if (e.op->is_mem)
+        o.lsq_count--;
+
+    o.rob.pop_back();
+}
+
+/* CPI stack: why nothing retired this cycle */
+static int retire_stall_cause(const Pipe_State &pipe)
+{
+    const Ooo_Core &o = *pipe.ooo;
+
+    /* an empty ROB, or a head that has only just been dispatched, is the
+     * front end's doing */
+    if (o.rob.empty())
+        return pipe.decode_bubble;
+
+    const Rob_Entry &e = o.rob.front();
+    if (!e.issued) {
+        int muldiv_busy = pipe.muldiv ? muldiv_wait(*pipe.muldiv, e.op.get(), pipe.stat_cycles) > 0
+                                      : pipe.multiplier_stall > 0;
+        return e.serialize && muldiv_busy ? CPI_MULDIV : pipe.decode_bubble;
+    }
+
+    /* a load waiting on a miss, or a store on the write buffer */
+    return CPI_MEMORY;
+}
+
+static void ooo_retire(Pipe_State &pipe)
+{
+    const Sim_Config &config = pipe.sim->config;
+    Ooo_Core &o = *pipe.ooo;
+    uint64_t now = pipe.stat_cycles;
+    uint32_t retired = 0;
+
+    while (retired < config.width && !o.rob.empty()) {
+        Rob_Entry &e = o.rob.front();
+        Pipe_Op *op = e.op.get();
+
+        if (!e.issued || e.ready_cycle > now)
+            break;
+
+        if (op->is_mem) {
+            if (op->mem_write) {
+                /* the write buffer is still busy with the previous store */
+                if (o.store_stall > 0)
+                    break;
+
+                uint32_t addr = op->mem_addr & ~3;
+                o.store_stall = tlb_translate(pipe, addr, 0);
+                o.store_stall += pipe.dcache.access(addr, 1);
+                pipe.sim->mem.write_32(addr, pipe_store_value(op, pipe.sim->mem.read_32(addr)));
+            }
+            o.lsq_count--;
+        }
+
+        /* if this instruction writes a register, do so now. The physical
+         * register it replaced has no readers left: they are all older. */
+        if (e.pdst >= 0) {
+            pipe.REGS[op->reg_dst] = o.prf[e.pdst];
+            if (e.pold >= 0)
+                o.free_regs.push_back(e.pold);
+        }
+
+        if (pipe.cosim)
+            cosim_retire(pipe, op);
+
+        retired++;
+        pipe.stat_inst_retire++;
+        pipe.sim->stat_inst_retire++;
+
+        /* if this was a syscall, perform action */
+        if (op->opcode == OP_SPECIAL && op->subop == SUBOP_SYSCALL &&
+                op->reg_src1_value == SYSCALL_EXIT) {
+            pipe.PC = op->pc; /* fetch will do pc += 4, then we stop with correct PC */
+            pipe.halted = 1;
+            pipe.decode_ops.clear();
+            o.rob.pop_front();
+            break;
+        }
+
+        o.rob.pop_front();
+    }
+
+    pipe.stat_retire_width[retired]++;
+    pipe.stat_cpi[retired ? CPI_BASE : retire_stall_cause(pipe)]++;
+}
+
+static void ooo_issue(Pipe_State &pipe)
+{
+    const Sim_Config &config = pipe.sim->config;
+    Ooo_Core &o = *pipe.ooo;
+    uint64_t now = pipe.stat_cycles;
+    uint32_t alus = config.alu_ports;
+    uint32_t mem_ports = config.mem_ports;
+
+    for (size_t i = 0; i < o.rob.size(); i++) {
+        Rob_Entry &e = o.rob[i];
+        Pipe_Op *op = e.op.get();
+
+        if (e.issued || (e.serialize && i != 0))
+            continue;
+        if (op->is_mem ? mem_ports == 0 : alus == 0)
+            continue;
+        if (!src_ready(o, e.psrc1, now) || !src_ready(o, e.psrc2, now))
+            continue;
+
+        read_src(pipe, op->reg_src1, e.psrc1, &op->reg_src1_value);
+        read_src(pipe, op->reg_src2, e.psrc2, &op->reg_src2_value);
+
+        /* a syscall writes $v0 back unchanged unless it returns a value */
+        if (op->opcode == OP_SPECIAL && op->subop == SUBOP_SYSCALL)
+            op->reg_dst_value = op->reg_src1_value;
+
+        /* the handler returns 0 if it must wait (e.g. on the multiplier) */
+        if (!op->exec(pipe, op))
+            continue;
+
+        uint64_t ready = now + 1;
+
+        if (op->is_mem && !op->mem_write) {
+            /* look for older stores: any unknown address holds the load
+             * back; the youngest one to the same word supplies the data */
+            const Pipe_Op *fwd = nullptr;
+            int blocked = 0;
+            for (size_t j = 0; j < i && !blocked; j++) {
+                const Rob_Entry &s = o.rob[j];
+                if (!s.op->is_mem || !s.op->mem_write)
+                    continue;
+                if (!s.issued)
+                    blocked = 1;
+                else if ((s.op->mem_addr & ~3) == (op->mem_addr & ~3))
+                    fwd = s.op.get();
+            }
+            if (fwd && fwd->opcode != OP_SW)
+                blocked = 1;
+            if (blocked) {
+                o.stats.loads_blocked++;
+                continue;
+            }
+
+            if (fwd) {
+                pipe_load_value(op, fwd->mem_value);
+                o.stats.loads_forwarded++;
+            }
+            else {
+                uint32_t addr = op->mem_addr & ~3;
+                ready += tlb_translate(pipe, addr, 0);
+                ready += pipe.dcache.access(addr, 0);
+                pipe_load_value(op, pipe.sim->mem.read_32(addr));
+            }
+        }
+
+        if (op->is_mem)
+            mem_ports--;
+        else
+            alus--;
+
+        if (e.pdst >= 0) {
+            o.prf[e.pdst] = op->reg_dst_value;
+            o.prf_ready[e.pdst] = ready;
+        }
+        e.issued = 1;
+        e.ready_cycle = ready;
+        o.iq_count--;
+
+        /* a mispredicted branch: squash the wrong path and redirect
+         * fetch at the end of the cycle */
+        if (pipe_mispredicted(pipe, op)) {
+            while (o.rob.size() > i + 1)
+                squash_youngest(o);
+            pipe_recover(pipe, 2, op->branch_taken ? op->branch_dest : op->pc + 4);
+        }
+    }
+}
+
+static void ooo_dispatch(Pipe_State &pipe)
+{
+    const Sim_Config &config = pipe.sim->config;
+    Ooo_Core &o = *pipe.ooo;
+
+    while (!pipe.decode_ops.empty()) {
+        Pipe_Op *op = pipe.decode_ops.front().get();
+
+        if (!op->exec) {
+            pipe_decode_op(op);
+
+            /* syscalls may return a value in $v0 */
+            if (op->opcode == OP_SPECIAL && op->subop == SUBOP_SYSCALL)
+                op->reg_dst = 2;
+        }
+
+        int has_dst = op->reg_dst > 0;
+
+        if (o.rob.size() >= config.rob_size) {
+            o.stats.rob_full++;
+            return;
+        }
+        if (o.iq_count >= config.iq_size) {
+            o.stats.iq_full++;
+            return;
+        }
+        if (op->is_mem && o.lsq_count >= config.lsq_size) {
+            o.stats.lsq_full++;
+            return;
+        }
+        if (has_dst && o.free_regs.empty()) {
+            o.stats.regs_full++;
+            return;
+        }
+
+        Rob_Entry e;
+        e.serialize = is_serializing(op);
+        if (op->reg_src1 > 0)
+            e.psrc1 = o.rat[op->reg_src1];
+        if (op->reg_src2 > 0)
+            e.psrc2 = o.rat[op->reg_src2];
+        if (has_dst) {
+            e.pdst = o.free_regs.back();
+            o.free_regs.pop_back();
+            e.pold = o.rat[op->reg_dst];
+            o.rat[op->reg_dst] = e.pdst;
+            o.prf_ready[e.pdst] = UINT64_MAX;
+        }
+
+        o.iq_count++;
+        if (op->is_mem)
+            o.lsq_count++;
+
+        /* a J/JAL the front end did not predict redirects fetch here; the
+         * rest of decode_ops is on the wrong path */
+        int redirected = pipe.frontend && frontend_decode_redirect(pipe, op);
+
+        e.op = std::move(pipe.decode_ops.front());
+        pipe.decode_ops.erase(pipe.decode_ops.begin());
+        o.rob.push_back(std::move(e));
+
+        if (redirected)
+            return;
+    }
+}
+
+void ooo_cycle(Pipe_State &pipe)
+{
+    PROF_SCOPE(&pipe.sim->profile, PROF_OOO);
+    Ooo_Core &o = *pipe.ooo;
+
+    ooo_retire(pipe);
+
+    /* after the exit syscall only the fetch stage's final PC update is left */
+    if (!pipe.halted) {
+        /* if a multiply/divide is in progress, decrement cycles until value is ready */
+        if (pipe.multiplier_stall > 0)
+            pipe.multiplier_stall--;
+        if (o.store_stall > 0)
+            o.store_stall--;
+
+        ooo_issue(pipe);
+
+        /* on a mispredict, decode_ops holds wrong-path ops: leave them to be
+         * flushed with the recovery */
+        if (!pipe.branch_recover)
+            ooo_dispatch(pipe);
+    }
+
+    pipe_stage_fetch(pipe);
+
+    o.stats.rob_occupancy += o.rob.size();
+}
@@ -0,0 +1,99 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: out-of-order core model
+ */
+
+#ifndef _OOO_H_
+#define _OOO_H_
+
+#include "pipe.h"
+#include <array>
+#include <deque>
+#include <memory>
+#include <vector>
+
+/* The out-of-order core (--core=ooo) shares fetch, decode, the execute
+ * handlers and the load/store data path with the in-order pipe, and keeps
+ * the same architectural state (REGS/HI/LO/PC in Pipe_State). Each cycle:
+ *
+ *   retire   - up to config.width completed ops leave the ROB head in order;
+ *              registers and (for stores) memory are updated here, and the
+ *              exit syscall halts the core exactly as in pipe_stage_wb()
+ *   issue    - ready ops are picked oldest first from the issue queue, up to
+ *              config.alu_ports ALU ops and config.mem_ports loads/stores;
+ *              a taken branch squashes everything younger (fetch predicts
+ *              not-taken, like the in-order pipe)
+ *   dispatch - fetched ops are decoded, renamed and placed in the ROB, the
+ *              issue queue and (loads/stores) the load/store queue
+ *   fetch    - pipe_stage_fetch()
+ *
+ * HI/LO ops (MULT/DIV/MFHI/...) and syscalls are serializing: they issue only
+ * at the ROB head, so HI/LO never needs renaming here and the multiplier
+ * model of the in-order pipe (multiplier_stall, or the Muldiv_Unit of
+ * --muldiv=pipelined) applies unchanged. Loads issue once
+ * all older stores have their addresses; the youngest older SW to the same
+ * word forwards its data, a partial (SB/SH) store makes the load wait until
+ * it retires. Stores write the cache and memory at retire, through a
+ * one-entry write buffer that is busy for the duration of a miss. */
+
+/* one in-flight instruction in the reorder buffer */
+struct Rob_Entry {
+    std::unique_ptr<Pipe_Op> op;
+
+    /* renamed registers: physical destination and the mapping it replaced
+     * (restored on a squash, freed at retire), and physical sources. -1
+     * means no physical register: the value is read from REGS. */
+    int pdst, pold;
+    int psrc1, psrc2;
+
+    int serialize;        /* must issue at the ROB head */
+    int issued;           /* has left the issue queue and executed */
+    uint64_t ready_cycle; /* cycle its result is available (once issued) */
+
+    Rob_Entry() : pdst(-1), pold(-1), psrc1(-1), psrc2(-1),
+                  serialize(0), issued(0), ready_cycle(0) {}
+};
+
+struct Ooo_Stats {
+    /* cycles dispatch stalled on a full structure */
+    uint64_t rob_full, iq_full, lsq_full, regs_full;
+    /* loads that took their value from an older store in the LSQ, and
+     * issue attempts held back by an older store */
+    uint64_t loads_forwarded, loads_blocked;
+    /* ROB occupancy summed over cycles (average = this / cycles) */
+    uint64_t rob_occupancy;
+
+    Ooo_Stats() : rob_full(0), iq_full(0), lsq_full(0), regs_full(0),
+                  loads_forwarded(0), loads_blocked(0), rob_occupancy(0) {}
+};
+
+struct Ooo_Core {
+    /* reorder buffer, oldest first */
+    std::deque<Rob_Entry> rob;
+    uint32_t iq_count;  /* dispatched ops not yet issued */
+    uint32_t lsq_count; /* loads and stores in the ROB */
+
+    /* register alias table (architectural -> physical; -1 until the first
+     * write, for the initial value in REGS) and the physical register file */
+    std::array<int, 32> rat;
+    std::vector<uint32_t> prf;
+    std::vector<uint64_t> prf_ready; /* cycle each value is available */
+    std::vector<int> free_regs;
+
+    /* cycles until the write buffer can take another retiring store */
+    uint32_t store_stall;
+
+    Ooo_Stats stats;
+
+    Ooo_Core(const Sim_Config &config);
+};
+
+/* simulate one cycle of an out-of-order core */
+void ooo_cycle(Pipe_State &pipe);
+
+/* with the ROB empty, map every register back to its value in REGS, after
+ * that changed behind the core's back (Simulator::fast_forward()) */
+void ooo_reset_rename(Ooo_Core &o);
+
+#endif
@@ -7,7 +7,13 @@
  */
 
 #include "pipe.h"
-#include "shell.h"
+#include "ooo.h"
+#include "tlb.h"
+#include "frontend.h"
+#include "cosim.h"
+#include "xlat.h"
+#include "muldiv.h"
+#include "sim.h"
 #include "mips.h"
 #include <cstdio>
 #include <cstring>
@@ -15,11 +21,12 @@
 #include <cassert>
 #include <memory>
 #include <array>
+#include <algorithm>
 
 //#define DEBUG
 
 /* debug */
-void print_op(Pipe_Op *op)
+void print_op(const Pipe_Op *op)
 {
     if (op)
         printf("OP (PC=%08x inst=%08x) src1=R%d (%08x) src2=R%d (%08x) dst=R%d valid %d (%08x) br=%d taken=%d dest=%08x mem=%d addr=%08x\n",
@@ -29,30 +36,124 @@ void print_op(Pipe_Op *op)
         printf("(null)\n");
 }
 
-/* global pipeline state */
-Pipe_State pipe;
+void print_bundle(const char *stage, const Pipe_Bundle &bundle)
+{
+    printf("%s: ", stage);
+    if (bundle.empty())
+        print_op(nullptr);
+    for (size_t i = 0; i < bundle.size(); i++) {
+        if (i > 0)
+            printf("       ");
+        print_op(bundle[i].get());
+    }
+}
+
+const char *const cpi_cause_names[CPI_NUM_CAUSES] = {
+    "Base", "LoadUse", "MulDiv", "Branch", "Fetch", "Memory"
+};
+
+/* global pipeline state, one per core */
+Pipe_State::Pipe_State(Simulator *sim, int id) : sim(sim), HI(0), LO(0), PC(0x00400000), 
+               branch_recover(0), branch_dest(0), branch_flush(0),
+               multiplier_stall(0),
+               core_id(id), halted(0),
+               icache(sim->config.l1i_size, sim->config.l1i_assoc, sim->config.block_size, sim->config.mem_latency),
+               dcache(sim->config.l1d_size, sim->config.l1d_assoc, sim->config.block_size, sim->config.mem_latency),
+               fetch_stall(0), mem_stall(0), draining(0),
+               stat_cycles(0), stat_inst_retire(0), stat_inst_fetch(0), stat_squash(0),
+               stat_retire_width(sim->config.width + 1, 0),
+               decode_bubble(CPI_FETCH), execute_bubble(CPI_FETCH),
+               mem_bubble(CPI_FETCH), wb_bubble(CPI_FETCH), stat_inst_ff(0)
+{
+    REGS.fill(0);
+    stat_cpi.fill(0);
+    if (sim->config.core_model == CORE_OOO)
+        ooo.reset(new Ooo_Core(sim->config));
+    if (sim->config.tlb)
+        mmu.reset(new Mmu(sim->config));
+    if (sim->config.ftq_size)
+        frontend.reset(new Front_End(sim->config));
+    if (sim->config.muldiv == MULDIV_PIPELINED)
+        muldiv.reset(new Muldiv_Unit(sim->config));
+    if (sim->config.cache_model) {
+        const Sim_Config &c = sim->config;
+        icache.timing = cache_timing(c.l1i_size, c.l1i_assoc, c.block_size, 1, c.clock_mhz);
+        dcache.timing = cache_timing(c.l1d_size, c.l1d_assoc, c.block_size, c.mem_ports, c.clock_mhz);
+    }
+    icache.stream = STREAM_INSTR;
+    icache.beat_bytes = dcache.beat_bytes = sim->config.mem_bus_bytes;
+    icache.cwf = dcache.cwf = sim->config.cwf;
+    if (sim->config.sector_size)
+        dcache.enable_sectors(sim->config.sector_size);
+    if (sim->config.l2_size) {
+        const Sim_Config &c = sim->config;
+        l2.reset(new Cache(c.l2_size, c.l2_assoc, c.block_size, c.mem_latency));
+        l2->beat_bytes = c.mem_bus_bytes;
+        l2->cwf = c.cwf;
+        if (c.cache_model) {
+            /* no stage cycle to hide any of the L2's access in */
+            l2->timing = cache_timing(c.l2_size, c.l2_assoc, c.block_size, 1, c.clock_mhz);
+            l2->timing.hit_latency++;
+            l2->timing.tag_latency++;
+        }
+        else {
+            /* a miss looks the block up before going to memory */
+            l2->timing.hit_latency = c.l2_latency;
+            l2->timing.tag_latency = c.l2_latency;
+        }
+        if (c.l2_partition)
+            l2->enable_partitioning(c.umon_interval);
+        icache.next = dcache.next = l2.get();
+    }
+    if (sim->config.l1d_compress)
+        dcache.enable_compression(&sim->mem, sim->config.compress_tags, sim->config.decompress_latency);
+}
+
+/* out of line: the unique_ptr members' types are incomplete in pipe.h */
+Pipe_State::~Pipe_State() = default;
+Pipe_State::Pipe_State(Pipe_State &&) = default;
+Pipe_State &Pipe_State::operator=(Pipe_State &&) = default;
 
-void pipe_init()
+void pipe_init(Simulator &sim)
 {
-    pipe = Pipe_State();
+    sim.pipes.clear();
+    sim.pipes.reserve(sim.config.ncores);
+    for (uint32_t i = 0; i < sim.config.ncores; i++)
+        sim.pipes.emplace_back(&sim, i);
+
+    /* the vector no longer moves, so the bus can point into it */
+    sim.data_bus.caches.clear();
+    for (auto &p : sim.pipes) {
+        p.dcache.bus = &sim.data_bus;
+        sim.data_bus.caches.push_back(&p.dcache);
+        p.icache.clock = p.dcache.clock = &p.stat_cycles;
+        if (p.l2)
+            p.l2->clock = &p.stat_cycles;
+        if (p.l2 && p.l2->umon)
+            p.l2->umon->clock = &p.stat_cycles;
+    }
 }
 
-void pipe_cycle()
+static void core_cycle(Pipe_State &pipe)
 {
 #ifdef DEBUG
-    printf("\n\n----\n\nPIPELINE:\n");
-    printf("DCODE: "); print_op(pipe.decode_op);
-    printf("EXEC : "); print_op(pipe.execute_op);
-    printf("MEM  : "); print_op(pipe.mem_op);
-    printf("WB   : "); print_op(pipe.wb_op);
+    printf("\n\n----\n\nPIPELINE (core %d):\n", pipe.core_id);
+    print_bundle("DCODE", pipe.decode_ops);
+    print_bundle("EXEC ", pipe.execute_ops);
+    print_bundle("MEM  ", pipe.mem_ops);
+    print_bundle("WB   ", pipe.wb_ops);
     printf("\n");
 #endif
 
-    pipe_stage_wb();
-    pipe_stage_mem();
-    pipe_stage_execute();
-    pipe_stage_decode();
-    pipe_stage_fetch();
+    if (pipe.ooo)
+        ooo_cycle(pipe);
+    else {
+        pipe_stage_wb(pipe);
+        pipe_stage_mem(pipe);
+        pipe_stage_execute(pipe);
+        pipe_stage_decode(pipe);
+        pipe_stage_fetch(pipe);
+    }
 
     /* handle branch recoveries */
     if (pipe.branch_recover) {
@@ -62,31 +163,77 @@ void pipe_cycle()
 
         pipe.PC = pipe.branch_dest;
 
+        /* abandon any instruction cache miss for the wrong path, and the
+         * blocks the BPU queued beyond the branch */
+        pipe.fetch_stall = 0;
+        if (pipe.frontend)
+            pipe.frontend->ftq.clear();
+
         if (pipe.branch_flush >= 2) {
-            pipe.decode_op.reset();
+            pipe.decode_ops.clear();
+            pipe.decode_bubble = CPI_BRANCH;
         }
 
         if (pipe.branch_flush >= 3) {
-            pipe.execute_op.reset();
+            pipe.execute_ops.clear();
+            pipe.execute_bubble = CPI_BRANCH;
         }
 
         if (pipe.branch_flush >= 4) {
-            pipe.mem_op.reset();
+            pipe.mem_ops.clear();
+            pipe.mem_bubble = CPI_BRANCH;
         }
 
         if (pipe.branch_flush >= 5) {
-            pipe.wb_op.reset();
+            pipe.wb_ops.clear();
+            pipe.wb_bubble = CPI_BRANCH;
         }
 
         pipe.branch_recover = 0;
         pipe.branch_dest = 0;
         pipe.branch_flush = 0;
 
-        stat_squash++;
+        pipe.stat_squash++;
+        pipe.sim->stat_squash++;
     }
+
+    pipe.stat_cycles++;
+}
+
+void pipe_cycle(Simulator &sim)
+{
+    int running = 0;
+
+    /* cores step in ID order; their caches see each other's coherence
+     * actions immediately */
+    for (auto &p : sim.pipes) {
+        if (p.halted)
+            continue;
+        if (sim.config.cosim && !p.cosim)
+            p.cosim.reset(new Cosim(p));
+        core_cycle(p);
+        running |= !p.halted;
+    }
+
+    if (!running)
+        sim.run_bit = false;
+}
+
+int pipe_drained(const Pipe_State &pipe)
+{
+    return pipe.decode_ops.empty() && pipe.execute_ops.empty() && pipe.mem_ops.empty() &&
+        pipe.wb_ops.empty() && !pipe.branch_recover && (!pipe.ooo || pipe.ooo->rob.empty());
 }
 
-void pipe_recover(int flush, uint32_t dest)
+int pipe_mispredicted(const Pipe_State &pipe, const Pipe_Op *op)
+{
+    if (!pipe.frontend)
+        return op->branch_taken;
+
+    return op->next_pc != (op->branch_taken ? op->branch_dest : op->pc + 4);
+}
+
+void pipe_recover(Pipe_State &pipe, int flush, uint32_t dest)
 {
     /* if there is already a recovery scheduled, it must have come from a later
      * stage (which executes older instructions), hence that recovery overrides
@@ -99,97 +246,241 @@ void pipe_recover(int flush, uint32_t dest)
     pipe.branch_dest = dest;
 }
 
-void pipe_stage_wb()
+static int waits_on_multiplier(const Pipe_Op *op)
 {
-    /* if there is no instruction in this pipeline stage, we are done */
-    if (!pipe.wb_op)
-        return;
+    return op->opcode == OP_SPECIAL &&
+        (op->subop == SUBOP_MFHI || op->subop == SUBOP_MTHI ||
+         op->subop == SUBOP_MFLO || op->subop == SUBOP_MTLO);
+}
 
-    /* grab the op out of our input slot */
-    Pipe_Op *op = pipe.wb_op.get();
+/* does reading 'reg' wait on a value a load in the memory stage has not
+ * produced yet? */
+static int waits_on_mem(const Pipe_State &pipe, int reg)
+{
+    if (reg <= 0)
+        return 0;
 
-    /* if this instruction writes a register, do so now */
-    if (op->reg_dst != -1 && op->reg_dst != 0) {
-        pipe.REGS[op->reg_dst] = op->reg_dst_value;
-#ifdef DEBUG
-        printf("R%d = %08x\n", op->reg_dst, op->reg_dst_value);
-#endif
+    for (size_t i = pipe.mem_ops.size(); i-- > 0; ) {
+        if (pipe.mem_ops[i]->reg_dst == reg)
+            return !pipe.mem_ops[i]->reg_dst_value_ready;
+    }
+    return 0;
+}
+
+/* idle cycles ahead for one core. Each stage is idle if it has nothing to
+ * do or is blocked; countdowns bound how long that lasts. Stages decrement
+ * their countdown before checking it, so every cycle that starts with more
+ * than one remaining cycle is idle. */
+static uint32_t core_idle_cycles(const Pipe_State &pipe)
+{
+    const Sim_Config &config = pipe.sim->config;
+    uint32_t idle = UINT32_MAX;
+
+    if (pipe.halted)
+        return idle;
+
+    /* the out-of-order core and the decoupled front end are always cycled */
+    if (pipe.ooo || pipe.frontend)
+        return 0;
+
+    /* a pending recovery always changes state at the end of the cycle */
+    if (pipe.branch_recover)
+        return 0;
+
+    /* writeback makes progress whenever it holds an op */
+    if (!pipe.wb_ops.empty())
+        return 0;
+
+    /* memory is idle only while waiting on a data cache miss */
+    if (!pipe.mem_ops.empty()) {
+        if (pipe.mem_stall <= 1)
+            return 0;
+        idle = std::min(idle, pipe.mem_stall - 1);
     }
 
-    /* if this was a syscall, perform action */
-    if (op->opcode == OP_SPECIAL && op->subop == SUBOP_SYSCALL) {
-        if (op->reg_src1_value == 0xA) {
-            pipe.PC = op->pc; /* fetch will do pc += 4, then we stop with correct PC */
-            RUN_BIT = false;
+    /* execute is blocked by a full memory stage, by a load stuck in the
+     * (stalled) memory stage, or must be an HI/LO access waiting on the
+     * multiplier */
+    if (!pipe.execute_ops.empty() && pipe.mem_ops.size() < config.width) {
+        const Pipe_Op *op = pipe.execute_ops.front().get();
+        if (!waits_on_mem(pipe, op->reg_src1) && !waits_on_mem(pipe, op->reg_src2)) {
+            if (pipe.muldiv) {
+                /* the unit's wait counts from the coming cycle on */
+                uint64_t wait = muldiv_wait(*pipe.muldiv, op, pipe.stat_cycles);
+                if (wait == 0)
+                    return 0;
+                idle = std::min<uint64_t>(idle, wait);
+            }
+            else {
+                if (!waits_on_multiplier(op) || pipe.multiplier_stall <= 1)
+                    return 0;
+                idle = std::min(idle, (uint32_t)pipe.multiplier_stall - 1);
+            }
         }
     }
 
-    /* free the op */
-    pipe.wb_op.reset();
+    /* decode only waits when the execute input is full */
+    if (!pipe.decode_ops.empty() && pipe.execute_ops.size() < config.width)
+        return 0;
 
-    stat_inst_retire++;
+    /* fetch waits on a full decode input or an instruction cache miss */
+    if (pipe.decode_ops.size() < config.width) {
+        if (pipe.fetch_stall <= 1)
+            return 0;
+        idle = std::min(idle, pipe.fetch_stall - 1);
+    }
+
+    return idle;
 }
 
-void pipe_stage_mem()
+uint32_t pipe_idle_cycles(const Simulator &sim)
 {
-    /* if there is no instruction in this pipeline stage, we are done */
-    if (!pipe.mem_op)
-        return;
+    if (!sim.run_bit)
+        return 0;
 
-    /* grab the op out of our input slot */
-    Pipe_Op *op = pipe.mem_op.get();
+    uint32_t idle = UINT32_MAX;
+    for (const auto &p : sim.pipes)
+        idle = std::min(idle, core_idle_cycles(p));
 
-    uint32_t val = 0;
-    if (op->is_mem)
-        val = mem_read_32(op->mem_addr & ~3);
+    return idle;
+}
 
-    switch (op->opcode) {
-        case OP_LW:
-        case OP_LH:
-        case OP_LHU:
-        case OP_LB:
-        case OP_LBU:
-            {
-                /* extract needed value */
-                op->reg_dst_value_ready = 1;
-                if (op->opcode == OP_LW) {
-                    op->reg_dst_value = val;
-                }
-                else if (op->opcode == OP_LH || op->opcode == OP_LHU) {
-                    if (op->mem_addr & 2)
-                        val = (val >> 16) & 0xFFFF;
-                    else
-                        val = val & 0xFFFF;
-
-                    if (op->opcode == OP_LH)
-                        val |= (val & 0x8000) ? 0xFFFF8000 : 0;
-
-                    op->reg_dst_value = val;
-                }
-                else if (op->opcode == OP_LB || op->opcode == OP_LBU) {
-                    switch (op->mem_addr & 3) {
-                        case 0:
-                            val = val & 0xFF;
-                            break;
-                        case 1:
-                            val = (val >> 8) & 0xFF;
-                            break;
-                        case 2:
-                            val = (val >> 16) & 0xFF;
-                            break;
-                        case 3:
-                            val = (val >> 24) & 0xFF;
-                            break;
-                    }
-
-                    if (op->opcode == OP_LB)
-                        val |= (val & 0x80) ? 0xFFFFFF80 : 0;
-
-                    op->reg_dst_value = val;
-                }
+static uint32_t countdown(uint32_t count, uint32_t n)
+{
+    return count > n ? count - n : 0;
+}
+
+/* the CPI accounting of one idle cycle: charge it, then move the bubble
+ * causes down the pipe the way the (blocked) stages would */
+static void idle_bubble_cycle(Pipe_State &pipe)
+{
+    const Sim_Config &config = pipe.sim->config;
+
+    pipe.stat_cpi[pipe.wb_bubble]++;
+
+    pipe.wb_bubble = pipe.mem_ops.empty() ? pipe.mem_bubble : CPI_MEMORY;
+
+    /* with the memory stage empty, execute can only be waiting on the
+     * multiplier */
+    if (pipe.mem_ops.empty())
+        pipe.mem_bubble = pipe.execute_ops.empty() ? pipe.execute_bubble : CPI_MULDIV;
+
+    if (pipe.decode_ops.empty())
+        pipe.execute_bubble = pipe.decode_bubble;
+
+    if (pipe.decode_ops.size() < config.width)
+        pipe.decode_bubble = CPI_FETCH;
+}
+
+void pipe_skip_cycles(Simulator &sim, uint32_t n)
+{
+    assert(n <= pipe_idle_cycles(sim));
+
+    for (auto &p : sim.pipes) {
+        if (p.halted)
+            continue;
+        p.multiplier_stall = countdown(p.multiplier_stall, n);
+        p.mem_stall = countdown(p.mem_stall, n);
+        p.fetch_stall = countdown(p.fetch_stall, n);
+        p.stat_cycles += n;
+        p.stat_retire_width[0] += n;
+
+        /* the bubble causes settle once they have crossed the four stage
+         * inputs; every later idle cycle is charged the same */
+        uint32_t i;
+        for (i = 0; i < n && i < 4; i++)
+            idle_bubble_cycle(p);
+        p.stat_cpi[p.wb_bubble] += n - i;
+    }
+}
+
+void pipe_stage_wb(Pipe_State &pipe)
+{
+    PROF_SCOPE(&pipe.sim->profile, PROF_WB);
+    uint32_t retired = 0;
+
+    /* retire every op in our input bundle, oldest first */
+    for (auto &slot : pipe.wb_ops) {
+        Pipe_Op *op = slot.get();
+
+        /* if this instruction writes a register, do so now */
+        if (op->reg_dst != -1 && op->reg_dst != 0) {
+            pipe.REGS[op->reg_dst] = op->reg_dst_value;
+#ifdef DEBUG
+            printf("R%d = %08x\n", op->reg_dst, op->reg_dst_value);
+#endif
+        }
+
+        if (pipe.cosim)
+            cosim_retire(pipe, op);
+
+        retired++;
+        pipe.stat_inst_retire++;
+        pipe.sim->stat_inst_retire++;
+
+        /* if this was a syscall, perform action */
+        if (op->opcode == OP_SPECIAL && op->subop == SUBOP_SYSCALL) {
+            if (op->reg_src1_value == SYSCALL_EXIT) {
+                pipe.PC = op->pc; /* fetch will do pc += 4, then we stop with correct PC */
+                pipe.halted = 1;
+
+                /* nothing younger than the exit retires */
+                break;
             }
-            break;
+        }
+    }
+
+    /* free the ops */
+    pipe.wb_ops.clear();
+
+    pipe.stat_retire_width[retired]++;
+    pipe.stat_cpi[retired ? CPI_BASE : pipe.wb_bubble]++;
+}
+
+void pipe_load_value(Pipe_Op *op, uint32_t val)
+{
+    /* extract needed value */
+    op->reg_dst_value_ready = 1;
+    if (op->opcode == OP_LW) {
+        op->reg_dst_value = val;
+    }
+    else if (op->opcode == OP_LH || op->opcode == OP_LHU) {
+        if (op->mem_addr & 2)
+            val = (val >> 16) & 0xFFFF;
+        else
+            val = val & 0xFFFF;
+
+        if (op->opcode == OP_LH)
+            val |= (val & 0x8000) ? 0xFFFF8000 : 0;
+
+        op->reg_dst_value = val;
+    }
+    else if (op->opcode == OP_LB || op->opcode == OP_LBU) {
+        switch (op->mem_addr & 3) {
+            case 0:
+                val = val & 0xFF;
+                break;
+            case 1:
+                val = (val >> 8) & 0xFF;
+                break;
+            case 2:
+                val = (val >> 16) & 0xFF;
+                break;
+            case 3:
+                val = (val >> 24) & 0xFF;
+                break;
+        }
+
+        if (op->opcode == OP_LB)
+            val |= (val & 0x80) ? 0xFFFFFF80 : 0;
 
+        op->reg_dst_value = val;
+    }
+}
+
+uint32_t pipe_store_value(const Pipe_Op *op, uint32_t val)
+{
+    switch (op->opcode) {
         case OP_SB:
             switch (op->mem_addr & 3) {
                 case 0: val = (val & 0xFFFFFF00) | ((op->mem_value & 0xFF) << 0); break;
@@ -197,8 +488,6 @@ void pipe_stage_mem()
                 case 2: val = (val & 0xFF00FFFF) | ((op->mem_value & 0xFF) << 16); break;
                 case 3: val = (val & 0x00FFFFFF) | ((op->mem_value & 0xFF) << 24); break;
             }
-
-            mem_write_32(op->mem_addr & ~3, val);
             break;
 
         case OP_SH:
@@ -212,325 +501,637 @@ void pipe_stage_mem()
 #ifdef DEBUG
             printf("new word %08x\n", val);
 #endif
-
-            mem_write_32(op->mem_addr & ~3, val);
             break;
 
         case OP_SW:
             val = op->mem_value;
-            mem_write_32(op->mem_addr & ~3, val);
             break;
     }
 
-    /* clear stage input and transfer to next stage */
-    pipe.wb_op = std::move(pipe.mem_op);
+    return val;
 }
 
-void pipe_stage_execute()
+/* perform the memory access of a load or store */
+static void mem_access(Sim_Memory &mem, Pipe_Op *op)
 {
-    /* if a multiply/divide is in progress, decrement cycles until value is ready */
-    if (pipe.multiplier_stall > 0)
-        pipe.multiplier_stall--;
-
-    /* if downstream stall, return (and leave any input we had) */
-    if (pipe.mem_op)
+    if (!op->is_mem)
         return;
 
-    /* if no op to execute, return */
-    if (!pipe.execute_op)
-        return;
+    uint32_t val = mem.read_32(op->mem_addr & ~3);
 
-    /* grab op and read sources */
-    Pipe_Op *op = pipe.execute_op.get();
-
-    /* read register values, and check for bypass; stall if necessary */
-    int stall = 0;
-    if (op->reg_src1 != -1) {
-        if (op->reg_src1 == 0)
-            op->reg_src1_value = 0;
-        else if (pipe.mem_op && pipe.mem_op->reg_dst == op->reg_src1) {
-            if (!pipe.mem_op->reg_dst_value_ready)
-                stall = 1;
-            else
-                op->reg_src1_value = pipe.mem_op->reg_dst_value;
+    if (op->mem_write)
+        mem.write_32(op->mem_addr & ~3, pipe_store_value(op, val));
+    else
+        pipe_load_value(op, val);
+}
+
+void pipe_stage_mem(Pipe_State &pipe)
+{
+    PROF_SCOPE(&pipe.sim->profile, PROF_MEM);
+    const Sim_Config &config = pipe.sim->config;
+    uint32_t ports = config.mem_ports;
+
+    /* writeback's input stays empty: pass on our bubble, or start one */
+    pipe.wb_bubble = pipe.mem_ops.empty() ? pipe.mem_bubble : CPI_MEMORY;
+
+    /* process our input bundle oldest first; an op that cannot complete
+     * this cycle holds up all younger ones */
+    while (!pipe.mem_ops.empty()) {
+        Pipe_Op *op = pipe.mem_ops.front().get();
+
+        /* wait for an outstanding data cache miss; a load or store that
+         * misses leaves its op in place until the miss has been serviced */
+        if (pipe.mem_stall > 0) {
+            if (--pipe.mem_stall > 0)
+                return;
+            ports--;
         }
-        else if (pipe.wb_op && pipe.wb_op->reg_dst == op->reg_src1) {
-            op->reg_src1_value = pipe.wb_op->reg_dst_value;
+        else if (op->is_mem) {
+            /* all memory ports used this cycle */
+            if (ports == 0)
+                return;
+            ports--;
+
+            pipe.mem_stall = tlb_translate(pipe, op->mem_addr, 0);
+            pipe.mem_stall += pipe.dcache.access(op->mem_addr & ~3, op->mem_write);
+            if (pipe.mem_stall > 0)
+                return;
         }
-        else
-            op->reg_src1_value = pipe.REGS[op->reg_src1];
+
+        mem_access(pipe.sim->mem, op);
+
+        /* clear stage input and transfer to next stage */
+        pipe.wb_ops.push_back(std::move(pipe.mem_ops.front()));
+        pipe.mem_ops.erase(pipe.mem_ops.begin());
     }
-    if (op->reg_src2 != -1) {
-        if (op->reg_src2 == 0)
-            op->reg_src2_value = 0;
-        else if (pipe.mem_op && pipe.mem_op->reg_dst == op->reg_src2) {
-            if (!pipe.mem_op->reg_dst_value_ready)
-                stall = 1;
-            else
-                op->reg_src2_value = pipe.mem_op->reg_dst_value;
-        }
-        else if (pipe.wb_op && pipe.wb_op->reg_dst == op->reg_src2) {
-            op->reg_src2_value = pipe.wb_op->reg_dst_value;
-        }
-        else
-            op->reg_src2_value = pipe.REGS[op->reg_src2];
+}
+
+/* execute handlers: one per instruction (or group of instructions with the
+ * same semantics). Decode resolves each op to its handler once through the
+ * tables below, so execute does a single indirect call. A handler returns 0
+ * if the op must stall in execute (its input is left in place), 1 otherwise. */
+
+static int exec_none(Pipe_State &pipe, Pipe_Op *op)
+{
+    return 1;
+}
+
+/* SPECIAL ops that produce no ALU result (unknown subops) */
+static int exec_special_none(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    return 1;
+}
+
+static int exec_syscall(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+
+    /* the core-ID syscall returns this core's ID in $v0 */
+    if (op->reg_src1_value == SYSCALL_CORE_ID) {
+        op->reg_dst = 2;
+        op->reg_dst_value = pipe.core_id;
     }
+    return 1;
+}
 
-    /* if bypassing requires a stall (e.g. use immediately after load),
-     * return without clearing stage input */
-    if (stall) 
-        return;
+static int exec_sll(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src2_value << op->shamt;
+    return 1;
+}
 
-    /* execute the op */
-    switch (op->opcode) {
-        case OP_SPECIAL:
-            op->reg_dst_value_ready = 1;
-            switch (op->subop) {
-                case SUBOP_SLL:
-                    op->reg_dst_value = op->reg_src2_value << op->shamt;
-                    break;
-                case SUBOP_SLLV:
-                    op->reg_dst_value = op->reg_src2_value << op->reg_src1_value;
-                    break;
-                case SUBOP_SRL:
-                    op->reg_dst_value = op->reg_src2_value >> op->shamt;
-                    break;
-                case SUBOP_SRLV:
-                    op->reg_dst_value = op->reg_src2_value >> op->reg_src1_value;
-                    break;
-                case SUBOP_SRA:
-                    op->reg_dst_value = (int32_t)op->reg_src2_value >> op->shamt;
-                    break;
-                case SUBOP_SRAV:
-                    op->reg_dst_value = (int32_t)op->reg_src2_value >> op->reg_src1_value;
-                    break;
-                case SUBOP_JR:
-                case SUBOP_JALR:
-                    op->reg_dst_value = op->pc + 4;
-                    op->branch_dest = op->reg_src1_value;
-                    op->branch_taken = 1;
-                    break;
-
-                case SUBOP_MULT:
-                    {
-                        /* we set a result value right away; however, we will
-                         * model a stall if the program tries to read the value
-                         * before it's ready (or overwrite HI/LO). Also, if
-                         * another multiply comes down the pipe later, it will
-                         * update the values and re-set the stall cycle count
-                         * for a new operation.
-                         */
-                        int64_t val = (int64_t)((int32_t)op->reg_src1_value) * (int64_t)((int32_t)op->reg_src2_value);
-                        uint64_t uval = (uint64_t)val;
-                        pipe.HI = (uval >> 32) & 0xFFFFFFFF;
-                        pipe.LO = (uval >>  0) & 0xFFFFFFFF;
-
-                        /* four-cycle multiplier latency */
-                        pipe.multiplier_stall = 4;
-                    }
-                    break;
-                case SUBOP_MULTU:
-                    {
-                        uint64_t val = (uint64_t)op->reg_src1_value * (uint64_t)op->reg_src2_value;
-                        pipe.HI = (val >> 32) & 0xFFFFFFFF;
-                        pipe.LO = (val >>  0) & 0xFFFFFFFF;
-
-                        /* four-cycle multiplier latency */
-                        pipe.multiplier_stall = 4;
-                    }
-                    break;
-
-                case SUBOP_DIV:
-                    if (op->reg_src2_value != 0) {
-
-                        int32_t val1 = (int32_t)op->reg_src1_value;
-                        int32_t val2 = (int32_t)op->reg_src2_value;
-                        int32_t div, mod;
-
-                        div = val1 / val2;
-                        mod = val1 % val2;
-
-                        pipe.LO = div;
-                        pipe.HI = mod;
-                    } else {
-                        // really this would be a div-by-0 exception
-                        pipe.HI = pipe.LO = 0;
-                    }
-
-                    /* 32-cycle divider latency */
-                    pipe.multiplier_stall = 32;
-                    break;
-
-                case SUBOP_DIVU:
-                    if (op->reg_src2_value != 0) {
-                        pipe.HI = (uint32_t)op->reg_src1_value % (uint32_t)op->reg_src2_value;
-                        pipe.LO = (uint32_t)op->reg_src1_value / (uint32_t)op->reg_src2_value;
-                    } else {
-                        /* really this would be a div-by-0 exception */
-                        pipe.HI = pipe.LO = 0;
-                    }
-
-                    /* 32-cycle divider latency */
-                    pipe.multiplier_stall = 32;
-                    break;
-
-                case SUBOP_MFHI:
-                    /* stall until value is ready */
-                    if (pipe.multiplier_stall > 0)
-                        return;
-
-                    op->reg_dst_value = pipe.HI;
-                    break;
-                case SUBOP_MTHI:
-                    /* stall to respect WAW dependence */
-                    if (pipe.multiplier_stall > 0)
-                        return;
-
-                    pipe.HI = op->reg_src1_value;
-                    break;
-
-                case SUBOP_MFLO:
-                    /* stall until value is ready */
-                    if (pipe.multiplier_stall > 0)
-                        return;
-
-                    op->reg_dst_value = pipe.LO;
-                    break;
-                case SUBOP_MTLO:
-                    /* stall to respect WAW dependence */
-                    if (pipe.multiplier_stall > 0)
-                        return;
-
-                    pipe.LO = op->reg_src1_value;
-                    break;
-
-                case SUBOP_ADD:
-                case SUBOP_ADDU:
-                    op->reg_dst_value = op->reg_src1_value + op->reg_src2_value;
-                    break;
-                case SUBOP_SUB:
-                case SUBOP_SUBU:
-                    op->reg_dst_value = op->reg_src1_value - op->reg_src2_value;
-                    break;
-                case SUBOP_AND:
-                    op->reg_dst_value = op->reg_src1_value & op->reg_src2_value;
-                    break;
-                case SUBOP_OR:
-                    op->reg_dst_value = op->reg_src1_value | op->reg_src2_value;
-                    break;
-                case SUBOP_NOR:
-                    op->reg_dst_value = ~(op->reg_src1_value | op->reg_src2_value);
-                    break;
-                case SUBOP_XOR:
-                    op->reg_dst_value = op->reg_src1_value ^ op->reg_src2_value;
-                    break;
-                case SUBOP_SLT:
-                    op->reg_dst_value = ((int32_t)op->reg_src1_value <
-                            (int32_t)op->reg_src2_value) ? 1 : 0;
-                    break;
-                case SUBOP_SLTU:
-                    op->reg_dst_value = (op->reg_src1_value < op->reg_src2_value) ? 1 : 0;
-                    break;
-            }
-            break;
+static int exec_sllv(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src2_value << op->reg_src1_value;
+    return 1;
+}
 
-        case OP_BRSPEC:
-            switch (op->subop) {
-                case BROP_BLTZ:
-                case BROP_BLTZAL:
-                    if ((int32_t)op->reg_src1_value < 0) op->branch_taken = 1;
-                    break;
-
-                case BROP_BGEZ:
-                case BROP_BGEZAL:
-                    if ((int32_t)op->reg_src1_value >= 0) op->branch_taken = 1;
-                    break;
-            }
-            break;
+static int exec_srl(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src2_value >> op->shamt;
+    return 1;
+}
 
-        case OP_BEQ:
-            if (op->reg_src1_value == op->reg_src2_value) op->branch_taken = 1;
-            break;
+static int exec_srlv(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src2_value >> op->reg_src1_value;
+    return 1;
+}
 
-        case OP_BNE:
-            if (op->reg_src1_value != op->reg_src2_value) op->branch_taken = 1;
-            break;
+static int exec_sra(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = (int32_t)op->reg_src2_value >> op->shamt;
+    return 1;
+}
 
-        case OP_BLEZ:
-            if ((int32_t)op->reg_src1_value <= 0) op->branch_taken = 1;
-            break;
+static int exec_srav(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = (int32_t)op->reg_src2_value >> op->reg_src1_value;
+    return 1;
+}
 
-        case OP_BGTZ:
-            if ((int32_t)op->reg_src1_value > 0) op->branch_taken = 1;
-            break;
+static int exec_jr(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->pc + 4;
+    op->branch_dest = op->reg_src1_value;
+    op->branch_taken = 1;
+    return 1;
+}
 
-        case OP_ADDI:
-        case OP_ADDIU:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = op->reg_src1_value + op->se_imm16;
-            break;
-        case OP_SLTI:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = (int32_t)op->reg_src1_value < (int32_t)op->se_imm16 ? 1 : 0;
-            break;
-        case OP_SLTIU:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = (uint32_t)op->reg_src1_value < (uint32_t)op->se_imm16 ? 1 : 0;
-            break;
-        case OP_ANDI:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = op->reg_src1_value & op->imm16;
-            break;
-        case OP_ORI:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = op->reg_src1_value | op->imm16;
-            break;
-        case OP_XORI:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = op->reg_src1_value ^ op->imm16;
-            break;
-        case OP_LUI:
-            op->reg_dst_value_ready = 1;
-            op->reg_dst_value = op->imm16 << 16;
-            break;
+/* may the HI/LO op 'op' execute this cycle? With the pipelined unit, this
+ * also starts it there. */
+static int hilo_issue(Pipe_State &pipe, Pipe_Op *op)
+{
+    if (pipe.muldiv)
+        return muldiv_issue(*pipe.muldiv, op, pipe.stat_cycles);
+    return !waits_on_multiplier(op) || pipe.multiplier_stall == 0;
+}
 
-        case OP_LW:
-        case OP_LH:
-        case OP_LHU:
-        case OP_LB:
-        case OP_LBU:
-            op->mem_addr = op->reg_src1_value + op->se_imm16;
-            break;
+/* a multiply or divide executed: with the simple model, HI/LO are ready
+ * 'latency' cycles from now */
+static void hilo_start(Pipe_State &pipe, uint32_t latency)
+{
+    if (!pipe.muldiv)
+        pipe.multiplier_stall = latency;
+}
 
-        case OP_SW:
-        case OP_SH:
-        case OP_SB:
-            op->mem_addr = op->reg_src1_value + op->se_imm16;
-            op->mem_value = op->reg_src2_value;
-            break;
+static int exec_mult(Pipe_State &pipe, Pipe_Op *op)
+{
+    /* we set a result value right away; however, we will model a stall if
+     * the program tries to read the value before it's ready (or overwrite
+     * HI/LO). Also, if another multiply comes down the pipe later, it will
+     * update the values and re-set the stall cycle count for a new
+     * operation.
+     */
+    op->reg_dst_value_ready = 1;
+    if (!hilo_issue(pipe, op))
+        return 0;
+    int64_t val = (int64_t)((int32_t)op->reg_src1_value) * (int64_t)((int32_t)op->reg_src2_value);
+    uint64_t uval = (uint64_t)val;
+    pipe.HI = (uval >> 32) & 0xFFFFFFFF;
+    pipe.LO = (uval >>  0) & 0xFFFFFFFF;
+
+    hilo_start(pipe, pipe.sim->config.mul_latency);
+    return 1;
+}
+
+static int exec_multu(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    if (!hilo_issue(pipe, op))
+        return 0;
+    uint64_t val = (uint64_t)op->reg_src1_value * (uint64_t)op->reg_src2_value;
+    pipe.HI = (val >> 32) & 0xFFFFFFFF;
+    pipe.LO = (val >>  0) & 0xFFFFFFFF;
+
+    hilo_start(pipe, pipe.sim->config.mul_latency);
+    return 1;
+}
+
+static int exec_div(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    if (!hilo_issue(pipe, op))
+        return 0;
+    if (op->reg_src2_value != 0) {
+
+        int32_t val1 = (int32_t)op->reg_src1_value;
+        int32_t val2 = (int32_t)op->reg_src2_value;
+        int32_t div, mod;
+
+        div = val1 / val2;
+        mod = val1 % val2;
+
+        pipe.LO = div;
+        pipe.HI = mod;
+    } else {
+        // really this would be a div-by-0 exception
+        pipe.HI = pipe.LO = 0;
     }
 
-    /* handle branch recoveries at this point */
-    if (op->branch_taken)
-        pipe_recover(3, op->branch_dest);
+    hilo_start(pipe, pipe.sim->config.div_latency);
+    return 1;
+}
 
-    /* remove from upstream stage and place in downstream stage */
-    pipe.mem_op = std::move(pipe.execute_op);
+static int exec_divu(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    if (!hilo_issue(pipe, op))
+        return 0;
+    if (op->reg_src2_value != 0) {
+        pipe.HI = (uint32_t)op->reg_src1_value % (uint32_t)op->reg_src2_value;
+        pipe.LO = (uint32_t)op->reg_src1_value / (uint32_t)op->reg_src2_value;
+    } else {
+        /* really this would be a div-by-0 exception */
+        pipe.HI = pipe.LO = 0;
+    }
+
+    hilo_start(pipe, pipe.sim->config.div_latency);
+    return 1;
 }
 
-void pipe_stage_decode()
+static int exec_mfhi(Pipe_State &pipe, Pipe_Op *op)
 {
-    /* if downstream stall, return (and leave any input we had) */
-    if (pipe.execute_op)
-        return;
+    op->reg_dst_value_ready = 1;
+    /* stall until value is ready */
+    if (!hilo_issue(pipe, op))
+        return 0;
 
-    /* if no op to decode, return */
-    if (!pipe.decode_op)
-        return;
+    op->reg_dst_value = pipe.HI;
+    return 1;
+}
+
+static int exec_mthi(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    /* stall to respect WAW dependence */
+    if (!hilo_issue(pipe, op))
+        return 0;
+
+    pipe.HI = op->reg_src1_value;
+    return 1;
+}
+
+static int exec_mflo(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    /* stall until value is ready */
+    if (!hilo_issue(pipe, op))
+        return 0;
+
+    op->reg_dst_value = pipe.LO;
+    return 1;
+}
+
+static int exec_mtlo(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    /* stall to respect WAW dependence */
+    if (!hilo_issue(pipe, op))
+        return 0;
+
+    pipe.LO = op->reg_src1_value;
+    return 1;
+}
+
+static int exec_add(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value + op->reg_src2_value;
+    return 1;
+}
+
+static int exec_sub(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value - op->reg_src2_value;
+    return 1;
+}
+
+static int exec_and(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value & op->reg_src2_value;
+    return 1;
+}
+
+static int exec_or(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value | op->reg_src2_value;
+    return 1;
+}
+
+static int exec_nor(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = ~(op->reg_src1_value | op->reg_src2_value);
+    return 1;
+}
+
+static int exec_xor(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value ^ op->reg_src2_value;
+    return 1;
+}
+
+static int exec_slt(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = ((int32_t)op->reg_src1_value <
+            (int32_t)op->reg_src2_value) ? 1 : 0;
+    return 1;
+}
+
+static int exec_sltu(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = (op->reg_src1_value < op->reg_src2_value) ? 1 : 0;
+    return 1;
+}
+
+static int exec_bltz(Pipe_State &pipe, Pipe_Op *op)
+{
+    if ((int32_t)op->reg_src1_value < 0) op->branch_taken = 1;
+    return 1;
+}
+
+static int exec_bgez(Pipe_State &pipe, Pipe_Op *op)
+{
+    if ((int32_t)op->reg_src1_value >= 0) op->branch_taken = 1;
+    return 1;
+}
+
+static int exec_beq(Pipe_State &pipe, Pipe_Op *op)
+{
+    if (op->reg_src1_value == op->reg_src2_value) op->branch_taken = 1;
+    return 1;
+}
+
+static int exec_bne(Pipe_State &pipe, Pipe_Op *op)
+{
+    if (op->reg_src1_value != op->reg_src2_value) op->branch_taken = 1;
+    return 1;
+}
+
+static int exec_blez(Pipe_State &pipe, Pipe_Op *op)
+{
+    if ((int32_t)op->reg_src1_value <= 0) op->branch_taken = 1;
+    return 1;
+}
+
+static int exec_bgtz(Pipe_State &pipe, Pipe_Op *op)
+{
+    if ((int32_t)op->reg_src1_value > 0) op->branch_taken = 1;
+    return 1;
+}
+
+static int exec_addi(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value + op->se_imm16;
+    return 1;
+}
+
+static int exec_slti(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = (int32_t)op->reg_src1_value < (int32_t)op->se_imm16 ? 1 : 0;
+    return 1;
+}
+
+static int exec_sltiu(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = (uint32_t)op->reg_src1_value < (uint32_t)op->se_imm16 ? 1 : 0;
+    return 1;
+}
+
+static int exec_andi(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value & op->imm16;
+    return 1;
+}
+
+static int exec_ori(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value | op->imm16;
+    return 1;
+}
+
+static int exec_xori(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->reg_src1_value ^ op->imm16;
+    return 1;
+}
+
+static int exec_lui(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->reg_dst_value_ready = 1;
+    op->reg_dst_value = op->imm16 << 16;
+    return 1;
+}
+
+static int exec_load(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->mem_addr = op->reg_src1_value + op->se_imm16;
+    return 1;
+}
 
-    /* grab op and remove from stage input */
-    Pipe_Op *op = pipe.decode_op.get();
+static int exec_store(Pipe_State &pipe, Pipe_Op *op)
+{
+    op->mem_addr = op->reg_src1_value + op->se_imm16;
+    op->mem_value = op->reg_src2_value;
+    return 1;
+}
+
+/* dispatch tables, indexed by primary opcode, SPECIAL function code and
+ * BRSPEC rt field respectively. Built at compile time from mips.h. */
+typedef std::array<Pipe_Exec_Fn, 64> Exec_Table;
+
+static constexpr Exec_Table make_opcode_table()
+{
+    Exec_Table t{};
+    for (auto &fn : t)
+        fn = exec_none;
+
+    t[OP_BEQ]   = exec_beq;
+    t[OP_BNE]   = exec_bne;
+    t[OP_BLEZ]  = exec_blez;
+    t[OP_BGTZ]  = exec_bgtz;
+    t[OP_ADDI]  = exec_addi;
+    t[OP_ADDIU] = exec_addi;
+    t[OP_SLTI]  = exec_slti;
+    t[OP_SLTIU] = exec_sltiu;
+    t[OP_ANDI]  = exec_andi;
+    t[OP_ORI]   = exec_ori;
+    t[OP_XORI]  = exec_xori;
+    t[OP_LUI]   = exec_lui;
+    t[OP_LW]    = exec_load;
+    t[OP_LH]    = exec_load;
+    t[OP_LHU]   = exec_load;
+    t[OP_LB]    = exec_load;
+    t[OP_LBU]   = exec_load;
+    t[OP_SW]    = exec_store;
+    t[OP_SH]    = exec_store;
+    t[OP_SB]    = exec_store;
+    return t;
+}
+
+static constexpr Exec_Table make_special_table()
+{
+    Exec_Table t{};
+    for (auto &fn : t)
+        fn = exec_special_none;
+
+    t[SUBOP_SLL]   = exec_sll;
+    t[SUBOP_SLLV]  = exec_sllv;
+    t[SUBOP_SRL]   = exec_srl;
+    t[SUBOP_SRLV]  = exec_srlv;
+    t[SUBOP_SRA]   = exec_sra;
+    t[SUBOP_SRAV]  = exec_srav;
+    t[SUBOP_JR]    = exec_jr;
+    t[SUBOP_JALR]  = exec_jr;
+    t[SUBOP_SYSCALL] = exec_syscall;
+    t[SUBOP_MULT]  = exec_mult;
+    t[SUBOP_MULTU] = exec_multu;
+    t[SUBOP_DIV]   = exec_div;
+    t[SUBOP_DIVU]  = exec_divu;
+    t[SUBOP_MFHI]  = exec_mfhi;
+    t[SUBOP_MTHI]  = exec_mthi;
+    t[SUBOP_MFLO]  = exec_mflo;
+    t[SUBOP_MTLO]  = exec_mtlo;
+    t[SUBOP_ADD]   = exec_add;
+    t[SUBOP_ADDU]  = exec_add;
+    t[SUBOP_SUB]   = exec_sub;
+    t[SUBOP_SUBU]  = exec_sub;
+    t[SUBOP_AND]   = exec_and;
+    t[SUBOP_OR]    = exec_or;
+    t[SUBOP_NOR]   = exec_nor;
+    t[SUBOP_XOR]   = exec_xor;
+    t[SUBOP_SLT]   = exec_slt;
+    t[SUBOP_SLTU]  = exec_sltu;
+    return t;
+}
+
+static constexpr Exec_Table make_brspec_table()
+{
+    Exec_Table t{};
+    for (auto &fn : t)
+        fn = exec_none;
+
+    t[BROP_BLTZ]   = exec_bltz;
+    t[BROP_BLTZAL] = exec_bltz;
+    t[BROP_BGEZ]   = exec_bgez;
+    t[BROP_BGEZAL] = exec_bgez;
+    return t;
+}
+
+static constexpr Exec_Table opcode_table = make_opcode_table();
+static constexpr Exec_Table special_table = make_special_table();
+static constexpr Exec_Table brspec_table = make_brspec_table();
+
+Pipe_Exec_Fn pipe_exec_handler(int opcode, int subop)
+{
+    switch (opcode) {
+        case OP_SPECIAL:
+            return special_table[subop & 0x3F];
+        case OP_BRSPEC:
+            return brspec_table[subop & 0x3F];
+        default:
+            return opcode_table[opcode & 0x3F];
+    }
+}
+
+/* read one source register, bypassing from the youngest older op ahead of us
+ * in the pipe. Ops at index 'fresh' and above in the memory bundle left
+ * execute earlier in this same cycle and cannot forward to us yet. Returns 0
+ * if the producer has not computed its value yet (must stall). */
+static int read_operand(Pipe_State &pipe, int reg, uint32_t *value, size_t fresh)
+{
+    if (reg == -1)
+        return 1;
 
+    if (reg == 0) {
+        *value = 0;
+        return 1;
+    }
+
+    for (size_t i = pipe.mem_ops.size(); i-- > 0; ) {
+        const Pipe_Op *prod = pipe.mem_ops[i].get();
+        if (prod->reg_dst != reg)
+            continue;
+        if (i >= fresh || !prod->reg_dst_value_ready)
+            return 0;
+        *value = prod->reg_dst_value;
+        return 1;
+    }
+
+    for (size_t i = pipe.wb_ops.size(); i-- > 0; ) {
+        const Pipe_Op *prod = pipe.wb_ops[i].get();
+        if (prod->reg_dst == reg) {
+            *value = prod->reg_dst_value;
+            return 1;
+        }
+    }
+
+    *value = pipe.REGS[reg];
+    return 1;
+}
+
+void pipe_stage_execute(Pipe_State &pipe)
+{
+    PROF_SCOPE(&pipe.sim->profile, PROF_EXECUTE);
+    const Sim_Config &config = pipe.sim->config;
+    /* if a multiply/divide is in progress, decrement cycles until value is ready */
+    if (pipe.multiplier_stall > 0)
+        pipe.multiplier_stall--;
+
+    uint32_t alus = config.alu_ports;
+    size_t fresh = pipe.mem_ops.size();
+
+    /* if the memory stage's input stays empty, this is why */
+    pipe.mem_bubble = pipe.execute_ops.empty() ? pipe.execute_bubble : CPI_LOAD_USE;
+
+    /* execute our input bundle in order, as long as the memory stage has
+     * room and ALU ports remain */
+    while (!pipe.execute_ops.empty()) {
+        /* if downstream stall, return (and leave any input we had) */
+        if (pipe.mem_ops.size() >= config.width || alus == 0)
+            return;
+
+        /* grab op and read sources */
+        Pipe_Op *op = pipe.execute_ops.front().get();
+
+        /* read register values, and check for bypass; stall if necessary */
+        int stall = 0;
+        if (!read_operand(pipe, op->reg_src1, &op->reg_src1_value, fresh))
+            stall = 1;
+        if (!read_operand(pipe, op->reg_src2, &op->reg_src2_value, fresh))
+            stall = 1;
+
+        /* if bypassing requires a stall (e.g. use immediately after load, or
+         * a producer in the same bundle), return without clearing stage input */
+        if (stall) 
+            return;
+
+        /* execute the op; the handler returns 0 if it must wait (e.g. on the
+         * multiplier), in which case we leave the stage input in place */
+        if (!op->exec(pipe, op)) {
+            pipe.mem_bubble = CPI_MULDIV;
+            return;
+        }
+        alus--;
+
+        /* handle branch recoveries at this point */
+        int mispredicted = pipe_mispredicted(pipe, op);
+        if (mispredicted)
+            pipe_recover(pipe, 3, op->branch_taken ? op->branch_dest : op->pc + 4);
+
+        /* remove from upstream stage and place in downstream stage */
+        pipe.mem_ops.push_back(std::move(pipe.execute_ops.front()));
+        pipe.execute_ops.erase(pipe.execute_ops.begin());
+
+        /* the rest of the bundle is on the wrong path and will be flushed */
+        if (mispredicted)
+            return;
+    }
+}
+
+void pipe_decode_op(Pipe_Op *op)
+{
     /* set up info fields (source/dest regs, immediate, jump dest) as necessary */
     uint32_t opcode = (op->instruction >> 26) & 0x3F;
     uint32_t rs = (op->instruction >> 21) & 0x1F;
@@ -651,27 +1252,105 @@ void pipe_stage_decode()
             break;
     }
 
-    /* we will handle reg-read together with bypass in the execute stage */
+    /* resolve the execute handler once, here, rather than in execute */
+    op->exec = pipe_exec_handler(op->opcode, op->subop);
+}
+
+void pipe_stage_decode(Pipe_State &pipe)
+{
+    PROF_SCOPE(&pipe.sim->profile, PROF_DECODE);
+    const Sim_Config &config = pipe.sim->config;
+
+    if (pipe.decode_ops.empty())
+        pipe.execute_bubble = pipe.decode_bubble;
+
+    /* decode as many ops as the execute stage has room for (leaving any
+     * others in our input on a downstream stall) */
+    while (!pipe.decode_ops.empty() && pipe.execute_ops.size() < config.width) {
+        Pipe_Op *op = pipe.decode_ops.front().get();
+        pipe_decode_op(op);
+
+        /* we will handle reg-read together with bypass in the execute stage */
 
-    /* place op in downstream slot */
-    pipe.execute_op = std::move(pipe.decode_op);
+        /* a J/JAL the front end did not predict redirects fetch from here */
+        int redirected = pipe.frontend && frontend_decode_redirect(pipe, op);
+
+        /* place op in downstream slot */
+        pipe.execute_ops.push_back(std::move(pipe.decode_ops.front()));
+        pipe.decode_ops.erase(pipe.decode_ops.begin());
+
+        /* the rest of our input is on the wrong path and will be flushed */
+        if (redirected)
+            return;
+    }
 }
 
-void pipe_stage_fetch()
+void pipe_stage_fetch(Pipe_State &pipe)
 {
-    /* if pipeline is stalled (our output slot is not empty), return */
-    if (pipe.decode_op)
+    PROF_SCOPE(&pipe.sim->profile, PROF_FETCH);
+    const Sim_Config &config = pipe.sim->config;
+
+    /* fetch nothing new while draining */
+    if (pipe.draining && !pipe.halted) {
+        pipe.decode_bubble = CPI_FETCH;
         return;
+    }
 
-    /* Allocate an op and send it down the pipeline. */
-    auto op = std::make_unique<Pipe_Op>();
+    if (pipe.frontend && !pipe.halted)
+        frontend_cycle(pipe);
+
+    /* fetch sequential instructions (or, with the FTQ, the blocks it
+     * holds) until our output bundle is full (if it already is, the
+     * pipeline is stalled) */
+    while (pipe.decode_ops.size() < config.width) {
+        /* a core that has just halted only steps its PC past the exit
+         * syscall (counting that as one dead fetch) */
+        if (pipe.halted) {
+            pipe.PC += 4;
+            pipe.stat_inst_fetch++;
+            pipe.sim->stat_inst_fetch++;
+            return;
+        }
 
-    op->instruction = mem_read_32(pipe.PC);
-    op->pc = pipe.PC;
-    pipe.decode_op = std::move(op);
+        /* wait for an outstanding instruction cache miss */
+        if (pipe.fetch_stall > 0) {
+            if (--pipe.fetch_stall > 0) {
+                pipe.decode_bubble = CPI_FETCH;
+                return;
+            }
+        }
+        else if (pipe.frontend && pipe.frontend->ftq.empty()) {
+            pipe.frontend->stats.ftq_empty++;
+            pipe.decode_bubble = CPI_FETCH;
+            return;
+        }
+        else {
+            pipe.fetch_stall = tlb_translate(pipe, pipe.PC, 1);
+            if (pipe.frontend)
+                pipe.fetch_stall += frontend_fetch(pipe, pipe.PC);
+            else
+                pipe.fetch_stall += pipe.icache.access(pipe.PC, 0);
+            if (pipe.fetch_stall > 0) {
+                pipe.decode_bubble = CPI_FETCH;
+                return;
+            }
+        }
+
+        /* Allocate an op and send it down the pipeline. */
+        auto op = std::make_unique<Pipe_Op>();
 
-    /* update PC */
-    pipe.PC += 4;
+        op->instruction = pipe.sim->mem.read_32(pipe.PC);
+        op->pc = pipe.PC;
+        pipe.decode_ops.push_back(std::move(op));
 
-    stat_inst_fetch++;
+        /* update PC */
+        if (pipe.frontend)
+            pipe.PC = frontend_next_pc(pipe, pipe.PC);
+        else
+            pipe.PC += 4;
+        pipe.decode_ops.back()->next_pc = pipe.PC;
+
+        pipe.stat_inst_fetch++;
+        pipe.sim->stat_inst_fetch++;
+    }
 }
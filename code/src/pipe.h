@@ -9,9 +9,42 @@
 #ifndef _PIPE_H_
 #define _PIPE_H_
 
-#include "shell.h"
+#include "config.h"
+#include "cache.h"
 #include <array>
 #include <memory>
+#include <vector>
+
+struct Pipe_Op;
+struct Pipe_State;
+struct Ooo_Core;
+struct Mmu;
+struct Front_End;
+struct Cosim;
+struct Xlat_Cache;
+struct Muldiv_Unit;
+struct Simulator;
+
+/* CPI stack: what every cycle of a core is charged to. A cycle that retires
+ * at least one op is a base cycle; a cycle that retires nothing is charged to
+ * whatever left the writeback stage (or, out of order, the ROB head) empty:
+ * each empty stage input carries the cause of its bubble down the pipe. */
+enum Cpi_Cause {
+    CPI_BASE = 0,   /* retired something */
+    CPI_LOAD_USE,   /* execute waited on an operand still in flight */
+    CPI_MULDIV,     /* an HI/LO access waited on the multiplier/divider */
+    CPI_BRANCH,     /* ops flushed by a branch recovery */
+    CPI_FETCH,      /* instruction cache miss (and the initial pipeline fill) */
+    CPI_MEMORY,     /* data cache miss or store write buffer */
+    CPI_NUM_CAUSES
+};
+
+/* "Base", "LoadUse", ... as printed by the stats command */
+extern const char *const cpi_cause_names[CPI_NUM_CAUSES];
+
+/* execute-stage handler for one instruction (see pipe_exec_handler()).
+ * Returns 0 if the op must stall in execute, 1 if it completed. */
+typedef int (*Pipe_Exec_Fn)(Pipe_State &pipe, Pipe_Op *op);
 
 /* Pipeline ops (instances of this structure) are high-level representations of
  * the instructions that actually flow through the pipeline. This struct does
@@ -57,6 +90,10 @@ struct Pipe_Op {
                              for unconditional, execute for conditional) */
     int is_link;          /* jump-and-link or branch-and-link inst? */
     int link_reg;         /* register to place link into? */
+    uint32_t next_pc;     /* where fetch went after this inst */
+
+    /* execute handler, resolved from opcode/subop during decode */
+    Pipe_Exec_Fn exec;
 
     /* Constructor - initializes all fields to safe defaults */
     Pipe_Op() : pc(0), instruction(0), opcode(0), subop(0),
@@ -65,21 +102,29 @@ struct Pipe_Op {
                 is_mem(0), mem_addr(0), mem_write(0), mem_value(0),
                 reg_dst(-1), reg_dst_value(0), reg_dst_value_ready(0),
                 is_branch(0), branch_dest(0), branch_cond(0), branch_taken(0),
-                is_link(0), link_reg(0) {}
+                is_link(0), link_reg(0), next_pc(0), exec(nullptr) {}
 };
 
-/* The pipe state represents the current state of the pipeline. It holds a
- * pointer to the op that is currently at the input of each stage. As stages
- * execute, they remove the op from their input (set the pointer to NULL) and
- * place an op at their output. If the pointer that represents a stage's output
- * is not null when that stage executes, then this represents a pipeline stall,
- * and the stage must not overwrite its output (otherwise an instruction would
- * be lost).
+/* the ops at the input of one stage, oldest first; holds at most
+ * config.width ops */
+typedef std::vector<std::unique_ptr<Pipe_Op>> Pipe_Bundle;
+
+/* The pipe state represents the current state of the pipeline. It holds the
+ * bundle of ops that is currently at the input of each stage (up to
+ * config.width of them; exactly one in the default scalar pipeline). As stages
+ * execute, they remove ops from the front of their input, in order, and append
+ * them to their output. If a stage's output bundle is full when that stage
+ * executes, then this represents a pipeline stall, and the stage must leave
+ * its remaining input in place (otherwise an instruction would be lost).
  */
 
 struct Pipe_State {
-    /* pipe op currently at the input of the given stage (NULL for none) */
-    std::unique_ptr<Pipe_Op> decode_op, execute_op, mem_op, wb_op;
+    /* the simulation this core belongs to: its configuration, memory and
+     * global statistics */
+    Simulator *sim;
+
+    /* pipe ops currently at the input of the given stage (empty for none) */
+    Pipe_Bundle decode_ops, execute_ops, mem_ops, wb_ops;
 
     /* register file state */
     std::array<uint32_t, 32> REGS;
@@ -98,35 +143,107 @@ struct Pipe_State {
     /* multiplier stall info */
     int multiplier_stall; /* number of remaining cycles until HI/LO are ready */
 
-    /* place other information here as necessary */
+    /* HI/LO functional units (muldiv.h); null for the simple countdown
+     * above */
+    std::unique_ptr<Muldiv_Unit> muldiv;
+
+    /* which core this pipeline is; a core halts once it retires the exit
+     * syscall, and the simulator stops when all cores have halted */
+    int core_id;
+    int halted;
+
+    /* private L1 caches and the unified L2 behind them (null unless
+     * configured), and the remaining cycles of an outstanding miss in the
+     * fetch and memory stages */
+    Cache icache, dcache;
+    std::unique_ptr<Cache> l2;
+    uint32_t fetch_stall, mem_stall;
+
+    /* set while Simulator::fast_forward() drains the pipeline: fetch
+     * stops, so that the ops in flight retire */
+    int draining;
+
+    /* per-core statistics (the Simulator's stat_* counters sum all cores) */
+    uint32_t stat_cycles, stat_inst_retire, stat_inst_fetch, stat_squash;
+    std::vector<uint32_t> stat_retire_width; /* cycles retiring 0..width ops */
+    std::array<uint32_t, CPI_NUM_CAUSES> stat_cpi; /* cycles per Cpi_Cause */
+
+    /* the cause of the bubble in each stage input, while it is empty */
+    int decode_bubble, execute_bubble, mem_bubble, wb_bubble;
+
+    /* out-of-order engine (ooo.h); null for the in-order pipe */
+    std::unique_ptr<Ooo_Core> ooo;
+
+    /* TLBs and page walker (tlb.h); null unless config.tlb */
+    std::unique_ptr<Mmu> mmu;
+
+    /* decoupled front end (frontend.h); null unless config.ftq_size */
+    std::unique_ptr<Front_End> frontend;
+
+    /* co-simulation checker (cosim.h); null until the first cycle, and
+     * unless config.cosim */
+    std::unique_ptr<Cosim> cosim;
+
+    /* translation cache for fast-forwarding (xlat.h), made on first use,
+     * and the instructions fast-forwarded (not in stat_inst_retire) */
+    std::unique_ptr<Xlat_Cache> xlat;
+    uint64_t stat_inst_ff;
 
     /* Constructor - initializes all fields */
-    Pipe_State() : HI(0), LO(0), PC(0x00400000), 
-                   branch_recover(0), branch_dest(0), branch_flush(0),
-                   multiplier_stall(0) {
-        REGS.fill(0);
-    }
+    Pipe_State(Simulator *sim, int id);
+    ~Pipe_State();
+    Pipe_State(Pipe_State &&);
+    Pipe_State &operator=(Pipe_State &&);
 };
 
-/* global variable -- pipeline state */
-extern Pipe_State pipe;
+/* called during simulator startup: create the cores (sim.pipes) */
+void pipe_init(Simulator &sim);
 
-/* called during simulator startup */
-void pipe_init();
-
-/* this function calls the others */
-void pipe_cycle();
+/* this function calls the others, for every core that has not halted */
+void pipe_cycle(Simulator &sim);
 
 /* helper: pipe stages can call this to schedule a branch recovery */
 /* flushes 'flush' stages (1 = execute only, 2 = fetch/decode, ...) and then
  * sets the fetch PC to the given destination. */
-void pipe_recover(int flush, uint32_t dest);
+void pipe_recover(Pipe_State &pipe, int flush, uint32_t dest);
+
+/* did fetch go the wrong way after the executed branch 'op'? Without the
+ * FTQ fetch always falls through, so that is every taken branch. */
+int pipe_mispredicted(const Pipe_State &pipe, const Pipe_Op *op);
+
+/* is the pipeline empty, so that its architectural state (REGS, HI, LO
+ * and PC) is all there is to this core? */
+int pipe_drained(const Pipe_State &pipe);
+
+/* cycle skipping: returns how many of the upcoming cycles are idle, i.e. no
+ * stage can make progress and the only state change is a countdown (0 if the
+ * next cycle must be simulated). pipe_skip_cycles() then advances the pipe
+ * over 'n' such cycles in one step. Both consider all cores. */
+uint32_t pipe_idle_cycles(const Simulator &sim);
+void pipe_skip_cycles(Simulator &sim, uint32_t n);
+
+/* decode one fetched instruction: fill in the op's operand, destination,
+ * branch and memory fields, and its execute handler */
+void pipe_decode_op(Pipe_Op *op);
+
+/* load/store data path. 'word' is the aligned memory word at the op's
+ * address: loads extract their destination value from it, stores merge their
+ * data into it and return the word to write back. */
+void pipe_load_value(Pipe_Op *op, uint32_t word);
+uint32_t pipe_store_value(const Pipe_Op *op, uint32_t word);
+
+/* debug: print one op, and the ops at the input of a stage */
+void print_op(const Pipe_Op *op);
+void print_bundle(const char *stage, const Pipe_Bundle &bundle);
+
+/* look up the execute handler for a decoded opcode/subop pair */
+Pipe_Exec_Fn pipe_exec_handler(int opcode, int subop);
 
 /* each of these functions implements one stage of the pipeline */
-void pipe_stage_fetch();
-void pipe_stage_decode();
-void pipe_stage_execute();
-void pipe_stage_mem();
-void pipe_stage_wb();
+void pipe_stage_fetch(Pipe_State &pipe);
+void pipe_stage_decode(Pipe_State &pipe);
+void pipe_stage_execute(Pipe_State &pipe);
+void pipe_stage_mem(Pipe_State &pipe);
+void pipe_stage_wb(Pipe_State &pipe);
 
 #endif
@@ -0,0 +1,84 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: work-stealing thread pool
+ */
+
+#include "pool.h"
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* one worker's share of the jobs: it takes from the front, thieves from
+ * the back */
+struct Work_Queue {
+    std::mutex lock;
+    std::deque<size_t> jobs;
+};
+
+static bool take_job(Work_Queue &q, bool steal, size_t *job)
+{
+    std::lock_guard<std::mutex> guard(q.lock);
+
+    if (q.jobs.empty())
+        return false;
+
+    if (steal) {
+        *job = q.jobs.back();
+        q.jobs.pop_back();
+    }
+    else {
+        *job = q.jobs.front();
+        q.jobs.pop_front();
+    }
+    return true;
+}
+
+static void worker(std::vector<Work_Queue> &queues, unsigned self,
+                   const std::function<void(size_t)> &fn)
+{
+    size_t job;
+
+    for (;;) {
+        bool found = take_job(queues[self], false, &job);
+
+        /* no jobs are ever added, so once every queue is seen empty there
+         * is nothing left to do */
+        for (unsigned i = 1; i < queues.size() && !found; i++)
+            found = take_job(queues[(self + i) % queues.size()], true, &job);
+        if (!found)
+            return;
+
+        fn(job);
+    }
+}
+
+void pool_run(unsigned nthreads, size_t njobs, const std::function<void(size_t)> &fn)
+{
+    if (nthreads > njobs)
+        nthreads = njobs;
+    if (nthreads <= 1) {
+        for (size_t i = 0; i < njobs; i++)
+            fn(i);
+        return;
+    }
+
+    std::vector<Work_Queue> queues(nthreads);
+    for (unsigned w = 0; w < nthreads; w++) {
+        for (size_t i = njobs * w / nthreads; i < njobs * (w + 1) / nthreads; i++)
+            queues[w].jobs.push_back(i);
+    }
+
+    std::vector<std::thread> threads;
+    for (unsigned w = 0; w < nthreads; w++)
+        threads.emplace_back(worker, std::ref(queues), w, std::cref(fn));
+    for (auto &t : threads)
+        t.join();
+}
+
+unsigned pool_default_threads()
+{
+    unsigned n = std::thread::hardware_concurrency();
+    return n > 0 ? n : 1;
+}
@@ -0,0 +1,24 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: work-stealing thread pool
+ */
+
+#ifndef _POOL_H_
+#define _POOL_H_
+
+#include <cstddef>
+#include <functional>
+
+/* Run fn(0) .. fn(njobs - 1) on 'nthreads' worker threads and return once
+ * all of them have finished. Each worker starts with an equal contiguous
+ * share of the jobs and works through it in order; a worker that runs dry
+ * steals from the far end of another worker's share, so uneven job lengths
+ * (e.g. simulations of very different cycle counts) still keep every thread
+ * busy. Jobs must not depend on each other. */
+void pool_run(unsigned nthreads, size_t njobs, const std::function<void(size_t)> &fn);
+
+/* number of hardware threads (at least 1) */
+unsigned pool_default_threads();
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: host-time profiling of the simulator
+ */
+
+#ifndef _PROF_H_
+#define _PROF_H_
+
+#include <chrono>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Where the host spends its time. In a profiling build (make sim_profile,
+ * which defines SIM_PROFILE), PROF_SCOPE(profile, region) charges the host
+ * ticks spent in the rest of the enclosing block to that region; otherwise
+ * it compiles to nothing. Regions nest and count inclusive time (a memory
+ * read inside the memory stage counts in both). Ticks are TSC cycles on x86
+ * and nanoseconds elsewhere. */
+enum Prof_Region {
+    PROF_RUN = 0,   /* all of Simulator::run()/go() */
+    PROF_FETCH,
+    PROF_DECODE,
+    PROF_EXECUTE,
+    PROF_MEM,
+    PROF_WB,
+    PROF_OOO,       /* the whole out-of-order core cycle (ooo.cpp) */
+    PROF_MEM_READ,  /* Sim_Memory::read_32() */
+    PROF_MEM_WRITE, /* Sim_Memory::write_32() */
+    PROF_NUM_REGIONS
+};
+
+/* "Run", "Fetch", ... as printed by the stats command */
+extern const char *const prof_region_names[PROF_NUM_REGIONS];
+
+struct Host_Profile {
+    uint64_t ticks[PROF_NUM_REGIONS];
+    uint64_t calls[PROF_NUM_REGIONS];
+
+    Host_Profile() : ticks(), calls() {}
+};
+
+static inline uint64_t prof_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+struct Prof_Scope {
+    Host_Profile *profile;
+    int region;
+    uint64_t start;
+
+    Prof_Scope(Host_Profile *profile, int region)
+        : profile(profile), region(region), start(prof_ticks()) {}
+    ~Prof_Scope()
+    {
+        if (!profile)
+            return;
+        profile->ticks[region] += prof_ticks() - start;
+        profile->calls[region]++;
+    }
+};
+
+#ifdef SIM_PROFILE
+#define PROF_SCOPE(profile, region) Prof_Scope prof_scope_(profile, region)
+#else
+#define PROF_SCOPE(profile, region) do { } while (0)
+#endif
+
+#endif
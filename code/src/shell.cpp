@@ -18,88 +18,19 @@
 #include <vector>
 #include <memory>
 
-#include "shell.h"
-#include "pipe.h"
+#include "sim.h"
+#include "ooo.h"
+#include "tlb.h"
+#include "frontend.h"
+#include "cosim.h"
+#include "xlat.h"
+#include "muldiv.h"
 
 /***************************************************************/
-/* Statistics.                                                 */
+/* The simulation driven by this shell.                        */
 /***************************************************************/
 
-uint32_t stat_cycles = 0, stat_inst_retire = 0, stat_inst_fetch = 0;
-uint32_t stat_squash = 0;
-
-/***************************************************************/
-/* Main memory.                                                */
-/***************************************************************/
-
-#define MEM_DATA_START  0x10000000
-#define MEM_DATA_SIZE   0x00100000
-#define MEM_TEXT_START  0x00400000
-#define MEM_TEXT_SIZE   0x00100000
-#define MEM_STACK_START 0x7ff00000
-#define MEM_STACK_SIZE  0x00100000
-#define MEM_KDATA_START 0x90000000
-#define MEM_KDATA_SIZE  0x00100000
-#define MEM_KTEXT_START 0x80000000
-#define MEM_KTEXT_SIZE  0x00100000
-
-struct mem_region_t {
-    uint32_t start, size;
-    std::vector<uint8_t> mem;
-    
-    mem_region_t(uint32_t s, uint32_t sz) : start(s), size(sz), mem(sz, 0) {}
-};
-
-/* memory will be dynamically allocated at initialization */
-std::vector<mem_region_t> MEM_REGIONS;
-
-bool RUN_BIT = true;
-
-/***************************************************************/
-/*                                                             */
-/* Procedure: mem_read_32                                      */
-/*                                                             */
-/* Purpose: Read a 32-bit word from memory                     */
-/*                                                             */
-/***************************************************************/
-uint32_t mem_read_32(uint32_t address)
-{
-    for (auto& region : MEM_REGIONS) {
-        if (address >= region.start && address < (region.start + region.size)) {
-            uint32_t offset = address - region.start;
-
-            return
-                (region.mem[offset+3] << 24) |
-                (region.mem[offset+2] << 16) |
-                (region.mem[offset+1] <<  8) |
-                (region.mem[offset+0] <<  0);
-        }
-    }
-
-    return 0;
-}
-
-/***************************************************************/
-/*                                                             */
-/* Procedure: mem_write_32                                     */
-/*                                                             */
-/* Purpose: Write a 32-bit word to memory                      */
-/*                                                             */
-/***************************************************************/
-void mem_write_32(uint32_t address, uint32_t value)
-{
-    for (auto& region : MEM_REGIONS) {
-        if (address >= region.start && address < (region.start + region.size)) {
-            uint32_t offset = address - region.start;
-
-            region.mem[offset+3] = (value >> 24) & 0xFF;
-            region.mem[offset+2] = (value >> 16) & 0xFF;
-            region.mem[offset+1] = (value >>  8) & 0xFF;
-            region.mem[offset+0] = (value >>  0) & 0xFF;
-            return;
-        }
-    }
-}
+static std::unique_ptr<Simulator> sim;
 
 /***************************************************************/
 /*                                                             */
@@ -112,26 +43,18 @@ void help() {
   printf("----------------MIPS ISIM Help-----------------------\n");
   printf("go                     -  run program to completion         \n");
   printf("run n                  -  execute program for n instructions\n");
+  printf("fastforward n          -  execute n instructions without timing\n");
   printf("rdump                  -  dump architectural registers      \n");
   printf("mdump low high         -  dump memory from low to high      \n");
   printf("input reg_no reg_value - set GPR reg_no to reg_value  \n");
+  printf("stats                  -  dump statistics: per core, cycles,\n");
+  printf("                          CPI stack, retire widths, caches,  \n");
+  printf("                          and the OoO/TLB/FTQ/mul-div units, \n");
+  printf("                          energy and host profile if enabled \n");
   printf("?                      -  display this help menu            \n");
   printf("quit                   -  exit the program                  \n\n");
 }
 
-/***************************************************************/
-/*                                                             */
-/* Procedure : cycle                                           */
-/*                                                             */
-/* Purpose   : Execute a cycle                                 */
-/*                                                             */
-/***************************************************************/
-void cycle() {                                                
-  pipe_cycle();
-
-  stat_cycles++;
-}
-
 /***************************************************************/
 /*                                                             */
 /* Procedure : run n                                           */
@@ -140,19 +63,14 @@ void cycle() {
 /*                                                             */
 /***************************************************************/
 void run(int num_cycles) {                                      
-  if (!RUN_BIT) {
+  if (!sim->run_bit) {
     printf("Can't simulate, Simulator is halted\n\n");
     return;
   }
 
   printf("Simulating for %d cycles...\n\n", num_cycles);
-  for (int i = 0; i < num_cycles; i++) {
-    if (!RUN_BIT) {
-	    printf("Simulator halted\n\n");
-	    break;
-    }
-    cycle();
-  }
+  if (sim->run((uint32_t)num_cycles) < (uint32_t)num_cycles)
+    printf("Simulator halted\n\n");
 }
 
 /***************************************************************/
@@ -163,17 +81,35 @@ void run(int num_cycles) {
 /*                                                             */
 /***************************************************************/
 void go() {                                                     
-  if (!RUN_BIT) {
+  if (!sim->run_bit) {
     printf("Can't simulate, Simulator is halted\n\n");
     return;
   }
 
   printf("Simulating...\n\n");
-  while (RUN_BIT)
-    cycle();
+  sim->go();
   printf("Simulator halted\n\n");
 }
 
+/***************************************************************/
+/*                                                             */
+/* Procedure : fastforward n                                   */
+/*                                                             */
+/* Purpose   : Execute n instructions per core functionally    */
+/*                                                             */
+/***************************************************************/
+void fastforward(uint64_t num_insts) {
+  if (!sim->run_bit) {
+    printf("Can't simulate, Simulator is halted\n\n");
+    return;
+  }
+
+  int64_t n = sim->fast_forward(num_insts);
+  printf("Fast-forwarded %lld instructions\n\n", (long long)n);
+  if (!sim->run_bit)
+    printf("Simulator halted\n\n");
+}
+
 /***************************************************************/ 
 /*                                                             */
 /* Procedure : rdump                                           */
@@ -184,19 +120,307 @@ void go() {
 void rdump() {
     int i;
 
-    printf("PC: 0x%08x\n", pipe.PC);
+    printf("PC: 0x%08x\n", sim->pipes[0].PC);
 
     for (i = 0; i < 32; i++) {
-        printf("R%d: 0x%08x\n", i, pipe.REGS[i]);
+        printf("R%d: 0x%08x\n", i, sim->pipes[0].REGS[i]);
     }
 
-    printf("HI: 0x%08x\n", pipe.HI);
-    printf("LO: 0x%08x\n", pipe.LO);
-    printf("Cycles: %u\n", stat_cycles);
-    printf("FetchedInstr: %u\n", stat_inst_fetch);
-    printf("RetiredInstr: %u\n", stat_inst_retire);
-    printf("IPC: %0.3f\n", ((float) stat_inst_retire) / stat_cycles);
-    printf("Flushes: %u\n", stat_squash);
+    printf("HI: 0x%08x\n", sim->pipes[0].HI);
+    printf("LO: 0x%08x\n", sim->pipes[0].LO);
+    printf("Cycles: %u\n", sim->stat_cycles);
+    printf("FetchedInstr: %u\n", sim->stat_inst_fetch);
+    printf("RetiredInstr: %u\n", sim->stat_inst_retire);
+    printf("IPC: %0.3f\n", ((float) sim->stat_inst_retire) / sim->stat_cycles);
+    printf("Flushes: %u\n", sim->stat_squash);
+
+    /* the other cores' architectural state, indented so that tools which
+     * only understand a single core ignore it */
+    for (size_t c = 1; c < sim->pipes.size(); c++) {
+        printf("Core%zu:\n", c);
+        printf("  PC: 0x%08x\n", sim->pipes[c].PC);
+        for (i = 0; i < 32; i++)
+            printf("  R%d: 0x%08x\n", i, sim->pipes[c].REGS[i]);
+        printf("  HI: 0x%08x\n", sim->pipes[c].HI);
+        printf("  LO: 0x%08x\n", sim->pipes[c].LO);
+    }
+}
+
+/***************************************************************/ 
+/*                                                             */
+/* Procedure : cache_stats                                     */
+/*                                                             */
+/* Purpose   : Dump one cache's hit/miss and coherence stats   */
+/*                                                             */
+/***************************************************************/
+void cache_stats(const char *prefix, const Cache &cache) {
+    const Cache_Stats &s = cache.stats;
+
+    printf("%s.Accesses: %llu\n", prefix, (unsigned long long)s.accesses);
+    printf("%s.Hits: %llu\n", prefix, (unsigned long long)s.hits);
+    printf("%s.Misses: %llu\n", prefix, (unsigned long long)s.misses);
+    printf("%s.Writebacks: %llu\n", prefix, (unsigned long long)s.writebacks);
+    if (cache.mem) {
+        /* bytes filled uncompressed per byte stored, and the average data
+         * held (in uncompressed bytes) against the physical data store */
+        double ratio = s.fill_bytes ? (double)s.misses * cache.block_size / s.fill_bytes : 0;
+        double capacity = s.accesses ? (double)s.resident_blocks / s.accesses * cache.block_size : 0;
+        printf("%s.CompressionRatio: %0.3f\n", prefix, ratio);
+        printf("%s.EffectiveCapacity: %0.0f\n", prefix, capacity);
+        printf("%s.EffectiveCapacityRatio: %0.3f\n", prefix,
+               capacity / ((double)cache.num_sets * cache.assoc * cache.block_size));
+        printf("%s.SpaceEvictions: %llu\n", prefix, (unsigned long long)s.space_evictions);
+    }
+    if (cache.sector_size < cache.block_size || cache.beat_bytes) {
+        /* traffic against whole-block fills of the same blocks (sector
+         * misses would have been hits), and the stall cycles critical-
+         * word-first saved, net of waiting for the rest of a fill */
+        uint64_t whole = (s.misses - s.sector_misses + s.writebacks) * cache.block_size;
+        printf("%s.SectorMisses: %llu\n", prefix, (unsigned long long)s.sector_misses);
+        printf("%s.TransferBytes: %llu\n", prefix, (unsigned long long)s.transfer_bytes);
+        printf("%s.WritebackBytes: %llu\n", prefix, (unsigned long long)s.writeback_bytes);
+        printf("%s.BytesSaved: %llu\n", prefix,
+               (unsigned long long)(whole - s.transfer_bytes - s.writeback_bytes));
+        printf("%s.EarlyRestartCycles: %llu\n", prefix, (unsigned long long)s.restart_cycles);
+        printf("%s.FillWaitCycles: %llu\n", prefix, (unsigned long long)s.fill_wait_cycles);
+        printf("%s.StallCyclesSaved: %lld\n", prefix, (long long)(s.restart_cycles - s.fill_wait_cycles));
+    }
+    if (sim->config.cache_model) {
+        const Cache_Timing &t = cache.timing;
+        printf("%s.AccessTime: %0.3f ns\n", prefix, t.access_ns);
+        printf("%s.HitLatency: %u\n", prefix, t.hit_latency);
+        printf("%s.TagLatency: %u\n", prefix, t.tag_latency);
+        printf("%s.DynamicEnergy: %0.3f nJ\n", prefix, s.energy / 1e6);
+    }
+    if (!cache.bus)
+        return;
+    printf("%s.BusRd: %llu\n", prefix, (unsigned long long)s.bus_rd);
+    printf("%s.BusRdX: %llu\n", prefix, (unsigned long long)s.bus_rdx);
+    printf("%s.BusUpgr: %llu\n", prefix, (unsigned long long)s.bus_upgr);
+    printf("%s.Invalidations: %llu\n", prefix, (unsigned long long)s.invalidations);
+    printf("%s.CoherenceMisses: %llu\n", prefix, (unsigned long long)s.coherence_misses);
+    printf("%s.FalseSharingMisses: %llu\n", prefix, (unsigned long long)s.false_sharing_misses);
+}
+
+/***************************************************************/
+/*                                                             */
+/* Procedure : partition_stats                                 */
+/*                                                             */
+/* Purpose   : Dump a unified cache's way partitioning and     */
+/*             every change of it                              */
+/*                                                             */
+/***************************************************************/
+void partition_stats(const char *prefix, const Umon &umon) {
+    for (int s = 0; s < NUM_STREAMS; s++)
+        printf("%s.%sWays: %u\n", prefix, stream_names[s], umon.ways[s]);
+    printf("%s.Repartitions: %llu\n", prefix, (unsigned long long)umon.repartitions);
+    for (const Umon_Decision &d : umon.log) {
+        printf("%s.Partition: cycle %u:", prefix, d.cycle);
+        for (int s = 0; s < NUM_STREAMS; s++)
+            printf(" %u %s", d.ways[s], stream_names[s]);
+        printf("\n");
+    }
+}
+
+/***************************************************************/ 
+/*                                                             */
+/* Procedure : tlb_stats                                       */
+/*                                                             */
+/* Purpose   : Dump one TLB's hit/miss stats                   */
+/*                                                             */
+/***************************************************************/
+void tlb_stats(const char *prefix, const Tlb &tlb) {
+    printf("%s.Accesses: %llu\n", prefix, (unsigned long long)tlb.stats.accesses);
+    printf("%s.Hits: %llu\n", prefix, (unsigned long long)tlb.stats.hits);
+    printf("%s.Misses: %llu\n", prefix, (unsigned long long)tlb.stats.misses);
+}
+
+/***************************************************************/
+/*                                                             */
+/* Procedure : muldiv_stats                                    */
+/*                                                             */
+/* Purpose   : Dump the utilization of a core's multiplier     */
+/*             and divider over 'cycles' cycles                */
+/*                                                             */
+/***************************************************************/
+void muldiv_stats(const char *prefix, const Muldiv_Unit &u, uint32_t cycles) {
+    const Muldiv_Stats &s = u.stats;
+
+    /* the multiplier accepts one op per cycle and holds each for its
+     * latency; the divider holds one at a time */
+    printf("%s.Mul.Ops: %llu\n", prefix, (unsigned long long)s.mul_ops);
+    printf("%s.Mul.Utilization: %0.3f\n", prefix, cycles ? (double)s.mul_ops / cycles : 0.0);
+    printf("%s.Mul.AvgInFlight: %0.3f\n", prefix,
+           cycles ? (double)s.mul_ops * u.mul_latency / cycles : 0.0);
+    printf("%s.Div.Ops: %llu\n", prefix, (unsigned long long)s.div_ops);
+    printf("%s.Div.BusyCycles: %llu\n", prefix, (unsigned long long)s.div_busy);
+    printf("%s.Div.Utilization: %0.3f\n", prefix, cycles ? (double)s.div_busy / cycles : 0.0);
+    printf("%s.Div.AvgLatency: %0.3f\n", prefix, s.div_ops ? (double)s.div_busy / s.div_ops : 0.0);
+    printf("%s.Div.EarlyOutCycles: %llu\n", prefix, (unsigned long long)s.div_saved);
+}
+
+/***************************************************************/
+/*                                                             */
+/* Procedure : cache_energy                                    */
+/*                                                             */
+/* Purpose   : Energy (fJ) of one cache over 'cycles' cycles:  */
+/*             its accesses, its leakage and (at the last      */
+/*             level) the main memory traffic of its misses    */
+/*             and writebacks                                  */
+/*                                                             */
+/***************************************************************/
+double cache_energy(const Cache &cache, uint32_t cycles) {
+    const Cache_Timing &t = cache.timing;
+    double leakage = t.leakage_mw * cycles / sim->config.clock_mhz * 1e6;
+    double memory = cache.next ? 0 : (double)(cache.stats.misses + cache.stats.writebacks) * t.mem_energy;
+
+    return cache.stats.energy + leakage + memory;
+}
+
+/***************************************************************/
+/*                                                             */
+/* Procedure : energy_stats                                    */
+/*                                                             */
+/* Purpose   : Dump the cache model's energy totals, and the   */
+/*             performance per watt they amount to             */
+/*                                                             */
+/***************************************************************/
+void energy_stats() {
+    double total = 0;
+
+    for (const auto &p : sim->pipes) {
+        double core = cache_energy(p.icache, p.stat_cycles) + cache_energy(p.dcache, p.stat_cycles);
+        if (p.l2)
+            core += cache_energy(*p.l2, p.stat_cycles);
+        printf("Core%d.Energy: %0.3f nJ\n", p.core_id, core / 1e6);
+        total += core;
+    }
+
+    /* instructions per microjoule is millions of instructions per second
+     * per watt */
+    printf("Energy.Total: %0.3f nJ\n", total / 1e6);
+    printf("Energy.PerInstr: %0.3f pJ\n", sim->stat_inst_retire ? total / 1e3 / sim->stat_inst_retire : 0.0);
+    printf("Energy.MIPSPerWatt: %0.3f\n", total > 0 ? sim->stat_inst_retire / (total / 1e9) : 0.0);
+}
+
+/***************************************************************/ 
+/*                                                             */
+/* Procedure : host_stats                                      */
+/*                                                             */
+/* Purpose   : Dump host time, simulation speed and (in a      */
+/*             profiling build) host time per region           */
+/*                                                             */
+/***************************************************************/
+void host_stats() {
+    double seconds = sim->host_seconds;
+
+    printf("Host.Seconds: %0.3f\n", seconds);
+    printf("Host.CyclesPerSecond: %0.0f\n", seconds > 0 ? sim->stat_cycles / seconds : 0.0);
+    printf("Host.KIPS: %0.1f\n", seconds > 0 ? sim->stat_inst_retire / seconds / 1e3 : 0.0);
+    printf("Host.MIPS: %0.3f\n", seconds > 0 ? sim->stat_inst_retire / seconds / 1e6 : 0.0);
+
+#ifdef SIM_PROFILE
+    const Host_Profile &prof = sim->profile;
+    for (int r = 0; r < PROF_NUM_REGIONS; r++) {
+        printf("Host.Profile.%s: %llu ticks, %llu calls, %0.1f%%\n", prof_region_names[r],
+               (unsigned long long)prof.ticks[r], (unsigned long long)prof.calls[r],
+               prof.ticks[PROF_RUN] ? 100.0 * prof.ticks[r] / prof.ticks[PROF_RUN] : 0.0);
+    }
+#endif
+}
+
+/***************************************************************/ 
+/*                                                             */
+/* Procedure : sdump                                           */
+/*                                                             */
+/* Purpose   : Dump per-core pipeline and cache statistics     */
+/*                                                             */
+/***************************************************************/
+void sdump() {
+    char prefix[32];
+
+    for (const auto &p : sim->pipes) {
+        printf("Core%d.Cycles: %u\n", p.core_id, p.stat_cycles);
+        printf("Core%d.FetchedInstr: %u\n", p.core_id, p.stat_inst_fetch);
+        printf("Core%d.RetiredInstr: %u\n", p.core_id, p.stat_inst_retire);
+        printf("Core%d.IPC: %0.3f\n", p.core_id, ((float) p.stat_inst_retire) / p.stat_cycles);
+        printf("Core%d.Flushes: %u\n", p.core_id, p.stat_squash);
+        for (size_t w = 0; w < p.stat_retire_width.size(); w++)
+            printf("Core%d.RetireWidth%zu: %u\n", p.core_id, w, p.stat_retire_width[w]);
+
+        /* the CPI stack: cycles charged to each cause, and their share of
+         * the CPI */
+        for (int c = 0; c < CPI_NUM_CAUSES; c++)
+            printf("Core%d.Cycles.%s: %u\n", p.core_id, cpi_cause_names[c], p.stat_cpi[c]);
+        for (int c = 0; c < CPI_NUM_CAUSES; c++)
+            printf("Core%d.CPI.%s: %0.3f\n", p.core_id, cpi_cause_names[c],
+                   p.stat_inst_retire ? ((float) p.stat_cpi[c]) / p.stat_inst_retire : 0.0f);
+
+        if (p.ooo) {
+            const Ooo_Stats &os = p.ooo->stats;
+            printf("Core%d.RobOccupancy: %0.3f\n", p.core_id, ((double) os.rob_occupancy) / p.stat_cycles);
+            printf("Core%d.RobFullCycles: %llu\n", p.core_id, (unsigned long long) os.rob_full);
+            printf("Core%d.IqFullCycles: %llu\n", p.core_id, (unsigned long long) os.iq_full);
+            printf("Core%d.LsqFullCycles: %llu\n", p.core_id, (unsigned long long) os.lsq_full);
+            printf("Core%d.RegsFullCycles: %llu\n", p.core_id, (unsigned long long) os.regs_full);
+            printf("Core%d.LoadsForwarded: %llu\n", p.core_id, (unsigned long long) os.loads_forwarded);
+            printf("Core%d.LoadsBlocked: %llu\n", p.core_id, (unsigned long long) os.loads_blocked);
+        }
+
+        snprintf(prefix, sizeof(prefix), "Core%d", p.core_id);
+        if (p.muldiv)
+            muldiv_stats(prefix, *p.muldiv, p.stat_cycles);
+
+        snprintf(prefix, sizeof(prefix), "Core%d.L1I", p.core_id);
+        cache_stats(prefix, p.icache);
+        snprintf(prefix, sizeof(prefix), "Core%d.L1D", p.core_id);
+        cache_stats(prefix, p.dcache);
+        if (p.l2) {
+            snprintf(prefix, sizeof(prefix), "Core%d.L2", p.core_id);
+            cache_stats(prefix, *p.l2);
+            if (p.l2->umon)
+                partition_stats(prefix, *p.l2->umon);
+        }
+
+        if (p.mmu) {
+            snprintf(prefix, sizeof(prefix), "Core%d.ITLB", p.core_id);
+            tlb_stats(prefix, p.mmu->itlb);
+            snprintf(prefix, sizeof(prefix), "Core%d.DTLB", p.core_id);
+            tlb_stats(prefix, p.mmu->dtlb);
+            snprintf(prefix, sizeof(prefix), "Core%d.L2TLB", p.core_id);
+            tlb_stats(prefix, p.mmu->l2tlb);
+            printf("Core%d.PageWalks: %llu\n", p.core_id, (unsigned long long)p.mmu->walks);
+            printf("Core%d.PageWalkCycles: %llu\n", p.core_id, (unsigned long long)p.mmu->walk_cycles);
+        }
+
+        if (p.xlat) {
+            printf("Core%d.FastForwardedInstr: %llu\n", p.core_id, (unsigned long long)p.stat_inst_ff);
+            printf("Core%d.Xlat.Blocks: %llu\n", p.core_id, (unsigned long long)p.xlat->stats.blocks);
+            printf("Core%d.Xlat.Ops: %llu\n", p.core_id, (unsigned long long)p.xlat->stats.ops);
+            printf("Core%d.Xlat.Flushes: %llu\n", p.core_id, (unsigned long long)p.xlat->stats.flushes);
+        }
+
+        if (p.cosim)
+            printf("Core%d.CosimChecked: %llu\n", p.core_id, (unsigned long long)p.cosim->checked);
+
+        if (p.frontend) {
+            const Frontend_Stats &fs = p.frontend->stats;
+            printf("Core%d.FTQ.Blocks: %llu\n", p.core_id, (unsigned long long)fs.blocks);
+            printf("Core%d.FTQ.BtbHits: %llu\n", p.core_id, (unsigned long long)fs.btb_hits);
+            printf("Core%d.FTQ.Prefetches: %llu\n", p.core_id, (unsigned long long)fs.prefetches);
+            printf("Core%d.FTQ.LatePrefetches: %llu\n", p.core_id, (unsigned long long)fs.late_prefetches);
+            printf("Core%d.FTQ.DecodeRedirects: %llu\n", p.core_id, (unsigned long long)fs.decode_redirects);
+            printf("Core%d.FTQ.EmptyCycles: %llu\n", p.core_id, (unsigned long long)fs.ftq_empty);
+        }
+    }
+
+    printf("Mem.PagesTouched: %u\n", sim->mem.pages_touched);
+
+    if (sim->config.cache_model)
+        energy_stats();
+
+    if (sim->config.host_stats)
+        host_stats();
 }
 
 /***************************************************************/ 
@@ -213,7 +437,7 @@ void mdump(int start, int stop) {
   printf("\nMemory content [0x%08x..0x%08x] :\n", start, stop);
   printf("-------------------------------------\n");
   for (address = start; address <= stop; address += 4)
-    printf("  0x%08x (%d) : 0x%08x\n", address, address, mem_read_32(address));
+    printf("  0x%08x (%d) : 0x%08x\n", address, address, sim->mem.read_32(address));
   printf("\n");
 }
 
@@ -250,6 +474,16 @@ void get_command() {
     mdump(start, stop);
     break;
 
+  case 'F':
+  case 'f': {
+    unsigned long long insts;
+    if (scanf("%llu", &insts) != 1)
+        break;
+
+    fastforward(insts);
+    break;
+  }
+
   case '?':
     help();
     break;
@@ -268,13 +502,24 @@ void get_command() {
     }
     break;
 
+  case 'S':
+  case 's':
+    sdump();
+    break;
+
   case 'I':
   case 'i':
    if (scanf("%i %i", &register_no, &register_value) != 2)
       break;
    
    printf("%i %i\n", register_no, register_value);
-   pipe.REGS[register_no] = register_value;
+   /* program inputs are given to every core (and to the checker's
+    * model, if it is already running) */
+   for (auto &p : sim->pipes) {
+     p.REGS[register_no] = register_value;
+     if (p.cosim)
+       p.cosim->REGS[register_no] = register_value;
+   }
    break;
    
   case 'H':
@@ -282,7 +527,11 @@ void get_command() {
    if (scanf("%i", &register_value) != 1)
       break;
 
-   pipe.HI = register_value; 
+   for (auto &p : sim->pipes) {
+     p.HI = register_value;
+     if (p.cosim)
+       p.cosim->HI = register_value;
+   }
    break;
   
   case 'L':
@@ -290,7 +539,11 @@ void get_command() {
    if (scanf("%i", &register_value) != 1)
       break;
 
-   pipe.LO = register_value; 
+   for (auto &p : sim->pipes) {
+     p.LO = register_value;
+     if (p.cosim)
+       p.cosim->LO = register_value;
+   }
    break;
 
   default:
@@ -299,51 +552,6 @@ void get_command() {
   }
 }
 
-/***************************************************************/
-/*                                                             */
-/* Procedure : init_memory                                     */
-/*                                                             */
-/* Purpose   : Allocate and zero memoryy                       */
-/*                                                             */
-/***************************************************************/
-void init_memory() {                                           
-    MEM_REGIONS.clear();
-    MEM_REGIONS.emplace_back(MEM_TEXT_START, MEM_TEXT_SIZE);
-    MEM_REGIONS.emplace_back(MEM_DATA_START, MEM_DATA_SIZE);
-    MEM_REGIONS.emplace_back(MEM_STACK_START, MEM_STACK_SIZE);
-    MEM_REGIONS.emplace_back(MEM_KDATA_START, MEM_KDATA_SIZE);
-    MEM_REGIONS.emplace_back(MEM_KTEXT_START, MEM_KTEXT_SIZE);
-}
-
-/**************************************************************/
-/*                                                            */
-/* Procedure : load_program                                   */
-/*                                                            */
-/* Purpose   : Load program and service routines into mem.    */
-/*                                                            */
-/**************************************************************/
-void load_program(char *program_filename) {                   
-  FILE * prog;
-  int ii, word;
-
-  /* Open program file. */
-  prog = fopen(program_filename, "r");
-  if (prog == NULL) {
-    printf("Error: Can't open program file %s\n", program_filename);
-    exit(-1);
-  }
-
-  /* Read in the program. */
-
-  ii = 0;
-  while (fscanf(prog, "%x\n", &word) != EOF) {
-    mem_write_32(MEM_TEXT_START + ii, word);
-    ii += 4;
-  }
-
-  printf("Read %d words from program into memory.\n\n", ii/4);
-}
-
 /************************************************************/
 /*                                                          */
 /* Procedure : initialize                                   */
@@ -352,15 +560,15 @@ void load_program(char *program_filename) {
 /*             and set up initial state of the machine.     */
 /*                                                          */
 /************************************************************/
-void initialize(char *program_filename, int num_prog_files) { 
-  init_memory();
-  pipe_init();
+void initialize(const Sim_Config &config, char *program_filename, int num_prog_files) { 
+  sim.reset(new Simulator(config));
   for (int i = 0; i < num_prog_files; i++) {
-    load_program(program_filename);
+    int64_t words = sim->load_program(program_filename);
+    if (words < 0)
+      exit(-1);
+    printf("Read %d words from program into memory.\n\n", (int)words);
     while(*program_filename++ != '\0');
   }
-    
-  RUN_BIT = true;
 }
 
 /***************************************************************/
@@ -371,15 +579,18 @@ void initialize(char *program_filename, int num_prog_files) {
 int main(int argc, char *argv[]) {                              
 
   /* Error Checking */
-  if (argc < 2) {
-    printf("Error: usage: %s <program_file_1> <program_file_2> ...\n",
+  Sim_Config config;
+  int first = config_parse(config, argc, argv);
+  if (first < 0 || first >= argc) {
+    printf("Error: usage: %s [--option=value ...] <program_file_1> <program_file_2> ...\n",
            argv[0]);
+    config_usage();
     exit(1);
   }
 
   printf("MIPS Simulator\n\n");
 
-  initialize(argv[1], argc - 1);
+  initialize(config, argv[first], argc - first);
 
   while (1)
     get_command();
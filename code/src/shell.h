@@ -1,28 +0,0 @@
-/***************************************************************/
-/*                                                             */
-/*   MIPS-32 Instruction Level Simulator                       */
-/*                                                             */
-/*   Computer Architecture - Professor Onur Mutlu              */
-/*                                                             */
-/***************************************************************/
-
-/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! */
-/*          DO NOT MODIFY THIS FILE!                            */
-/*          You should only change sim.c!                       */
-/* !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! */
-
-#ifndef _SIM_SHELL_H_
-#define _SIM_SHELL_H_
-
-#include <cstdint>
-
-extern bool RUN_BIT;	/* run bit */
-
-/* only the cache touches these functions */
-uint32_t mem_read_32(uint32_t address);
-void     mem_write_32(uint32_t address, uint32_t value);
-
-/* statistics */
-extern uint32_t stat_cycles, stat_inst_retire, stat_inst_fetch, stat_squash;
-
-#endif
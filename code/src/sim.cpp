@@ -0,0 +1,458 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: simulator instance
+ */
+
+#include "sim.h"
+#include "xlat.h"
+#include "frontend.h"
+#include "ooo.h"
+#include "cosim.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MEM_TEXT_START  0x00400000
+
+/* instructions a core fast-forwards before the next core's turn */
+#define FF_QUANTUM      65536
+
+const char *const prof_region_names[PROF_NUM_REGIONS] = {
+    "Run", "Fetch", "Decode", "Execute", "Mem", "Writeback", "OutOfOrder",
+    "MemRead", "MemWrite"
+};
+
+/* the page holding 'address', or nullptr if it was never written */
+const uint8_t *Sim_Memory::page(uint32_t address) const
+{
+    const Table *table = dir[address >> (MEM_PAGE_BITS + MEM_TABLE_BITS)].get();
+    if (!table)
+        return nullptr;
+
+    return table->pages[(address >> MEM_PAGE_BITS) & (MEM_TABLE_SIZE - 1)].get();
+}
+
+/* the page holding 'address', allocated on first touch */
+uint8_t *Sim_Memory::page_alloc(uint32_t address)
+{
+    std::unique_ptr<Table> &table = dir[address >> (MEM_PAGE_BITS + MEM_TABLE_BITS)];
+    if (!table)
+        table.reset(new Table());
+
+    std::shared_ptr<uint8_t[]> &p = table->pages[(address >> MEM_PAGE_BITS) & (MEM_TABLE_SIZE - 1)];
+    if (!p) {
+        p.reset(new uint8_t[MEM_PAGE_SIZE]());
+        pages_touched++;
+    }
+    else if (p.use_count() > 1) {
+        /* still shared with the memory we were copied from (or a copy of
+         * ours): take a private copy before writing */
+        std::shared_ptr<uint8_t[]> copy(new uint8_t[MEM_PAGE_SIZE]);
+        memcpy(copy.get(), p.get(), MEM_PAGE_SIZE);
+        p = copy;
+    }
+    return p.get();
+}
+
+Sim_Memory::Sim_Memory(const Sim_Memory &other)
+    : pages_touched(0), profile(nullptr)
+{
+    *this = other;
+}
+
+Sim_Memory &Sim_Memory::operator=(const Sim_Memory &other)
+{
+    if (this == &other)
+        return *this;
+
+    /* copy the tables; the pages themselves are shared */
+    for (uint32_t i = 0; i < MEM_DIR_SIZE; i++) {
+        if (other.dir[i])
+            dir[i].reset(new Table(*other.dir[i]));
+        else
+            dir[i].reset();
+    }
+    pages_touched = other.pages_touched;
+    return *this;
+}
+
+uint32_t Sim_Memory::read_32(uint32_t address) const
+{
+    PROF_SCOPE(profile, PROF_MEM_READ);
+    uint32_t offset = address & (MEM_PAGE_SIZE - 1);
+
+    /* a word straddling two pages is read a byte at a time */
+    if (offset > MEM_PAGE_SIZE - 4) {
+        uint32_t value = 0;
+        for (int i = 3; i >= 0; i--) {
+            const uint8_t *p = page(address + i);
+            value = (value << 8) | (p ? p[(address + i) & (MEM_PAGE_SIZE - 1)] : 0);
+        }
+        return value;
+    }
+
+    const uint8_t *mem = page(address);
+    if (!mem)
+        return 0;
+
+    return
+        (mem[offset+3] << 24) |
+        (mem[offset+2] << 16) |
+        (mem[offset+1] <<  8) |
+        (mem[offset+0] <<  0);
+}
+
+void Sim_Memory::write_32(uint32_t address, uint32_t value)
+{
+    PROF_SCOPE(profile, PROF_MEM_WRITE);
+    uint32_t offset = address & (MEM_PAGE_SIZE - 1);
+
+    if (offset > MEM_PAGE_SIZE - 4) {
+        for (int i = 0; i < 4; i++)
+            page_alloc(address + i)[(address + i) & (MEM_PAGE_SIZE - 1)] = (value >> (8 * i)) & 0xFF;
+        return;
+    }
+
+    uint8_t *mem = page_alloc(address);
+    mem[offset+3] = (value >> 24) & 0xFF;
+    mem[offset+2] = (value >> 16) & 0xFF;
+    mem[offset+1] = (value >>  8) & 0xFF;
+    mem[offset+0] = (value >>  0) & 0xFF;
+}
+
+void Sim_Memory::write_block(uint32_t address, const uint8_t *data, uint32_t len)
+{
+    while (len > 0) {
+        uint32_t offset = address & (MEM_PAGE_SIZE - 1);
+        uint32_t n = std::min(len, MEM_PAGE_SIZE - offset);
+        uint8_t *mem = page_alloc(address);
+
+        if (data) {
+            memcpy(mem + offset, data, n);
+            data += n;
+        }
+        else
+            memset(mem + offset, 0, n);
+
+        address += n;
+        len -= n;
+    }
+}
+
+void Sim_Memory::clear()
+{
+    for (auto &table : dir)
+        table.reset();
+    pages_touched = 0;
+}
+
+Simulator::Simulator(const Sim_Config &config)
+    : config(config), run_bit(true),
+      stat_cycles(0), stat_inst_retire(0), stat_inst_fetch(0), stat_squash(0),
+      host_seconds(0)
+{
+    mem.profile = &profile;
+    pipe_init(*this);
+    stats_register(*this);
+    if (config.sample_interval > 0)
+        sampler = stats_sampler_open(*this);
+}
+
+Simulator::~Simulator()
+{
+    if (sampler)
+        stats_sample_finish(*this);
+}
+
+/* little-endian fields of a mapped image */
+static uint16_t image_u16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t image_u32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Copy the PT_LOAD segments of a 32-bit little-endian MIPS ELF image into
+ * memory, zero-fill their .bss tails and start the cores at the entry
+ * point. Returns the number of words read, or -1 on a malformed image. */
+static int64_t load_elf(Simulator &sim, const char *program_filename,
+                        const uint8_t *image, size_t size)
+{
+    uint32_t bytes = 0;
+
+    /* e_ident: ELFCLASS32, ELFDATA2LSB; e_machine: EM_MIPS */
+    if (size < 52 || image[4] != 1 || image[5] != 1 || image_u16(image + 18) != 8) {
+        printf("Error: %s is not a 32-bit little-endian MIPS ELF file\n", program_filename);
+        return -1;
+    }
+
+    uint32_t entry = image_u32(image + 24);
+    uint32_t phoff = image_u32(image + 28);
+    uint32_t phentsize = image_u16(image + 42);
+    uint32_t phnum = image_u16(image + 44);
+
+    /* a program header is at least the 32 bytes read below */
+    if (phnum > 0 && phentsize < 32) {
+        printf("Error: bad ELF program header size in %s\n", program_filename);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < phnum; i++) {
+        const uint8_t *ph = image + phoff + (size_t)i * phentsize;
+        if (phoff + (size_t)(i + 1) * phentsize > size) {
+            printf("Error: truncated ELF program headers in %s\n", program_filename);
+            return -1;
+        }
+
+        /* p_type PT_LOAD */
+        if (image_u32(ph) != 1)
+            continue;
+
+        uint32_t offset = image_u32(ph + 4);
+        uint32_t vaddr = image_u32(ph + 8);
+        uint32_t filesz = image_u32(ph + 16);
+        uint32_t memsz = image_u32(ph + 20);
+        if ((size_t)offset + filesz > size) {
+            printf("Error: truncated ELF segment in %s\n", program_filename);
+            return -1;
+        }
+
+        sim.mem.write_block(vaddr, image + offset, filesz);
+        if (memsz > filesz)
+            sim.mem.write_block(vaddr + filesz, nullptr, memsz - filesz);
+        bytes += filesz;
+    }
+
+    for (auto &p : sim.pipes)
+        p.PC = entry;
+
+    return (bytes + 3) / 4;
+}
+
+/* Load an ELF file, or a raw little-endian text image (*.bin), by mapping
+ * it and copying it into memory in bulk. Returns the number of words read,
+ * -1 on error, or -2 for any other (*.x hex text) file. */
+static int64_t load_image(Simulator &sim, const char *program_filename)
+{
+    size_t len = strlen(program_filename);
+    bool is_bin = len > 4 && strcmp(program_filename + len - 4, ".bin") == 0;
+    struct stat st;
+    uint8_t magic[4] = {0, 0, 0, 0};
+
+    int fd = open(program_filename, O_RDONLY);
+    if (fd < 0)
+        return -2;
+    if (fstat(fd, &st) < 0 || (!is_bin && (read(fd, magic, 4) != 4 || memcmp(magic, "\177ELF", 4) != 0))) {
+        close(fd);
+        return -2;
+    }
+
+    size_t size = st.st_size;
+    const uint8_t *image = nullptr;
+    if (size > 0) {
+        void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            printf("Error: Can't map program file %s\n", program_filename);
+            close(fd);
+            return -1;
+        }
+        image = (const uint8_t *)map;
+    }
+    close(fd);
+
+    int64_t words;
+    if (is_bin) {
+        sim.mem.write_block(MEM_TEXT_START, image, size);
+        words = (size + 3) / 4;
+    }
+    else
+        words = load_elf(sim, program_filename, image, size);
+
+    if (image)
+        munmap((void *)image, size);
+
+    return words;
+}
+
+int64_t Simulator::load_program(const char *program_filename)
+{
+    /* ELF and raw binary images are copied in bulk */
+    int64_t words = load_image(*this, program_filename);
+
+    if (words == -2) {
+        /* Open program file. */
+        FILE *prog = fopen(program_filename, "r");
+        if (prog == NULL) {
+            printf("Error: Can't open program file %s\n", program_filename);
+            return -1;
+        }
+
+        /* Read in the program. */
+        uint32_t ii = 0, word;
+        while (fscanf(prog, "%x\n", &word) != EOF) {
+            mem.write_32(MEM_TEXT_START + ii, word);
+            ii += 4;
+        }
+        fclose(prog);
+        words = ii / 4;
+    }
+
+    return words;
+}
+
+void Simulator::share_program(const Simulator &other)
+{
+    mem = other.mem;
+    for (auto &p : pipes)
+        p.PC = other.pipes[0].PC;
+}
+
+void Simulator::cycle()
+{
+    pipe_cycle(*this);
+
+    stat_cycles++;
+
+    if (sampler) {
+        stats_sample(*this);
+        if (!run_bit)
+            stats_sample_finish(*this);
+    }
+}
+
+uint32_t Simulator::skip_idle_cycles(uint32_t max_cycles)
+{
+    uint32_t idle = pipe_idle_cycles(*this);
+
+    if (idle > max_cycles)
+        idle = max_cycles;
+    if (sampler && idle > 0)
+        idle = std::min(idle, stats_sampler_skippable(*this));
+
+    if (idle > 0) {
+        pipe_skip_cycles(*this, idle);
+        stat_cycles += idle;
+    }
+
+    return idle;
+}
+
+/* seconds since 'start' */
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t Simulator::run(uint32_t num_cycles)
+{
+    PROF_SCOPE(&profile, PROF_RUN);
+    auto start = std::chrono::steady_clock::now();
+    uint32_t i = 0;
+
+    while (i < num_cycles && run_bit) {
+        i += skip_idle_cycles(num_cycles - i);
+        if (i < num_cycles) {
+            cycle();
+            i++;
+        }
+    }
+
+    host_seconds += seconds_since(start);
+    return i;
+}
+
+void Simulator::go()
+{
+    PROF_SCOPE(&profile, PROF_RUN);
+    auto start = std::chrono::steady_clock::now();
+
+    while (run_bit) {
+        skip_idle_cycles(UINT32_MAX);
+        cycle();
+    }
+
+    host_seconds += seconds_since(start);
+}
+
+/* finish the ops in flight, without fetching more, so that the cores'
+ * architectural state is all there is to them */
+static void drain(Simulator &sim)
+{
+    for (auto &p : sim.pipes)
+        p.draining = 1;
+
+    for (;;) {
+        int drained = 1;
+        for (const auto &p : sim.pipes)
+            drained &= p.halted || pipe_drained(p);
+        if (drained || !sim.run_bit)
+            break;
+        sim.cycle();
+    }
+
+    for (auto &p : sim.pipes)
+        p.draining = 0;
+}
+
+int64_t Simulator::fast_forward(uint64_t num_insts)
+{
+    drain(*this);
+
+    /* timing simulation since the last fast-forward may have written
+     * translated code */
+    for (auto &p : pipes) {
+        if (!p.xlat)
+            p.xlat.reset(new Xlat_Cache());
+        else if (p.xlat->cycles != p.stat_cycles)
+            xlat_flush(*p.xlat);
+    }
+
+    /* the cores take turns, so that they interleave on shared memory */
+    std::vector<uint64_t> left(pipes.size(), num_insts);
+    Xlat_Pages pages;
+    uint64_t total = 0;
+    bool more = true;
+    while (more) {
+        more = false;
+        for (size_t i = 0; i < pipes.size(); i++) {
+            Pipe_State &p = pipes[i];
+            if (p.halted || left[i] == 0)
+                continue;
+
+            uint64_t n = xlat_run(p, std::min<uint64_t>(left[i], FF_QUANTUM), pages);
+            left[i] -= n;
+            p.stat_inst_ff += n;
+            total += n;
+            more |= !p.halted && left[i] > 0;
+        }
+    }
+
+    /* fetch restarts at the new PC, and the co-simulation model from the
+     * new state */
+    run_bit = false;
+    for (auto &p : pipes) {
+        p.xlat->cycles = p.stat_cycles;
+        p.fetch_stall = 0;
+        if (p.frontend)
+            p.frontend->ftq.clear();
+        if (p.ooo && !p.halted)
+            ooo_reset_rename(*p.ooo);
+        if (p.cosim) {
+            uint64_t checked = p.cosim->checked;
+            p.cosim.reset(new Cosim(p));
+            p.cosim->checked = checked;
+        }
+        run_bit |= !p.halted;
+    }
+
+    return total;
+}
@@ -0,0 +1,141 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: simulator instance
+ */
+
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include "config.h"
+#include "cache.h"
+#include "pipe.h"
+#include "stats.h"
+#include "prof.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Simulated memory: a sparse, demand-paged 4 GB address space. A two-level
+ * table maps the 2^20 4 KB pages, and a page is allocated (zeroed) on its
+ * first write. Reads of a page that was never written return 0 without
+ * allocating it. Copies of a Sim_Memory share their pages copy-on-write, so
+ * a loaded program image can seed many simulations (see sweep.cpp). */
+#define MEM_PAGE_BITS   12
+#define MEM_PAGE_SIZE   (1u << MEM_PAGE_BITS)
+#define MEM_TABLE_BITS  10
+#define MEM_TABLE_SIZE  (1u << MEM_TABLE_BITS)
+#define MEM_DIR_SIZE    (1u << (32 - MEM_PAGE_BITS - MEM_TABLE_BITS))
+
+struct Sim_Memory {
+    struct Table {
+        std::shared_ptr<uint8_t[]> pages[MEM_TABLE_SIZE];
+    };
+
+    /* top level of the page table, and the number of pages allocated (or
+     * inherited from the memory this one was copied from) */
+    std::unique_ptr<Table> dir[MEM_DIR_SIZE];
+    uint32_t pages_touched;
+
+    /* the owning simulator's host profile (prof.h); not copied */
+    Host_Profile *profile;
+
+    Sim_Memory() : pages_touched(0), profile(nullptr) {}
+    Sim_Memory(const Sim_Memory &other);
+    Sim_Memory &operator=(const Sim_Memory &other);
+
+    uint32_t read_32(uint32_t address) const;
+    void write_32(uint32_t address, uint32_t value);
+
+    /* copy a byte image into memory (data == nullptr zero-fills) */
+    void write_block(uint32_t address, const uint8_t *data, uint32_t len);
+
+    /* release every page */
+    void clear();
+
+    /* the host copy of the page holding 'address' (bytes in address
+     * order): null if it was never written, and for writing allocated or
+     * made private first. Valid until the memory is copied, assigned or
+     * cleared; a read-only pointer also only until the next page_alloc()
+     * of its page, which may move a copy-on-write page. */
+    const uint8_t *page(uint32_t address) const;
+    uint8_t *page_alloc(uint32_t address);
+};
+
+/* One complete, independent simulation: configuration, memory, cores and
+ * statistics. Nothing here is shared between instances, so a host program
+ * may run any number of them, each on its own thread. The interactive
+ * shell (shell.cpp) drives a single instance; other programs link against
+ * libsim.a, which is everything but the shell:
+ *
+ *     Sim_Config config;
+ *     config.mem_latency = 50;
+ *     if (!config_check(config)) ...
+ *     Simulator sim(config);
+ *     if (sim.load_program("prog.x") < 0) ...
+ *     sim.go();
+ *     printf("%u cycles\n", sim.stat_cycles);
+ */
+struct Simulator {
+    Sim_Config config;
+    Sim_Memory mem;
+
+    /* one pipeline per core (config.ncores of them), and the snooping bus
+     * connecting their data caches */
+    std::vector<Pipe_State> pipes;
+    Coherence_Bus data_bus;
+
+    /* cleared once every core has halted */
+    bool run_bit;
+
+    /* statistics summed over all cores */
+    uint32_t stat_cycles, stat_inst_retire, stat_inst_fetch, stat_squash;
+
+    /* every counter by name, and the interval sampler (null unless
+     * config.sample_interval is set) */
+    Stats_Registry stats;
+    std::unique_ptr<Stats_Sampler> sampler;
+
+    /* host wall-clock seconds spent in run() and go(), and (in a profiling
+     * build) where they went */
+    double host_seconds;
+    Host_Profile profile;
+
+    /* the configuration must have passed config_check() */
+    explicit Simulator(const Sim_Config &config);
+    ~Simulator();
+
+    /* the caches' bus and the pipes point into this object */
+    Simulator(const Simulator &) = delete;
+    Simulator &operator=(const Simulator &) = delete;
+
+    /* load an ELF, raw binary (*.bin) or hex text (*.x) program; returns
+     * the number of words read, or -1 (after printing why) if it cannot */
+    int64_t load_program(const char *program_filename);
+
+    /* start from the program another instance has loaded: its memory,
+     * shared copy-on-write, and its entry point */
+    void share_program(const Simulator &other);
+
+    /* execute one cycle */
+    void cycle();
+
+    /* jump over at most max_cycles cycles in which no core can make
+     * progress; returns the number skipped */
+    uint32_t skip_idle_cycles(uint32_t max_cycles);
+
+    /* simulate up to num_cycles cycles, stopping early if all cores halt;
+     * returns the number simulated */
+    uint32_t run(uint32_t num_cycles);
+
+    /* simulate until all cores halt */
+    void go();
+
+    /* execute up to num_insts instructions on each core functionally
+     * (xlat.h), without timing; returns the number executed over all
+     * cores. Ops already in a pipeline first finish in timing simulation,
+     * with fetch stopped. */
+    int64_t fast_forward(uint64_t num_insts);
+};
+
+#endif
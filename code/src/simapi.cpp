@@ -0,0 +1,163 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: C ABI
+ */
+
+#include "simapi.h"
+#include "sim.h"
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+struct sim_t {
+    Simulator sim;
+    /* an allocation failed part way through a call: the state is no
+     * longer consistent, so the handle refuses everything but reads */
+    bool failed;
+
+    explicit sim_t(const Sim_Config &config) : sim(config), failed(false) {}
+};
+
+/* no C++ exception may cross the C boundary: run f() and turn running out
+ * of memory into a failed handle and -1 */
+template <typename F>
+static int64_t guard(sim_t *sim, F f)
+{
+    if (sim->failed) {
+        printf("Error: simulator handle failed earlier\n");
+        return -1;
+    }
+    try {
+        return f();
+    }
+    catch (const std::bad_alloc &) {
+        printf("Error: out of memory\n");
+        sim->failed = true;
+        sim->sim.run_bit = false;
+        return -1;
+    }
+}
+
+int sim_api_version(void)
+{
+    return SIM_API_VERSION;
+}
+
+sim_t *sim_create(const char *const *options, int noptions)
+{
+    Sim_Config config;
+
+    for (int i = 0; i < noptions; i++) {
+        const char *arg = options[i];
+        if (strncmp(arg, "--", 2) == 0)
+            arg += 2;
+        const char *eq = strchr(arg, '=');
+        if (!eq) {
+            printf("Error: option %s needs a value (name=value)\n", options[i]);
+            return nullptr;
+        }
+        if (!config_set(config, arg, eq - arg, eq + 1))
+            return nullptr;
+    }
+    if (!config_check(config))
+        return nullptr;
+
+    /* no C++ exception may cross the C boundary */
+    try {
+        return new sim_t(config);
+    }
+    catch (const std::bad_alloc &) {
+        printf("Error: out of memory\n");
+        return nullptr;
+    }
+}
+
+void sim_destroy(sim_t *sim)
+{
+    delete sim;
+}
+
+int64_t sim_load_program(sim_t *sim, const char *filename)
+{
+    return guard(sim, [&]() -> int64_t { return sim->sim.load_program(filename); });
+}
+
+int sim_share_program(sim_t *sim, const sim_t *other)
+{
+    return guard(sim, [&]() -> int64_t { sim->sim.share_program(other->sim); return 0; });
+}
+
+int64_t sim_run(sim_t *sim, uint32_t cycles)
+{
+    return guard(sim, [&]() -> int64_t { return sim->sim.run(cycles); });
+}
+
+int sim_go(sim_t *sim)
+{
+    return guard(sim, [&]() -> int64_t { sim->sim.go(); return 0; });
+}
+
+int64_t sim_fast_forward(sim_t *sim, uint64_t insts)
+{
+    return guard(sim, [&]() -> int64_t { return sim->sim.fast_forward(insts); });
+}
+
+int sim_running(const sim_t *sim)
+{
+    return sim->sim.run_bit;
+}
+
+uint32_t sim_num_cores(const sim_t *sim)
+{
+    return sim->sim.pipes.size();
+}
+
+uint32_t sim_read_reg(const sim_t *sim, uint32_t core, uint32_t reg)
+{
+    if (core >= sim->sim.pipes.size())
+        return 0;
+
+    const Pipe_State &p = sim->sim.pipes[core];
+    switch (reg) {
+        case SIM_REG_PC: return p.PC;
+        case SIM_REG_HI: return p.HI;
+        case SIM_REG_LO: return p.LO;
+    }
+    return reg < 32 ? p.REGS[reg] : 0;
+}
+
+uint32_t sim_read_mem32(const sim_t *sim, uint32_t addr)
+{
+    return sim->sim.mem.read_32(addr);
+}
+
+size_t sim_num_stats(const sim_t *sim)
+{
+    return sim->sim.stats.counters.size();
+}
+
+const char *sim_stat_name(const sim_t *sim, size_t index)
+{
+    if (index >= sim->sim.stats.counters.size())
+        return nullptr;
+    return sim->sim.stats.counters[index].name.c_str();
+}
+
+uint64_t sim_stat_value(const sim_t *sim, size_t index)
+{
+    if (index >= sim->sim.stats.counters.size())
+        return 0;
+    return sim->sim.stats.counters[index].value();
+}
+
+int sim_stat(const sim_t *sim, const char *name, uint64_t *value)
+{
+    for (const Stat_Counter &c : sim->sim.stats.counters) {
+        if (c.name == name) {
+            *value = c.value();
+            return 0;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,93 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: C ABI
+ */
+
+#ifndef _SIMAPI_H_
+#define _SIMAPI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* A small, stable C interface to the Simulator of sim.h, for programs and
+ * languages that cannot use its C++ interface: libsim.so exports it (and
+ * libsim.a contains it), and tools/simlib.py binds it with ctypes.
+ *
+ *     const char *opts[] = { "mem_latency=50", "core=ooo" };
+ *     sim_t *s = sim_create(opts, 2);
+ *     if (!s || sim_load_program(s, "prog.x") < 0 || sim_go(s) < 0) ...
+ *     uint64_t cycles;
+ *     sim_stat(s, "Cycles", &cycles);
+ *     sim_destroy(s);
+ *
+ * Options are the simulator's command-line options, with or without the
+ * leading "--". Errors are printed to stdout, as the simulator prints
+ * them. No C++ exception ever leaves these functions: a load, run or
+ * fast-forward that runs out of memory returns -1 and fails the handle,
+ * which from then on returns -1 from those calls too and stops running;
+ * only reads and sim_destroy() remain useful. Each handle is an independent simulation; different handles may
+ * be used from different threads at the same time, one handle from one
+ * thread at a time.
+ *
+ * Functions are only ever added, never changed: a binding built against
+ * SIM_API_VERSION n works with any library whose sim_api_version() is at
+ * least n. */
+#define SIM_API_VERSION 1
+
+/* register numbers of sim_read_reg() beyond the 32 general registers */
+#define SIM_REG_PC 32
+#define SIM_REG_HI 33
+#define SIM_REG_LO 34
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct sim_t sim_t;
+
+int sim_api_version(void);
+
+/* a simulator configured by 'noptions' "name=value" options; NULL if one
+ * is unknown or malformed, or the configuration is invalid */
+sim_t *sim_create(const char *const *options, int noptions);
+void sim_destroy(sim_t *sim);
+
+/* load a program (see Simulator::load_program()); returns the number of
+ * words read, or -1. sim_share_program() starts from the program another
+ * handle has loaded instead, sharing its memory copy-on-write; returns 0,
+ * or -1. */
+int64_t sim_load_program(sim_t *sim, const char *filename);
+int sim_share_program(sim_t *sim, const sim_t *other);
+
+/* simulate up to 'cycles' cycles (returns the number simulated), until
+ * every core halts (returns 0), or functionally for up to 'insts'
+ * instructions per core (returns the number executed; the pipelines are
+ * drained first, see Simulator::fast_forward()); each returns -1 if the
+ * handle has failed */
+int64_t sim_run(sim_t *sim, uint32_t cycles);
+int sim_go(sim_t *sim);
+int64_t sim_fast_forward(sim_t *sim, uint64_t insts);
+
+/* 1 until every core has halted */
+int sim_running(const sim_t *sim);
+
+/* architectural state: a core's register (0-31 or SIM_REG_*), and a
+ * 32-bit word of memory */
+uint32_t sim_num_cores(const sim_t *sim);
+uint32_t sim_read_reg(const sim_t *sim, uint32_t core, uint32_t reg);
+uint32_t sim_read_mem32(const sim_t *sim, uint32_t addr);
+
+/* the statistics registry (stats.h): counter names (valid as long as the
+ * handle) and current values by index, or a value by name (returns 0, or
+ * -1 if there is no such counter) */
+size_t sim_num_stats(const sim_t *sim);
+const char *sim_stat_name(const sim_t *sim, size_t index);
+uint64_t sim_stat_value(const sim_t *sim, size_t index);
+int sim_stat(const sim_t *sim, const char *name, uint64_t *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
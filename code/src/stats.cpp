@@ -0,0 +1,274 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: statistics registry and interval sampling
+ */
+
+#include "stats.h"
+#include "sim.h"
+#include "ooo.h"
+#include "tlb.h"
+#include "frontend.h"
+#include "muldiv.h"
+#include <cstring>
+
+/* rows buffered between writes to the sample file */
+#define SAMPLE_RING_ROWS 1024
+
+/* stats_register() adds these first, in this order */
+enum {
+    STAT_CYCLES = 0,
+    STAT_FETCHED,
+    STAT_RETIRED,
+    STAT_FLUSHES
+};
+
+void Stats_Registry::add(const std::string &name, const uint32_t *counter)
+{
+    counters.push_back(Stat_Counter{name, counter, nullptr});
+}
+
+void Stats_Registry::add(const std::string &name, const uint64_t *counter)
+{
+    counters.push_back(Stat_Counter{name, nullptr, counter});
+}
+
+static void register_cache(Stats_Registry &r, const std::string &prefix, const Cache &cache)
+{
+    const Cache_Stats &s = cache.stats;
+
+    r.add(prefix + "Accesses", &s.accesses);
+    r.add(prefix + "Hits", &s.hits);
+    r.add(prefix + "Misses", &s.misses);
+    r.add(prefix + "Writebacks", &s.writebacks);
+    if (cache.timing.read_energy)
+        r.add(prefix + "Energy", &s.energy);
+    if (cache.sector_size < cache.block_size || cache.beat_bytes) {
+        r.add(prefix + "SectorMisses", &s.sector_misses);
+        r.add(prefix + "TransferBytes", &s.transfer_bytes);
+        r.add(prefix + "WritebackBytes", &s.writeback_bytes);
+        r.add(prefix + "EarlyRestartCycles", &s.restart_cycles);
+        r.add(prefix + "FillWaitCycles", &s.fill_wait_cycles);
+    }
+    if (cache.mem) {
+        r.add(prefix + "FillBytes", &s.fill_bytes);
+        r.add(prefix + "ResidentBlocks", &s.resident_blocks);
+        r.add(prefix + "SpaceEvictions", &s.space_evictions);
+    }
+    if (!cache.bus)
+        return;
+    r.add(prefix + "BusRd", &s.bus_rd);
+    r.add(prefix + "BusRdX", &s.bus_rdx);
+    r.add(prefix + "BusUpgr", &s.bus_upgr);
+    r.add(prefix + "Invalidations", &s.invalidations);
+    r.add(prefix + "CoherenceMisses", &s.coherence_misses);
+    r.add(prefix + "FalseSharingMisses", &s.false_sharing_misses);
+}
+
+static void register_tlb(Stats_Registry &r, const std::string &prefix, const Tlb &tlb)
+{
+    r.add(prefix + "Accesses", &tlb.stats.accesses);
+    r.add(prefix + "Hits", &tlb.stats.hits);
+    r.add(prefix + "Misses", &tlb.stats.misses);
+}
+
+void stats_register(Simulator &sim)
+{
+    Stats_Registry &r = sim.stats;
+
+    r.counters.clear();
+    r.add("Cycles", &sim.stat_cycles);
+    r.add("FetchedInstr", &sim.stat_inst_fetch);
+    r.add("RetiredInstr", &sim.stat_inst_retire);
+    r.add("Flushes", &sim.stat_squash);
+
+    for (const auto &p : sim.pipes) {
+        std::string core = "Core" + std::to_string(p.core_id) + ".";
+
+        r.add(core + "Cycles", &p.stat_cycles);
+        r.add(core + "FetchedInstr", &p.stat_inst_fetch);
+        r.add(core + "RetiredInstr", &p.stat_inst_retire);
+        r.add(core + "Flushes", &p.stat_squash);
+        for (size_t w = 0; w < p.stat_retire_width.size(); w++)
+            r.add(core + "RetireWidth" + std::to_string(w), &p.stat_retire_width[w]);
+        for (int c = 0; c < CPI_NUM_CAUSES; c++)
+            r.add(core + "Cycles." + cpi_cause_names[c], &p.stat_cpi[c]);
+
+        if (p.ooo) {
+            const Ooo_Stats &os = p.ooo->stats;
+            r.add(core + "RobOccupancy", &os.rob_occupancy);
+            r.add(core + "RobFullCycles", &os.rob_full);
+            r.add(core + "IqFullCycles", &os.iq_full);
+            r.add(core + "LsqFullCycles", &os.lsq_full);
+            r.add(core + "RegsFullCycles", &os.regs_full);
+            r.add(core + "LoadsForwarded", &os.loads_forwarded);
+            r.add(core + "LoadsBlocked", &os.loads_blocked);
+        }
+
+        if (p.muldiv) {
+            const Muldiv_Stats &ms = p.muldiv->stats;
+            r.add(core + "Mul.Ops", &ms.mul_ops);
+            r.add(core + "Div.Ops", &ms.div_ops);
+            r.add(core + "Div.BusyCycles", &ms.div_busy);
+            r.add(core + "Div.EarlyOutCycles", &ms.div_saved);
+        }
+
+        register_cache(r, core + "L1I.", p.icache);
+        register_cache(r, core + "L1D.", p.dcache);
+        if (p.l2) {
+            register_cache(r, core + "L2.", *p.l2);
+            if (p.l2->umon)
+                r.add(core + "L2.Repartitions", &p.l2->umon->repartitions);
+        }
+
+        if (p.mmu) {
+            register_tlb(r, core + "ITLB.", p.mmu->itlb);
+            register_tlb(r, core + "DTLB.", p.mmu->dtlb);
+            register_tlb(r, core + "L2TLB.", p.mmu->l2tlb);
+            r.add(core + "PageWalks", &p.mmu->walks);
+            r.add(core + "PageWalkCycles", &p.mmu->walk_cycles);
+        }
+
+        if (p.frontend) {
+            const Frontend_Stats &fs = p.frontend->stats;
+            r.add(core + "FTQ.Blocks", &fs.blocks);
+            r.add(core + "FTQ.BtbHits", &fs.btb_hits);
+            r.add(core + "FTQ.Prefetches", &fs.prefetches);
+            r.add(core + "FTQ.LatePrefetches", &fs.late_prefetches);
+            r.add(core + "FTQ.DecodeRedirects", &fs.decode_redirects);
+            r.add(core + "FTQ.EmptyCycles", &fs.ftq_empty);
+        }
+    }
+
+    r.add("Mem.PagesTouched", &sim.mem.pages_touched);
+}
+
+/* write out the buffered rows */
+static void flush_rows(Stats_Sampler &s)
+{
+    if (!s.csv) {
+        fwrite(s.ring.data(), sizeof(uint64_t), s.rows * s.row_size, s.file);
+        s.rows = 0;
+        return;
+    }
+
+    for (size_t i = 0; i < s.rows; i++) {
+        const uint64_t *row = &s.ring[i * s.row_size];
+        const uint64_t *delta = row + 1;
+
+        fprintf(s.file, "%llu,%0.3f", (unsigned long long) row[0],
+                delta[STAT_CYCLES] ? ((double) delta[STAT_RETIRED]) / delta[STAT_CYCLES] : 0.0);
+        for (size_t c = 0; c + 1 < s.row_size; c++)
+            fprintf(s.file, ",%llu", (unsigned long long) delta[c]);
+        fprintf(s.file, "\n");
+    }
+    s.rows = 0;
+}
+
+Stats_Sampler::~Stats_Sampler()
+{
+    if (!file)
+        return;
+
+    flush_rows(*this);
+    fclose(file);
+}
+
+std::unique_ptr<Stats_Sampler> stats_sampler_open(const Simulator &sim)
+{
+    const std::string &path = sim.config.sample_file;
+    const std::vector<Stat_Counter> &counters = sim.stats.counters;
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file) {
+        printf("Error: Can't create sample file %s\n", path.c_str());
+        return nullptr;
+    }
+
+    std::unique_ptr<Stats_Sampler> s(new Stats_Sampler());
+    s->registry = &sim.stats;
+    s->interval = sim.config.sample_interval;
+    s->by_instructions = sim.config.sample_unit == SAMPLE_INSTRUCTIONS;
+    s->next = s->interval;
+    s->csv = path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+    s->file = file;
+
+    for (const auto &c : counters)
+        s->last.push_back(c.value());
+
+    s->row_size = 1 + counters.size();
+    s->capacity = SAMPLE_RING_ROWS;
+    s->ring.resize(s->capacity * s->row_size);
+
+    if (s->csv) {
+        fprintf(file, "Cycle,IPC");
+        for (const auto &c : counters)
+            fprintf(file, ",%s", c.name.c_str());
+        fprintf(file, "\n");
+    }
+    else {
+        uint32_t version = 1, n = counters.size();
+        fwrite("MSTS", 1, 4, file);
+        fwrite(&version, sizeof(version), 1, file);
+        fwrite(&n, sizeof(n), 1, file);
+        for (const auto &c : counters)
+            fwrite(c.name.c_str(), 1, c.name.size() + 1, file);
+    }
+
+    return s;
+}
+
+/* buffer one row: the current cycle and every counter's change */
+static void take_sample(Simulator &sim, Stats_Sampler &s)
+{
+    const std::vector<Stat_Counter> &counters = s.registry->counters;
+    uint64_t *row = &s.ring[s.rows * s.row_size];
+
+    row[0] = sim.stat_cycles;
+    for (size_t i = 0; i < counters.size(); i++) {
+        uint64_t v = counters[i].value();
+        row[1 + i] = v - s.last[i];
+        s.last[i] = v;
+    }
+
+    if (++s.rows == s.capacity)
+        flush_rows(s);
+}
+
+uint32_t stats_sampler_skippable(const Simulator &sim)
+{
+    const Stats_Sampler &s = *sim.sampler;
+
+    /* idle cycles retire nothing, so they never cross an instruction
+     * boundary; a cycle boundary must be reached by a simulated cycle */
+    if (s.by_instructions || s.next > (uint64_t) sim.stat_cycles + UINT32_MAX)
+        return UINT32_MAX;
+    if (s.next <= (uint64_t) sim.stat_cycles + 1)
+        return 0;
+    return s.next - sim.stat_cycles - 1;
+}
+
+void stats_sample(Simulator &sim)
+{
+    Stats_Sampler &s = *sim.sampler;
+    uint64_t now = s.by_instructions ? sim.stat_inst_retire : sim.stat_cycles;
+
+    if (now < s.next)
+        return;
+
+    /* a wide retire may cross more than one instruction boundary: the
+     * sample then covers all of them */
+    take_sample(sim, s);
+    while (s.next <= now)
+        s.next += s.interval;
+}
+
+void stats_sample_finish(Simulator &sim)
+{
+    Stats_Sampler &s = *sim.sampler;
+
+    if (s.last[STAT_CYCLES] != sim.stat_cycles)
+        take_sample(sim, s);
+    flush_rows(s);
+    fflush(s.file);
+}
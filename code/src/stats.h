@@ -0,0 +1,85 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: statistics registry and interval sampling
+ */
+
+#ifndef _STATS_H_
+#define _STATS_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct Simulator;
+
+/* one named counter, owned by some part of a Simulator */
+struct Stat_Counter {
+    std::string name;
+    const uint32_t *u32;
+    const uint64_t *u64;
+
+    uint64_t value() const { return u32 ? *u32 : *u64; }
+};
+
+/* Every counter of a Simulator, registered once it is constructed (so the
+ * counters no longer move). Names follow the stats command: "Cycles",
+ * "Core0.RetiredInstr", "Core1.L1D.Misses", ... */
+struct Stats_Registry {
+    std::vector<Stat_Counter> counters;
+
+    void add(const std::string &name, const uint32_t *counter);
+    void add(const std::string &name, const uint64_t *counter);
+};
+
+/* register all counters of a freshly constructed simulator */
+void stats_register(Simulator &sim);
+
+/* Interval sampling (--sample=N): every N cycles or retired instructions,
+ * the change in every registered counter since the previous sample is
+ * buffered in a ring of rows that is written out whenever it fills, and
+ * when the simulation ends.
+ *
+ * CSV output has one header line, then one line per interval: the cycle at
+ * which the interval ended, its IPC, and one column per counter.
+ *
+ * Binary output, in host byte order: the magic "MSTS", a uint32 version
+ * (1), a uint32 counter count n, then n NUL-terminated counter names, and
+ * then one row per interval of n+1 uint64 values: the ending cycle and the
+ * n counter changes. */
+struct Stats_Sampler {
+    const Stats_Registry *registry;
+    uint32_t interval;
+    int by_instructions;
+    uint64_t next;  /* cycle or instruction count of the next sample */
+    int csv;
+    FILE *file;
+
+    /* counter values at the previous sample */
+    std::vector<uint64_t> last;
+
+    /* buffered rows, each 1 + registry->counters.size() values */
+    std::vector<uint64_t> ring;
+    size_t row_size, rows, capacity;
+
+    Stats_Sampler() : registry(nullptr), interval(0), by_instructions(0), next(0),
+                      csv(0), file(nullptr), row_size(0), rows(0), capacity(0) {}
+    ~Stats_Sampler();
+};
+
+/* start sampling as configured (config.sample_*); returns null, after
+ * printing why, if the output file cannot be created */
+std::unique_ptr<Stats_Sampler> stats_sampler_open(const Simulator &sim);
+
+/* cycles that may be skipped in one step without passing a sample point */
+uint32_t stats_sampler_skippable(const Simulator &sim);
+
+/* called after every cycle: take a sample at each interval boundary */
+void stats_sample(Simulator &sim);
+
+/* record the final (partial) interval and write everything out */
+void stats_sample_finish(Simulator &sim);
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: TLBs and page-table walker
+ */
+
+#include "tlb.h"
+#include "pipe.h"
+#include "sim.h"
+#include <algorithm>
+
+Tlb::Tlb(uint32_t entries, uint32_t assoc)
+    : num_sets(entries / assoc), assoc(assoc), entries(entries), lru_clock(0)
+{
+}
+
+int Tlb::lookup(uint32_t vpn)
+{
+    Tlb_Entry *set = &entries[(vpn & (num_sets - 1)) * assoc];
+
+    stats.accesses++;
+    lru_clock++;
+
+    for (uint32_t w = 0; w < assoc; w++) {
+        if (set[w].valid && set[w].vpn == vpn) {
+            set[w].lru = lru_clock;
+            stats.hits++;
+            return 1;
+        }
+    }
+
+    stats.misses++;
+    return 0;
+}
+
+void Tlb::fill(uint32_t vpn)
+{
+    Tlb_Entry *set = &entries[(vpn & (num_sets - 1)) * assoc];
+    Tlb_Entry *victim = &set[0];
+
+    for (uint32_t w = 0; w < assoc; w++) {
+        if (!set[w].valid) {
+            victim = &set[w];
+            break;
+        }
+        if (set[w].lru < victim->lru)
+            victim = &set[w];
+    }
+
+    victim->vpn = vpn;
+    victim->valid = 1;
+    victim->lru = lru_clock;
+}
+
+static int log2i(uint32_t x)
+{
+    int n = 0;
+    while ((1u << n) < x)
+        n++;
+    return n;
+}
+
+Mmu::Mmu(const Sim_Config &config)
+    : itlb(config.itlb_entries, config.itlb_entries),
+      dtlb(config.dtlb_entries, config.dtlb_entries),
+      l2tlb(config.l2tlb_entries, config.l2tlb_assoc),
+      page_bits(log2i(config.page_size)), walks(0), walk_cycles(0)
+{
+    /* a leaf table of 4-byte PTEs fills one page */
+    leaf_bits = std::min(32 - page_bits, page_bits - 2);
+}
+
+/* walk the page table for 'vpn': one PTE read through the data cache per
+ * level. Returns the cycles taken. */
+static uint32_t page_walk(Pipe_State &pipe, Mmu &mmu, uint32_t vpn)
+{
+    uint32_t root_bits = 32 - mmu.page_bits - mmu.leaf_bits;
+    uint32_t page_size = 1u << mmu.page_bits;
+    uint32_t root = vpn >> mmu.leaf_bits;
+    uint32_t leaf = vpn & ((1u << mmu.leaf_bits) - 1);
+    uint32_t cycles = 0;
+
+    /* the root table (if any) occupies whole pages, followed by one leaf
+     * table per root entry */
+    uint32_t root_table = root_bits ? std::max(page_size, 4u << root_bits) : 0;
+
+    if (root_bits)
+        cycles += 1 + pipe.dcache.access(TLB_PT_BASE + 4 * root, 0);
+    cycles += 1 + pipe.dcache.access(TLB_PT_BASE + root_table + root * page_size + 4 * leaf, 0);
+
+    mmu.walks++;
+    mmu.walk_cycles += cycles;
+    return cycles;
+}
+
+uint32_t tlb_translate(Pipe_State &pipe, uint32_t addr, int inst)
+{
+    if (!pipe.mmu)
+        return 0;
+
+    const Sim_Config &config = pipe.sim->config;
+    Mmu &mmu = *pipe.mmu;
+    Tlb &l1 = inst ? mmu.itlb : mmu.dtlb;
+    uint32_t vpn = addr >> mmu.page_bits;
+
+    if (l1.lookup(vpn))
+        return 0;
+
+    uint32_t cycles = config.l2tlb_latency;
+    if (!mmu.l2tlb.lookup(vpn)) {
+        cycles += page_walk(pipe, mmu, vpn);
+        mmu.l2tlb.fill(vpn);
+    }
+    l1.fill(vpn);
+
+    return cycles;
+}
@@ -0,0 +1,76 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: TLBs and page-table walker
+ */
+
+#ifndef _TLB_H_
+#define _TLB_H_
+
+#include <cstdint>
+#include <vector>
+
+struct Pipe_State;
+struct Sim_Config;
+
+/* The translation model (--tlb=1) is timing only: programs run on identity-
+ * mapped (virtual == physical) memory, but every fetch and data access must
+ * first find its page in a TLB. Each core has an ITLB and a DTLB (fully
+ * associative, LRU) backed by an L2 TLB that both share. A miss in the L2
+ * TLB starts a hardware walk of a two-level radix page table: each level
+ * reads one 4-byte PTE through the core's L1 data cache, so page walks
+ * compete with (and can miss like) ordinary loads. With page_size P, a leaf
+ * table maps P/4 pages and fills one page; the root maps the rest of the
+ * virtual page number (and a walk has a single level if that is nothing).
+ *
+ * The page table lives at TLB_PT_BASE. Its PTEs only ever pass through the
+ * caches: the walker never reads memory, so it allocates no pages. */
+#define TLB_PT_BASE 0xC0000000u
+
+struct Tlb_Entry {
+    uint32_t vpn;
+    int valid;
+    uint64_t lru;
+
+    Tlb_Entry() : vpn(0), valid(0), lru(0) {}
+};
+
+struct Tlb_Stats {
+    uint64_t accesses, hits, misses;
+
+    Tlb_Stats() : accesses(0), hits(0), misses(0) {}
+};
+
+/* one set-associative, LRU TLB */
+struct Tlb {
+    uint32_t num_sets, assoc;
+    std::vector<Tlb_Entry> entries; /* num_sets * assoc, set-major */
+    uint64_t lru_clock;
+    Tlb_Stats stats;
+
+    Tlb(uint32_t entries, uint32_t assoc);
+
+    /* look up a virtual page number; returns 1 on a hit */
+    int lookup(uint32_t vpn);
+
+    /* install a translation, replacing the set's LRU entry */
+    void fill(uint32_t vpn);
+};
+
+/* a core's translation hardware */
+struct Mmu {
+    Tlb itlb, dtlb, l2tlb;
+    int page_bits, leaf_bits;
+
+    /* page walks, and the cycles they took */
+    uint64_t walks, walk_cycles;
+
+    explicit Mmu(const Sim_Config &config);
+};
+
+/* translate a fetch (inst = 1) or data address for this core; returns the
+ * cycles the access stalls before it can go to the cache (0 on an L1 TLB
+ * hit, and always 0 without --tlb) */
+uint32_t tlb_translate(Pipe_State &pipe, uint32_t addr, int inst);
+
+#endif
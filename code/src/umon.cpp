@@ -0,0 +1,125 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: utility-based L2 way partitioning
+ */
+
+#include "umon.h"
+#include "cache.h"
+#include <algorithm>
+
+const char *const stream_names[NUM_STREAMS] = { "Instr", "Data" };
+
+Umon::Umon(uint32_t num_sets, uint32_t assoc, uint32_t interval)
+    : assoc(assoc), set_stride(std::max(1u, num_sets / UMON_SAMPLED_SETS)),
+      interval(interval), accesses(0), repartitions(0), clock(nullptr)
+{
+    uint32_t sampled = (num_sets + set_stride - 1) / set_stride;
+
+    for (int s = 0; s < NUM_STREAMS; s++) {
+        tags[s].assign(sampled * assoc, UMON_EMPTY);
+        hits[s].assign(assoc, 0);
+        ways[s] = assoc / NUM_STREAMS;
+    }
+    ways[NUM_STREAMS - 1] += assoc % NUM_STREAMS;
+}
+
+/* the lookahead allocation: give each stream one way, then repeatedly the
+ * stream with the highest marginal utility as many ways as it takes to
+ * reach it */
+static void umon_partition(Umon &u)
+{
+    uint32_t alloc[NUM_STREAMS];
+    uint32_t balance = u.assoc;
+
+    for (int s = 0; s < NUM_STREAMS; s++) {
+        alloc[s] = 1;
+        balance--;
+    }
+
+    while (balance > 0) {
+        double best_mu = 0;
+        int best = -1;
+        uint32_t best_k = 0;
+
+        for (int s = 0; s < NUM_STREAMS; s++) {
+            uint64_t gain = 0;
+            for (uint32_t k = 1; k <= balance; k++) {
+                gain += u.hits[s][alloc[s] + k - 1];
+                double mu = (double)gain / k;
+                if (mu > best_mu) {
+                    best_mu = mu;
+                    best = s;
+                    best_k = k;
+                }
+            }
+        }
+
+        /* no stream gains from more ways: share the rest */
+        if (best < 0) {
+            for (int s = 0; balance > 0; s = (s + 1) % NUM_STREAMS, balance--)
+                alloc[s]++;
+            break;
+        }
+        alloc[best] += best_k;
+        balance -= best_k;
+    }
+
+    /* the first decision is logged even if it keeps the initial split */
+    int changed = !std::equal(alloc, alloc + NUM_STREAMS, u.ways);
+    if (!changed && !u.log.empty())
+        return;
+
+    Umon_Decision d;
+    d.cycle = u.clock ? *u.clock : 0;
+    for (int s = 0; s < NUM_STREAMS; s++)
+        u.ways[s] = d.ways[s] = alloc[s];
+    u.log.push_back(d);
+    u.repartitions += changed;
+}
+
+void umon_access(Umon &u, uint32_t set, uint32_t block, int stream)
+{
+    if (set % u.set_stride == 0) {
+        uint32_t *tags = &u.tags[stream][set / u.set_stride * u.assoc];
+        uint32_t p = 0;
+        while (p < u.assoc - 1 && tags[p] != block)
+            p++;
+        if (tags[p] == block)
+            u.hits[stream][p]++;
+
+        /* move to the MRU position (a miss drops the LRU tag) */
+        std::copy_backward(tags, tags + p, tags + p + 1);
+        tags[0] = block;
+    }
+
+    if (++u.accesses < u.interval)
+        return;
+    u.accesses = 0;
+
+    umon_partition(u);
+    for (int s = 0; s < NUM_STREAMS; s++) {
+        for (uint64_t &h : u.hits[s])
+            h /= 2;
+    }
+}
+
+Cache_Block *umon_victim(const Umon &u, Cache_Block *set, uint32_t ways, int stream)
+{
+    uint32_t own = 0;
+    for (uint32_t w = 0; w < ways; w++)
+        own += set[w].stream == stream;
+
+    /* under quota: take a block from another stream; at or over it,
+     * replace one of our own */
+    int take_other = own < u.ways[stream];
+    Cache_Block *victim = nullptr;
+    for (uint32_t w = 0; w < ways; w++) {
+        Cache_Block *b = &set[w];
+        if ((b->stream != stream) != take_other)
+            continue;
+        if (!victim || b->lru < victim->lru)
+            victim = b;
+    }
+    return victim ? victim : set;
+}
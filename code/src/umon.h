@@ -0,0 +1,79 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: utility-based L2 way partitioning
+ */
+
+#ifndef _UMON_H_
+#define _UMON_H_
+
+#include <cstdint>
+#include <vector>
+
+struct Cache_Block;
+
+/* the streams sharing a unified cache: what each L1 misses on */
+enum Cache_Stream {
+    STREAM_INSTR = 0,
+    STREAM_DATA,
+    NUM_STREAMS
+};
+
+extern const char *const stream_names[NUM_STREAMS];
+
+/* Utility-based cache partitioning (--l2_partition=1; Qureshi and Patt,
+ * MICRO 2006) of a unified L2's ways between instruction fetches and data
+ * accesses, so that a loop streaming through a large data set cannot evict
+ * its own code.
+ *
+ * A utility monitor (UMON) per stream keeps shadow tags for a sample of the
+ * sets (UMON_SAMPLED_SETS, dynamic set sampling), managed as if the stream
+ * had the whole cache to itself, and counts hits at each LRU stack
+ * position: hits[p] is what the stream gains from its (p+1)th way. Every
+ * 'interval' accesses to the cache, the lookahead algorithm hands out the
+ * ways, at least one per stream, always to the stream with the most hits
+ * per way over its next few ways; then the counters are halved so that
+ * the monitors follow phase changes.
+ *
+ * Replacement enforces the allocation: a stream that misses while holding
+ * fewer blocks of the set than its ways evicts the least recently used
+ * block of another stream, otherwise its own. An allocation that changes
+ * is logged with the cycle it was decided in. */
+#define UMON_SAMPLED_SETS 32
+
+struct Umon_Decision {
+    uint32_t cycle;
+    uint32_t ways[NUM_STREAMS];
+};
+
+struct Umon {
+    uint32_t assoc, set_stride, interval;
+    uint32_t accesses;      /* since the last decision */
+
+    /* shadow tags of the sampled sets, most recently used first
+     * (UMON_EMPTY if unused), and hits per stack position */
+    std::vector<uint32_t> tags[NUM_STREAMS];
+    std::vector<uint64_t> hits[NUM_STREAMS];
+
+    /* current allocation, and its history */
+    uint32_t ways[NUM_STREAMS];
+    std::vector<Umon_Decision> log;
+    uint64_t repartitions;
+
+    /* the owning core's cycle count, for the log (set once the core no
+     * longer moves) */
+    const uint32_t *clock;
+
+    Umon(uint32_t num_sets, uint32_t assoc, uint32_t interval);
+};
+
+#define UMON_EMPTY 0xFFFFFFFFu
+
+/* monitor an access of 'stream' to block number 'block' in 'set', and
+ * repartition at the end of an interval */
+void umon_access(Umon &u, uint32_t set, uint32_t block, int stream);
+
+/* the block of a full set that a miss of 'stream' replaces */
+Cache_Block *umon_victim(const Umon &u, Cache_Block *set, uint32_t ways, int stream);
+
+#endif
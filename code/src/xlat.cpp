@@ -0,0 +1,646 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: superblock translation cache
+ */
+
+#include "xlat.h"
+#include "pipe.h"
+#include "sim.h"
+#include "mips.h"
+
+/* micro-op handlers. Register numbers are final: writes to R0 were turned
+ * into xop_nop at translation time. */
+
+static int xop_nop(Pipe_State &pipe, Xlat_Op &op)
+{
+    return 0;
+}
+
+/* rd = imm (LUI, unknown SPECIAL ops, which write 0, and JAL's link) */
+static int xop_li(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = op.imm;
+    return 0;
+}
+
+static int xop_sll(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rt] << op.sa;
+    return 0;
+}
+
+static int xop_srl(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rt] >> op.sa;
+    return 0;
+}
+
+static int xop_sra(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = (int32_t)pipe.REGS[op.rt] >> op.sa;
+    return 0;
+}
+
+static int xop_sllv(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rt] << (pipe.REGS[op.rs] & 31);
+    return 0;
+}
+
+static int xop_srlv(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rt] >> (pipe.REGS[op.rs] & 31);
+    return 0;
+}
+
+static int xop_srav(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = (int32_t)pipe.REGS[op.rt] >> (pipe.REGS[op.rs] & 31);
+    return 0;
+}
+
+static int xop_add(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rs] + pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_sub(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rs] - pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_and(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rs] & pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_or(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rs] | pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_xor(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rs] ^ pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_nor(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = ~(pipe.REGS[op.rs] | pipe.REGS[op.rt]);
+    return 0;
+}
+
+static int xop_slt(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = (int32_t)pipe.REGS[op.rs] < (int32_t)pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_sltu(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.REGS[op.rs] < pipe.REGS[op.rt];
+    return 0;
+}
+
+static int xop_mult(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint64_t p = (uint64_t)((int64_t)(int32_t)pipe.REGS[op.rs] * (int32_t)pipe.REGS[op.rt]);
+    pipe.HI = p >> 32;
+    pipe.LO = (uint32_t)p;
+    return 0;
+}
+
+static int xop_multu(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint64_t p = (uint64_t)pipe.REGS[op.rs] * pipe.REGS[op.rt];
+    pipe.HI = p >> 32;
+    pipe.LO = (uint32_t)p;
+    return 0;
+}
+
+static int xop_div(Pipe_State &pipe, Xlat_Op &op)
+{
+    int32_t a = pipe.REGS[op.rs], b = pipe.REGS[op.rt];
+
+    /* division by zero leaves zeros, as in the pipeline */
+    if (b == 0)
+        pipe.HI = pipe.LO = 0;
+    else if (a == INT32_MIN && b == -1) {
+        pipe.LO = a;
+        pipe.HI = 0;
+    }
+    else {
+        pipe.LO = a / b;
+        pipe.HI = a % b;
+    }
+    return 0;
+}
+
+static int xop_divu(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint32_t a = pipe.REGS[op.rs], b = pipe.REGS[op.rt];
+
+    if (b == 0)
+        pipe.HI = pipe.LO = 0;
+    else {
+        pipe.LO = a / b;
+        pipe.HI = a % b;
+    }
+    return 0;
+}
+
+static int xop_mfhi(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.HI;
+    return 0;
+}
+
+static int xop_mthi(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.HI = pipe.REGS[op.rs];
+    return 0;
+}
+
+static int xop_mflo(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rd] = pipe.LO;
+    return 0;
+}
+
+static int xop_mtlo(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.LO = pipe.REGS[op.rs];
+    return 0;
+}
+
+static int xop_addi(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rt] = pipe.REGS[op.rs] + op.imm;
+    return 0;
+}
+
+static int xop_slti(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rt] = (int32_t)pipe.REGS[op.rs] < (int32_t)op.imm;
+    return 0;
+}
+
+static int xop_sltiu(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rt] = pipe.REGS[op.rs] < op.imm;
+    return 0;
+}
+
+static int xop_andi(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rt] = pipe.REGS[op.rs] & op.imm;
+    return 0;
+}
+
+static int xop_ori(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rt] = pipe.REGS[op.rs] | op.imm;
+    return 0;
+}
+
+static int xop_xori(Pipe_State &pipe, Xlat_Op &op)
+{
+    pipe.REGS[op.rt] = pipe.REGS[op.rs] ^ op.imm;
+    return 0;
+}
+
+/* the host byte at 'addr' for a load (null: the page was never written
+ * and reads as zeros), or for a store */
+static const uint8_t *load_ptr(Pipe_State &pipe, uint32_t addr)
+{
+    uint32_t page = addr >> MEM_PAGE_BITS;
+    Xlat_Pages::Entry &e = pipe.xlat->pages->entries[page % XLAT_PAGE_ENTRIES];
+
+    if (e.page != page) {
+        const uint8_t *host = pipe.sim->mem.page(addr);
+        if (!host)
+            return nullptr;
+        e.page = page;
+        e.read = host;
+        e.write = nullptr;
+    }
+    return e.read + (addr & (MEM_PAGE_SIZE - 1));
+}
+
+static uint8_t *store_ptr(Pipe_State &pipe, uint32_t addr)
+{
+    uint32_t page = addr >> MEM_PAGE_BITS;
+    Xlat_Pages::Entry &e = pipe.xlat->pages->entries[page % XLAT_PAGE_ENTRIES];
+
+    if (e.page != page || !e.write) {
+        e.page = page;
+        e.read = e.write = pipe.sim->mem.page_alloc(addr);
+    }
+    return e.write + (addr & (MEM_PAGE_SIZE - 1));
+}
+
+/* loads and stores: like the pipeline, a word access ignores the low two
+ * address bits and a halfword access the lowest. Memory holds bytes in
+ * address order (little-endian words), so none crosses a page. */
+static int xop_lw(Pipe_State &pipe, Xlat_Op &op)
+{
+    const uint8_t *p = load_ptr(pipe, (pipe.REGS[op.rs] + op.imm) & ~3);
+    pipe.REGS[op.rt] = p ? p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24) : 0;
+    return 0;
+}
+
+static int xop_lh(Pipe_State &pipe, Xlat_Op &op)
+{
+    const uint8_t *p = load_ptr(pipe, (pipe.REGS[op.rs] + op.imm) & ~1);
+    pipe.REGS[op.rt] = p ? (uint32_t)(int32_t)(int16_t)(p[0] | (p[1] << 8)) : 0;
+    return 0;
+}
+
+static int xop_lhu(Pipe_State &pipe, Xlat_Op &op)
+{
+    const uint8_t *p = load_ptr(pipe, (pipe.REGS[op.rs] + op.imm) & ~1);
+    pipe.REGS[op.rt] = p ? p[0] | (p[1] << 8) : 0;
+    return 0;
+}
+
+static int xop_lb(Pipe_State &pipe, Xlat_Op &op)
+{
+    const uint8_t *p = load_ptr(pipe, pipe.REGS[op.rs] + op.imm);
+    pipe.REGS[op.rt] = p ? (uint32_t)(int32_t)(int8_t)*p : 0;
+    return 0;
+}
+
+static int xop_lbu(Pipe_State &pipe, Xlat_Op &op)
+{
+    const uint8_t *p = load_ptr(pipe, pipe.REGS[op.rs] + op.imm);
+    pipe.REGS[op.rt] = p ? *p : 0;
+    return 0;
+}
+
+/* after a store: leave the block if it wrote translated code */
+static int store_done(Pipe_State &pipe, const Xlat_Op &op, uint32_t addr)
+{
+    Xlat_Cache &c = *pipe.xlat;
+
+    if ((addr & ~3) - c.code_lo >= c.code_span)
+        return 0;
+
+    c.flush_pending = 1;
+    pipe.PC = op.pc + 4;
+    return 1;
+}
+
+static int xop_sw(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint32_t addr = pipe.REGS[op.rs] + op.imm;
+    uint32_t v = pipe.REGS[op.rt];
+    uint8_t *p = store_ptr(pipe, addr & ~3);
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+    return store_done(pipe, op, addr);
+}
+
+static int xop_sh(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint32_t addr = pipe.REGS[op.rs] + op.imm;
+    uint32_t v = pipe.REGS[op.rt];
+    uint8_t *p = store_ptr(pipe, addr & ~1);
+    p[0] = v;
+    p[1] = v >> 8;
+    return store_done(pipe, op, addr);
+}
+
+static int xop_sb(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint32_t addr = pipe.REGS[op.rs] + op.imm;
+    *store_ptr(pipe, addr) = pipe.REGS[op.rt];
+    return store_done(pipe, op, addr);
+}
+
+/* conditional branches: side exits to op.imm when taken */
+static int xop_beq(Pipe_State &pipe, Xlat_Op &op)
+{
+    if (pipe.REGS[op.rs] != pipe.REGS[op.rt])
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+static int xop_bne(Pipe_State &pipe, Xlat_Op &op)
+{
+    if (pipe.REGS[op.rs] == pipe.REGS[op.rt])
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+static int xop_blez(Pipe_State &pipe, Xlat_Op &op)
+{
+    if ((int32_t)pipe.REGS[op.rs] > 0)
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+static int xop_bgtz(Pipe_State &pipe, Xlat_Op &op)
+{
+    if ((int32_t)pipe.REGS[op.rs] <= 0)
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+static int xop_bltz(Pipe_State &pipe, Xlat_Op &op)
+{
+    if ((int32_t)pipe.REGS[op.rs] >= 0)
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+static int xop_bgez(Pipe_State &pipe, Xlat_Op &op)
+{
+    if ((int32_t)pipe.REGS[op.rs] < 0)
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+/* BLTZAL/BGEZAL link whether or not they are taken */
+static int xop_bltzal(Pipe_State &pipe, Xlat_Op &op)
+{
+    int32_t v = pipe.REGS[op.rs];
+    pipe.REGS[31] = op.pc + 4;
+    if (v >= 0)
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+static int xop_bgezal(Pipe_State &pipe, Xlat_Op &op)
+{
+    int32_t v = pipe.REGS[op.rs];
+    pipe.REGS[31] = op.pc + 4;
+    if (v < 0)
+        return 0;
+    pipe.PC = op.imm;
+    return 1;
+}
+
+/* JR/JALR end the block (rd = 0 for JR) */
+static int xop_jr(Pipe_State &pipe, Xlat_Op &op)
+{
+    uint32_t target = pipe.REGS[op.rs];
+    if (op.rd)
+        pipe.REGS[op.rd] = op.pc + 4;
+    pipe.PC = target;
+    return 1;
+}
+
+/* a syscall ends the block; exit halts the core, and leaves the PC past
+ * the syscall as the pipeline does */
+static int xop_syscall(Pipe_State &pipe, Xlat_Op &op)
+{
+    if (pipe.REGS[2] == SYSCALL_EXIT)
+        pipe.halted = 1;
+    else if (pipe.REGS[2] == SYSCALL_CORE_ID)
+        pipe.REGS[2] = pipe.core_id;
+    pipe.PC = op.pc + 4;
+    return 1;
+}
+
+/* handlers of SPECIAL ops that write rd, by function code */
+static Xlat_Fn special_fn(uint32_t funct)
+{
+    switch (funct) {
+        case SUBOP_SLL:  return xop_sll;
+        case SUBOP_SRL:  return xop_srl;
+        case SUBOP_SRA:  return xop_sra;
+        case SUBOP_SLLV: return xop_sllv;
+        case SUBOP_SRLV: return xop_srlv;
+        case SUBOP_SRAV: return xop_srav;
+        case SUBOP_MFHI: return xop_mfhi;
+        case SUBOP_MFLO: return xop_mflo;
+        case SUBOP_ADD:
+        case SUBOP_ADDU: return xop_add;
+        case SUBOP_SUB:
+        case SUBOP_SUBU: return xop_sub;
+        case SUBOP_AND:  return xop_and;
+        case SUBOP_OR:   return xop_or;
+        case SUBOP_XOR:  return xop_xor;
+        case SUBOP_NOR:  return xop_nor;
+        case SUBOP_SLT:  return xop_slt;
+        case SUBOP_SLTU: return xop_sltu;
+        default:         return xop_li;  /* unknown: rd = 0 */
+    }
+}
+
+/* translate one instruction; returns 1 if it ends the superblock, and sets
+ * 'next' to the PC the trace continues at */
+static int translate_op(uint32_t pc, uint32_t inst, Xlat_Op &op, uint32_t &next)
+{
+    uint32_t opcode = inst >> 26;
+    uint32_t rs = (inst >> 21) & 0x1F, rt = (inst >> 16) & 0x1F, rd = (inst >> 11) & 0x1F;
+    uint32_t funct = inst & 0x3F, imm = inst & 0xFFFF;
+    uint32_t simm = (uint32_t)(int32_t)(int16_t)imm;
+    uint32_t branch_dest = pc + 4 + (simm << 2);
+
+    op.fn = xop_nop;
+    op.rd = rd;
+    op.rs = rs;
+    op.rt = rt;
+    op.sa = (inst >> 6) & 0x1F;
+    op.imm = simm;
+    op.pc = pc;
+    op.link = nullptr;
+    next = pc + 4;
+
+    switch (opcode) {
+        case OP_SPECIAL:
+            switch (funct) {
+                case SUBOP_JR:
+                case SUBOP_JALR:
+                    op.fn = xop_jr;
+                    if (funct == SUBOP_JR)
+                        op.rd = 0;
+                    return 1;
+                case SUBOP_SYSCALL: op.fn = xop_syscall; return 1;
+                case SUBOP_MULT:    op.fn = xop_mult; return 0;
+                case SUBOP_MULTU:   op.fn = xop_multu; return 0;
+                case SUBOP_DIV:     op.fn = xop_div; return 0;
+                case SUBOP_DIVU:    op.fn = xop_divu; return 0;
+                case SUBOP_MTHI:    op.fn = xop_mthi; return 0;
+                case SUBOP_MTLO:    op.fn = xop_mtlo; return 0;
+            }
+            if (rd != 0) {
+                op.fn = special_fn(funct);
+                op.imm = 0;
+            }
+            return 0;
+
+        case OP_BRSPEC:
+            op.imm = branch_dest;
+            if (rt == BROP_BLTZ)
+                op.fn = xop_bltz;
+            else if (rt == BROP_BGEZ)
+                op.fn = xop_bgez;
+            else if (rt == BROP_BLTZAL)
+                op.fn = xop_bltzal;
+            else if (rt == BROP_BGEZAL)
+                op.fn = xop_bgezal;
+            return 0;
+
+        case OP_JAL:
+            op.fn = xop_li;
+            op.rd = 31;
+            op.imm = pc + 4;
+            /* fallthrough */
+        case OP_J:
+            next = (pc & 0xF0000000) | ((inst & 0x03FFFFFF) << 2);
+            return 0;
+
+        case OP_BEQ:  op.fn = xop_beq; op.imm = branch_dest; return 0;
+        case OP_BNE:  op.fn = xop_bne; op.imm = branch_dest; return 0;
+        case OP_BLEZ: op.fn = xop_blez; op.imm = branch_dest; return 0;
+        case OP_BGTZ: op.fn = xop_bgtz; op.imm = branch_dest; return 0;
+
+        case OP_SW: op.fn = xop_sw; return 0;
+        case OP_SH: op.fn = xop_sh; return 0;
+        case OP_SB: op.fn = xop_sb; return 0;
+    }
+
+    /* everything else writes rt */
+    if (rt == 0)
+        return 0;
+
+    switch (opcode) {
+        case OP_ADDI:
+        case OP_ADDIU: op.fn = xop_addi; break;
+        case OP_SLTI:  op.fn = xop_slti; break;
+        case OP_SLTIU: op.fn = xop_sltiu; break;
+        case OP_ANDI:  op.fn = xop_andi; op.imm = imm; break;
+        case OP_ORI:   op.fn = xop_ori; op.imm = imm; break;
+        case OP_XORI:  op.fn = xop_xori; op.imm = imm; break;
+        case OP_LUI:   op.fn = xop_li; op.rd = rt; op.imm = imm << 16; break;
+        case OP_LW:    op.fn = xop_lw; break;
+        case OP_LH:    op.fn = xop_lh; break;
+        case OP_LHU:   op.fn = xop_lhu; break;
+        case OP_LB:    op.fn = xop_lb; break;
+        case OP_LBU:   op.fn = xop_lbu; break;
+    }
+    return 0;
+}
+
+/* translate the superblock starting at 'pc' */
+static Xlat_Block *translate(Pipe_State &pipe, uint32_t pc)
+{
+    Xlat_Cache &c = *pipe.xlat;
+    std::unique_ptr<Xlat_Block> b(new Xlat_Block());
+    uint32_t lo = c.code_span ? c.code_lo : pc;
+    uint32_t hi = c.code_span ? c.code_lo + c.code_span : pc;
+
+    b->start = pc;
+    b->end_link = nullptr;
+    b->ops.reserve(16);
+
+    int end = 0;
+    while (!end && b->ops.size() < XLAT_MAX_OPS) {
+        Xlat_Op op;
+        uint32_t next;
+        end = translate_op(pc, pipe.sim->mem.read_32(pc), op, next);
+        b->ops.push_back(op);
+
+        if (pc < lo)
+            lo = pc;
+        if (pc + 4 > hi)
+            hi = pc + 4;
+        pc = next;
+    }
+    b->end_pc = pc;
+
+    c.code_lo = lo;
+    c.code_span = hi - lo;
+    c.stats.blocks++;
+    c.stats.ops += b->ops.size();
+
+    Xlat_Block *block = b.get();
+    c.blocks[block->start] = std::move(b);
+    return block;
+}
+
+static Xlat_Block *find_block(Pipe_State &pipe, uint32_t pc)
+{
+    auto it = pipe.xlat->blocks.find(pc);
+    return it != pipe.xlat->blocks.end() ? it->second.get() : translate(pipe, pc);
+}
+
+void xlat_flush(Xlat_Cache &cache)
+{
+    cache.blocks.clear();
+    cache.code_lo = 0;
+    cache.code_span = 0;
+    cache.flush_pending = 0;
+    cache.stats.flushes++;
+}
+
+uint64_t xlat_run(Pipe_State &pipe, uint64_t max_insts, Xlat_Pages &pages)
+{
+    Xlat_Cache &c = *pipe.xlat;
+    uint64_t done = 0;
+    Xlat_Block *b = nullptr;
+
+    c.pages = &pages;
+
+    while (done < max_insts && !pipe.halted) {
+        if (!b)
+            b = find_block(pipe, pipe.PC);
+
+        /* run the block, or as much of it as is left to do */
+        Xlat_Op *ops = b->ops.data();
+        size_t n = b->ops.size();
+        size_t limit = max_insts - done < n ? max_insts - done : n;
+        size_t i;
+        for (i = 0; i < limit; i++) {
+            if (ops[i].fn(pipe, ops[i]))
+                break;
+        }
+
+        if (i < limit) {
+            done += i + 1;
+        }
+        else if (limit < n) {
+            /* out of instructions in mid-block */
+            pipe.PC = ops[limit].pc;
+            done += limit;
+            break;
+        }
+        else {
+            pipe.PC = b->end_pc;
+            done += n;
+        }
+
+        if (c.flush_pending) {
+            xlat_flush(c);
+            b = nullptr;
+            continue;
+        }
+        if (pipe.halted || done >= max_insts)
+            break;
+
+        /* follow the exit's link, if it still leads where we are going */
+        Xlat_Block *&link = i < limit ? ops[i].link : b->end_link;
+        if (!link || link->start != pipe.PC)
+            link = find_block(pipe, pipe.PC);
+        b = link;
+    }
+
+    return done;
+}
@@ -0,0 +1,115 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: superblock translation cache
+ */
+
+#ifndef _XLAT_H_
+#define _XLAT_H_
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+struct Pipe_State;
+struct Xlat_Op;
+struct Xlat_Block;
+
+/* Fast-forwarding (Simulator::fast_forward(), the shell's "fastforward n")
+ * executes instructions functionally, with no timing at all, directly on a
+ * core's architectural state (REGS, HI, LO, PC) and the simulated memory.
+ * Caches, TLBs and predictors are left as they were.
+ *
+ * Code is translated on first execution into superblocks: single-entry
+ * traces of up to XLAT_MAX_OPS instructions that run through the fall-
+ * through path of conditional branches (each one a side exit) and follow
+ * J/JAL to their targets, and that end at JR/JALR or a syscall. Each
+ * instruction becomes one micro-op: a pre-decoded handler with its register
+ * numbers and immediate already extracted, so running a block is a tight
+ * loop of indirect calls. The exit a block leaves through remembers the
+ * block it led to last time (block linking), so hot code goes from block
+ * to block without a lookup.
+ *
+ * A store into the range of addresses translated so far throws away the
+ * whole cache (after finishing the instruction), so self-modifying code
+ * runs correctly. So does any timing simulation between fast-forwards,
+ * whose stores are not watched. */
+#define XLAT_MAX_OPS 256
+
+/* one micro-op's handler: returns 1 if the block is left here, having set
+ * pipe.PC, or 0 to go on with the next micro-op */
+typedef int (*Xlat_Fn)(Pipe_State &pipe, Xlat_Op &op);
+
+struct Xlat_Op {
+    Xlat_Fn fn;
+    uint8_t rd, rs, rt, sa;
+    uint32_t imm;           /* immediate (already extended) or target */
+    uint32_t pc;
+    Xlat_Block *link;       /* the block this exit last led to */
+};
+
+struct Xlat_Block {
+    uint32_t start;
+    uint32_t end_pc;        /* where the block falls through to */
+    std::vector<Xlat_Op> ops;
+    Xlat_Block *end_link;
+};
+
+struct Xlat_Stats {
+    uint64_t blocks, ops, flushes;
+
+    Xlat_Stats() : blocks(0), ops(0), flushes(0) {}
+};
+
+/* Host pointers to the pages of simulated memory that fast-forwarded loads
+ * and stores touched (Sim_Memory::page()), direct-mapped by page number, so
+ * that most accesses skip the page table. Valid for one fast-forward only:
+ * copies of the memory and timing simulation may move pages in between.
+ * All cores share one, as a store to a copy-on-write page moves it. */
+#define XLAT_PAGE_ENTRIES 64
+
+struct Xlat_Pages {
+    struct Entry {
+        uint32_t page;              /* page number; UINT32_MAX if unused */
+        const uint8_t *read;
+        uint8_t *write;             /* null until written this time */
+    };
+    Entry entries[XLAT_PAGE_ENTRIES];
+
+    Xlat_Pages()
+    {
+        for (Entry &e : entries)
+            e = Entry{UINT32_MAX, nullptr, nullptr};
+    }
+};
+
+struct Xlat_Cache {
+    std::unordered_map<uint32_t, std::unique_ptr<Xlat_Block>> blocks;
+
+    /* addresses translated so far: [code_lo, code_lo + code_span) */
+    uint32_t code_lo, code_span;
+
+    /* a store hit translated code: flush once the block is left */
+    int flush_pending;
+
+    /* the core's cycle count when it last fast-forwarded */
+    uint32_t cycles;
+
+    /* the page pointers of the current xlat_run() */
+    Xlat_Pages *pages;
+
+    Xlat_Stats stats;
+
+    Xlat_Cache() : code_lo(0), code_span(0), flush_pending(0), cycles(0), pages(nullptr) {}
+};
+
+/* drop every translation */
+void xlat_flush(Xlat_Cache &cache);
+
+/* execute up to max_insts instructions of this core functionally (fewer
+ * if it halts), accessing memory through 'pages'; returns the number
+ * executed */
+uint64_t xlat_run(Pipe_State &pipe, uint64_t max_insts, Xlat_Pages &pages);
+
+#endif
@@ -0,0 +1,285 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: hot-path microbenchmarks
+ *
+ * Measures the simulator's hot paths in isolation (memory, decode, one
+ * pipeline cycle, cache lookup, fast-forwarding) and end to end
+ * (simulated MIPS on each program), and prints the results as JSON:
+ *
+ *     ./simbench inputs/long/primes.x inputs/random/random1.x > bench.json
+ *
+ * "make bench" does this for inputs/long and inputs/random. Every timing
+ * is the best of --reps runs (default 3). The output has one result per
+ * line, always in the same order with the same keys, so two runs diff
+ * cleanly:
+ *
+ *     {
+ *       "version": 1,
+ *       "micro": [
+ *         {"name": "mem_read_32", "ops": 16777216, "seconds": 0.081234, "ns_per_op": 4.842},
+ *         ...
+ *       ],
+ *       "programs": [
+ *         {"name": "inputs/long/primes.x", "cycles": 2995487, "instructions": 2096285,
+ *          "seconds": 0.612345, "mips": 3.423, "cycles_per_second": 4891808},
+ *         ...
+ *       ]
+ *     }
+ *
+ * (each entry is on a single line in the actual output)
+ */
+
+#include "sim.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* ops per microbenchmark run */
+#define BENCH_MEM_OPS    (1u << 24)
+#define BENCH_DECODE_OPS (1u << 24)
+#define BENCH_CACHE_OPS  (1u << 24)
+#define BENCH_CYCLES     (1u << 21)
+#define BENCH_FF_INSTS   (1u << 26)
+
+/* the region the memory and cache benchmarks walk */
+#define BENCH_MEM_REGION (4u << 20)
+
+struct Bench_Result {
+    std::string name;
+    uint64_t ops;
+    double seconds;
+};
+
+/* results fed here cannot be optimized away */
+static volatile uint64_t bench_sink;
+
+static unsigned reps = 3;
+
+/* best time of 'reps' runs of 'body', which returns the ops it did */
+static Bench_Result measure(const char *name, const std::function<uint64_t()> &body)
+{
+    Bench_Result r{name, 0, 0};
+
+    for (unsigned i = 0; i < reps; i++) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t ops = body();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (i == 0 || seconds < r.seconds) {
+            r.ops = ops;
+            r.seconds = seconds;
+        }
+    }
+    return r;
+}
+
+/* a cheap address stream: a linear congruential generator */
+static uint32_t lcg(uint32_t &x)
+{
+    x = x * 1664525 + 1013904223;
+    return x;
+}
+
+static void bench_micro(const Simulator &image, const std::vector<uint32_t> &text,
+                        std::vector<Bench_Result> &results)
+{
+    Sim_Memory mem;
+
+    results.push_back(measure("mem_write_32", [&]() {
+        for (uint32_t i = 0; i < BENCH_MEM_OPS; i++)
+            mem.write_32((i * 4) & (BENCH_MEM_REGION - 1), i);
+        return (uint64_t)BENCH_MEM_OPS;
+    }));
+
+    results.push_back(measure("mem_read_32", [&]() {
+        uint32_t x = 1, sum = 0;
+        for (uint32_t i = 0; i < BENCH_MEM_OPS; i++)
+            sum += mem.read_32(lcg(x) & (BENCH_MEM_REGION - 4));
+        bench_sink = sum;
+        return (uint64_t)BENCH_MEM_OPS;
+    }));
+
+    results.push_back(measure("decode", [&]() {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < BENCH_DECODE_OPS; i++) {
+            Pipe_Op op;
+            op.instruction = text[i % text.size()];
+            pipe_decode_op(&op);
+            sum += op.opcode + (op.exec != nullptr);
+        }
+        bench_sink = sum;
+        return (uint64_t)BENCH_DECODE_OPS;
+    }));
+
+    /* the default L1 data cache: a working set that fits, and one that
+     * does not */
+    Sim_Config config;
+    config_check(config);
+    Cache cache(config.l1d_size, config.l1d_assoc, config.block_size, config.mem_latency);
+
+    results.push_back(measure("cache_access_hit", [&]() {
+        uint32_t x = 1, sum = 0;
+        for (uint32_t i = 0; i < BENCH_CACHE_OPS; i++)
+            sum += cache.access(lcg(x) & (config.l1d_size / 2 - 4), i & 1);
+        bench_sink = sum;
+        return (uint64_t)BENCH_CACHE_OPS;
+    }));
+
+    results.push_back(measure("cache_access_random", [&]() {
+        uint32_t x = 1, sum = 0;
+        for (uint32_t i = 0; i < BENCH_CACHE_OPS; i++)
+            sum += cache.access(lcg(x) & (BENCH_MEM_REGION - 4), i & 1);
+        bench_sink = sum;
+        return (uint64_t)BENCH_CACHE_OPS;
+    }));
+
+    /* every cycle simulated in full, with no idle-cycle skipping; a program
+     * that halts early starts over (and the restart is timed too) */
+    results.push_back(measure("pipe_cycle", [&]() {
+        std::unique_ptr<Simulator> sim;
+        uint64_t cycles = 0;
+        while (cycles < BENCH_CYCLES) {
+            if (!sim || !sim->run_bit) {
+                sim.reset(new Simulator(config));
+                sim->share_program(image);
+            }
+            pipe_cycle(*sim);
+            cycles++;
+        }
+        return cycles;
+    }));
+
+    /* functional execution through the translation cache; a program that
+     * halts early starts over, translating its code again */
+    results.push_back(measure("fast_forward", [&]() {
+        uint64_t insts = 0;
+        while (insts < BENCH_FF_INSTS) {
+            Simulator sim(config);
+            sim.share_program(image);
+            int64_t n = sim.fast_forward(BENCH_FF_INSTS - insts);
+            if (n <= 0)
+                break;
+            insts += n;
+        }
+        return insts;
+    }));
+}
+
+static void bench_program(const char *file, std::vector<Bench_Result> &results,
+                          std::vector<uint64_t> &cycles, std::vector<uint64_t> &instructions)
+{
+    Sim_Config config;
+    config_check(config);
+    Simulator image(config);
+    if (image.load_program(file) < 0)
+        exit(1);
+
+    uint64_t c = 0, n = 0;
+    results.push_back(measure(file, [&]() {
+        Simulator sim(config);
+        sim.share_program(image);
+        sim.go();
+        c = sim.stat_cycles;
+        n = sim.stat_inst_retire;
+        return (uint64_t)sim.stat_inst_retire;
+    }));
+    cycles.push_back(c);
+    instructions.push_back(n);
+}
+
+/* 's' as the body of a JSON string: quotes, backslashes and control
+ * characters escaped, other bytes (UTF-8 file names) kept as they are */
+static std::string json_escape(const std::string &s)
+{
+    std::string out;
+    for (unsigned char c : s) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    char hex[8];
+                    snprintf(hex, sizeof(hex), "\\u%04x", c);
+                    out += hex;
+                }
+                else
+                    out += c;
+        }
+    }
+    return out;
+}
+
+static void usage(const char *prog)
+{
+    printf("Error: usage: %s [--reps=N] <program_file> ...\n", prog);
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        if (strncmp(argv[i], "--reps=", 7) != 0)
+            usage(argv[0]);
+        reps = strtoul(argv[i] + 7, nullptr, 0);
+        if (reps < 1)
+            usage(argv[0]);
+    }
+    if (i >= argc)
+        usage(argv[0]);
+
+    /* the first program seeds the decode and pipe_cycle benchmarks */
+    Sim_Config config;
+    config_check(config);
+    Simulator image(config);
+    int64_t words = image.load_program(argv[i]);
+    if (words <= 0)
+        exit(1);
+
+    std::vector<uint32_t> text;
+    for (int64_t w = 0; w < words; w++)
+        text.push_back(image.mem.read_32(image.pipes[0].PC + 4 * w));
+
+    std::vector<Bench_Result> micro;
+    bench_micro(image, text, micro);
+
+    std::vector<Bench_Result> programs;
+    std::vector<uint64_t> cycles, instructions;
+    for (; i < argc; i++)
+        bench_program(argv[i], programs, cycles, instructions);
+
+    printf("{\n");
+    printf("  \"version\": 1,\n");
+    printf("  \"micro\": [\n");
+    for (size_t m = 0; m < micro.size(); m++) {
+        const Bench_Result &r = micro[m];
+        printf("    {\"name\": \"%s\", \"ops\": %llu, \"seconds\": %0.6f, \"ns_per_op\": %0.3f}%s\n",
+               json_escape(r.name).c_str(), (unsigned long long)r.ops, r.seconds,
+               r.ops ? r.seconds * 1e9 / r.ops : 0.0, m + 1 < micro.size() ? "," : "");
+    }
+    printf("  ],\n");
+    printf("  \"programs\": [\n");
+    for (size_t p = 0; p < programs.size(); p++) {
+        const Bench_Result &r = programs[p];
+        printf("    {\"name\": \"%s\", \"cycles\": %llu, \"instructions\": %llu, "
+               "\"seconds\": %0.6f, \"mips\": %0.3f, \"cycles_per_second\": %0.0f}%s\n",
+               json_escape(r.name).c_str(), (unsigned long long)cycles[p], (unsigned long long)instructions[p],
+               r.seconds, r.seconds > 0 ? instructions[p] / r.seconds / 1e6 : 0.0,
+               r.seconds > 0 ? cycles[p] / r.seconds : 0.0, p + 1 < programs.size() ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: parallel interval simulation driver
+ *
+ * Simulates one long single-core program in detail on all host cores by
+ * splitting it into intervals at functional checkpoints (src/interval.h),
+ * and prints the whole run's statistics, one counter per line as the
+ * stats command names them:
+ *
+ *     ./intervals --interval=1000000 --warmup=100000 --mem_latency=50 prog.x
+ *
+ * Every simulator option (see ./sim with no arguments) may be given.
+ *
+ * Interval options:
+ *     --interval=N    instructions per interval (default 1000000)
+ *     --warmup=N      instructions simulated in detail before each
+ *                     interval, and not counted (default 100000)
+ *     --threads=N     worker threads (default: all hardware threads)
+ */
+
+#include "sim.h"
+#include "interval.h"
+#include "pool.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void usage(const char *prog)
+{
+    printf("Error: usage: %s [--interval=N] [--warmup=N] [--threads=N] [--option=value] ... "
+           "<program_file_1> <program_file_2> ...\n", prog);
+    config_usage();
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned threads = pool_default_threads();
+    uint64_t interval = 1000000, warmup = 100000;
+    Sim_Config config;
+    int i;
+
+    for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        const char *arg = argv[i] + 2;
+        const char *eq = strchr(arg, '=');
+        if (!eq || eq[1] == '\0')
+            usage(argv[0]);
+
+        if (strncmp(arg, "threads=", 8) == 0) {
+            threads = strtoul(eq + 1, nullptr, 0);
+            if (threads < 1)
+                usage(argv[0]);
+            continue;
+        }
+        if (strncmp(arg, "interval=", 9) == 0) {
+            interval = strtoull(eq + 1, nullptr, 0);
+            continue;
+        }
+        if (strncmp(arg, "warmup=", 7) == 0) {
+            warmup = strtoull(eq + 1, nullptr, 0);
+            continue;
+        }
+        if (!config_set(config, arg, eq - arg, eq + 1))
+            exit(1);
+    }
+    if (i >= argc || !config_check(config))
+        usage(argv[0]);
+
+    Sim_Config image_config;
+    config_check(image_config);
+    Simulator image(image_config);
+    for (; i < argc; i++) {
+        if (image.load_program(argv[i]) < 0)
+            exit(1);
+    }
+
+    Interval_Result result;
+    if (!interval_run(config, image, interval, warmup, threads, result))
+        exit(1);
+
+    fprintf(stderr, "intervals: %zu intervals of %llu instructions on %u threads: "
+            "%0.3f s functional, %0.3f s detailed\n", result.intervals,
+            (unsigned long long)interval, threads, result.functional_seconds, result.detailed_seconds);
+
+    printf("Intervals: %zu\n", result.intervals);
+    printf("FunctionalInstr: %llu\n", (unsigned long long)result.insts);
+    for (size_t c = 0; c < result.names.size(); c++)
+        printf("%s: %llu\n", result.names[c].c_str(), (unsigned long long)result.totals[c]);
+
+    return 0;
+}
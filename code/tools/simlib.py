@@ -0,0 +1,147 @@
+#!/usr/bin/python3
+
+"""Drive simulations in-process through libsim.so (see src/simapi.h).
+
+    from simlib import Simulator
+
+    base = Simulator()
+    base.load("inputs/long/primes.x")
+    for lat in (0, 20, 100):
+        with Simulator(mem_latency=lat, core="ooo") as s:
+            s.share(base)           # no reload: copy-on-write memory
+            s.go()
+            print(lat, s.stat("Cycles"), s.reg(2))
+
+Options are the simulator's command-line options as keyword arguments.
+The library is looked up next to this file's directory (code/libsim.so,
+built by "make libsim.so"), or wherever SIMLIB_PATH points.
+"""
+
+import ctypes, os
+
+API_VERSION = 1
+
+REG_PC = 32
+REG_HI = 33
+REG_LO = 34
+
+_lib = None
+
+
+def _load():
+    global _lib
+    if _lib is not None:
+        return _lib
+
+    here = os.path.dirname(os.path.abspath(__file__))
+    path = os.environ.get("SIMLIB_PATH", os.path.join(here, "..", "libsim.so"))
+    lib = ctypes.CDLL(path)
+
+    c_sim = ctypes.c_void_p
+    sigs = {
+        "sim_api_version":   (ctypes.c_int, []),
+        "sim_create":        (c_sim, [ctypes.POINTER(ctypes.c_char_p), ctypes.c_int]),
+        "sim_destroy":       (None, [c_sim]),
+        "sim_load_program":  (ctypes.c_int64, [c_sim, ctypes.c_char_p]),
+        "sim_share_program": (ctypes.c_int, [c_sim, c_sim]),
+        "sim_run":           (ctypes.c_int64, [c_sim, ctypes.c_uint32]),
+        "sim_go":            (ctypes.c_int, [c_sim]),
+        "sim_fast_forward":  (ctypes.c_int64, [c_sim, ctypes.c_uint64]),
+        "sim_running":       (ctypes.c_int, [c_sim]),
+        "sim_num_cores":     (ctypes.c_uint32, [c_sim]),
+        "sim_read_reg":      (ctypes.c_uint32, [c_sim, ctypes.c_uint32, ctypes.c_uint32]),
+        "sim_read_mem32":    (ctypes.c_uint32, [c_sim, ctypes.c_uint32]),
+        "sim_num_stats":     (ctypes.c_size_t, [c_sim]),
+        "sim_stat_name":     (ctypes.c_char_p, [c_sim, ctypes.c_size_t]),
+        "sim_stat_value":    (ctypes.c_uint64, [c_sim, ctypes.c_size_t]),
+        "sim_stat":          (ctypes.c_int, [c_sim, ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint64)]),
+    }
+    for name, (restype, argtypes) in sigs.items():
+        f = getattr(lib, name)
+        f.restype = restype
+        f.argtypes = argtypes
+
+    if lib.sim_api_version() < API_VERSION:
+        raise OSError("%s: C ABI version %d, need %d" % (path, lib.sim_api_version(), API_VERSION))
+    _lib = lib
+    return lib
+
+
+class SimError(Exception):
+    pass
+
+
+class Simulator:
+    def __init__(self, **options):
+        lib = _load()
+        opts = [("%s=%s" % kv).encode() for kv in options.items()]
+        argv = (ctypes.c_char_p * max(len(opts), 1))(*opts)
+        self._h = lib.sim_create(argv, len(opts))
+        if not self._h:
+            raise SimError("bad configuration: %s" % options)
+        self._lib = lib
+
+    def close(self):
+        if self._h:
+            self._lib.sim_destroy(self._h)
+            self._h = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __del__(self):
+        self.close()
+
+    def load(self, filename):
+        n = self._lib.sim_load_program(self._h, filename.encode())
+        if n < 0:
+            raise SimError("cannot load %s" % filename)
+        return n
+
+    def _check(self, n):
+        if n < 0:
+            raise SimError("simulator failed (out of memory)")
+        return n
+
+    def share(self, other):
+        self._check(self._lib.sim_share_program(self._h, other._h))
+
+    def run(self, cycles):
+        return self._check(self._lib.sim_run(self._h, cycles))
+
+    def go(self):
+        self._check(self._lib.sim_go(self._h))
+
+    def fast_forward(self, insts):
+        return self._check(self._lib.sim_fast_forward(self._h, insts))
+
+    @property
+    def running(self):
+        return bool(self._lib.sim_running(self._h))
+
+    @property
+    def cores(self):
+        return self._lib.sim_num_cores(self._h)
+
+    def reg(self, n, core=0):
+        return self._lib.sim_read_reg(self._h, core, n)
+
+    def pc(self, core=0):
+        return self.reg(REG_PC, core)
+
+    def mem32(self, addr):
+        return self._lib.sim_read_mem32(self._h, addr)
+
+    def stat(self, name):
+        value = ctypes.c_uint64()
+        if self._lib.sim_stat(self._h, name.encode(), ctypes.byref(value)) < 0:
+            raise KeyError(name)
+        return value.value
+
+    def stats(self):
+        lib, h = self._lib, self._h
+        return {lib.sim_stat_name(h, i).decode(): lib.sim_stat_value(h, i)
+                for i in range(lib.sim_num_stats(h))}
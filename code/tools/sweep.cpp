@@ -0,0 +1,207 @@
+/*
+ * Computer Architecture - Professor Onur Mutlu
+ *
+ * MIPS pipeline timing simulator: configuration sweep driver
+ *
+ * Runs one program under every combination of a set of configuration
+ * values, in parallel, and prints one CSV row of statistics per
+ * configuration:
+ *
+ *     ./sweep --width=1,2,4 --core=inorder,ooo --mem_latency=0,20,100 prog.x
+ *
+ * Every simulator option (see ./sim with no arguments) takes a
+ * comma-separated list of values. The program is loaded once, and every
+ * simulation starts from a copy-on-write share of that image, so a sweep
+ * costs neither a process nor a program load per configuration. The
+ * configurations run on a work-stealing thread pool (pool.h).
+ *
+ * Sweep options:
+ *     --threads=N     worker threads (default: all hardware threads)
+ *     --max_cycles=N  stop each simulation after N cycles (default: run
+ *                     until every core halts)
+ *
+ * With --sample, configuration j writes its samples to the sample file
+ * name with "-j" inserted before the extension.
+ */
+
+#include "sim.h"
+#include "pool.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/* one swept option and the values it takes */
+struct Sweep_Axis {
+    std::string name;
+    std::vector<std::string> values;
+};
+
+/* one configuration of the matrix, and its results */
+struct Sweep_Job {
+    Sim_Config config;
+    std::vector<size_t> point; /* index into each axis' values */
+
+    uint32_t cycles, fetched, retired, flushes;
+    uint64_t l1i_misses, l1d_misses, coherence_misses;
+    uint32_t pages;
+    int halted;
+
+    Sweep_Job() : cycles(0), fetched(0), retired(0), flushes(0),
+                  l1i_misses(0), l1d_misses(0), coherence_misses(0),
+                  pages(0), halted(0) {}
+};
+
+static void usage(const char *prog)
+{
+    printf("Error: usage: %s [--threads=N] [--max_cycles=N] [--option=v1,v2,...] ... "
+           "<program_file_1> <program_file_2> ...\n", prog);
+    config_usage();
+    exit(1);
+}
+
+static std::vector<std::string> split(const char *list)
+{
+    std::vector<std::string> items;
+    const char *p = list;
+
+    for (;;) {
+        const char *comma = strchr(p, ',');
+        if (!comma) {
+            items.emplace_back(p);
+            return items;
+        }
+        items.emplace_back(p, comma - p);
+        p = comma + 1;
+    }
+}
+
+static void run_job(const Simulator &image, uint32_t max_cycles, Sweep_Job &job)
+{
+    Simulator sim(job.config);
+    sim.share_program(image);
+
+    if (max_cycles)
+        sim.run(max_cycles);
+    else
+        sim.go();
+
+    job.cycles = sim.stat_cycles;
+    job.fetched = sim.stat_inst_fetch;
+    job.retired = sim.stat_inst_retire;
+    job.flushes = sim.stat_squash;
+    job.l1i_misses = job.l1d_misses = job.coherence_misses = 0;
+    for (const auto &p : sim.pipes) {
+        job.l1i_misses += p.icache.stats.misses;
+        job.l1d_misses += p.dcache.stats.misses;
+        job.coherence_misses += p.dcache.stats.coherence_misses;
+    }
+    job.pages = sim.mem.pages_touched;
+    job.halted = !sim.run_bit;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned threads = pool_default_threads();
+    uint32_t max_cycles = 0;
+    std::vector<Sweep_Axis> axes;
+    int i;
+
+    for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        const char *arg = argv[i] + 2;
+        const char *eq = strchr(arg, '=');
+        if (!eq || eq[1] == '\0')
+            usage(argv[0]);
+
+        if (strncmp(arg, "threads=", 8) == 0) {
+            threads = strtoul(eq + 1, nullptr, 0);
+            if (threads < 1)
+                usage(argv[0]);
+            continue;
+        }
+        if (strncmp(arg, "max_cycles=", 11) == 0) {
+            max_cycles = strtoul(eq + 1, nullptr, 0);
+            continue;
+        }
+
+        /* check every value now rather than in the middle of the sweep */
+        Sweep_Axis axis;
+        axis.name.assign(arg, eq - arg);
+        axis.values = split(eq + 1);
+        for (const auto &v : axis.values) {
+            Sim_Config scratch;
+            if (!config_set(scratch, arg, eq - arg, v.c_str()))
+                exit(1);
+        }
+        axes.push_back(axis);
+    }
+    if (i >= argc)
+        usage(argv[0]);
+
+    /* the cross product of all axes, first axis varying slowest */
+    std::vector<Sweep_Job> jobs(1);
+    for (size_t a = 0; a < axes.size(); a++) {
+        std::vector<Sweep_Job> next;
+        for (const auto &job : jobs) {
+            for (size_t v = 0; v < axes[a].values.size(); v++) {
+                Sweep_Job j = job;
+                config_set(j.config, axes[a].name.c_str(), axes[a].name.size(), axes[a].values[v].c_str());
+                j.point.push_back(v);
+                next.push_back(j);
+            }
+        }
+        jobs.swap(next);
+    }
+    for (auto &job : jobs) {
+        if (!config_check(job.config)) {
+            printf("Error: in configuration");
+            for (size_t a = 0; a < axes.size(); a++)
+                printf(" --%s=%s", axes[a].name.c_str(), axes[a].values[job.point[a]].c_str());
+            printf("\n");
+            exit(1);
+        }
+    }
+
+    /* sampled runs each write their own file: samples.csv -> samples-3.csv */
+    for (size_t j = 0; j < jobs.size(); j++) {
+        std::string &file = jobs[j].config.sample_file;
+        if (!jobs[j].config.sample_interval)
+            continue;
+        size_t dot = file.rfind('.');
+        if (dot == std::string::npos || file.find('/', dot) != std::string::npos)
+            dot = file.size();
+        file.insert(dot, "-" + std::to_string(j));
+    }
+
+    /* load the program once; every job shares this image */
+    Sim_Config image_config;
+    config_check(image_config);
+    Simulator image(image_config);
+    for (; i < argc; i++) {
+        if (image.load_program(argv[i]) < 0)
+            exit(1);
+    }
+
+    fprintf(stderr, "sweep: %zu configurations on %u threads\n", jobs.size(), threads);
+    pool_run(threads, jobs.size(), [&](size_t j) {
+        run_job(image, max_cycles, jobs[j]);
+    });
+
+    /* the stats table */
+    for (const auto &axis : axes)
+        printf("%s,", axis.name.c_str());
+    printf("Cycles,FetchedInstr,RetiredInstr,IPC,Flushes,L1IMisses,L1DMisses,"
+           "CoherenceMisses,PagesTouched,Halted\n");
+    for (const auto &job : jobs) {
+        for (size_t a = 0; a < axes.size(); a++)
+            printf("%s,", axes[a].values[job.point[a]].c_str());
+        printf("%u,%u,%u,%0.3f,%u,%llu,%llu,%llu,%u,%d\n",
+               job.cycles, job.fetched, job.retired,
+               job.cycles ? ((float) job.retired) / job.cycles : 0.0f, job.flushes,
+               (unsigned long long) job.l1i_misses, (unsigned long long) job.l1d_misses,
+               (unsigned long long) job.coherence_misses, job.pages, job.halted);
+    }
+
+    return 0;
+}